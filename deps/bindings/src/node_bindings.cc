@@ -20,6 +20,8 @@
 #include <glib.h>
 #include <uv.h>
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
 #include "node_bindings.h"
 
 namespace glib {
@@ -29,6 +31,7 @@ using namespace nodejerry;
 struct SourceData {
   GSource source;
   gpointer tag;
+  uv_loop_t* loop;
   NodeBindings* node_bindings;
 };
 
@@ -38,37 +41,40 @@ static GMainContext* gcontext;
 static GMainLoop* gmainLoop;
 static GSource* uvsource;
 static GSourceFuncs source_funcs;
-static bool gmainLoopDone = false;
 
+// The uv backend fd (epoll on Linux) becomes readable whenever one of the
+// uv watchers has a pending event, so GLib polls it together with its own
+// sources. Libuv itself is only entered from the dispatch callback and it
+// never blocks there, which means one poll per loop turn.
 static gboolean GmainLoopPrepareCallback(GSource* source, gint* timeout) {
-  uv_update_time(uv_default_loop());
-  *timeout = uv_backend_timeout(uv_default_loop());
+  uv_loop_t* loop = ((SourceData*)source)->loop;
 
-  if (!uv_watcher_queue_empty(uv_default_loop())) {
+  // Changes of the watcher queue are only flushed to the backend fd by
+  // uv__io_poll, so they must be processed before GLib goes to sleep.
+  if (!uv_watcher_queue_empty(loop)) {
+    *timeout = 0;
     return TRUE;
   }
 
+  uv_update_time(loop);
+  *timeout = uv_backend_timeout(loop);
   return 0 == *timeout;
 }
 
 static gboolean GmainLoopCheckCallback(GSource* source) {
-  if (!uv_backend_timeout(uv_default_loop())) {
+  SourceData* data = (SourceData*)source;
+
+  if (g_source_query_unix_fd(source, data->tag) & G_IO_IN) {
     return TRUE;
   }
 
-  return (G_IO_IN ==
-          g_source_query_unix_fd(source, ((SourceData*)source)->tag));
+  // Expired timers do not signal the backend fd.
+  uv_update_time(data->loop);
+  return 0 == uv_backend_timeout(data->loop);
 }
 
 static gboolean GmainLoopDispatchCallback(GSource* source, GSourceFunc callback,
                                           gpointer user_data) {
-  assert(gcontext);
-  g_main_context_iteration(gcontext, FALSE);
-
-  if (gmainLoopDone) {
-    return G_SOURCE_REMOVE;
-  }
-
   NodeBindings* node_bindings = ((SourceData*)source)->node_bindings;
 
   node_bindings->RunOnce();
@@ -80,7 +86,7 @@ static gboolean GmainLoopDispatchCallback(GSource* source, GSourceFunc callback,
   return G_SOURCE_CONTINUE;
 }
 
-static void GmainLoopInit(NodeBindings* self) {
+static void GmainLoopInit(NodeBindings* self, uv_loop_t* loop) {
   gcontext = g_main_context_default();
   gmainLoop = g_main_loop_new(gcontext, FALSE);
   source_funcs = {
@@ -91,12 +97,14 @@ static void GmainLoopInit(NodeBindings* self) {
 
   uvsource = g_source_new(&source_funcs, sizeof(SourceData));
   ((SourceData*)uvsource)->tag = g_source_add_unix_fd(
-      uvsource, uv_backend_fd(uv_default_loop()),
-      (GIOCondition)(G_IO_IN | G_IO_OUT | G_IO_ERR | G_IO_PRI));
+      uvsource, uv_backend_fd(loop),
+      (GIOCondition)(G_IO_IN | G_IO_ERR | G_IO_PRI));
+  ((SourceData*)uvsource)->loop = loop;
   ((SourceData*)uvsource)->node_bindings = self;
 
+  // The reference is kept until GmainLoopExit, since the source may be
+  // removed from the context by the dispatch callback before that.
   g_source_attach(uvsource, gcontext);
-  g_source_unref(uvsource);
 }
 
 void GmainLoopStart() {
@@ -104,20 +112,19 @@ void GmainLoopStart() {
   assert(gcontext);
 
   g_main_loop_run(gmainLoop);
-  gmainLoopDone = true;
-  g_main_context_iteration(gcontext, TRUE);
 }
 
 void GmainLoopExit() {
   if (uvsource) {
     g_source_destroy(uvsource);
+    g_source_unref(uvsource);
+    uvsource = nullptr;
   }
   if (gmainLoop) {
     g_main_loop_unref(gmainLoop);
+    gmainLoop = nullptr;
   }
-  if(gcontext) {
-    g_main_context_unref(gcontext);
-  }
+  gcontext = nullptr;
 }
 
 }  // namespace glib
@@ -126,20 +133,73 @@ namespace nodejerry {
 
 NodeBindings::NodeBindings() {}
 
+NodeBindings::LoopBackend NodeBindings::DefaultLoopBackend() {
+  const char* backend = getenv("NODE_JERRY_LOOP_BACKEND");
+
+  if (backend != nullptr) {
+    if (strcmp(backend, "glib") == 0) {
+      return LoopBackend::kGlib;
+    }
+    if (strcmp(backend, "libuv") == 0) {
+      return LoopBackend::kLibuv;
+    }
+  }
+
+#if defined(HOST_TIZEN)
+  return LoopBackend::kGlib;
+#else
+  return LoopBackend::kLibuv;
+#endif
+}
+
 void NodeBindings::Initialize(Environment&& env, Platform&& platform,
-                              Node&& node) {
+                              Node&& node, LoopBackend backend) {
   assert(platform.DrainVMTasks);
 
   m_env = std::move(env);
   m_platform = std::move(platform);
   m_node = std::move(node);
+  m_backend = backend;
   m_isInitialize = true;
 }
 
 void NodeBindings::StartEventLoop() {
   assert(m_isInitialize);
 
-  glib::GmainLoopInit(this);
+  if (m_backend == LoopBackend::kGlib) {
+    RunGlibLoop();
+  } else {
+    RunLibuvLoop();
+  }
+}
+
+void NodeBindings::RunLibuvLoop() {
+  auto isolate = m_env.isolate();
+  auto event_loop = m_env.event_loop();
+  bool more;
+
+  do {
+    uv_run(event_loop, UV_RUN_DEFAULT);
+
+    m_platform.DrainVMTasks(isolate);
+
+    more = uv_loop_alive(event_loop);
+    if (more) {
+      continue;
+    }
+
+    m_node.EmitBeforeExit();
+
+    // Emit `beforeExit` if the loop became alive either after emitting
+    // event, or after running some callbacks.
+    more = uv_loop_alive(event_loop);
+  } while (more);
+
+  m_hasMoreNodeTasks = false;
+}
+
+void NodeBindings::RunGlibLoop() {
+  glib::GmainLoopInit(this, m_env.event_loop());
 
   RunOnce();
 
@@ -156,9 +216,9 @@ void NodeBindings::RunOnce() {
   auto isolate = m_env.isolate();
   auto event_loop = m_env.event_loop();
   bool more;
-  
+
   uv_run(event_loop, UV_RUN_NOWAIT);
-  
+
   m_platform.DrainVMTasks(isolate);
 
   more = uv_loop_alive(event_loop);
@@ -52,12 +52,26 @@ class NodeBindings {
     std::function<void()> EmitBeforeExit;
   };
 
-  void Initialize(Environment&& env, Platform&& platform, Node&& node);
+  // kLibuv drives the loop with plain uv_run(UV_RUN_DEFAULT) and has no
+  // extra wakeups. kGlib embeds the uv backend fd into the default
+  // GMainContext so that GLib based platform sources (Tizen) keep working.
+  enum class LoopBackend { kLibuv, kGlib };
+
+  // Returns the backend selected by the NODE_JERRY_LOOP_BACKEND environment
+  // variable ("libuv" or "glib"), or the platform default otherwise.
+  static LoopBackend DefaultLoopBackend();
+
+  void Initialize(Environment&& env, Platform&& platform, Node&& node,
+                  LoopBackend backend = DefaultLoopBackend());
   void StartEventLoop();
   void RunOnce();
   bool HasMoreTasks();
 
  private:
+  void RunLibuvLoop();
+  void RunGlibLoop();
+
+  LoopBackend m_backend = {LoopBackend::kLibuv};
   Environment m_env;
   Platform m_platform;
   Node m_node;
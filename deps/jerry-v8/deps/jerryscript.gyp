@@ -51,7 +51,13 @@
         'JERRY_ERROR_MESSAGES=1',
         'JERRY_LINE_INFO=1', 
         'JERRY_CPOINTER_32_BIT=1',
-        'JERRY_VM_EXEC_STOP=1',
+        'JERRY_VM_INTERRUPT=1',
+        'JERRY_SNAPSHOT_SAVE=1',
+        'JERRY_SNAPSHOT_EXEC=1',
+        'JERRY_LAZY_FUNCTIONS=1',
+        'JERRY_INLINE_CACHE=1',
+        'JERRY_HIDDEN_CLASSES=1',
+        'JERRY_VM_THREADED_DISPATCH=1',
       ],
 
       'sources': [
@@ -72,12 +78,21 @@
           'defines': [
             'JERRY_SYSTEM_ALLOCATOR=0',
             'JERRY_GLOBAL_HEAP_SIZE=(200*1024)',
-          ]
+            'JERRY_VALUE_64_BIT=1',
+          ],
+          'direct_dependent_settings': {
+            # The size of jerry_value_t depends on this option.
+            'defines': [ 'JERRY_VALUE_64_BIT=1' ],
+          },
         }, {
           'defines': [
             'JERRY_SYSTEM_ALLOCATOR=1'
           ]
         }],
+        ['target_arch=="x64" and OS!="win"', {
+          # The JIT compiler emits x86-64 System V code.
+          'defines': [ 'JERRY_JIT=1' ],
+        }],
         ['OS=="linux"', {
           'defines': ['PATH_MAX=4096'],
         }],
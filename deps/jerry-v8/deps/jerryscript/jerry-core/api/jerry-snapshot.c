@@ -48,6 +48,12 @@ snapshot_get_global_flags (bool has_regex, /**< regex literal is present */
 #if ENABLED (JERRY_ESNEXT)
   flags |= (has_class ? JERRY_SNAPSHOT_HAS_CLASS_LITERAL : 0);
 #endif /* ENABLED (JERRY_ESNEXT) */
+#if ENABLED (JERRY_VALUE_64_BIT)
+  flags |= JERRY_SNAPSHOT_EIGHT_BYTE_VALUE;
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+#if ENABLED (JERRY_JIT)
+  flags |= JERRY_SNAPSHOT_JIT_COUNTER;
+#endif /* ENABLED (JERRY_JIT) */
 
   return flags;
 } /* snapshot_get_global_flags */
@@ -253,6 +259,10 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< compiled
     cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) buffer_p;
     literal_end = (uint32_t) (args_p->literal_end - args_p->register_end);
     const_literal_end = (uint32_t) (args_p->const_literal_end - args_p->register_end);
+#if ENABLED (JERRY_JIT)
+    /* The compiled machine code is not part of the snapshot. */
+    args_p->jit_counter = 0;
+#endif /* ENABLED (JERRY_JIT) */
   }
   else
   {
@@ -261,6 +271,9 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< compiled
     cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) buffer_p;
     literal_end = (uint32_t) (args_p->literal_end - args_p->register_end);
     const_literal_end = (uint32_t) (args_p->const_literal_end - args_p->register_end);
+#if ENABLED (JERRY_JIT)
+    args_p->jit_counter = 0;
+#endif /* ENABLED (JERRY_JIT) */
   }
 
   for (uint32_t i = const_literal_end; i < literal_end; i++)
@@ -766,6 +779,9 @@ jerry_generate_snapshot_with_args (const jerry_char_t *resource_name_p, /**< scr
   uint32_t status_flags = ((generate_snapshot_opts & JERRY_SNAPSHOT_SAVE_STRICT) ? ECMA_PARSE_STRICT_MODE
                                                                                  : ECMA_PARSE_NO_OPTS);
 
+  /* Snapshots store complete byte code, so every function must be compiled. */
+  status_flags |= ECMA_PARSE_NO_LAZY_FUNCTIONS;
+
   ecma_compiled_code_t *bytecode_data_p = parser_parse_script (args_p,
                                                                args_size,
                                                                source_p,
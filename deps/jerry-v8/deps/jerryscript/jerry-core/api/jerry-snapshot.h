@@ -47,7 +47,9 @@ typedef enum
   JERRY_SNAPSHOT_HAS_REGEX_LITERAL = (1u << 0), /**< byte code has regex literal */
   JERRY_SNAPSHOT_HAS_CLASS_LITERAL = (1u << 1), /**< byte code has class literal */
   /* 24 bits are reserved for compile time features */
-  JERRY_SNAPSHOT_FOUR_BYTE_CPOINTER = (1u << 8) /**< deprecated, an unused placeholder now */
+  JERRY_SNAPSHOT_FOUR_BYTE_CPOINTER = (1u << 8), /**< deprecated, an unused placeholder now */
+  JERRY_SNAPSHOT_EIGHT_BYTE_VALUE = (1u << 9), /**< byte code literals are 64 bit ecma values */
+  JERRY_SNAPSHOT_JIT_COUNTER = (1u << 10), /**< byte code headers have a JIT counter */
 } jerry_snapshot_global_flags_t;
 
 #endif /* !JERRY_SNAPSHOT_H */
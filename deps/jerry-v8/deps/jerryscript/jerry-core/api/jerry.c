@@ -363,6 +363,40 @@ jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p) /**< [out] heap memory
 #endif /* ENABLED (JERRY_MEM_STATS) */
 } /* jerry_get_memory_stats */
 
+/**
+ * Get inline cache stats.
+ *
+ * @return true - get the inline cache stats successful
+ *         false - otherwise. Usually it is because the INLINE_CACHE feature is not enabled.
+ */
+bool
+jerry_get_inline_cache_stats (jerry_inline_cache_stats_t *out_stats_p) /**< [out] inline cache stats */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_INLINE_CACHE)
+  if (out_stats_p == NULL)
+  {
+    return false;
+  }
+
+  *out_stats_p = (jerry_inline_cache_stats_t)
+  {
+    .version = 1,
+    .load_hits = JERRY_CONTEXT (inline_cache_stats).load_hits,
+    .load_misses = JERRY_CONTEXT (inline_cache_stats).load_misses,
+    .store_hits = JERRY_CONTEXT (inline_cache_stats).store_hits,
+    .store_misses = JERRY_CONTEXT (inline_cache_stats).store_misses,
+    .caches = JERRY_CONTEXT (inline_cache_count)
+  };
+
+  return true;
+#else /* !ENABLED (JERRY_INLINE_CACHE) */
+  JERRY_UNUSED (out_stats_p);
+  return false;
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+} /* jerry_get_inline_cache_stats */
+
 /**
  * Simple Jerry runner
  *
@@ -571,7 +605,9 @@ jerry_run (const jerry_value_t func_val) /**< function to run */
   ecma_object_t *scope_p = ECMA_GET_NON_NULL_POINTER_FROM_POINTER_TAG (ecma_object_t,
                                                                        ext_func_p->u.function.scope_cp);
 
-  if (scope_p != ecma_get_global_environment ())
+  /* Script snapshots loaded by jerry_load_function_snapshot are bound to the global scope. */
+  if (scope_p != ecma_get_global_environment ()
+      && scope_p != ecma_get_global_scope ())
   {
     return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG (wrong_args_msg_p)));
   }
@@ -956,6 +992,15 @@ jerry_is_feature_enabled (const jerry_feature_t feature) /**< feature to check *
 #if ENABLED (JERRY_VM_EXEC_STOP)
           || feature == JERRY_FEATURE_VM_EXEC_STOP
 #endif /* ENABLED (JERRY_VM_EXEC_STOP) */
+#if ENABLED (JERRY_VM_INTERRUPT)
+          || feature == JERRY_FEATURE_VM_INTERRUPT
+#endif /* ENABLED (JERRY_VM_INTERRUPT) */
+#if ENABLED (JERRY_INLINE_CACHE)
+          || feature == JERRY_FEATURE_INLINE_CACHE
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+          || feature == JERRY_FEATURE_HIDDEN_CLASSES
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
 #if ENABLED (JERRY_BUILTIN_JSON)
           || feature == JERRY_FEATURE_JSON
 #endif /* ENABLED (JERRY_BUILTIN_JSON) */
@@ -1979,6 +2024,44 @@ jerry_string_to_char_buffer (const jerry_value_t value, /**< input string value
                                            buffer_size);
 } /* jerry_string_to_char_buffer */
 
+/**
+ * Get the cesu-8 encoded characters of a string without copying them.
+ *
+ * Note:
+ *      The returned buffer is owned by the string, and it is valid
+ *      until the string is released.
+ *
+ * @return pointer to the characters - if the characters of the string are stored in a buffer
+ *         NULL - otherwise (e.g. the value is not a string, or the string represents an integer number)
+ */
+const jerry_char_t *
+jerry_get_string_buffer (const jerry_value_t value, /**< input string value */
+                         jerry_size_t *buffer_size_p) /**< [out] size of the characters */
+{
+  jerry_assert_api_available ();
+
+  if (!ecma_is_value_string (value))
+  {
+    return NULL;
+  }
+
+  ecma_string_t *str_p = ecma_get_string_from_value (value);
+  lit_utf8_byte_t uint32_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
+  lit_utf8_size_t size;
+  uint8_t flags = ECMA_STRING_FLAG_EMPTY;
+
+  const lit_utf8_byte_t *chars_p = ecma_string_get_chars (str_p, &size, NULL, uint32_buffer, &flags);
+
+  /* Integer numbers are converted to characters on demand. */
+  if (flags & ECMA_STRING_FLAG_IS_UINT32)
+  {
+    return NULL;
+  }
+
+  *buffer_size_p = size;
+  return (const jerry_char_t *) chars_p;
+} /* jerry_get_string_buffer */
+
 /**
  * Copy the characters of an utf-8 encoded string into a specified buffer.
  *
@@ -3540,6 +3623,39 @@ jerry_set_vm_exec_stop_callback (jerry_vm_exec_stop_callback_t stop_cb, /**< per
 #endif /* ENABLED (JERRY_VM_EXEC_STOP) */
 } /* jerry_set_vm_exec_stop_callback */
 
+/**
+ * If JERRY_VM_INTERRUPT is enabled the callback passed to this function is
+ * called with the user_p argument at the next backward branch or function
+ * entry after jerry_request_vm_interrupt is called.
+ */
+void
+jerry_set_vm_interrupt_callback (jerry_vm_interrupt_callback_t interrupt_cb, /**< user function */
+                                 void *user_p) /**< pointer passed to the function */
+{
+#if ENABLED (JERRY_VM_INTERRUPT)
+  JERRY_CONTEXT (vm_interrupt_user_p) = user_p;
+  JERRY_CONTEXT (vm_interrupt_cb) = interrupt_cb;
+#else /* !ENABLED (JERRY_VM_INTERRUPT) */
+  JERRY_UNUSED (interrupt_cb);
+  JERRY_UNUSED (user_p);
+#endif /* ENABLED (JERRY_VM_INTERRUPT) */
+} /* jerry_set_vm_interrupt_callback */
+
+/**
+ * Request the vm to call the interrupt callback at the next safe point.
+ *
+ * Note:
+ *      unlike other API functions, this function can be called from
+ *      any thread and from signal handlers, since it only sets a flag.
+ */
+void
+jerry_request_vm_interrupt (void)
+{
+#if ENABLED (JERRY_VM_INTERRUPT)
+  JERRY_CONTEXT (vm_interrupt_pending) = 1;
+#endif /* ENABLED (JERRY_VM_INTERRUPT) */
+} /* jerry_request_vm_interrupt */
+
 /**
  * Get backtrace. The backtrace is an array of strings where
  * each string contains the position of the corresponding frame.
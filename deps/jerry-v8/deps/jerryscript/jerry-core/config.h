@@ -137,6 +137,25 @@
 # define JERRY_CPOINTER_32_BIT 0
 #endif /* !defined (JERRY_CPOINTER_32_BIT) */
 
+/**
+ * Specifies the size of ecma values
+ *
+ * With 64 bit values most floating point numbers (which are not integers
+ * or their magnitude is out of the range of the directly stored integers)
+ * are stored in the value itself instead of a heap allocated number.
+ * This option requires 64 bit floating point numbers and 32 bit compressed pointers.
+ *
+ * Allowed values:
+ *  0: use 32 bit ecma values
+ *  1: use 64 bit ecma values
+ *
+ * Default value: 0
+ * For more details see: ecma/base/ecma-globals.h
+ */
+#ifndef JERRY_VALUE_64_BIT
+# define JERRY_VALUE_64_BIT 0
+#endif /* !defined (JERRY_VALUE_64_BIT) */
+
 /**
  * Enable/Disable the engine's JavaScript debugger interface
  *
@@ -177,10 +196,14 @@
 /**
  * Maximum size of heap in kilobytes
  *
- * Default value: 512 KiB
+ * Default value: 512 KiB (1024 KiB with 64 bit ecma values)
  */
 #ifndef JERRY_GLOBAL_HEAP_SIZE
-# define JERRY_GLOBAL_HEAP_SIZE (512)
+# if JERRY_VALUE_64_BIT
+#  define JERRY_GLOBAL_HEAP_SIZE (1024)
+# else /* !JERRY_VALUE_64_BIT */
+#  define JERRY_GLOBAL_HEAP_SIZE (512)
+# endif /* JERRY_VALUE_64_BIT */
 #endif /* !defined (JERRY_GLOBAL_HEAP_SIZE) */
 
 /**
@@ -214,6 +237,78 @@
 # define JERRY_GC_MARK_LIMIT (8)
 #endif /* !defined (JERRY_GC_MARK_LIMIT) */
 
+/**
+ * Enable/Disable lazy compilation of function bodies.
+ *
+ * When enabled, the parser only pre-scans the body of eligible function
+ * declarations and expressions, and compiles it the first time the function
+ * is called.
+ *
+ * Allowed values:
+ *  0: Compile every function body eagerly.
+ *  1: Compile eligible function bodies on first call.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_LAZY_FUNCTIONS
+# define JERRY_LAZY_FUNCTIONS 0
+#endif /* !defined (JERRY_LAZY_FUNCTIONS) */
+
+/**
+ * Enable/Disable per-site inline caches of property accesses.
+ *
+ * When enabled, every byte code which accesses object properties gets a
+ * small cache of the properties found by each of its property load and
+ * store instructions.
+ *
+ * Allowed values:
+ *  0: Disable inline caches.
+ *  1: Enable inline caches.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_INLINE_CACHE
+# define JERRY_INLINE_CACHE 0
+#endif /* !defined (JERRY_INLINE_CACHE) */
+
+/**
+ * Enable/Disable hidden classes of ordinary objects.
+ *
+ * When enabled, the property names of ordinary objects which only have
+ * writable, enumerable and configurable data properties are stored in
+ * shapes, which are shared by the objects created with the same property
+ * insertion sequence. The objects only store their property values.
+ *
+ * Allowed values:
+ *  0: Disable hidden classes.
+ *  1: Enable hidden classes.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_HIDDEN_CLASSES
+# define JERRY_HIDDEN_CLASSES 0
+#endif /* !defined (JERRY_HIDDEN_CLASSES) */
+
+/**
+ * Enable/Disable the baseline JIT compiler.
+ *
+ * When enabled, the byte code of frequently called functions and frequently
+ * executed loops is translated to x86-64 machine code. Instructions which are
+ * not supported by the compiler are executed by the interpreter.
+ *
+ * Note:
+ *      the executable memory is allocated by the jerry_port_jit_* port functions
+ *
+ * Allowed values:
+ *  0: Disable the JIT compiler.
+ *  1: Enable the JIT compiler.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_JIT
+# define JERRY_JIT 0
+#endif /* !defined (JERRY_JIT) */
+
 /**
  * Enable/Disable property lookup cache.
  *
@@ -428,6 +523,39 @@
 # define JERRY_VM_EXEC_STOP 0
 #endif /* !defined (JERRY_VM_EXEC_STOP) */
 
+/**
+ * Enable/Disable asynchronous vm interrupt requests.
+ *
+ * When enabled, the vm checks a single pending flag at backward branches
+ * and at function entry, and calls the interrupt callback only when the
+ * flag has been set by jerry_request_vm_interrupt.
+ *
+ * Allowed values:
+ *  0: Disable vm interrupt requests.
+ *  1: Enable vm interrupt requests.
+ */
+#ifndef JERRY_VM_INTERRUPT
+# define JERRY_VM_INTERRUPT 0
+#endif /* !defined (JERRY_VM_INTERRUPT) */
+
+/**
+ * Enable/Disable threaded dispatch of the byte code interpreter.
+ *
+ * When enabled, vm_loop jumps to the handlers of the opcodes through a table
+ * of label addresses instead of a switch statement. The option requires the
+ * labels as values extension of GCC and Clang, other compilers keep using
+ * the switch statement.
+ *
+ * Allowed values:
+ *  0: Dispatch the opcodes with a switch statement.
+ *  1: Dispatch the opcodes through a table of label addresses.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_VM_THREADED_DISPATCH
+# define JERRY_VM_THREADED_DISPATCH 0
+#endif /* !defined (JERRY_VM_THREADED_DISPATCH) */
+
 /**
  * Advanced section configurations.
  */
@@ -582,6 +710,10 @@
 || ((JERRY_CPOINTER_32_BIT != 0) && (JERRY_CPOINTER_32_BIT != 1))
 # error "Invalid value for 'JERRY_CPOINTER_32_BIT' macro."
 #endif
+#if !defined (JERRY_VALUE_64_BIT) \
+|| ((JERRY_VALUE_64_BIT != 0) && (JERRY_VALUE_64_BIT != 1))
+# error "Invalid value for 'JERRY_VALUE_64_BIT' macro."
+#endif
 #if !defined (JERRY_DEBUGGER) \
 || ((JERRY_DEBUGGER != 0) && (JERRY_DEBUGGER != 1))
 # error "Invalid value for 'JERRY_DEBUGGER' macro."
@@ -606,6 +738,22 @@
 #if !defined (JERRY_GC_MARK_LIMIT) || (JERRY_GC_MARK_LIMIT < 0)
 # error "Invalid value for 'JERRY_GC_MARK_LIMIT' macro."
 #endif
+#if !defined (JERRY_INLINE_CACHE) \
+|| ((JERRY_INLINE_CACHE != 0) && (JERRY_INLINE_CACHE != 1))
+# error "Invalid value for 'JERRY_INLINE_CACHE' macro."
+#endif
+#if !defined (JERRY_HIDDEN_CLASSES) \
+|| ((JERRY_HIDDEN_CLASSES != 0) && (JERRY_HIDDEN_CLASSES != 1))
+# error "Invalid value for 'JERRY_HIDDEN_CLASSES' macro."
+#endif
+#if !defined (JERRY_JIT) \
+|| ((JERRY_JIT != 0) && (JERRY_JIT != 1))
+# error "Invalid value for 'JERRY_JIT' macro."
+#endif
+#if !defined (JERRY_LAZY_FUNCTIONS) \
+|| ((JERRY_LAZY_FUNCTIONS != 0) && (JERRY_LAZY_FUNCTIONS != 1))
+# error "Invalid value for 'JERRY_LAZY_FUNCTIONS' macro."
+#endif
 #if !defined (JERRY_LCACHE) \
 || ((JERRY_LCACHE != 0) && (JERRY_LCACHE != 1))
 # error "Invalid value for 'JERRY_LCACHE' macro."
@@ -674,6 +822,14 @@
 || ((JERRY_VM_EXEC_STOP != 0) && (JERRY_VM_EXEC_STOP != 1))
 # error "Invalid value for 'JERRY_VM_EXEC_STOP' macro."
 #endif
+#if !defined (JERRY_VM_INTERRUPT) \
+|| ((JERRY_VM_INTERRUPT != 0) && (JERRY_VM_INTERRUPT != 1))
+# error "Invalid value for 'JERRY_VM_INTERRUPT' macro."
+#endif
+#if !defined (JERRY_VM_THREADED_DISPATCH) \
+|| ((JERRY_VM_THREADED_DISPATCH != 0) && (JERRY_VM_THREADED_DISPATCH != 1))
+# error "Invalid value for 'JERRY_VM_THREADED_DISPATCH' macro."
+#endif
 
 #define ENABLED(FEATURE) ((FEATURE) == 1)
 #define DISABLED(FEATURE) ((FEATURE) != 1)
@@ -688,6 +844,33 @@
 #if ENABLED (JERRY_BUILTIN_DATE) && !ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
 #  error "Date does not support float32"
 #endif
+#if ENABLED (JERRY_VALUE_64_BIT) && !ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
+#  error "JERRY_VALUE_64_BIT requires JERRY_NUMBER_TYPE_FLOAT64."
+#endif
+#if ENABLED (JERRY_VALUE_64_BIT) && !ENABLED (JERRY_CPOINTER_32_BIT)
+#  error "JERRY_VALUE_64_BIT requires JERRY_CPOINTER_32_BIT."
+#endif
+
+/**
+ * Lazy functions are compiled on their first call, so the parser is required.
+ */
+#if ENABLED (JERRY_LAZY_FUNCTIONS) && !ENABLED (JERRY_PARSER)
+#  error "Lazy function compilation requires the parser"
+#endif
+
+/**
+ * The JIT compiler emits x86-64 code, which relies on the integer range of the
+ * float64 number type, and it cannot stop at the breakpoints of the debugger.
+ */
+#if ENABLED (JERRY_JIT) && !(defined (__x86_64__) && !defined (_WIN32))
+#  error "The JIT compiler is only supported on x86-64 non-Windows targets."
+#endif
+#if ENABLED (JERRY_JIT) && !ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
+#  error "JERRY_JIT requires JERRY_NUMBER_TYPE_FLOAT64."
+#endif
+#if ENABLED (JERRY_JIT) && ENABLED (JERRY_DEBUGGER)
+#  error "The JIT compiler cannot be used together with the debugger."
+#endif
 
 /**
  * Wrap container types into a single guard
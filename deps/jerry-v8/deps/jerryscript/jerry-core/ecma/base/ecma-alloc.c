@@ -16,6 +16,7 @@
 #include "ecma-alloc.h"
 #include "ecma-globals.h"
 #include "ecma-gc.h"
+#include "ecma-inline-cache.h"
 #include "jrt.h"
 #include "jmem.h"
 
@@ -24,8 +25,8 @@ JERRY_STATIC_ASSERT (sizeof (ecma_property_value_t) == sizeof (ecma_value_t),
 JERRY_STATIC_ASSERT (((sizeof (ecma_property_value_t) - 1) & sizeof (ecma_property_value_t)) == 0,
                      size_of_ecma_property_value_t_must_be_power_of_2);
 
-JERRY_STATIC_ASSERT (sizeof (ecma_extended_object_t) - sizeof (ecma_object_t) <= sizeof (uint64_t),
-                     size_of_ecma_extended_object_part_must_be_less_than_or_equal_to_8_bytes);
+JERRY_STATIC_ASSERT (sizeof (ecma_extended_object_t) - sizeof (ecma_object_t) <= 2 * sizeof (ecma_value_t),
+                     size_of_ecma_extended_object_part_must_be_less_than_or_equal_to_two_values);
 
 /** \addtogroup ecma ECMA
  * @{
@@ -257,6 +258,10 @@ ecma_alloc_property_pair (void)
 inline void JERRY_ATTR_ALWAYS_INLINE
 ecma_dealloc_property_pair (ecma_property_pair_t *property_pair_p) /**< property pair to be freed */
 {
+#if ENABLED (JERRY_INLINE_CACHE)
+  ecma_inline_cache_invalidate ();
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
 #if ENABLED (JERRY_MEM_STATS)
   jmem_stats_free_property_bytes (sizeof (ecma_property_pair_t));
 #endif /* ENABLED (JERRY_MEM_STATS) */
@@ -27,6 +27,7 @@
 #include "ecma-objects.h"
 #include "ecma-property-hashmap.h"
 #include "ecma-proxy-object.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
@@ -34,6 +35,7 @@
 #include "re-compiler.h"
 #include "vm-defines.h"
 #include "vm-stack.h"
+#include "vm.h"
 
 #if ENABLED (JERRY_BUILTIN_TYPEDARRAY)
 #include "ecma-typedarray-object.h"
@@ -207,6 +209,30 @@ ecma_gc_mark_properties (ecma_property_pair_t *property_pair_p) /**< property pa
   }
 } /* ecma_gc_mark_properties */
 
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+
+/**
+ * Mark objects referenced by the property values of a shaped object.
+ */
+static void
+ecma_gc_mark_shape_values (ecma_shape_values_t *values_p) /**< property values */
+{
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, values_p->header.next_property_cp);
+  ecma_property_value_t *prop_values_p = ECMA_SHAPE_VALUES (values_p);
+
+  for (uint32_t index = 0; index < shape_p->property_count; index++)
+  {
+    ecma_value_t value = prop_values_p[index].value;
+
+    if (ecma_is_value_object (value))
+    {
+      ecma_gc_set_object_visited (ecma_get_object_from_value (value));
+    }
+  }
+} /* ecma_gc_mark_shape_values */
+
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
 /**
  * Mark objects referenced by bound function object.
  */
@@ -425,10 +451,17 @@ ecma_gc_mark_executable_object (ecma_object_t *object_p) /**< object */
     }
   }
 
-  if (!ECMA_EXECUTABLE_OBJECT_IS_SUSPENDED (executable_object_p->extended_object.u.class_prop.extra_info))
+  if (executable_object_p->extended_object.u.class_prop.extra_info & ECMA_EXECUTABLE_OBJECT_RUNNING)
   {
-    /* All objects referenced by running executable objects are strong roots,
-     * and a finished executable object cannot refer to other values. */
+    /* The registers and the stack of running executable objects are strong roots,
+     * but the lexical environment of the frame is only referenced by the frame. */
+    ecma_gc_set_object_visited (executable_object_p->frame_ctx.lex_env_p);
+    return;
+  }
+
+  if (executable_object_p->extended_object.u.class_prop.extra_info & ECMA_EXECUTABLE_OBJECT_COMPLETED)
+  {
+    /* A finished executable object cannot refer to other values. */
     return;
   }
 
@@ -818,6 +851,19 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
   }
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  if (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+    {
+      ecma_gc_mark_shape_values ((ecma_shape_values_t *) prop_iter_p);
+      return;
+    }
+  }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
   while (prop_iter_cp != JMEM_CP_NULL)
   {
     ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
@@ -1006,6 +1052,14 @@ ecma_gc_free_executable_object (ecma_object_t *object_p) /**< object */
 void
 ecma_gc_free_properties (ecma_object_t *object_p) /**< object */
 {
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  if (ECMA_OBJECT_HAS_SHAPE (object_p))
+  {
+    ecma_shape_free_values (object_p);
+    return;
+  }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
   jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
 
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
@@ -1197,6 +1251,16 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
 
           break;
         }
+#if ENABLED (JERRY_LINE_INFO)
+        case LIT_MAGIC_STRING_ERROR_UL:
+        {
+          if (!ECMA_IS_INTERNAL_VALUE_NULL (ext_object_p->u.class_prop.u.value))
+          {
+            vm_free_backtrace (ECMA_GET_INTERNAL_VALUE_POINTER (vm_backtrace_t, ext_object_p->u.class_prop.u.value));
+          }
+          break;
+        }
+#endif /* ENABLED (JERRY_LINE_INFO) */
 #if ENABLED (JERRY_BUILTIN_TYPEDARRAY)
         case LIT_MAGIC_STRING_ARRAY_BUFFER_UL:
         {
@@ -1556,6 +1620,10 @@ ecma_gc_run (void)
   /* Free RegExp bytecodes stored in cache */
   re_cache_gc ();
 #endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  ecma_shape_free_unused (false);
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
 } /* ecma_gc_run */
 
 /**
@@ -1650,6 +1718,10 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
     }
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+    ecma_shape_free_unused (true);
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
     jmem_pools_collect_empty ();
     return;
   }
@@ -121,6 +121,8 @@ typedef enum
 
   ECMA_PARSE_GENERATOR_FUNCTION = (1u << 9), /**< generator function is parsed */
   ECMA_PARSE_ASYNC_FUNCTION = (1u << 10), /**< async function is parsed */
+  ECMA_PARSE_NO_LAZY_FUNCTIONS = (1u << 11), /**< compile all function bodies eagerly
+                                              *   (see JERRY_LAZY_FUNCTIONS) */
 
   /* These flags are internally used by the parser. */
 #ifndef JERRY_NDEBUG
@@ -132,6 +134,17 @@ typedef enum
 #endif /* !JERRY_NDEBUG */
 } ecma_parse_opts_t;
 
+#if ENABLED (JERRY_VALUE_64_BIT)
+
+/**
+ * Description of an ecma value
+ *
+ * Bit-field structure: type (3) | value (61)
+ */
+typedef uint64_t ecma_value_t;
+
+#else /* !ENABLED (JERRY_VALUE_64_BIT) */
+
 /**
  * Description of an ecma value
  *
@@ -139,6 +152,8 @@ typedef enum
  */
 typedef uint32_t ecma_value_t;
 
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+
 /**
  * Type for directly encoded integer numbers in JerryScript.
  */
@@ -174,6 +189,26 @@ typedef int32_t ecma_integer_value_t;
  */
 #define ECMA_DIRECT_SHIFT 4
 
+#if ENABLED (JERRY_VALUE_64_BIT)
+
+/**
+ * Shift for the exponent of directly encoded floating point numbers in ecma_value_t
+ *
+ * Bit-field structure: exponent (8) | fraction (52) | sign (1) | type (3)
+ */
+#define ECMA_DIRECT_FLOAT_EXPONENT_SHIFT 56
+
+/**
+ * Offset subtracted from the biased exponent of directly encoded floating point numbers
+ *
+ * Numbers whose biased exponent is between 896 and 1150 (magnitude between 2^-127 and 2^128)
+ * are directly encoded. Their encoded exponent is never zero, while the upper bits of
+ * compressed float pointers are always zero.
+ */
+#define ECMA_DIRECT_FLOAT_EXPONENT_OFFSET 895
+
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+
 /**
  * ECMA make simple value
  */
@@ -282,6 +317,11 @@ enum
  */
 typedef ecma_value_t (*ecma_vm_exec_stop_callback_t) (void *user_p);
 
+/**
+ * Callback which is called when a pending vm interrupt request is serviced.
+ */
+typedef ecma_value_t (*ecma_vm_interrupt_callback_t) (void *user_p);
+
 /**
  * Type of an external function handler.
  */
@@ -466,6 +506,7 @@ typedef enum
    * ECMA_PROPERTY_IS_PROPERTY_PAIR must be updated as well. */
   ECMA_SPECIAL_PROPERTY_HASHMAP, /**< hashmap property */
   ECMA_SPECIAL_PROPERTY_DELETED, /**< deleted property */
+  ECMA_SPECIAL_PROPERTY_SHAPE, /**< property values of a shaped object */
 
   ECMA_SPECIAL_PROPERTY__COUNT /**< Number of special property types */
 } ecma_special_property_id_t;
@@ -486,6 +527,11 @@ typedef enum
  */
 #define ECMA_PROPERTY_TYPE_HASHMAP ECMA_SPECIAL_PROPERTY_VALUE (ECMA_SPECIAL_PROPERTY_HASHMAP)
 
+/**
+ * Type of the property values of a shaped object.
+ */
+#define ECMA_PROPERTY_TYPE_SHAPE ECMA_SPECIAL_PROPERTY_VALUE (ECMA_SPECIAL_PROPERTY_SHAPE)
+
 /**
  * Type of property not found.
  */
@@ -588,7 +634,8 @@ typedef struct
  * Returns true if the property pointer is a property pair.
  */
 #define ECMA_PROPERTY_IS_PROPERTY_PAIR(property_header_p) \
-  ((property_header_p)->types[0] != ECMA_PROPERTY_TYPE_HASHMAP)
+  ((property_header_p)->types[0] != ECMA_PROPERTY_TYPE_HASHMAP \
+   && (property_header_p)->types[0] != ECMA_PROPERTY_TYPE_SHAPE)
 
 /**
  * Returns true if the property is named property.
@@ -596,12 +643,27 @@ typedef struct
 #define ECMA_PROPERTY_IS_NAMED_PROPERTY(property) \
   (ECMA_PROPERTY_GET_TYPE (property) != ECMA_PROPERTY_TYPE_SPECIAL)
 
+#if ENABLED (JERRY_VALUE_64_BIT)
+
+/**
+ * Add the offset part to a property for computing its property data pointer.
+ *
+ * Note: the property types are at offset 4 and 5 of the 8 byte header,
+ *       and the 8 byte values are at offset 8 and 16 of the property pair.
+ */
+#define ECMA_PROPERTY_VALUE_ADD_OFFSET(property_p) \
+  ((uintptr_t) ((((uint8_t *) (property_p)) + (sizeof (ecma_property_value_t) + 3))))
+
+#else /* !ENABLED (JERRY_VALUE_64_BIT) */
+
 /**
  * Add the offset part to a property for computing its property data pointer.
  */
 #define ECMA_PROPERTY_VALUE_ADD_OFFSET(property_p) \
   ((uintptr_t) ((((uint8_t *) (property_p)) + (sizeof (ecma_property_value_t) * 2 - 1))))
 
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+
 /**
  * Align the property for computing its property data pointer.
  */
@@ -1076,7 +1138,7 @@ typedef struct
  * Size of the internal buffer.
  */
 #define ECMA_CONTAINER_GET_SIZE(container_p) \
-  (container_p->buffer_p[0])
+  ((uint32_t) container_p->buffer_p[0])
 
 /**
  * Remove the size field of the internal buffer.
@@ -1762,6 +1824,20 @@ typedef struct
   jmem_cpointer_t values[ECMA_LIT_STORAGE_VALUE_COUNT]; /**< list of values */
 } ecma_number_storage_item_t;
 
+/**
+ * Hash table which indexes the values of a literal storage list
+ *
+ * Note:
+ *      the table uses open addressing with linear probing, and the
+ *      values are owned by the literal storage list
+ */
+typedef struct
+{
+  jmem_cpointer_t *buckets_p; /**< buckets, empty buckets are JMEM_CP_NULL */
+  uint32_t size; /**< number of buckets (power of 2) */
+  uint32_t count; /**< number of values in the table */
+} ecma_lit_hash_table_t;
+
 #if ENABLED (JERRY_LCACHE)
 /**
  * Container of an LCache entry identifier
@@ -1796,6 +1872,60 @@ typedef struct
 
 #endif /* ENABLED (JERRY_LCACHE) */
 
+#if ENABLED (JERRY_INLINE_CACHE)
+
+/**
+ * Number of entries in a slot of an inline cache
+ */
+#define ECMA_INLINE_CACHE_SLOT_LENGTH 2
+
+/**
+ * Slot of an inline cache, which belongs to one property access instruction
+ *
+ * Note:
+ *      the first entry is the most recently inserted one
+ */
+typedef struct
+{
+  ecma_property_t *prop_p[ECMA_INLINE_CACHE_SLOT_LENGTH]; /**< cached properties, NULL for shape entries */
+  jmem_cpointer_t object_cp[ECMA_INLINE_CACHE_SLOT_LENGTH]; /**< objects which own the cached properties
+                                                             *   (shapes for shape entries),
+                                                             *   JMEM_CP_NULL for unused entries */
+  jmem_cpointer_t name_cp[ECMA_INLINE_CACHE_SLOT_LENGTH]; /**< names of the cached properties */
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  uint8_t shape_index[ECMA_INLINE_CACHE_SLOT_LENGTH]; /**< value indices of shape entries */
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+  uint32_t site; /**< byte code offset of the instruction, 0 for unused slots */
+  uint32_t misses; /**< number of misses since the slot was cleared, the instruction
+                    *   is megamorphic when it reaches ECMA_INLINE_CACHE_MISS_LIMIT */
+} ecma_inline_cache_slot_t;
+
+/**
+ * Inline cache of a byte code
+ */
+typedef struct ecma_inline_cache_t
+{
+  struct ecma_inline_cache_t *next_p; /**< next inline cache in the same bucket */
+  const ecma_compiled_code_t *bytecode_p; /**< byte code of the inline cache */
+  ecma_inline_cache_slot_t *slots_p; /**< slots hashed by their site (open addressing) */
+  uint32_t size; /**< number of slots (power of 2) */
+  uint32_t count; /**< number of used slots */
+  uint32_t epoch; /**< inline cache epoch when the slots were last valid */
+} ecma_inline_cache_t;
+
+/**
+ * Statistics of the inline caches
+ */
+typedef struct
+{
+  size_t load_hits; /**< property loads served by an inline cache */
+  size_t load_misses; /**< property loads which missed the inline cache */
+  size_t store_hits; /**< property stores served by an inline cache */
+  size_t store_misses; /**< property stores which missed the inline cache */
+} ecma_inline_cache_stats_t;
+
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
 #if ENABLED (JERRY_BUILTIN_TYPEDARRAY)
 
 /**
@@ -25,8 +25,10 @@
  * @{
  */
 
+#if !ENABLED (JERRY_VALUE_64_BIT)
 JERRY_STATIC_ASSERT (sizeof (ecma_value_t) == sizeof (ecma_integer_value_t),
                      size_of_ecma_value_t_must_be_equal_to_the_size_of_ecma_integer_value_t);
+#endif /* !ENABLED (JERRY_VALUE_64_BIT) */
 
 JERRY_STATIC_ASSERT (ECMA_DIRECT_SHIFT == ECMA_VALUE_SHIFT + 1,
                      currently_directly_encoded_values_has_one_extra_flag);
@@ -45,7 +45,7 @@ JERRY_STATIC_ASSERT (sizeof (jmem_cpointer_t) <= sizeof (jmem_cpointer_tag_t),
 JERRY_STATIC_ASSERT (sizeof (uintptr_t) <= sizeof (ecma_value_t),
                      uintptr_t_must_fit_in_ecma_value_t);
 
-#else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
+#elif !ENABLED (JERRY_VALUE_64_BIT)
 
 JERRY_STATIC_ASSERT (sizeof (uintptr_t) > sizeof (ecma_value_t),
                      uintptr_t_must_not_fit_in_ecma_value_t);
@@ -288,6 +288,71 @@ ecma_is_value_float_number (ecma_value_t value) /**< ecma value */
   return (ecma_get_value_type_field (value) == ECMA_TYPE_FLOAT);
 } /* ecma_is_value_float_number */
 
+#if ENABLED (JERRY_VALUE_64_BIT)
+
+/**
+ * Mask of the fraction part of a 64 bit floating point number.
+ */
+#define ECMA_DIRECT_FLOAT_FRACTION_MASK ((UINT64_C (1) << 52) - 1)
+
+/**
+ * Check if the value is a directly encoded floating-point ecma-number.
+ *
+ * @return true - if the number is stored in the value itself,
+ *         false - otherwise
+ */
+inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
+ecma_is_value_direct_float_number (ecma_value_t value) /**< ecma value */
+{
+  return (ecma_is_value_float_number (value)
+          && (value >> ECMA_DIRECT_FLOAT_EXPONENT_SHIFT) != 0);
+} /* ecma_is_value_direct_float_number */
+
+/**
+ * Encode a floating-point number directly into an ecma value.
+ *
+ * @return directly encoded value - if the exponent of the number is in the supported range,
+ *         ECMA_VALUE_EMPTY - otherwise (zero, denormals, very small or large numbers, infinity, NaN)
+ */
+static inline ecma_value_t JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
+ecma_make_direct_float_value (ecma_number_t ecma_number) /**< number to be encoded */
+{
+  ecma_number_accessor_t u;
+  u.as_ecma_number_t = ecma_number;
+
+  /* The unsigned subtraction also moves the exponents below the range above 0xff. */
+  uint64_t exponent = ((u.as_uint64_t >> 52) & 0x7ff) - ECMA_DIRECT_FLOAT_EXPONENT_OFFSET;
+
+  if (exponent - 1 >= 0xff)
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+  return ((exponent << ECMA_DIRECT_FLOAT_EXPONENT_SHIFT)
+          | ((u.as_uint64_t & ECMA_DIRECT_FLOAT_FRACTION_MASK) << (ECMA_VALUE_SHIFT + 1))
+          | ((u.as_uint64_t >> 63) << ECMA_VALUE_SHIFT)
+          | ECMA_TYPE_FLOAT);
+} /* ecma_make_direct_float_value */
+
+/**
+ * Decode a directly encoded floating-point number.
+ *
+ * @return floating point value
+ */
+static inline ecma_number_t JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
+ecma_get_direct_float_from_value (ecma_value_t value) /**< ecma value */
+{
+  JERRY_ASSERT (ecma_is_value_direct_float_number (value));
+
+  ecma_number_accessor_t u;
+  u.as_uint64_t = ((((value >> ECMA_DIRECT_FLOAT_EXPONENT_SHIFT) + ECMA_DIRECT_FLOAT_EXPONENT_OFFSET) << 52)
+                   | ((value >> (ECMA_VALUE_SHIFT + 1)) & ECMA_DIRECT_FLOAT_FRACTION_MASK)
+                   | ((value >> ECMA_VALUE_SHIFT) << 63));
+  return u.as_ecma_number_t;
+} /* ecma_get_direct_float_from_value */
+
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+
 /**
  * Check if the value is ecma-number.
  *
@@ -484,6 +549,15 @@ ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer number
 static ecma_value_t
 ecma_create_float_number (ecma_number_t ecma_number) /**< value of the float number */
 {
+#if ENABLED (JERRY_VALUE_64_BIT)
+  ecma_value_t direct_value = ecma_make_direct_float_value (ecma_number);
+
+  if (JERRY_LIKELY (direct_value != ECMA_VALUE_EMPTY))
+  {
+    return direct_value;
+  }
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+
   ecma_number_t *ecma_num_p = ecma_alloc_number ();
 
   *ecma_num_p = ecma_number;
@@ -699,6 +773,13 @@ ecma_get_float_from_value (ecma_value_t value) /**< ecma value */
 {
   JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_FLOAT);
 
+#if ENABLED (JERRY_VALUE_64_BIT)
+  if (ecma_is_value_direct_float_number (value))
+  {
+    return ecma_get_direct_float_from_value (value);
+  }
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+
   return *(ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
 } /* ecma_get_float_from_value */
 
@@ -711,6 +792,9 @@ inline ecma_number_t * JERRY_ATTR_PURE JERRY_ATTR_ALWAYS_INLINE
 ecma_get_pointer_from_float_value (ecma_value_t value) /**< ecma value */
 {
   JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_FLOAT);
+#if ENABLED (JERRY_VALUE_64_BIT)
+  JERRY_ASSERT (!ecma_is_value_direct_float_number (value));
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
 
   return (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
 } /* ecma_get_pointer_from_float_value */
@@ -833,6 +917,13 @@ ecma_copy_value (ecma_value_t value)  /**< value description */
   {
     case ECMA_TYPE_FLOAT:
     {
+#if ENABLED (JERRY_VALUE_64_BIT)
+      if (ecma_is_value_direct_float_number (value))
+      {
+        return value;
+      }
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+
       ecma_number_t *num_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
 
       return ecma_create_float_number (*num_p);
@@ -946,10 +1037,14 @@ ecma_value_assign_value (ecma_value_t *value_p, /**< [in, out] ecma value */
   else if (ecma_is_value_float_number (ecma_value)
            && ecma_is_value_float_number (*value_p))
   {
+#if ENABLED (JERRY_VALUE_64_BIT)
+    *value_p = ecma_update_float_number (*value_p, ecma_get_float_from_value (ecma_value));
+#else /* !ENABLED (JERRY_VALUE_64_BIT) */
     const ecma_number_t *num_src_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (ecma_value);
     ecma_number_t *num_dst_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (*value_p);
 
     *num_dst_p = *num_src_p;
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
   }
   else
   {
@@ -973,16 +1068,32 @@ ecma_update_float_number (ecma_value_t float_value, /**< original float value */
   JERRY_ASSERT (ecma_is_value_float_number (float_value));
 
   ecma_integer_value_t integer_number = (ecma_integer_value_t) new_number;
-  ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (float_value);
 
   if ((ecma_number_t) integer_number == new_number
       && ((integer_number == 0) ? ecma_is_number_equal_to_positive_zero (new_number)
                                 : ECMA_IS_INTEGER_NUMBER (integer_number)))
   {
-    ecma_dealloc_number (number_p);
+    ecma_free_number (float_value);
     return ecma_make_integer_value (integer_number);
   }
 
+#if ENABLED (JERRY_VALUE_64_BIT)
+  ecma_value_t direct_value = ecma_make_direct_float_value (new_number);
+
+  if (direct_value != ECMA_VALUE_EMPTY)
+  {
+    ecma_free_number (float_value);
+    return direct_value;
+  }
+
+  if (ecma_is_value_direct_float_number (float_value))
+  {
+    return ecma_create_float_number (new_number);
+  }
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+
+  ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (float_value);
+
   *number_p = new_number;
   return float_value;
 } /* ecma_update_float_number */
@@ -999,9 +1110,13 @@ ecma_value_assign_float_number (ecma_value_t *value_p, /**< [in, out] ecma value
 {
   if (ecma_is_value_float_number (*value_p))
   {
+#if ENABLED (JERRY_VALUE_64_BIT)
+    *value_p = ecma_update_float_number (*value_p, ecma_number);
+#else /* !ENABLED (JERRY_VALUE_64_BIT) */
     ecma_number_t *num_dst_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (*value_p);
 
     *num_dst_p = ecma_number;
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
     return;
   }
 
@@ -1052,6 +1167,13 @@ ecma_free_value (ecma_value_t value) /**< value description */
   {
     case ECMA_TYPE_FLOAT:
     {
+#if ENABLED (JERRY_VALUE_64_BIT)
+      if (ecma_is_value_direct_float_number (value))
+      {
+        break;
+      }
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+
       ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
       ecma_dealloc_number (number_p);
       break;
@@ -1125,7 +1247,11 @@ ecma_free_number (ecma_value_t value) /**< value description */
 {
   JERRY_ASSERT (ecma_is_value_number (value));
 
+#if ENABLED (JERRY_VALUE_64_BIT)
+  if (ecma_is_value_float_number (value) && !ecma_is_value_direct_float_number (value))
+#else /* !ENABLED (JERRY_VALUE_64_BIT) */
   if (ecma_is_value_float_number (value))
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
   {
     ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
     ecma_dealloc_number (number_p);
@@ -18,12 +18,15 @@
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "ecma-inline-cache.h"
 #include "ecma-lcache.h"
 #include "ecma-property-hashmap.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 #include "jrt-bit-fields.h"
 #include "byte-code.h"
 #include "re-compiler.h"
+#include "vm-jit.h"
 #include "ecma-builtins.h"
 
 #if ENABLED (JERRY_DEBUGGER)
@@ -384,6 +387,13 @@ ecma_create_property (ecma_object_t *object_p, /**< the object */
   JERRY_ASSERT (name_p != NULL);
   JERRY_ASSERT (object_p != NULL);
 
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  if (ECMA_OBJECT_HAS_SHAPE (object_p))
+  {
+    ecma_shape_convert_to_normal (object_p, NULL);
+  }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
   jmem_cpointer_t *property_list_head_p = &object_p->u1.property_list_cp;
 
   if (*property_list_head_p != ECMA_NULL_POINTER)
@@ -525,6 +535,18 @@ ecma_create_named_data_property (ecma_object_t *object_p, /**< object */
   JERRY_ASSERT (ecma_find_named_property (object_p, name_p) == NULL);
   JERRY_ASSERT ((prop_attributes & ~ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE) == 0);
 
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  if (prop_attributes == ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE && out_prop_p == NULL)
+  {
+    ecma_property_value_t *prop_value_p = ecma_shape_create_property (object_p, name_p);
+
+    if (prop_value_p != NULL)
+    {
+      return prop_value_p;
+    }
+  }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
   uint8_t type_and_flags = ECMA_PROPERTY_TYPE_NAMEDDATA | prop_attributes;
 
   ecma_property_value_t value;
@@ -587,6 +609,19 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
 
   ecma_property_t *property_p = NULL;
 
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  if (ECMA_OBJECT_HAS_SHAPE (obj_p))
+  {
+    if (ecma_shape_find_property_value (obj_p, name_p) == NULL)
+    {
+      return NULL;
+    }
+
+    /* The caller might change the property, which is only possible in a property list. */
+    ecma_shape_convert_to_normal (obj_p, NULL);
+  }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
 #if ENABLED (JERRY_LCACHE)
   property_p = ecma_lcache_lookup (obj_p, name_p);
   if (property_p != NULL)
@@ -812,6 +847,18 @@ void
 ecma_delete_property (ecma_object_t *object_p, /**< object */
                       ecma_property_value_t *prop_value_p) /**< property value reference */
 {
+#if ENABLED (JERRY_INLINE_CACHE)
+  ecma_inline_cache_invalidate ();
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  if (ECMA_OBJECT_HAS_SHAPE (object_p))
+  {
+    /* Objects whose properties are deleted leave their shape. */
+    prop_value_p = ecma_shape_convert_to_normal (object_p, prop_value_p);
+  }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
   jmem_cpointer_t cur_prop_cp = object_p->u1.property_list_cp;
 
   ecma_property_header_t *prev_prop_p = NULL;
@@ -919,6 +966,19 @@ ecma_assert_object_contains_the_property (const ecma_object_t *object_p, /**< ec
 
   ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
 
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+  {
+    ecma_shape_values_t *values_p = (ecma_shape_values_t *) prop_iter_p;
+    ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, values_p->header.next_property_cp);
+
+    JERRY_ASSERT (type == ECMA_PROPERTY_TYPE_NAMEDDATA
+                  && prop_value_p >= ECMA_SHAPE_VALUES (values_p)
+                  && prop_value_p < ECMA_SHAPE_VALUES (values_p) + shape_p->property_count);
+    return;
+  }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
   if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
   {
     prop_iter_cp = prop_iter_p->next_property_cp;
@@ -1214,10 +1274,10 @@ ecma_free_property_descriptor (ecma_property_descriptor_t *prop_desc_p) /**< pro
 } /* ecma_free_property_descriptor */
 
 /**
- * The size of error reference must be 8 bytes to use jmem_pools_alloc().
+ * The size of error reference must be 8 (or 16 with 64 bit values) bytes to use jmem_pools_alloc().
  */
-JERRY_STATIC_ASSERT (sizeof (ecma_error_reference_t) == 8,
-                     ecma_error_reference_size_must_be_8_bytes);
+JERRY_STATIC_ASSERT (sizeof (ecma_error_reference_t) == 2 * sizeof (ecma_value_t),
+                     ecma_error_reference_size_must_be_two_values);
 
 /**
  * Create an error reference from a given value.
@@ -1367,12 +1427,49 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
     return;
   }
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  if (CBC_IS_FUNCTION (bytecode_p->status_flags)
+      && (bytecode_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION))
+  {
+    cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) bytecode_p;
+
+    if (lazy_function_p->compiled_code_cp != JMEM_CP_NULL)
+    {
+      ecma_bytecode_deref (ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t, lazy_function_p->compiled_code_cp));
+    }
+
+    cbc_lazy_source_t *lazy_source_p = ECMA_GET_NON_NULL_POINTER (cbc_lazy_source_t, lazy_function_p->source_cp);
+
+    JERRY_ASSERT (lazy_source_p->refs > 0);
+
+    if (--lazy_source_p->refs == 0)
+    {
+      jmem_heap_free_block (lazy_source_p, sizeof (cbc_lazy_source_t) + lazy_source_p->size);
+    }
+
+#if ENABLED (JERRY_MEM_STATS)
+    jmem_stats_free_byte_code_bytes (((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+    jmem_heap_free_block (bytecode_p, ((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG);
+    return;
+  }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
   if (CBC_IS_FUNCTION (bytecode_p->status_flags))
   {
     ecma_value_t *literal_start_p = NULL;
     uint32_t literal_end;
     uint32_t const_literal_end;
 
+#if ENABLED (JERRY_INLINE_CACHE)
+    ecma_inline_cache_free (bytecode_p);
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
+#if ENABLED (JERRY_JIT)
+    vm_jit_free (bytecode_p);
+#endif /* ENABLED (JERRY_JIT) */
+
     if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
     {
       cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_p;
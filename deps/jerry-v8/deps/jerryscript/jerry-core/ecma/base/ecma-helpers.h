@@ -238,6 +238,9 @@ bool JERRY_ATTR_CONST ecma_is_value_array_hole (ecma_value_t value);
 bool JERRY_ATTR_CONST ecma_is_value_integer_number (ecma_value_t value);
 bool JERRY_ATTR_CONST ecma_are_values_integer_numbers (ecma_value_t first_value, ecma_value_t second_value);
 bool JERRY_ATTR_CONST ecma_is_value_float_number (ecma_value_t value);
+#if ENABLED (JERRY_VALUE_64_BIT)
+bool JERRY_ATTR_CONST ecma_is_value_direct_float_number (ecma_value_t value);
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
 bool JERRY_ATTR_CONST ecma_is_value_number (ecma_value_t value);
 bool JERRY_ATTR_CONST ecma_is_value_string (ecma_value_t value);
 #if ENABLED (JERRY_ESNEXT)
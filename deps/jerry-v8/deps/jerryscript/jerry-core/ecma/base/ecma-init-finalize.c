@@ -17,10 +17,13 @@
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
+#include "ecma-inline-cache.h"
 #include "ecma-lex-env.h"
 #include "ecma-literal-storage.h"
+#include "ecma-shape.h"
 #include "jmem.h"
 #include "jcontext.h"
+#include "vm-jit.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -89,7 +92,16 @@ ecma_finalize (void)
     }
   }
   while (JERRY_CONTEXT (ecma_gc_new_objects) != 0);
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  ecma_finalize_shapes ();
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
   ecma_finalize_lit_storage ();
+#if ENABLED (JERRY_INLINE_CACHE)
+  ecma_finalize_inline_cache ();
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+#if ENABLED (JERRY_JIT)
+  vm_jit_finalize ();
+#endif /* ENABLED (JERRY_JIT) */
 } /* ecma_finalize */
 
 /**
@@ -0,0 +1,571 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-inline-cache.h"
+#include "jcontext.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmainlinecache Inline caches of property accesses
+ * @{
+ */
+
+#if ENABLED (JERRY_INLINE_CACHE)
+
+/**
+ * Initial number of slots of an inline cache.
+ */
+#define ECMA_INLINE_CACHE_INITIAL_SIZE 4
+
+/**
+ * Initial number of buckets of the inline cache table.
+ */
+#define ECMA_INLINE_CACHE_INITIAL_BUCKETS 64
+
+/**
+ * Number of misses between two clears of an inline cache after
+ * which an instruction is no longer cached.
+ */
+#define ECMA_INLINE_CACHE_MISS_LIMIT 16
+
+/**
+ * Compute the bucket index of a byte code.
+ *
+ * @return bucket index
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_inline_cache_bucket_index (const ecma_compiled_code_t *bytecode_p) /**< byte code */
+{
+  return (uint32_t) ((uintptr_t) bytecode_p >> JMEM_ALIGNMENT_LOG) & (JERRY_CONTEXT (inline_cache_bucket_count) - 1);
+} /* ecma_inline_cache_bucket_index */
+
+/**
+ * Get the compressed pointer and the name type of a property name.
+ *
+ * @return name type of the property name
+ */
+static inline ecma_property_t JERRY_ATTR_ALWAYS_INLINE
+ecma_inline_cache_get_name (const ecma_string_t *name_p, /**< property name */
+                            jmem_cpointer_t *name_cp_p) /**< [out] compressed pointer of the name */
+{
+  if (JERRY_UNLIKELY (ECMA_IS_DIRECT_STRING (name_p)))
+  {
+    *name_cp_p = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (name_p);
+    return (ecma_property_t) ECMA_GET_DIRECT_STRING_TYPE (name_p);
+  }
+
+  ECMA_SET_NON_NULL_POINTER (*name_cp_p, name_p);
+  return ECMA_DIRECT_STRING_PTR;
+} /* ecma_inline_cache_get_name */
+
+/**
+ * Remove every cached property of an inline cache.
+ *
+ * Note:
+ *      megamorphic instructions are not cached again, since they would
+ *      most likely become megamorphic again
+ */
+static void
+ecma_inline_cache_clear (ecma_inline_cache_t *cache_p) /**< inline cache */
+{
+  ecma_inline_cache_slot_t *slot_p = cache_p->slots_p;
+  ecma_inline_cache_slot_t *slot_end_p = slot_p + cache_p->size;
+
+  while (slot_p < slot_end_p)
+  {
+    for (uint32_t i = 0; i < ECMA_INLINE_CACHE_SLOT_LENGTH; i++)
+    {
+      slot_p->object_cp[i] = JMEM_CP_NULL;
+    }
+
+    if (slot_p->misses < ECMA_INLINE_CACHE_MISS_LIMIT)
+    {
+      slot_p->misses = 0;
+    }
+    slot_p++;
+  }
+
+  cache_p->epoch = JERRY_CONTEXT (inline_cache_epoch);
+} /* ecma_inline_cache_clear */
+
+/**
+ * Insert an inline cache into the inline cache table.
+ */
+static void
+ecma_inline_cache_link (ecma_inline_cache_t *cache_p) /**< inline cache */
+{
+  uint32_t index = ecma_inline_cache_bucket_index (cache_p->bytecode_p);
+
+  cache_p->next_p = JERRY_CONTEXT (inline_cache_buckets_p)[index];
+  JERRY_CONTEXT (inline_cache_buckets_p)[index] = cache_p;
+} /* ecma_inline_cache_link */
+
+/**
+ * Double the number of buckets of the inline cache table.
+ */
+static void
+ecma_inline_cache_grow_buckets (void)
+{
+  uint32_t old_count = JERRY_CONTEXT (inline_cache_bucket_count);
+  uint32_t new_count = (old_count == 0) ? ECMA_INLINE_CACHE_INITIAL_BUCKETS : (old_count << 1);
+  ecma_inline_cache_t **new_buckets_p;
+
+  new_buckets_p = jmem_heap_alloc_block_null_on_error (new_count * sizeof (ecma_inline_cache_t *));
+
+  if (new_buckets_p == NULL)
+  {
+    return;
+  }
+
+  /* The allocation might run the garbage collector, which frees the inline caches of
+   * the unused byte codes, so the buckets are only read after the allocation. */
+  ecma_inline_cache_t **old_buckets_p = JERRY_CONTEXT (inline_cache_buckets_p);
+  old_count = JERRY_CONTEXT (inline_cache_bucket_count);
+
+  memset (new_buckets_p, 0, new_count * sizeof (ecma_inline_cache_t *));
+  JERRY_CONTEXT (inline_cache_buckets_p) = new_buckets_p;
+  JERRY_CONTEXT (inline_cache_bucket_count) = new_count;
+
+  for (uint32_t i = 0; i < old_count; i++)
+  {
+    ecma_inline_cache_t *cache_p = old_buckets_p[i];
+
+    while (cache_p != NULL)
+    {
+      ecma_inline_cache_t *next_p = cache_p->next_p;
+      ecma_inline_cache_link (cache_p);
+      cache_p = next_p;
+    }
+  }
+
+  if (old_buckets_p != NULL)
+  {
+    jmem_heap_free_block (old_buckets_p, old_count * sizeof (ecma_inline_cache_t *));
+  }
+} /* ecma_inline_cache_grow_buckets */
+
+/**
+ * Get the inline cache of a byte code, and create it on first use.
+ *
+ * @return pointer to the inline cache - if it exists or it can be allocated
+ *         NULL - otherwise
+ */
+ecma_inline_cache_t *
+ecma_inline_cache_get (const ecma_compiled_code_t *bytecode_p) /**< byte code */
+{
+  JERRY_ASSERT (CBC_IS_FUNCTION (bytecode_p->status_flags));
+
+  if (JERRY_CONTEXT (inline_cache_bucket_count) > 0)
+  {
+    ecma_inline_cache_t *cache_p;
+    cache_p = JERRY_CONTEXT (inline_cache_buckets_p)[ecma_inline_cache_bucket_index (bytecode_p)];
+
+    while (cache_p != NULL)
+    {
+      if (cache_p->bytecode_p == bytecode_p)
+      {
+        return cache_p;
+      }
+
+      cache_p = cache_p->next_p;
+    }
+  }
+
+  ecma_inline_cache_t *cache_p = jmem_heap_alloc_block_null_on_error (sizeof (ecma_inline_cache_t));
+
+  if (cache_p == NULL)
+  {
+    return NULL;
+  }
+
+  size_t slots_size = ECMA_INLINE_CACHE_INITIAL_SIZE * sizeof (ecma_inline_cache_slot_t);
+  ecma_inline_cache_slot_t *slots_p = jmem_heap_alloc_block_null_on_error (slots_size);
+
+  if (slots_p == NULL)
+  {
+    jmem_heap_free_block (cache_p, sizeof (ecma_inline_cache_t));
+    return NULL;
+  }
+
+  if (JERRY_CONTEXT (inline_cache_count) >= JERRY_CONTEXT (inline_cache_bucket_count))
+  {
+    ecma_inline_cache_grow_buckets ();
+
+    if (JERRY_CONTEXT (inline_cache_bucket_count) == 0)
+    {
+      jmem_heap_free_block (slots_p, slots_size);
+      jmem_heap_free_block (cache_p, sizeof (ecma_inline_cache_t));
+      return NULL;
+    }
+  }
+
+  memset (slots_p, 0, slots_size);
+  cache_p->bytecode_p = bytecode_p;
+  cache_p->slots_p = slots_p;
+  cache_p->size = ECMA_INLINE_CACHE_INITIAL_SIZE;
+  cache_p->count = 0;
+  cache_p->epoch = JERRY_CONTEXT (inline_cache_epoch);
+
+  ecma_inline_cache_link (cache_p);
+  JERRY_CONTEXT (inline_cache_count)++;
+  return cache_p;
+} /* ecma_inline_cache_get */
+
+/**
+ * Find the slot of a site in a slot array.
+ *
+ * @return the slot of the site, or the unused slot where it should be inserted
+ */
+static inline ecma_inline_cache_slot_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_inline_cache_find_slot (ecma_inline_cache_slot_t *slots_p, /**< slots */
+                             uint32_t size, /**< number of slots */
+                             uint32_t site) /**< byte code offset of the instruction */
+{
+  uint32_t mask = size - 1;
+  uint32_t index = site & mask;
+
+  while (slots_p[index].site != site && slots_p[index].site != 0)
+  {
+    index = (index + 1) & mask;
+  }
+
+  return slots_p + index;
+} /* ecma_inline_cache_find_slot */
+
+/**
+ * Double the number of slots of an inline cache.
+ *
+ * @return true - if the slots are reallocated
+ *         false - otherwise
+ */
+static bool
+ecma_inline_cache_grow (ecma_inline_cache_t *cache_p) /**< inline cache */
+{
+  uint32_t new_size = cache_p->size << 1;
+  size_t new_slots_size = new_size * sizeof (ecma_inline_cache_slot_t);
+  ecma_inline_cache_slot_t *new_slots_p = jmem_heap_alloc_block_null_on_error (new_slots_size);
+
+  if (new_slots_p == NULL)
+  {
+    return false;
+  }
+
+  memset (new_slots_p, 0, new_slots_size);
+
+  ecma_inline_cache_slot_t *slot_p = cache_p->slots_p;
+  ecma_inline_cache_slot_t *slot_end_p = slot_p + cache_p->size;
+
+  while (slot_p < slot_end_p)
+  {
+    if (slot_p->site != 0)
+    {
+      *ecma_inline_cache_find_slot (new_slots_p, new_size, slot_p->site) = *slot_p;
+    }
+    slot_p++;
+  }
+
+  jmem_heap_free_block (cache_p->slots_p, cache_p->size * sizeof (ecma_inline_cache_slot_t));
+  cache_p->slots_p = new_slots_p;
+  cache_p->size = new_size;
+  return true;
+} /* ecma_inline_cache_grow */
+
+/**
+ * Get the slot of a property access instruction.
+ *
+ * @return pointer to the slot - if the properties accessed by the instruction can be cached
+ *         NULL - otherwise
+ */
+inline ecma_inline_cache_slot_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_inline_cache_get_slot (ecma_inline_cache_t *cache_p, /**< inline cache */
+                            uint32_t site) /**< byte code offset of the instruction */
+{
+  JERRY_ASSERT (cache_p != NULL && site != 0);
+
+  ecma_inline_cache_slot_t *slot_p = ecma_inline_cache_find_slot (cache_p->slots_p, cache_p->size, site);
+
+  if (JERRY_UNLIKELY (slot_p->site == 0))
+  {
+    /* Keep at least one quarter of the slots unused. */
+    if ((cache_p->count + 1) * 4 > cache_p->size * 3)
+    {
+      if (!ecma_inline_cache_grow (cache_p))
+      {
+        return NULL;
+      }
+
+      slot_p = ecma_inline_cache_find_slot (cache_p->slots_p, cache_p->size, site);
+    }
+
+    slot_p->site = site;
+    cache_p->count++;
+  }
+
+  if (JERRY_UNLIKELY (cache_p->epoch != JERRY_CONTEXT (inline_cache_epoch)))
+  {
+    ecma_inline_cache_clear (cache_p);
+  }
+
+  if (JERRY_UNLIKELY (slot_p->misses >= ECMA_INLINE_CACHE_MISS_LIMIT))
+  {
+    return NULL;
+  }
+
+  return slot_p;
+} /* ecma_inline_cache_get_slot */
+
+/**
+ * Lookup a property in an inline cache slot.
+ *
+ * @return pointer to the property - if the property of the object is cached by the slot
+ *         NULL - otherwise
+ */
+inline ecma_property_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_inline_cache_lookup (ecma_inline_cache_slot_t *slot_p, /**< slot */
+                          const ecma_object_t *object_p, /**< object */
+                          const ecma_string_t *name_p) /**< property name */
+{
+  JERRY_ASSERT (slot_p != NULL && object_p != NULL && name_p != NULL);
+
+  jmem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  jmem_cpointer_t name_cp;
+  ecma_property_t name_type = ecma_inline_cache_get_name (name_p, &name_cp);
+
+  for (uint32_t i = 0; i < ECMA_INLINE_CACHE_SLOT_LENGTH; i++)
+  {
+    if (slot_p->object_cp[i] == object_cp
+        && slot_p->name_cp[i] == name_cp
+        && JERRY_LIKELY (slot_p->prop_p[i] != NULL)
+        && JERRY_LIKELY (ECMA_PROPERTY_GET_NAME_TYPE (*slot_p->prop_p[i]) == name_type))
+    {
+      return slot_p->prop_p[i];
+    }
+  }
+
+  slot_p->misses++;
+  return NULL;
+} /* ecma_inline_cache_lookup */
+
+/**
+ * Make room for a new entry at the start of an inline cache slot.
+ *
+ * Note:
+ *      the least recently inserted entry is evicted when the slot is full
+ */
+static void
+ecma_inline_cache_shift (ecma_inline_cache_slot_t *slot_p) /**< slot */
+{
+  for (uint32_t i = ECMA_INLINE_CACHE_SLOT_LENGTH - 1; i > 0; i--)
+  {
+    slot_p->prop_p[i] = slot_p->prop_p[i - 1];
+    slot_p->object_cp[i] = slot_p->object_cp[i - 1];
+    slot_p->name_cp[i] = slot_p->name_cp[i - 1];
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+    slot_p->shape_index[i] = slot_p->shape_index[i - 1];
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+  }
+} /* ecma_inline_cache_shift */
+
+/**
+ * Insert a property into an inline cache slot.
+ */
+void
+ecma_inline_cache_insert (ecma_inline_cache_slot_t *slot_p, /**< slot */
+                          const ecma_object_t *object_p, /**< object */
+                          const ecma_string_t *name_p, /**< property name */
+                          ecma_property_t *prop_p) /**< property of the object */
+{
+  JERRY_ASSERT (slot_p != NULL && object_p != NULL && name_p != NULL);
+  JERRY_ASSERT (prop_p != NULL && ECMA_PROPERTY_GET_TYPE (*prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
+
+  ecma_inline_cache_shift (slot_p);
+
+  slot_p->prop_p[0] = prop_p;
+  ECMA_SET_NON_NULL_POINTER (slot_p->object_cp[0], object_p);
+  ecma_inline_cache_get_name (name_p, slot_p->name_cp + 0);
+} /* ecma_inline_cache_insert */
+
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+
+/**
+ * Lookup a property of a shape in an inline cache slot.
+ *
+ * Shape entries are shared by every object of the shape, since the objects
+ * store the value of a property at the same index.
+ *
+ * @return index of the property value - if the property of the shape is cached by the slot
+ *         ECMA_SHAPE_PROPERTY_NOT_FOUND - otherwise
+ */
+uint32_t
+ecma_inline_cache_lookup_shape (ecma_inline_cache_slot_t *slot_p, /**< slot */
+                                const ecma_shape_t *shape_p, /**< shape */
+                                const ecma_string_t *name_p) /**< property name */
+{
+  JERRY_ASSERT (slot_p != NULL && shape_p != NULL && name_p != NULL);
+
+  jmem_cpointer_t shape_cp;
+  ECMA_SET_NON_NULL_POINTER (shape_cp, shape_p);
+
+  jmem_cpointer_t name_cp;
+  ecma_property_t name_type = ecma_inline_cache_get_name (name_p, &name_cp);
+
+  for (uint32_t i = 0; i < ECMA_INLINE_CACHE_SLOT_LENGTH; i++)
+  {
+    if (slot_p->object_cp[i] == shape_cp
+        && slot_p->name_cp[i] == name_cp
+        && JERRY_LIKELY (slot_p->prop_p[i] == NULL))
+    {
+      uint32_t index = slot_p->shape_index[i];
+      jmem_cpointer_t shape_name_cp;
+      ecma_property_t shape_name_type = ecma_shape_get_property_name (shape_p, index, &shape_name_cp);
+
+      if (JERRY_LIKELY (ECMA_PROPERTY_GET_NAME_TYPE (shape_name_type) == name_type))
+      {
+        JERRY_ASSERT (shape_name_cp == name_cp);
+        return index;
+      }
+    }
+  }
+
+  slot_p->misses++;
+  return ECMA_SHAPE_PROPERTY_NOT_FOUND;
+} /* ecma_inline_cache_lookup_shape */
+
+/**
+ * Insert a property of a shape into an inline cache slot.
+ */
+void
+ecma_inline_cache_insert_shape (ecma_inline_cache_slot_t *slot_p, /**< slot */
+                                const ecma_shape_t *shape_p, /**< shape */
+                                const ecma_string_t *name_p, /**< property name */
+                                uint32_t index) /**< index of the property value */
+{
+  JERRY_ASSERT (slot_p != NULL && shape_p != NULL && name_p != NULL);
+  JERRY_ASSERT (index < shape_p->property_count);
+
+  ecma_inline_cache_shift (slot_p);
+
+  slot_p->prop_p[0] = NULL;
+  ECMA_SET_NON_NULL_POINTER (slot_p->object_cp[0], shape_p);
+  ecma_inline_cache_get_name (name_p, slot_p->name_cp + 0);
+  slot_p->shape_index[0] = (uint8_t) index;
+} /* ecma_inline_cache_insert_shape */
+
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
+/**
+ * Invalidate every inline cache.
+ *
+ * Must be called before a property is deleted or its storage is freed, since the
+ * inline caches store direct pointers to the properties. The inline caches are
+ * cleared lazily, the next time they are used.
+ */
+void
+ecma_inline_cache_invalidate (void)
+{
+  if (JERRY_LIKELY (++JERRY_CONTEXT (inline_cache_epoch) != 0))
+  {
+    return;
+  }
+
+  /* The epoch wrapped around, so old epochs cannot be told apart from new ones. */
+  for (uint32_t i = 0; i < JERRY_CONTEXT (inline_cache_bucket_count); i++)
+  {
+    ecma_inline_cache_t *cache_p = JERRY_CONTEXT (inline_cache_buckets_p)[i];
+
+    while (cache_p != NULL)
+    {
+      ecma_inline_cache_clear (cache_p);
+      cache_p = cache_p->next_p;
+    }
+  }
+} /* ecma_inline_cache_invalidate */
+
+/**
+ * Free the inline cache of a byte code, if it has one.
+ */
+void
+ecma_inline_cache_free (const ecma_compiled_code_t *bytecode_p) /**< byte code */
+{
+  if (JERRY_CONTEXT (inline_cache_bucket_count) == 0)
+  {
+    return;
+  }
+
+  ecma_inline_cache_t **cache_p_p;
+  cache_p_p = JERRY_CONTEXT (inline_cache_buckets_p) + ecma_inline_cache_bucket_index (bytecode_p);
+
+  while (*cache_p_p != NULL)
+  {
+    ecma_inline_cache_t *cache_p = *cache_p_p;
+
+    if (cache_p->bytecode_p == bytecode_p)
+    {
+      *cache_p_p = cache_p->next_p;
+      JERRY_CONTEXT (inline_cache_count)--;
+
+      jmem_heap_free_block (cache_p->slots_p, cache_p->size * sizeof (ecma_inline_cache_slot_t));
+      jmem_heap_free_block (cache_p, sizeof (ecma_inline_cache_t));
+      return;
+    }
+
+    cache_p_p = &cache_p->next_p;
+  }
+} /* ecma_inline_cache_free */
+
+/**
+ * Free the remaining inline caches, which belong to static byte codes.
+ */
+void
+ecma_finalize_inline_cache (void)
+{
+  uint32_t bucket_count = JERRY_CONTEXT (inline_cache_bucket_count);
+
+  if (bucket_count == 0)
+  {
+    return;
+  }
+
+  for (uint32_t i = 0; i < bucket_count; i++)
+  {
+    ecma_inline_cache_t *cache_p = JERRY_CONTEXT (inline_cache_buckets_p)[i];
+
+    while (cache_p != NULL)
+    {
+      ecma_inline_cache_t *next_p = cache_p->next_p;
+
+      jmem_heap_free_block (cache_p->slots_p, cache_p->size * sizeof (ecma_inline_cache_slot_t));
+      jmem_heap_free_block (cache_p, sizeof (ecma_inline_cache_t));
+      cache_p = next_p;
+    }
+  }
+
+  jmem_heap_free_block (JERRY_CONTEXT (inline_cache_buckets_p), bucket_count * sizeof (ecma_inline_cache_t *));
+  JERRY_CONTEXT (inline_cache_buckets_p) = NULL;
+  JERRY_CONTEXT (inline_cache_bucket_count) = 0;
+  JERRY_CONTEXT (inline_cache_count) = 0;
+} /* ecma_finalize_inline_cache */
+
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,52 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_INLINE_CACHE_H
+#define ECMA_INLINE_CACHE_H
+
+#include "ecma-shape.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmainlinecache Inline caches of property accesses
+ * @{
+ */
+
+#if ENABLED (JERRY_INLINE_CACHE)
+ecma_inline_cache_t *ecma_inline_cache_get (const ecma_compiled_code_t *bytecode_p);
+ecma_inline_cache_slot_t *ecma_inline_cache_get_slot (ecma_inline_cache_t *cache_p, uint32_t site);
+ecma_property_t *ecma_inline_cache_lookup (ecma_inline_cache_slot_t *slot_p, const ecma_object_t *object_p,
+                                           const ecma_string_t *name_p);
+void ecma_inline_cache_insert (ecma_inline_cache_slot_t *slot_p, const ecma_object_t *object_p,
+                               const ecma_string_t *name_p, ecma_property_t *prop_p);
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+uint32_t ecma_inline_cache_lookup_shape (ecma_inline_cache_slot_t *slot_p, const ecma_shape_t *shape_p,
+                                         const ecma_string_t *name_p);
+void ecma_inline_cache_insert_shape (ecma_inline_cache_slot_t *slot_p, const ecma_shape_t *shape_p,
+                                     const ecma_string_t *name_p, uint32_t index);
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+void ecma_inline_cache_invalidate (void);
+void ecma_inline_cache_free (const ecma_compiled_code_t *bytecode_p);
+void ecma_finalize_inline_cache (void);
+
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_INLINE_CACHE_H */
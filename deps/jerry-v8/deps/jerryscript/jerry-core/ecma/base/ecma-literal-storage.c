@@ -109,6 +109,23 @@ ecma_free_number_list (jmem_cpointer_t number_list_cp) /**< string list */
   }
 } /* ecma_free_number_list */
 
+/**
+ * Initial number of buckets of a literal hash table
+ */
+#define ECMA_LIT_HASH_TABLE_INITIAL_SIZE 64
+
+/**
+ * Free the buckets of a literal hash table
+ */
+static void
+ecma_lit_hash_table_free (ecma_lit_hash_table_t *table_p) /**< hash table */
+{
+  if (table_p->buckets_p != NULL)
+  {
+    jmem_heap_free_block (table_p->buckets_p, table_p->size * sizeof (jmem_cpointer_t));
+  }
+} /* ecma_lit_hash_table_free */
+
 /**
  * Finalize literal storage
  */
@@ -120,78 +137,191 @@ ecma_finalize_lit_storage (void)
 #endif /* ENABLED (JERRY_ESNEXT) */
   ecma_free_string_list (JERRY_CONTEXT (string_list_first_cp));
   ecma_free_number_list (JERRY_CONTEXT (number_list_first_cp));
+  ecma_lit_hash_table_free (&JERRY_CONTEXT (string_hash_table));
+  ecma_lit_hash_table_free (&JERRY_CONTEXT (number_hash_table));
 } /* ecma_finalize_lit_storage */
 
 /**
- * Find or create a literal string.
+ * Calculate the hash of a literal number
  *
- * @return ecma_string_t compressed pointer
+ * @return hash of the number
  */
-ecma_value_t
-ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string to be searched */
-                                    lit_utf8_size_t size) /**< size of the string */
+static uint32_t
+ecma_lit_number_hash (ecma_number_t number) /**< number */
 {
-  ecma_string_t *string_p = ecma_new_ecma_string_from_utf8 (chars_p, size);
+  /* Positive and negative zero are equal. */
+  if (number == 0)
+  {
+    return 0;
+  }
 
-  if (ECMA_IS_DIRECT_STRING (string_p))
+  const uint8_t *bytes_p = (const uint8_t *) &number;
+  uint32_t hash = 2166136261u;
+
+  /* FNV-1a */
+  for (uint32_t i = 0; i < sizeof (ecma_number_t); i++)
   {
-    return ecma_make_string_value (string_p);
+    hash = (hash ^ bytes_p[i]) * 16777619u;
   }
 
-  jmem_cpointer_t string_list_cp = JERRY_CONTEXT (string_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
+  return hash;
+} /* ecma_lit_number_hash */
 
-  while (string_list_cp != JMEM_CP_NULL)
+/**
+ * Calculate the hash of a value stored in a literal hash table
+ *
+ * @return hash of the value
+ */
+static uint32_t
+ecma_lit_hash_table_value_hash (const ecma_lit_hash_table_t *table_p, /**< hash table */
+                                jmem_cpointer_t value_cp) /**< stored value */
+{
+  if (table_p == &JERRY_CONTEXT (number_hash_table))
   {
-    ecma_lit_storage_item_t *string_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, string_list_cp);
+    return ecma_lit_number_hash (*JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, value_cp));
+  }
 
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+  return ecma_string_hash (JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, value_cp));
+} /* ecma_lit_hash_table_value_hash */
+
+/**
+ * Insert a value into a literal hash table, and grow the table when it
+ * is three quarters full.
+ */
+static void
+ecma_lit_hash_table_insert (ecma_lit_hash_table_t *table_p, /**< hash table */
+                            jmem_cpointer_t value_cp, /**< value to be inserted */
+                            uint32_t hash) /**< hash of the value */
+{
+  if ((table_p->count + 1) * 4 > table_p->size * 3)
+  {
+    jmem_cpointer_t *old_buckets_p = table_p->buckets_p;
+    uint32_t old_size = table_p->size;
+    uint32_t new_size = (old_size == 0) ? ECMA_LIT_HASH_TABLE_INITIAL_SIZE : (old_size << 1);
+    size_t buckets_size = new_size * sizeof (jmem_cpointer_t);
+
+    table_p->buckets_p = (jmem_cpointer_t *) jmem_heap_alloc_block (buckets_size);
+    table_p->size = new_size;
+    memset (table_p->buckets_p, 0, buckets_size);
+
+    for (uint32_t i = 0; i < old_size; i++)
     {
-      if (string_list_p->values[i] == JMEM_CP_NULL)
-      {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = string_list_p->values + i;
-        }
-      }
-      else
+      if (old_buckets_p[i] != JMEM_CP_NULL)
       {
-        ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t,
-                                                               string_list_p->values[i]);
+        uint32_t index = ecma_lit_hash_table_value_hash (table_p, old_buckets_p[i]) & (new_size - 1);
 
-        if (ecma_compare_ecma_strings (string_p, value_p))
+        while (table_p->buckets_p[index] != JMEM_CP_NULL)
         {
-          /* Return with string if found in the list. */
-          ecma_deref_ecma_string (string_p);
-          return ecma_make_string_value (value_p);
+          index = (index + 1) & (new_size - 1);
         }
+
+        table_p->buckets_p[index] = old_buckets_p[i];
       }
     }
 
-    string_list_cp = string_list_p->next_cp;
+    if (old_buckets_p != NULL)
+    {
+      jmem_heap_free_block (old_buckets_p, old_size * sizeof (jmem_cpointer_t));
+    }
   }
 
-  ECMA_SET_STRING_AS_STATIC (string_p);
-  jmem_cpointer_t result;
-  JMEM_CP_SET_NON_NULL_POINTER (result, string_p);
+  uint32_t mask = table_p->size - 1;
+  uint32_t index = hash & mask;
 
-  if (empty_cpointer_p != NULL)
+  while (table_p->buckets_p[index] != JMEM_CP_NULL)
   {
-    *empty_cpointer_p = result;
-    return ecma_make_string_value (string_p);
+    index = (index + 1) & mask;
+  }
+
+  table_p->buckets_p[index] = value_cp;
+  table_p->count++;
+} /* ecma_lit_hash_table_insert */
+
+/**
+ * Append a value to a literal storage list
+ *
+ * Note:
+ *      values are never removed from the list, so only the first item may have empty slots
+ */
+static void
+ecma_lit_storage_append (jmem_cpointer_t *list_first_cp_p, /**< [in,out] first item of the list */
+                         jmem_cpointer_t value_cp) /**< value to be appended */
+{
+  JERRY_STATIC_ASSERT (sizeof (ecma_lit_storage_item_t) == sizeof (ecma_number_storage_item_t),
+                       literal_storage_items_must_have_the_same_layout);
+
+  if (*list_first_cp_p != JMEM_CP_NULL)
+  {
+    ecma_lit_storage_item_t *item_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, *list_first_cp_p);
+
+    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      if (item_p->values[i] == JMEM_CP_NULL)
+      {
+        item_p->values[i] = value_cp;
+        return;
+      }
+    }
   }
 
   ecma_lit_storage_item_t *new_item_p;
   new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
 
-  new_item_p->values[0] = result;
+  new_item_p->values[0] = value_cp;
   for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
   {
     new_item_p->values[i] = JMEM_CP_NULL;
   }
 
-  new_item_p->next_cp = JERRY_CONTEXT (string_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (string_list_first_cp), new_item_p);
+  new_item_p->next_cp = *list_first_cp_p;
+  JMEM_CP_SET_NON_NULL_POINTER (*list_first_cp_p, new_item_p);
+} /* ecma_lit_storage_append */
+
+/**
+ * Find or create a literal string.
+ *
+ * @return ecma_string_t compressed pointer
+ */
+ecma_value_t
+ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string to be searched */
+                                    lit_utf8_size_t size) /**< size of the string */
+{
+  ecma_string_t *string_p = ecma_new_ecma_string_from_utf8 (chars_p, size);
+
+  if (ECMA_IS_DIRECT_STRING (string_p))
+  {
+    return ecma_make_string_value (string_p);
+  }
+
+  ecma_lit_hash_table_t *table_p = &JERRY_CONTEXT (string_hash_table);
+  uint32_t hash = ecma_string_hash (string_p);
+
+  if (table_p->buckets_p != NULL)
+  {
+    uint32_t mask = table_p->size - 1;
+    uint32_t index = hash & mask;
+
+    while (table_p->buckets_p[index] != JMEM_CP_NULL)
+    {
+      ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, table_p->buckets_p[index]);
+
+      if (ecma_compare_ecma_strings (string_p, value_p))
+      {
+        /* Return with string if found in the table. */
+        ecma_deref_ecma_string (string_p);
+        return ecma_make_string_value (value_p);
+      }
+
+      index = (index + 1) & mask;
+    }
+  }
+
+  ECMA_SET_STRING_AS_STATIC (string_p);
+  jmem_cpointer_t result;
+  JMEM_CP_SET_NON_NULL_POINTER (result, string_p);
+
+  ecma_lit_storage_append (&JERRY_CONTEXT (string_list_first_cp), result);
+  ecma_lit_hash_table_insert (table_p, result, hash);
 
   return ecma_make_string_value (string_p);
 } /* ecma_find_or_create_literal_string */
@@ -211,39 +341,35 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
     return num;
   }
 
+#if ENABLED (JERRY_VALUE_64_BIT)
+  if (ecma_is_value_direct_float_number (num))
+  {
+    return num;
+  }
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+
   JERRY_ASSERT (ecma_is_value_float_number (num));
 
-  jmem_cpointer_t number_list_cp = JERRY_CONTEXT (number_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
+  ecma_lit_hash_table_t *table_p = &JERRY_CONTEXT (number_hash_table);
+  uint32_t hash = ecma_lit_number_hash (number_arg);
 
-  while (number_list_cp != JMEM_CP_NULL)
+  if (table_p->buckets_p != NULL)
   {
-    ecma_number_storage_item_t *number_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_storage_item_t,
-                                                                              number_list_cp);
+    uint32_t mask = table_p->size - 1;
+    uint32_t index = hash & mask;
 
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    while (table_p->buckets_p[index] != JMEM_CP_NULL)
     {
-      if (number_list_p->values[i] == JMEM_CP_NULL)
+      ecma_number_t *number_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, table_p->buckets_p[index]);
+
+      if (*number_p == number_arg)
       {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = number_list_p->values + i;
-        }
+        ecma_free_value (num);
+        return ecma_make_float_value (number_p);
       }
-      else
-      {
-        ecma_number_t *number_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t,
-                                                                number_list_p->values[i]);
 
-        if (*number_p == number_arg)
-        {
-          ecma_free_value (num);
-          return ecma_make_float_value (number_p);
-        }
-      }
+      index = (index + 1) & mask;
     }
-
-    number_list_cp = number_list_p->next_cp;
   }
 
   ecma_number_t *num_p = ecma_get_pointer_from_float_value (num);
@@ -251,23 +377,8 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
   jmem_cpointer_t result;
   JMEM_CP_SET_NON_NULL_POINTER (result, num_p);
 
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
-    return num;
-  }
-
-  ecma_number_storage_item_t *new_item_p;
-  new_item_p = (ecma_number_storage_item_t *) jmem_pools_alloc (sizeof (ecma_number_storage_item_t));
-
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
-  }
-
-  new_item_p->next_cp = JERRY_CONTEXT (number_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (number_list_first_cp), new_item_p);
+  ecma_lit_storage_append (&JERRY_CONTEXT (number_list_first_cp), result);
+  ecma_lit_hash_table_insert (table_p, result, hash);
 
   return num;
 } /* ecma_find_or_create_literal_number */
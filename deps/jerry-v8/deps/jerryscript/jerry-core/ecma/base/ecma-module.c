@@ -22,6 +22,7 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lex-env.h"
+#include "ecma-literal-storage.h"
 #include "ecma-module.h"
 #include "ecma-objects.h"
 #include "lit-char-helpers.h"
@@ -877,11 +878,20 @@ ecma_module_parse (ecma_module_t *module_p) /**< module */
   }
 #endif /* ENABLED (JERRY_DEBUGGER) && ENABLED (JERRY_PARSER) */
 
+  ecma_value_t resource_name = ecma_make_magic_string_value (LIT_MAGIC_STRING_RESOURCE_ANON);
+
+#if ENABLED (JERRY_RESOURCE_NAME)
+  /* The byte code may outlive the module (e.g. in a backtrace), so its resource name is a literal. */
+  ECMA_STRING_TO_UTF8_STRING (module_p->path_p, path_str_p, path_str_size);
+  resource_name = ecma_find_or_create_literal_string (path_str_p, path_str_size);
+  ECMA_FINALIZE_UTF8_STRING (path_str_p, path_str_size);
+#endif /* ENABLED (JERRY_RESOURCE_NAME) */
+
   ecma_compiled_code_t *bytecode_p = parser_parse_script (NULL,
                                                           0,
                                                           (jerry_char_t *) source_p,
                                                           source_size,
-                                                          ecma_make_string_value (module_p->path_p),
+                                                          resource_name,
                                                           ECMA_PARSE_STRICT_MODE | ECMA_PARSE_MODULE);
 
   JERRY_CONTEXT (module_top_context_p) = module_p->context_p->parent_p;
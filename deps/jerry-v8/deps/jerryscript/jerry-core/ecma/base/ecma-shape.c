@@ -0,0 +1,842 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-inline-cache.h"
+#include "ecma-shape.h"
+#include "jcontext.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Hidden classes of ordinary objects
+ * @{
+ */
+
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+
+/**
+ * Initial number of buckets of the transition table.
+ */
+#define ECMA_SHAPE_INITIAL_BUCKETS 64
+
+/**
+ * Initial number of names of a names table.
+ */
+#define ECMA_SHAPE_NAMES_INITIAL_SIZE 4
+
+/**
+ * Minimum number of unused shapes which are freed by the garbage collector.
+ */
+#define ECMA_SHAPE_UNUSED_LIMIT 64
+
+/**
+ * Size of a names table in bytes.
+ *
+ * @return size of the names table
+ */
+static inline size_t JERRY_ATTR_ALWAYS_INLINE
+ecma_shape_names_size (uint32_t size) /**< maximum number of names */
+{
+  return sizeof (ecma_shape_names_t) + size * (sizeof (jmem_cpointer_t) + sizeof (ecma_property_t));
+} /* ecma_shape_names_size */
+
+/**
+ * Size of the property values of a shaped object in bytes.
+ *
+ * @return size of the property values
+ */
+static inline size_t JERRY_ATTR_ALWAYS_INLINE
+ecma_shape_values_size (uint32_t capacity) /**< number of allocated values */
+{
+  return sizeof (ecma_shape_values_t) + capacity * sizeof (ecma_property_value_t);
+} /* ecma_shape_values_size */
+
+/**
+ * Compute the number of values which are allocated for a shaped object,
+ * rounded up so the size of the block is a multiple of JMEM_ALIGNMENT.
+ *
+ * @return number of values
+ */
+static uint32_t
+ecma_shape_get_capacity (uint32_t count) /**< minimum number of values */
+{
+  size_t size = JERRY_ALIGNUP (ecma_shape_values_size (count), JMEM_ALIGNMENT);
+  return (uint32_t) ((size - sizeof (ecma_shape_values_t)) / sizeof (ecma_property_value_t));
+} /* ecma_shape_get_capacity */
+
+/**
+ * Get the property names of a shape.
+ *
+ * @return names table of the shape
+ */
+static inline ecma_shape_names_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_shape_get_names (const ecma_shape_t *shape_p) /**< shape */
+{
+  return ECMA_GET_NON_NULL_POINTER (ecma_shape_names_t, shape_p->names_cp);
+} /* ecma_shape_get_names */
+
+/**
+ * Compute the bucket index of a transition.
+ *
+ * @return bucket index
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_shape_bucket_index (jmem_cpointer_t parent_cp, /**< parent shape */
+                         lit_string_hash_t hash) /**< hash of the property name */
+{
+  return ((uint32_t) parent_cp * 31u + hash) & (JERRY_CONTEXT (shape_bucket_count) - 1);
+} /* ecma_shape_bucket_index */
+
+/**
+ * Compute the bucket index of a shape.
+ *
+ * @return bucket index
+ */
+static uint32_t
+ecma_shape_get_bucket_index (const ecma_shape_t *shape_p) /**< shape */
+{
+  ecma_shape_names_t *names_p = ecma_shape_get_names (shape_p);
+  uint32_t index = (uint32_t) shape_p->property_count - 1;
+  lit_string_hash_t hash = ecma_string_get_property_name_hash (ECMA_SHAPE_NAME_TYPES (names_p)[index],
+                                                               ECMA_SHAPE_NAMES_CP (names_p)[index]);
+
+  return ecma_shape_bucket_index (shape_p->parent_cp, hash);
+} /* ecma_shape_get_bucket_index */
+
+/**
+ * Increase the reference counter of a shape.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_shape_ref (ecma_shape_t *shape_p) /**< shape */
+{
+  if (shape_p->refs++ == 0)
+  {
+    JERRY_CONTEXT (shape_unused_count)--;
+  }
+} /* ecma_shape_ref */
+
+/**
+ * Decrease the reference counter of a shape.
+ *
+ * Note:
+ *      unused shapes are kept in the transition table until
+ *      the garbage collector frees them
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_shape_deref (ecma_shape_t *shape_p) /**< shape */
+{
+  JERRY_ASSERT (shape_p->refs > 0);
+
+  if (--shape_p->refs == 0)
+  {
+    JERRY_CONTEXT (shape_unused_count)++;
+  }
+} /* ecma_shape_deref */
+
+/**
+ * Free a names table.
+ */
+static void
+ecma_shape_free_names (ecma_shape_names_t *names_p) /**< names table */
+{
+  jmem_cpointer_t *names_cp_p = ECMA_SHAPE_NAMES_CP (names_p);
+  ecma_property_t *name_types_p = ECMA_SHAPE_NAME_TYPES (names_p);
+
+  for (uint32_t i = 0; i < names_p->count; i++)
+  {
+    if (ECMA_PROPERTY_GET_NAME_TYPE (name_types_p[i]) == ECMA_DIRECT_STRING_PTR)
+    {
+      ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_cp_p[i]));
+    }
+  }
+
+  size_t size = ecma_shape_names_size (names_p->size);
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_free_property_bytes (size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  jmem_heap_free_block (names_p, size);
+} /* ecma_shape_free_names */
+
+/**
+ * Find the index of a property in a shape.
+ *
+ * @return index of the property - if the shape has the property
+ *         ECMA_SHAPE_PROPERTY_NOT_FOUND - otherwise
+ */
+uint32_t
+ecma_shape_find_property (const ecma_shape_t *shape_p, /**< shape */
+                          const ecma_string_t *name_p) /**< property name */
+{
+  ecma_shape_names_t *names_p = ecma_shape_get_names (shape_p);
+  jmem_cpointer_t *names_cp_p = ECMA_SHAPE_NAMES_CP (names_p);
+  ecma_property_t *name_types_p = ECMA_SHAPE_NAME_TYPES (names_p);
+  uint32_t count = shape_p->property_count;
+
+  if (ECMA_IS_DIRECT_STRING (name_p))
+  {
+    ecma_property_t name_type = (ecma_property_t) ECMA_GET_DIRECT_STRING_TYPE (name_p);
+    jmem_cpointer_t name_cp = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (name_p);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+      if (names_cp_p[i] == name_cp
+          && ECMA_PROPERTY_GET_NAME_TYPE (name_types_p[i]) == name_type)
+      {
+        return i;
+      }
+    }
+
+    return ECMA_SHAPE_PROPERTY_NOT_FOUND;
+  }
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    if (ECMA_PROPERTY_GET_NAME_TYPE (name_types_p[i]) == ECMA_DIRECT_STRING_PTR
+        && ecma_compare_ecma_non_direct_strings (name_p, ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_cp_p[i])))
+    {
+      return i;
+    }
+  }
+
+  return ECMA_SHAPE_PROPERTY_NOT_FOUND;
+} /* ecma_shape_find_property */
+
+/**
+ * Get the property name of a shape.
+ *
+ * @return property name type (see ecma_string_to_property_name)
+ */
+ecma_property_t
+ecma_shape_get_property_name (const ecma_shape_t *shape_p, /**< shape */
+                              uint32_t index, /**< index of the property */
+                              jmem_cpointer_t *name_cp_p) /**< [out] property name */
+{
+  JERRY_ASSERT (index < shape_p->property_count);
+
+  ecma_shape_names_t *names_p = ecma_shape_get_names (shape_p);
+
+  *name_cp_p = ECMA_SHAPE_NAMES_CP (names_p)[index];
+  return ECMA_SHAPE_NAME_TYPES (names_p)[index];
+} /* ecma_shape_get_property_name */
+
+/**
+ * Find the shape which is created by adding a property to a shape.
+ *
+ * @return pointer to the shape - if the transition exists
+ *         NULL - otherwise
+ */
+static ecma_shape_t *
+ecma_shape_find_transition (jmem_cpointer_t parent_cp, /**< parent shape */
+                            const ecma_string_t *name_p, /**< property name */
+                            lit_string_hash_t hash) /**< hash of the property name */
+{
+  if (JERRY_CONTEXT (shape_bucket_count) == 0)
+  {
+    return NULL;
+  }
+
+  jmem_cpointer_t shape_cp = JERRY_CONTEXT (shape_buckets_p)[ecma_shape_bucket_index (parent_cp, hash)];
+
+  while (shape_cp != JMEM_CP_NULL)
+  {
+    ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_cp);
+
+    if (shape_p->parent_cp == parent_cp)
+    {
+      jmem_cpointer_t name_cp;
+      ecma_property_t name_type = ecma_shape_get_property_name (shape_p,
+                                                                (uint32_t) shape_p->property_count - 1,
+                                                                &name_cp);
+
+      if (ecma_string_compare_to_property_name (name_type, name_cp, name_p))
+      {
+        return shape_p;
+      }
+    }
+
+    shape_cp = shape_p->next_cp;
+  }
+
+  return NULL;
+} /* ecma_shape_find_transition */
+
+/**
+ * Insert a shape into the transition table.
+ */
+static void
+ecma_shape_link (ecma_shape_t *shape_p) /**< shape */
+{
+  uint32_t index = ecma_shape_get_bucket_index (shape_p);
+
+  shape_p->next_cp = JERRY_CONTEXT (shape_buckets_p)[index];
+  ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (shape_buckets_p)[index], shape_p);
+} /* ecma_shape_link */
+
+/**
+ * Double the number of buckets of the transition table.
+ */
+static void
+ecma_shape_grow_buckets (void)
+{
+  uint32_t old_count = JERRY_CONTEXT (shape_bucket_count);
+  uint32_t new_count = (old_count == 0) ? ECMA_SHAPE_INITIAL_BUCKETS : (old_count << 1);
+  jmem_cpointer_t *new_buckets_p;
+
+  new_buckets_p = jmem_heap_alloc_block_null_on_error (new_count * sizeof (jmem_cpointer_t));
+
+  if (new_buckets_p == NULL)
+  {
+    return;
+  }
+
+  /* The allocation might run the garbage collector, which frees
+   * the unused shapes, so the buckets are only read after it. */
+  jmem_cpointer_t *old_buckets_p = JERRY_CONTEXT (shape_buckets_p);
+  old_count = JERRY_CONTEXT (shape_bucket_count);
+
+  memset (new_buckets_p, 0, new_count * sizeof (jmem_cpointer_t));
+  JERRY_CONTEXT (shape_buckets_p) = new_buckets_p;
+  JERRY_CONTEXT (shape_bucket_count) = new_count;
+
+  for (uint32_t i = 0; i < old_count; i++)
+  {
+    jmem_cpointer_t shape_cp = old_buckets_p[i];
+
+    while (shape_cp != JMEM_CP_NULL)
+    {
+      ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_cp);
+      shape_cp = shape_p->next_cp;
+      ecma_shape_link (shape_p);
+    }
+  }
+
+  if (old_buckets_p != NULL)
+  {
+    jmem_heap_free_block (old_buckets_p, old_count * sizeof (jmem_cpointer_t));
+  }
+} /* ecma_shape_grow_buckets */
+
+/**
+ * Create the shape which is created by adding a property to a shape.
+ *
+ * @return pointer to the new shape, its reference counter is set to one - if the
+ *                                   shape can be inserted into the transition table
+ *         NULL - otherwise
+ */
+static ecma_shape_t *
+ecma_shape_create (ecma_shape_t *parent_p, /**< parent shape, NULL for the first property */
+                   ecma_string_t *name_p) /**< property name */
+{
+  /* Everything is allocated first, since the garbage collector might run during
+   * the allocations, and it must not see partially initialized shapes. */
+  if (JERRY_CONTEXT (shape_count) >= JERRY_CONTEXT (shape_bucket_count))
+  {
+    ecma_shape_grow_buckets ();
+
+    if (JERRY_CONTEXT (shape_bucket_count) == 0)
+    {
+      return NULL;
+    }
+  }
+
+  uint32_t count = 0;
+  ecma_shape_names_t *names_p = NULL;
+
+  if (parent_p != NULL)
+  {
+    count = parent_p->property_count;
+    names_p = ecma_shape_get_names (parent_p);
+
+    /* The table is shared if no other child has appended its name to it. */
+    if (names_p->count != count || count >= names_p->size)
+    {
+      names_p = NULL;
+    }
+  }
+
+  ecma_shape_names_t *new_names_p = NULL;
+
+  if (names_p == NULL)
+  {
+    uint32_t size = JERRY_MAX (count * 2, ECMA_SHAPE_NAMES_INITIAL_SIZE);
+    size = JERRY_MIN (size, ECMA_SHAPE_MAX_PROPERTY_COUNT);
+
+#if ENABLED (JERRY_MEM_STATS)
+    jmem_stats_allocate_property_bytes (ecma_shape_names_size (size));
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+    new_names_p = jmem_heap_alloc_block (ecma_shape_names_size (size));
+    new_names_p->refs = 0;
+    new_names_p->count = (uint8_t) count;
+    new_names_p->size = (uint8_t) size;
+  }
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_allocate_property_bytes (sizeof (ecma_shape_t));
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  ecma_shape_t *shape_p = jmem_heap_alloc_block (sizeof (ecma_shape_t));
+
+  if (new_names_p != NULL)
+  {
+    if (parent_p != NULL)
+    {
+      ecma_shape_names_t *parent_names_p = ecma_shape_get_names (parent_p);
+      jmem_cpointer_t *parent_names_cp_p = ECMA_SHAPE_NAMES_CP (parent_names_p);
+      ecma_property_t *parent_name_types_p = ECMA_SHAPE_NAME_TYPES (parent_names_p);
+
+      for (uint32_t i = 0; i < count; i++)
+      {
+        ECMA_SHAPE_NAMES_CP (new_names_p)[i] = parent_names_cp_p[i];
+        ECMA_SHAPE_NAME_TYPES (new_names_p)[i] = parent_name_types_p[i];
+
+        if (ECMA_PROPERTY_GET_NAME_TYPE (parent_name_types_p[i]) == ECMA_DIRECT_STRING_PTR)
+        {
+          ecma_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, parent_names_cp_p[i]));
+        }
+      }
+    }
+
+    names_p = new_names_p;
+  }
+
+  JERRY_ASSERT (names_p->count == count && count < names_p->size);
+
+  ecma_property_t name_type;
+  ECMA_SHAPE_NAMES_CP (names_p)[count] = ecma_string_to_property_name (name_p, &name_type);
+  ECMA_SHAPE_NAME_TYPES (names_p)[count] = name_type;
+  names_p->count = (uint8_t) (count + 1);
+  names_p->refs++;
+
+  if (parent_p != NULL)
+  {
+    ECMA_SET_NON_NULL_POINTER (shape_p->parent_cp, parent_p);
+    ecma_shape_ref (parent_p);
+  }
+  else
+  {
+    shape_p->parent_cp = JMEM_CP_NULL;
+  }
+
+  ECMA_SET_NON_NULL_POINTER (shape_p->names_cp, names_p);
+  shape_p->property_count = (uint8_t) (count + 1);
+  shape_p->refs = 1;
+
+  ecma_shape_link (shape_p);
+  JERRY_CONTEXT (shape_count)++;
+  return shape_p;
+} /* ecma_shape_create */
+
+/**
+ * Free a shape which is not used by any object or shape.
+ */
+static void
+ecma_shape_free (ecma_shape_t *shape_p) /**< shape */
+{
+  JERRY_ASSERT (shape_p->refs == 0);
+
+  ecma_shape_names_t *names_p = ecma_shape_get_names (shape_p);
+
+  if (names_p->count == shape_p->property_count)
+  {
+    /* The last name of the table belongs to this shape, the next child of the parent can reuse its entry. */
+    uint32_t index = names_p->count - 1u;
+
+    if (ECMA_PROPERTY_GET_NAME_TYPE (ECMA_SHAPE_NAME_TYPES (names_p)[index]) == ECMA_DIRECT_STRING_PTR)
+    {
+      ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, ECMA_SHAPE_NAMES_CP (names_p)[index]));
+    }
+
+    names_p->count--;
+  }
+
+  if (--names_p->refs == 0)
+  {
+    ecma_shape_free_names (names_p);
+  }
+
+  if (shape_p->parent_cp != JMEM_CP_NULL)
+  {
+    ecma_shape_deref (ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp));
+  }
+
+  JERRY_CONTEXT (shape_count)--;
+  JERRY_CONTEXT (shape_unused_count)--;
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_free_property_bytes (sizeof (ecma_shape_t));
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  jmem_heap_free_block (shape_p, sizeof (ecma_shape_t));
+} /* ecma_shape_free */
+
+/**
+ * Find the value of a property of a shaped object.
+ *
+ * @return pointer to the property value - if the object has the property
+ *         NULL - otherwise
+ */
+ecma_property_value_t *
+ecma_shape_find_property_value (ecma_object_t *object_p, /**< shaped object */
+                                ecma_string_t *name_p) /**< property name */
+{
+  JERRY_ASSERT (ECMA_OBJECT_HAS_SHAPE (object_p));
+
+  ecma_shape_values_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, object_p->u1.property_list_cp);
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, values_p->header.next_property_cp);
+  uint32_t index = ecma_shape_find_property (shape_p, name_p);
+
+  if (index == ECMA_SHAPE_PROPERTY_NOT_FOUND)
+  {
+    return NULL;
+  }
+
+  return ECMA_SHAPE_VALUES (values_p) + index;
+} /* ecma_shape_find_property_value */
+
+/**
+ * Add a writable, enumerable and configurable data property to an object
+ * which has no properties or is a shaped object.
+ *
+ * Note:
+ *      shaped objects are converted to normal objects when the property
+ *      cannot be added to their shape
+ *
+ * @return pointer to the value of the new property, which is set to undefined - if
+ *                                                     the object is a shaped object
+ *         NULL - otherwise
+ */
+ecma_property_value_t *
+ecma_shape_create_property (ecma_object_t *object_p, /**< the object */
+                            ecma_string_t *name_p) /**< property name */
+{
+  if (ecma_is_lexical_environment (object_p))
+  {
+    return NULL;
+  }
+
+  ecma_shape_values_t *values_p = NULL;
+  ecma_shape_t *shape_p = NULL;
+
+  if (object_p->u1.property_list_cp == JMEM_CP_NULL)
+  {
+    if (ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_GENERAL
+        || ecma_get_object_is_builtin (object_p))
+    {
+      return NULL;
+    }
+  }
+  else
+  {
+    if (!ECMA_OBJECT_HAS_SHAPE (object_p))
+    {
+      return NULL;
+    }
+
+    values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, object_p->u1.property_list_cp);
+    shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, values_p->header.next_property_cp);
+  }
+
+  /* Internal properties and symbols stored as magic strings are never enumerated, so they are not part of shapes. */
+  if ((ECMA_IS_DIRECT_STRING (name_p)
+       && ECMA_GET_DIRECT_STRING_TYPE (name_p) == ECMA_DIRECT_STRING_MAGIC
+       && ECMA_GET_DIRECT_STRING_VALUE (name_p) >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
+       && ECMA_GET_DIRECT_STRING_VALUE (name_p) < LIT_MAGIC_STRING__COUNT)
+      || (shape_p != NULL && shape_p->property_count >= ECMA_SHAPE_MAX_PROPERTY_COUNT))
+  {
+    if (shape_p != NULL)
+    {
+      ecma_shape_convert_to_normal (object_p, NULL);
+    }
+    return NULL;
+  }
+
+  jmem_cpointer_t parent_cp = JMEM_CP_NULL;
+
+  if (shape_p != NULL)
+  {
+    ECMA_SET_NON_NULL_POINTER (parent_cp, shape_p);
+  }
+
+  ecma_shape_t *new_shape_p = ecma_shape_find_transition (parent_cp, name_p, ecma_string_hash (name_p));
+
+  if (new_shape_p != NULL)
+  {
+    ecma_shape_ref (new_shape_p);
+  }
+  else
+  {
+    new_shape_p = ecma_shape_create (shape_p, name_p);
+
+    if (JERRY_UNLIKELY (new_shape_p == NULL))
+    {
+      if (shape_p != NULL)
+      {
+        ecma_shape_convert_to_normal (object_p, NULL);
+      }
+      return NULL;
+    }
+  }
+
+  uint32_t count = new_shape_p->property_count;
+  uint32_t capacity = (values_p != NULL) ? values_p->header.types[1] : 0;
+
+  if (count > capacity)
+  {
+    /* Grow by a single aligned unit: shapes have a few properties, and
+     * the block can often be extended in place. */
+    uint32_t new_capacity = ecma_shape_get_capacity (count);
+    size_t new_size = ecma_shape_values_size (new_capacity);
+
+#if ENABLED (JERRY_MEM_STATS)
+    jmem_stats_allocate_property_bytes (new_size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+    /* The new shape is referenced, so the garbage collector keeps it. */
+    if (values_p == NULL)
+    {
+      values_p = jmem_heap_alloc_block (new_size);
+      values_p->header.types[0] = ECMA_PROPERTY_TYPE_SHAPE;
+    }
+    else
+    {
+      size_t size = ecma_shape_values_size (capacity);
+
+#if ENABLED (JERRY_MEM_STATS)
+      jmem_stats_free_property_bytes (size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+      values_p = jmem_heap_realloc_block (values_p, size, new_size);
+    }
+
+    values_p->header.types[1] = (ecma_property_t) new_capacity;
+    ECMA_SET_NON_NULL_POINTER (object_p->u1.property_list_cp, values_p);
+  }
+
+  ecma_property_value_t *value_p = ECMA_SHAPE_VALUES (values_p) + count - 1;
+  value_p->value = ECMA_VALUE_UNDEFINED;
+  ECMA_SET_NON_NULL_POINTER (values_p->header.next_property_cp, new_shape_p);
+
+  if (shape_p != NULL)
+  {
+    ecma_shape_deref (shape_p);
+  }
+
+  return value_p;
+} /* ecma_shape_create_property */
+
+/**
+ * Move the properties of a shaped object into a property list.
+ *
+ * @return the new location of the property value - if prop_value_p is not NULL
+ *         NULL - otherwise
+ */
+ecma_property_value_t *
+ecma_shape_convert_to_normal (ecma_object_t *object_p, /**< shaped object */
+                              ecma_property_value_t *prop_value_p) /**< value of a property of the object
+                                                                    *   or NULL */
+{
+  JERRY_ASSERT (ECMA_OBJECT_HAS_SHAPE (object_p));
+
+  ecma_shape_values_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, object_p->u1.property_list_cp);
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, values_p->header.next_property_cp);
+  uint32_t count = shape_p->property_count;
+  uint32_t pair_count = (count + 1) / 2;
+  ecma_property_pair_t *pairs_p[(ECMA_SHAPE_MAX_PROPERTY_COUNT + 1) / 2];
+
+  JERRY_ASSERT (count > 0 && count <= ECMA_SHAPE_MAX_PROPERTY_COUNT);
+
+  /* The object keeps its values until every pair is allocated, since the
+   * garbage collector might run during the allocations. */
+  for (uint32_t i = 0; i < pair_count; i++)
+  {
+    pairs_p[i] = ecma_alloc_property_pair ();
+  }
+
+  values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, object_p->u1.property_list_cp);
+
+  ecma_shape_names_t *names_p = ecma_shape_get_names (shape_p);
+  ecma_property_value_t *shape_values_p = ECMA_SHAPE_VALUES (values_p);
+  ecma_property_value_t *result_p = NULL;
+
+  /* Same layout as the properties created by ecma_create_property: the last property
+   * is the first item of the list, and the second item of a pair is filled first. */
+  for (uint32_t i = 0; i < pair_count; i++)
+  {
+    ecma_property_pair_t *pair_p = pairs_p[i];
+
+    pair_p->header.next_property_cp = JMEM_CP_NULL;
+
+    if (i > 0)
+    {
+      ECMA_SET_NON_NULL_POINTER (pair_p->header.next_property_cp, pairs_p[i - 1]);
+    }
+
+    pair_p->header.types[0] = ECMA_PROPERTY_TYPE_DELETED;
+    pair_p->names_cp[0] = LIT_INTERNAL_MAGIC_STRING_DELETED;
+
+    for (uint32_t j = 0; j < ECMA_PROPERTY_PAIR_ITEM_COUNT; j++)
+    {
+      uint32_t index = i * ECMA_PROPERTY_PAIR_ITEM_COUNT + j;
+
+      if (index >= count)
+      {
+        break;
+      }
+
+      uint32_t item = 1 - j;
+      jmem_cpointer_t name_cp = ECMA_SHAPE_NAMES_CP (names_p)[index];
+      ecma_property_t name_type = ECMA_SHAPE_NAME_TYPES (names_p)[index];
+
+      if (ECMA_PROPERTY_GET_NAME_TYPE (name_type) == ECMA_DIRECT_STRING_PTR)
+      {
+        ecma_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, name_cp));
+      }
+
+      pair_p->header.types[item] = (ecma_property_t) (ECMA_SHAPE_PROPERTY_TYPE | name_type);
+      pair_p->names_cp[item] = name_cp;
+      pair_p->values[item] = shape_values_p[index];
+
+      if (shape_values_p + index == prop_value_p)
+      {
+        result_p = pair_p->values + item;
+      }
+    }
+  }
+
+  ECMA_SET_NON_NULL_POINTER (object_p->u1.property_list_cp, pairs_p[pair_count - 1]);
+
+  size_t size = ecma_shape_values_size (values_p->header.types[1]);
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_free_property_bytes (size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  jmem_heap_free_block (values_p, size);
+  ecma_shape_deref (shape_p);
+
+  JERRY_ASSERT (prop_value_p == NULL || result_p != NULL);
+  return result_p;
+} /* ecma_shape_convert_to_normal */
+
+/**
+ * Free the property values of a shaped object.
+ */
+void
+ecma_shape_free_values (ecma_object_t *object_p) /**< shaped object */
+{
+  JERRY_ASSERT (ECMA_OBJECT_HAS_SHAPE (object_p));
+
+  ecma_shape_values_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, object_p->u1.property_list_cp);
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, values_p->header.next_property_cp);
+  ecma_property_value_t *value_p = ECMA_SHAPE_VALUES (values_p);
+  ecma_property_value_t *value_end_p = value_p + shape_p->property_count;
+
+  while (value_p < value_end_p)
+  {
+    ecma_free_value_if_not_object (value_p->value);
+    value_p++;
+  }
+
+  size_t size = ecma_shape_values_size (values_p->header.types[1]);
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_free_property_bytes (size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  jmem_heap_free_block (values_p, size);
+  object_p->u1.property_list_cp = JMEM_CP_NULL;
+  ecma_shape_deref (shape_p);
+} /* ecma_shape_free_values */
+
+/**
+ * Free the shapes which are not used by any object or shape.
+ *
+ * Unused shapes are kept for a while, since new objects often get the shapes
+ * of the objects which were freed by the garbage collector.
+ */
+void
+ecma_shape_free_unused (bool is_forced) /**< free the unused shapes regardless of their number */
+{
+  uint32_t unused_count = JERRY_CONTEXT (shape_unused_count);
+
+  if (unused_count == 0
+      || (!is_forced
+          && (unused_count < ECMA_SHAPE_UNUSED_LIMIT || unused_count * 2 < JERRY_CONTEXT (shape_count))))
+  {
+    return;
+  }
+
+  /* Freeing a shape might make its parent unused, which is freed by the next iteration. */
+  while (JERRY_CONTEXT (shape_unused_count) > 0)
+  {
+    JERRY_ASSERT (JERRY_CONTEXT (shape_count) > 0);
+
+    for (uint32_t i = 0; i < JERRY_CONTEXT (shape_bucket_count); i++)
+    {
+      jmem_cpointer_t *shape_cp_p = JERRY_CONTEXT (shape_buckets_p) + i;
+
+      while (*shape_cp_p != JMEM_CP_NULL)
+      {
+        ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, *shape_cp_p);
+
+        if (shape_p->refs == 0)
+        {
+          *shape_cp_p = shape_p->next_cp;
+          ecma_shape_free (shape_p);
+          continue;
+        }
+
+        shape_cp_p = &shape_p->next_cp;
+      }
+    }
+  }
+
+#if ENABLED (JERRY_INLINE_CACHE)
+  /* The inline caches refer to shapes. */
+  ecma_inline_cache_invalidate ();
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+} /* ecma_shape_free_unused */
+
+/**
+ * Free the transition table.
+ */
+void
+ecma_finalize_shapes (void)
+{
+  ecma_shape_free_unused (true);
+
+  JERRY_ASSERT (JERRY_CONTEXT (shape_count) == 0);
+
+  if (JERRY_CONTEXT (shape_bucket_count) > 0)
+  {
+    jmem_heap_free_block (JERRY_CONTEXT (shape_buckets_p),
+                          JERRY_CONTEXT (shape_bucket_count) * sizeof (jmem_cpointer_t));
+    JERRY_CONTEXT (shape_buckets_p) = NULL;
+    JERRY_CONTEXT (shape_bucket_count) = 0;
+  }
+} /* ecma_finalize_shapes */
+
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
+/**
+ * @}
+ * @}
+ */
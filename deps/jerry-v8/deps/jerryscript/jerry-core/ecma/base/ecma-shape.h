@@ -0,0 +1,133 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_SHAPE_H
+#define ECMA_SHAPE_H
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Hidden classes of ordinary objects
+ * @{
+ */
+
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+
+/**
+ * Maximum number of properties of a shaped object.
+ */
+#define ECMA_SHAPE_MAX_PROPERTY_COUNT 32
+
+/**
+ * Property names of a shape, shared with its ancestors.
+ *
+ * A child shape appends its name to the table of its parent if no other
+ * shape has done it before, otherwise it copies the table.
+ */
+typedef struct
+{
+  uint16_t refs; /**< number of shapes which use the table */
+  uint8_t count; /**< number of names in the table */
+  uint8_t size; /**< maximum number of names */
+
+  /*
+   * The header is followed by size jmem_cpointer_t names
+   * and size ecma_property_t name types.
+   */
+} ecma_shape_names_t;
+
+/**
+ * Shape (hidden class) of ordinary objects.
+ *
+ * The properties of a shape are writable, enumerable and configurable data
+ * properties, their values are stored by the objects in insertion order.
+ */
+typedef struct ecma_shape_t
+{
+  jmem_cpointer_t parent_cp; /**< shape without the last property, JMEM_CP_NULL for the first property */
+  jmem_cpointer_t names_cp; /**< property names */
+  jmem_cpointer_t next_cp; /**< next shape in the same bucket of the transition table */
+  uint8_t property_count; /**< number of properties */
+  uint32_t refs; /**< number of objects and child shapes which use the shape */
+} ecma_shape_t;
+
+/**
+ * Property values of a shaped object.
+ *
+ * The header is placed at the start of the property list, its first type is
+ * ECMA_PROPERTY_TYPE_SHAPE, its second type is the number of allocated values,
+ * and the compressed pointer of the next property refers to the shape.
+ */
+typedef struct
+{
+  ecma_property_header_t header; /**< header of the property list */
+
+  /*
+   * The header is followed by the property values.
+   */
+} ecma_shape_values_t;
+
+/**
+ * Returns true if the property list of an object is stored in a shape.
+ */
+#define ECMA_OBJECT_HAS_SHAPE(object_p) \
+  ((object_p)->u1.property_list_cp != JMEM_CP_NULL \
+   && (ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, \
+                                  (object_p)->u1.property_list_cp)->types[0] == ECMA_PROPERTY_TYPE_SHAPE))
+
+/**
+ * Get the property names of a shape names table.
+ */
+#define ECMA_SHAPE_NAMES_CP(names_p) ((jmem_cpointer_t *) ((names_p) + 1))
+
+/**
+ * Get the property name types of a shape names table.
+ */
+#define ECMA_SHAPE_NAME_TYPES(names_p) ((ecma_property_t *) (ECMA_SHAPE_NAMES_CP (names_p) + (names_p)->size))
+
+/**
+ * Get the property values of a shaped object.
+ */
+#define ECMA_SHAPE_VALUES(values_p) ((ecma_property_value_t *) ((values_p) + 1))
+
+/**
+ * Property type and flags of the properties of a shape.
+ */
+#define ECMA_SHAPE_PROPERTY_TYPE \
+  ((ecma_property_t) (ECMA_PROPERTY_TYPE_NAMEDDATA | ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE))
+
+/**
+ * Value returned by ecma_shape_find_property when the property is not found.
+ */
+#define ECMA_SHAPE_PROPERTY_NOT_FOUND UINT32_MAX
+
+uint32_t ecma_shape_find_property (const ecma_shape_t *shape_p, const ecma_string_t *name_p);
+ecma_property_t ecma_shape_get_property_name (const ecma_shape_t *shape_p, uint32_t index,
+                                              jmem_cpointer_t *name_cp_p);
+ecma_property_value_t *ecma_shape_find_property_value (ecma_object_t *object_p, ecma_string_t *name_p);
+ecma_property_value_t *ecma_shape_create_property (ecma_object_t *object_p, ecma_string_t *name_p);
+ecma_property_value_t *ecma_shape_convert_to_normal (ecma_object_t *object_p, ecma_property_value_t *prop_value_p);
+void ecma_shape_free_values (ecma_object_t *object_p);
+void ecma_shape_free_unused (bool is_forced);
+void ecma_finalize_shapes (void);
+
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_SHAPE_H */
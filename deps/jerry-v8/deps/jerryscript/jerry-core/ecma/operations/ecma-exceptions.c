@@ -65,6 +65,40 @@ const ecma_error_mapping_t ecma_error_mappings[] =
 #undef ERROR_ELEMENT
 };
 
+#if ENABLED (JERRY_LINE_INFO)
+
+/**
+ * The "stack" identifier is not a magic string.
+ */
+#define ECMA_ERROR_STACK_ID "stack"
+
+/**
+ * Create the "stack" property of an error object.
+ *
+ * @return pointer to the created property
+ */
+static ecma_property_t *
+ecma_error_create_stack_property (ecma_object_t *error_obj_p, /**< error object */
+                                  ecma_value_t backtrace_value) /**< backtrace array */
+{
+  ecma_string_t *stack_str_p = ecma_new_ecma_string_from_utf8 ((const lit_utf8_byte_t *) ECMA_ERROR_STACK_ID,
+                                                               sizeof (ECMA_ERROR_STACK_ID) - 1);
+
+  ecma_property_t *property_p;
+  ecma_property_value_t *prop_value_p = ecma_create_named_data_property (error_obj_p,
+                                                                         stack_str_p,
+                                                                         ECMA_PROPERTY_CONFIGURABLE_WRITABLE,
+                                                                         &property_p);
+  ecma_deref_ecma_string (stack_str_p);
+
+  prop_value_p->value = backtrace_value;
+  ecma_deref_object (ecma_get_object_from_value (backtrace_value));
+
+  return property_p;
+} /* ecma_error_create_stack_property */
+
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
 /**
  * Standard ecma-error object constructor.
  *
@@ -141,21 +175,19 @@ ecma_new_standard_error (ecma_standard_error_t error_type) /**< native error typ
   ((ecma_extended_object_t *) new_error_obj_p)->u.class_prop.class_id = LIT_MAGIC_STRING_ERROR_UL;
 
 #if ENABLED (JERRY_LINE_INFO)
-  /* The "stack" identifier is not a magic string. */
-  const char * const stack_id_p = "stack";
-
-  ecma_string_t *stack_str_p = ecma_new_ecma_string_from_utf8 ((const lit_utf8_byte_t *) stack_id_p, 5);
+  ecma_value_t *backtrace_value_p = &((ecma_extended_object_t *) new_error_obj_p)->u.class_prop.u.value;
+  vm_backtrace_t *backtrace_p = vm_capture_backtrace ();
 
-  ecma_property_value_t *prop_value_p = ecma_create_named_data_property (new_error_obj_p,
-                                                                         stack_str_p,
-                                                                         ECMA_PROPERTY_CONFIGURABLE_WRITABLE,
-                                                                         NULL);
-  ecma_deref_ecma_string (stack_str_p);
-
-  ecma_value_t backtrace_value = vm_get_backtrace (0);
-
-  prop_value_p->value = backtrace_value;
-  ecma_deref_object (ecma_get_object_from_value (backtrace_value));
+  if (JERRY_LIKELY (backtrace_p != NULL))
+  {
+    /* The "stack" property is instantiated when it is first accessed. */
+    ECMA_SET_INTERNAL_VALUE_POINTER (*backtrace_value_p, backtrace_p);
+  }
+  else
+  {
+    ECMA_SET_INTERNAL_VALUE_ANY_POINTER (*backtrace_value_p, NULL);
+    ecma_error_create_stack_property (new_error_obj_p, vm_get_backtrace (0));
+  }
 #endif /* ENABLED (JERRY_LINE_INFO) */
 
   return new_error_obj_p;
@@ -214,6 +246,96 @@ ecma_new_standard_error_with_message (ecma_standard_error_t error_type, /**< nat
   return new_error_obj_p;
 } /* ecma_new_standard_error_with_message */
 
+#if ENABLED (JERRY_LINE_INFO)
+
+/**
+ * Check whether a property name is the "stack" identifier.
+ *
+ * @return true - if the name is "stack",
+ *         false - otherwise
+ */
+static bool
+ecma_error_is_stack_property_name (ecma_string_t *property_name_p) /**< property name */
+{
+  if (ECMA_IS_DIRECT_STRING (property_name_p) || ecma_prop_name_is_symbol (property_name_p))
+  {
+    return false;
+  }
+
+  ECMA_STRING_TO_UTF8_STRING (property_name_p, name_p, name_size);
+
+  bool result = (name_size == sizeof (ECMA_ERROR_STACK_ID) - 1
+                 && memcmp (name_p, ECMA_ERROR_STACK_ID, sizeof (ECMA_ERROR_STACK_ID) - 1) == 0);
+
+  ECMA_FINALIZE_UTF8_STRING (name_p, name_size);
+  return result;
+} /* ecma_error_is_stack_property_name */
+
+/**
+ * Lazy instantiation of the "stack" property of error objects
+ *
+ * @return pointer to newly instantiated property - if the property is "stack"
+ *                                                  and it has not been instantiated yet,
+ *         NULL - otherwise
+ */
+ecma_property_t *
+ecma_op_error_try_to_lazy_instantiate_property (ecma_object_t *object_p, /**< error object */
+                                                ecma_string_t *property_name_p) /**< property's name */
+{
+  ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+
+  JERRY_ASSERT (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_CLASS
+                && ext_object_p->u.class_prop.class_id == LIT_MAGIC_STRING_ERROR_UL);
+
+  if (ECMA_IS_INTERNAL_VALUE_NULL (ext_object_p->u.class_prop.u.value)
+      || !ecma_error_is_stack_property_name (property_name_p))
+  {
+    return NULL;
+  }
+
+  vm_backtrace_t *backtrace_p = ECMA_GET_INTERNAL_VALUE_POINTER (vm_backtrace_t,
+                                                                 ext_object_p->u.class_prop.u.value);
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (ext_object_p->u.class_prop.u.value, NULL);
+
+  ecma_value_t backtrace_value = vm_backtrace_to_array (backtrace_p);
+  vm_free_backtrace (backtrace_p);
+
+  return ecma_error_create_stack_property (object_p, backtrace_value);
+} /* ecma_op_error_try_to_lazy_instantiate_property */
+
+/**
+ * List names of the lazy instantiated properties of error objects
+ */
+void
+ecma_op_error_list_lazy_property_names (ecma_object_t *object_p, /**< error object */
+                                        uint32_t opts, /**< listing options using flags
+                                                        *   from ecma_list_properties_options_t */
+                                        ecma_collection_t *main_collection_p, /**< 'main' collection */
+                                        ecma_collection_t *non_enum_collection_p) /**< skipped
+                                                                                   *   'non-enumerable'
+                                                                                   *   collection */
+{
+  ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+
+  JERRY_ASSERT (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_CLASS
+                && ext_object_p->u.class_prop.class_id == LIT_MAGIC_STRING_ERROR_UL);
+
+  if (ECMA_IS_INTERNAL_VALUE_NULL (ext_object_p->u.class_prop.u.value)
+      || (opts & ECMA_LIST_ARRAY_INDICES))
+  {
+    return;
+  }
+
+  ecma_collection_t *for_non_enumerable_p = (opts & ECMA_LIST_ENUMERABLE) ? non_enum_collection_p : main_collection_p;
+
+  /* The "stack" property is non-enumerable. */
+  ecma_string_t *stack_str_p = ecma_new_ecma_string_from_utf8 ((const lit_utf8_byte_t *) ECMA_ERROR_STACK_ID,
+                                                               sizeof (ECMA_ERROR_STACK_ID) - 1);
+  ecma_collection_push_back (for_non_enumerable_p, ecma_make_string_value (stack_str_p));
+} /* ecma_op_error_list_lazy_property_names */
+
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
 /**
  * Raise a standard ecma-error with the given type and message.
  *
@@ -53,6 +53,13 @@ typedef enum
 ecma_standard_error_t ecma_get_error_type (ecma_object_t *error_object);
 ecma_object_t *ecma_new_standard_error (ecma_standard_error_t error_type);
 ecma_object_t *ecma_new_standard_error_with_message (ecma_standard_error_t error_type, ecma_string_t *message_string_p);
+#if ENABLED (JERRY_LINE_INFO)
+ecma_property_t *ecma_op_error_try_to_lazy_instantiate_property (ecma_object_t *object_p,
+                                                                 ecma_string_t *property_name_p);
+void ecma_op_error_list_lazy_property_names (ecma_object_t *object_p, uint32_t opts,
+                                             ecma_collection_t *main_collection_p,
+                                             ecma_collection_t *non_enum_collection_p);
+#endif /* ENABLED (JERRY_LINE_INFO) */
 #if ENABLED (JERRY_ERROR_MESSAGES)
 ecma_value_t ecma_raise_standard_error_with_format (ecma_standard_error_t error_type, const char *msg_p, ...);
 #endif /* ENABLED (JERRY_ERROR_MESSAGES) */
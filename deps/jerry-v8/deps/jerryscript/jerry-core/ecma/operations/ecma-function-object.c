@@ -28,6 +28,7 @@
 #include "ecma-symbol-object.h"
 #include "ecma-try-catch-macro.h"
 #include "jcontext.h"
+#include "js-parser.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -824,6 +825,37 @@ ecma_op_get_prototype_from_constructor (ecma_object_t *ctor_obj_p, /**< construc
   return proto_obj_p;
 } /* ecma_op_get_prototype_from_constructor */
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+
+/**
+ * Compile the body of a lazily parsed function and replace the byte code
+ * reference of the function object with the compiled code.
+ *
+ * @return compiled code - if the compilation is successful
+ *         NULL - otherwise (an exception is raised)
+ */
+static const ecma_compiled_code_t *
+ecma_op_function_compile_lazy (ecma_extended_object_t *ext_func_p) /**< function object */
+{
+  ecma_compiled_code_t *lazy_code_p;
+  lazy_code_p = (ecma_compiled_code_t *) ecma_op_function_get_compiled_code (ext_func_p);
+
+  ecma_compiled_code_t *bytecode_p = parser_compile_lazy_function (lazy_code_p);
+
+  if (bytecode_p == NULL)
+  {
+    return NULL;
+  }
+
+  ecma_bytecode_ref (bytecode_p);
+  ECMA_SET_INTERNAL_VALUE_POINTER (ext_func_p->u.function.bytecode_cp, bytecode_p);
+  ecma_bytecode_deref (lazy_code_p);
+
+  return bytecode_p;
+} /* ecma_op_function_compile_lazy */
+
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 /**
  * Perform a JavaScript function object method call.
  *
@@ -855,6 +887,19 @@ ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
   bool free_this_binding = false;
 
   const ecma_compiled_code_t *bytecode_data_p = ecma_op_function_get_compiled_code (ext_func_p);
+
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  if (JERRY_UNLIKELY (bytecode_data_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION))
+  {
+    bytecode_data_p = ecma_op_function_compile_lazy (ext_func_p);
+
+    if (JERRY_UNLIKELY (bytecode_data_p == NULL))
+    {
+      return ECMA_VALUE_ERROR;
+    }
+  }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
   uint16_t status_flags = bytecode_data_p->status_flags;
 
 #if ENABLED (JERRY_ESNEXT)
@@ -35,17 +35,24 @@
  */
 
 /**
- * Arguments object creation operation.
+ * Create a new arguments object without binding it to any lexical environment.
+ *
+ * Note:
+ *      the callee function and the lexical environment are only used by
+ *      non-strict (mapped) arguments objects, so they can be NULL for strict mode code
  *
  * See also: ECMA-262 v5, 10.6
+ *
+ * @return the arguments object
+ *         Returned object must be freed with ecma_deref_object
  */
-void
-ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function */
-                                 ecma_object_t *lex_env_p, /**< lexical environment the Arguments
-                                                                object is created for */
-                                 const ecma_value_t *arguments_list_p, /**< arguments list */
-                                 uint32_t arguments_number, /**< length of arguments list */
-                                 const ecma_compiled_code_t *bytecode_data_p) /**< byte code */
+ecma_object_t *
+ecma_op_new_arguments_object (ecma_object_t *func_obj_p, /**< callee function */
+                              ecma_object_t *lex_env_p, /**< lexical environment the Arguments
+                                                         *   object is created for */
+                              const ecma_value_t *arguments_list_p, /**< arguments list */
+                              uint32_t arguments_number, /**< length of arguments list */
+                              const ecma_compiled_code_t *bytecode_data_p) /**< byte code */
 {
   bool is_strict = (bytecode_data_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0;
 
@@ -193,9 +200,31 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
     JERRY_ASSERT (ecma_is_value_true (completion));
   }
 
+  return obj_p;
+} /* ecma_op_new_arguments_object */
+
+/**
+ * Arguments object creation operation.
+ *
+ * See also: ECMA-262 v5, 10.6
+ */
+void
+ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function */
+                                 ecma_object_t *lex_env_p, /**< lexical environment the Arguments
+                                                                object is created for */
+                                 const ecma_value_t *arguments_list_p, /**< arguments list */
+                                 uint32_t arguments_number, /**< length of arguments list */
+                                 const ecma_compiled_code_t *bytecode_data_p) /**< byte code */
+{
+  ecma_object_t *obj_p = ecma_op_new_arguments_object (func_obj_p,
+                                                       lex_env_p,
+                                                       arguments_list_p,
+                                                       arguments_number,
+                                                       bytecode_data_p);
+
   ecma_string_t *arguments_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_ARGUMENTS);
 
-  if (is_strict)
+  if (bytecode_data_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE)
   {
     ecma_op_create_immutable_binding (lex_env_p,
                                       arguments_string_p,
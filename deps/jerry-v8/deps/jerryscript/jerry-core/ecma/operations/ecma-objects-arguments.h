@@ -19,6 +19,10 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 
+ecma_object_t *
+ecma_op_new_arguments_object (ecma_object_t *func_obj_p, ecma_object_t *lex_env_p,
+                              const ecma_value_t *arguments_list_p, uint32_t arguments_number,
+                              const ecma_compiled_code_t *bytecode_data_p);
 void
 ecma_op_create_arguments_object (ecma_object_t *func_obj_p, ecma_object_t *lex_env_p,
                                  const ecma_value_t *arguments_list_p, uint32_t arguments_number,
@@ -27,6 +27,7 @@
 #include "ecma-objects-general.h"
 #include "ecma-objects.h"
 #include "ecma-proxy-object.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 
 #if ENABLED (JERRY_BUILTIN_TYPEDARRAY)
@@ -231,6 +232,29 @@ ecma_op_object_get_own_property (ecma_object_t *object_p, /**< the object */
       break;
     }
 #endif /* ENABLED (JERRY_BUILTIN_TYPEDARRAY) */
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+    case ECMA_OBJECT_TYPE_GENERAL:
+    {
+      if (ECMA_OBJECT_HAS_SHAPE (object_p)
+          && !(options & ECMA_PROPERTY_GET_EXT_REFERENCE))
+      {
+        ecma_property_value_t *prop_value_p = ecma_shape_find_property_value (object_p, property_name_p);
+
+        if (prop_value_p == NULL)
+        {
+          return ECMA_PROPERTY_TYPE_NOT_FOUND;
+        }
+
+        if (property_ref_p != NULL)
+        {
+          property_ref_p->value_p = prop_value_p;
+        }
+
+        return ECMA_SHAPE_PROPERTY_TYPE;
+      }
+      break;
+    }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
     default:
     {
       break;
@@ -293,6 +317,13 @@ ecma_op_object_get_own_property (ecma_object_t *object_p, /**< the object */
     {
       property_p = ecma_op_bound_function_try_to_lazy_instantiate_property (object_p, property_name_p);
     }
+#if ENABLED (JERRY_LINE_INFO)
+    else if (type == ECMA_OBJECT_TYPE_CLASS
+             && ((ecma_extended_object_t *) object_p)->u.class_prop.class_id == LIT_MAGIC_STRING_ERROR_UL)
+    {
+      property_p = ecma_op_error_try_to_lazy_instantiate_property (object_p, property_name_p);
+    }
+#endif /* ENABLED (JERRY_LINE_INFO) */
 
     if (property_p == NULL)
     {
@@ -585,6 +616,23 @@ ecma_op_object_find_own (ecma_value_t base_value, /**< base value */
 
       break;
     }
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+    case ECMA_OBJECT_TYPE_GENERAL:
+    {
+      if (ECMA_OBJECT_HAS_SHAPE (object_p))
+      {
+        ecma_property_value_t *prop_value_p = ecma_shape_find_property_value (object_p, property_name_p);
+
+        if (prop_value_p == NULL)
+        {
+          return ECMA_VALUE_NOT_FOUND;
+        }
+
+        return ecma_fast_copy_value (prop_value_p->value);
+      }
+      break;
+    }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
     default:
     {
       break;
@@ -642,6 +690,13 @@ ecma_op_object_find_own (ecma_value_t base_value, /**< base value */
     {
       property_p = ecma_op_bound_function_try_to_lazy_instantiate_property (object_p, property_name_p);
     }
+#if ENABLED (JERRY_LINE_INFO)
+    else if (type == ECMA_OBJECT_TYPE_CLASS
+             && ((ecma_extended_object_t *) object_p)->u.class_prop.class_id == LIT_MAGIC_STRING_ERROR_UL)
+    {
+      property_p = ecma_op_error_try_to_lazy_instantiate_property (object_p, property_name_p);
+    }
+#endif /* ENABLED (JERRY_LINE_INFO) */
 
     if (property_p == NULL)
     {
@@ -1351,6 +1406,29 @@ ecma_op_object_put_with_receiver (ecma_object_t *object_p, /**< the object */
 #endif /* ENABLED (JERRY_BUILTIN_TYPEDARRAY) */
       break;
     }
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+    case ECMA_OBJECT_TYPE_GENERAL:
+    {
+      if (ECMA_OBJECT_HAS_SHAPE (object_p))
+      {
+        ecma_property_value_t *prop_value_p = ecma_shape_find_property_value (object_p, property_name_p);
+
+        if (prop_value_p != NULL)
+        {
+#if ENABLED (JERRY_ESNEXT)
+          if (ecma_make_object_value (object_p) != receiver)
+          {
+            return ecma_op_object_put_apply_receiver (receiver, property_name_p, value, is_throw);
+          }
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+          ecma_named_data_property_assign_value (object_p, prop_value_p, value);
+          return ECMA_VALUE_TRUE;
+        }
+      }
+      break;
+    }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
     default:
     {
       break;
@@ -1420,6 +1498,13 @@ ecma_op_object_put_with_receiver (ecma_object_t *object_p, /**< the object */
     {
       property_p = ecma_op_bound_function_try_to_lazy_instantiate_property (object_p, property_name_p);
     }
+#if ENABLED (JERRY_LINE_INFO)
+    else if (type == ECMA_OBJECT_TYPE_CLASS
+             && ((ecma_extended_object_t *) object_p)->u.class_prop.class_id == LIT_MAGIC_STRING_ERROR_UL)
+    {
+      property_p = ecma_op_error_try_to_lazy_instantiate_property (object_p, property_name_p);
+    }
+#endif /* ENABLED (JERRY_LINE_INFO) */
   }
 
   jmem_cpointer_t setter_cp = JMEM_CP_NULL;
@@ -2296,6 +2381,15 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
                                                        prop_names_p,
                                                        skipped_non_enumerable_p);
             }
+#if ENABLED (JERRY_LINE_INFO)
+            else if (ext_object_p->u.class_prop.class_id == LIT_MAGIC_STRING_ERROR_UL)
+            {
+              ecma_op_error_list_lazy_property_names (obj_p,
+                                                      opts,
+                                                      prop_names_p,
+                                                      skipped_non_enumerable_p);
+            }
+#endif /* ENABLED (JERRY_LINE_INFO) */
 
             break;
           }
@@ -2427,29 +2521,59 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
       while (prop_iter_cp != JMEM_CP_NULL)
       {
         ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
-        JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+        uint32_t item_count = ECMA_PROPERTY_PAIR_ITEM_COUNT;
+        prop_iter_cp = prop_iter_p->next_property_cp;
+
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+        ecma_shape_t *shape_p = NULL;
+
+        if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+        {
+          /* The values of a shape are the last item of the property list. */
+          shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, prop_iter_p->next_property_cp);
+          item_count = shape_p->property_count;
+          prop_iter_cp = JMEM_CP_NULL;
+        }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
+        JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p)
+                      || prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE);
 
-        for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+        for (uint32_t i = 0; i < item_count; i++)
         {
-          ecma_property_t *property_p = prop_iter_p->types + i;
+          ecma_property_t property;
+          jmem_cpointer_t name_cp;
 
-          if (ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
-              || ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+          if (shape_p != NULL)
           {
-            ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+            /* Newer properties are listed first, like the property pairs do. */
+            property = ecma_shape_get_property_name (shape_p, item_count - 1 - i, &name_cp);
+            property = (ecma_property_t) (property | ECMA_SHAPE_PROPERTY_TYPE);
+          }
+          else
+          {
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+            property = prop_iter_p->types[i];
+            name_cp = ((ecma_property_pair_t *) prop_iter_p)->names_cp[i];
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+          }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
 
-            if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_MAGIC
-                && prop_pair_p->names_cp[i] >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
-                && prop_pair_p->names_cp[i] < LIT_MAGIC_STRING__COUNT)
+          if (ECMA_PROPERTY_GET_TYPE (property) == ECMA_PROPERTY_TYPE_NAMEDDATA
+              || ECMA_PROPERTY_GET_TYPE (property) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
+          {
+            if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_MAGIC
+                && name_cp >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
+                && name_cp < LIT_MAGIC_STRING__COUNT)
             {
               /* Internal properties are never enumerated. */
               continue;
             }
 
-            ecma_string_t *name_p = ecma_string_from_property_name (*property_p,
-                                                                    prop_pair_p->names_cp[i]);
+            ecma_string_t *name_p = ecma_string_from_property_name (property, name_cp);
 
-            if (!(is_enumerable_only && !ecma_is_property_enumerable (*property_p)))
+            if (!(is_enumerable_only && !ecma_is_property_enumerable (property)))
             {
   #if ENABLED (JERRY_ESNEXT)
               /* We skip the current property in the following cases:
@@ -2526,14 +2650,12 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
             }
             else
             {
-              JERRY_ASSERT (is_enumerable_only && !ecma_is_property_enumerable (*property_p));
+              JERRY_ASSERT (is_enumerable_only && !ecma_is_property_enumerable (property));
 
               ecma_collection_push_back (skipped_non_enumerable_p, ecma_make_prop_name_value (name_p));
             }
           }
         }
-
-        prop_iter_cp = prop_iter_p->next_property_cp;
       }
     }
 
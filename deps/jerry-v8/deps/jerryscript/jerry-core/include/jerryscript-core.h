@@ -104,6 +104,9 @@ typedef enum
   JERRY_FEATURE_SET, /**< Set support */
   JERRY_FEATURE_WEAKMAP, /**< WeakMap support */
   JERRY_FEATURE_WEAKSET, /**< WeakSet support */
+  JERRY_FEATURE_VM_INTERRUPT, /**< asynchronous interrupt requests */
+  JERRY_FEATURE_INLINE_CACHE, /**< per-site inline caches */
+  JERRY_FEATURE_HIDDEN_CLASSES, /**< hidden classes of ordinary objects */
   JERRY_FEATURE__COUNT /**< number of features. NOTE: must be at the end of the list */
 } jerry_feature_t;
 
@@ -152,11 +155,24 @@ typedef uint32_t jerry_size_t;
  */
 typedef uint32_t jerry_length_t;
 
+#if defined (JERRY_VALUE_64_BIT) && JERRY_VALUE_64_BIT
+
+/**
+ * Description of a JerryScript value.
+ *
+ * Note: the engine and its users must be compiled with the same JERRY_VALUE_64_BIT setting.
+ */
+typedef uint64_t jerry_value_t;
+
+#else /* !JERRY_VALUE_64_BIT */
+
 /**
  * Description of a JerryScript value.
  */
 typedef uint32_t jerry_value_t;
 
+#endif /* JERRY_VALUE_64_BIT */
+
 /**
  * Description of ECMA property descriptor.
  */
@@ -212,6 +228,21 @@ typedef struct
   size_t reserved[4]; /**< padding for future extensions */
 } jerry_heap_stats_t;
 
+/**
+ * Description of the inline cache stats.
+ * It is for performance profiling.
+ */
+typedef struct
+{
+  size_t version; /**< the version of the stats struct */
+  size_t load_hits; /**< property loads served by an inline cache */
+  size_t load_misses; /**< property loads of ordinary objects which missed the inline cache */
+  size_t store_hits; /**< property stores served by an inline cache */
+  size_t store_misses; /**< property stores to ordinary objects which missed the inline cache */
+  size_t caches; /**< number of byte codes which have an inline cache */
+  size_t reserved[4]; /**< padding for future extensions */
+} jerry_inline_cache_stats_t;
+
 /**
  * Type of an external function handler.
  */
@@ -238,6 +269,17 @@ typedef void (*jerry_object_native_free_callback_t) (void *native_p);
  */
 typedef jerry_value_t (*jerry_vm_exec_stop_callback_t) (void *user_p);
 
+/**
+ * Callback which is called at the next safe point of the vm after
+ * jerry_request_vm_interrupt is called.
+ *
+ * The return value has the same meaning as in case of
+ * jerry_vm_exec_stop_callback_t. When a non-undefined value is returned
+ * the request stays pending, so the callback is called again at the
+ * next safe point.
+ */
+typedef jerry_value_t (*jerry_vm_interrupt_callback_t) (void *user_p);
+
 /**
  * Function type applied for each data property of an object.
  */
@@ -351,6 +393,7 @@ void jerry_gc (jerry_gc_mode_t mode);
 void *jerry_get_context_data (const jerry_context_data_manager_t *manager_p);
 
 bool jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p);
+bool jerry_get_inline_cache_stats (jerry_inline_cache_stats_t *out_stats_p);
 
 /**
  * Parser and executor functions.
@@ -446,6 +489,7 @@ jerry_size_t jerry_get_utf8_string_size (const jerry_value_t value);
 jerry_length_t jerry_get_string_length (const jerry_value_t value);
 jerry_length_t jerry_get_utf8_string_length (const jerry_value_t value);
 jerry_size_t jerry_string_to_char_buffer (const jerry_value_t value, jerry_char_t *buffer_p, jerry_size_t buffer_size);
+const jerry_char_t *jerry_get_string_buffer (const jerry_value_t value, jerry_size_t *buffer_size_p);
 jerry_size_t jerry_string_to_utf8_char_buffer (const jerry_value_t value,
                                                jerry_char_t *buffer_p,
                                                jerry_size_t buffer_size);
@@ -615,6 +659,8 @@ jerry_context_t *jerry_create_context (uint32_t heap_size, jerry_context_alloc_t
  * Miscellaneous functions.
  */
 void jerry_set_vm_exec_stop_callback (jerry_vm_exec_stop_callback_t stop_cb, void *user_p, uint32_t frequency);
+void jerry_set_vm_interrupt_callback (jerry_vm_interrupt_callback_t interrupt_cb, void *user_p);
+void jerry_request_vm_interrupt (void);
 jerry_value_t jerry_get_backtrace (uint32_t max_depth);
 jerry_value_t jerry_get_resource_name (const jerry_value_t value);
 jerry_value_t jerry_get_new_target (void);
@@ -252,6 +252,44 @@ size_t jerry_port_normalize_path (const char *in_path_p,
  */
 jerry_value_t jerry_port_get_native_module (jerry_value_t name);
 
+/**
+ * Allocate memory for the machine code generated by the JIT compiler.
+ *
+ * Note:
+ *      This port function is called by jerry-core when JERRY_JIT is
+ *      enabled. The returned memory must be readable and writable.
+ *
+ * @param size size of the requested memory in bytes.
+ *
+ * @return pointer to the allocated memory, or NULL if the allocation failed.
+ */
+void *jerry_port_jit_alloc (size_t size);
+
+/**
+ * Make the memory returned by jerry_port_jit_alloc executable. The memory
+ * is never written again after this call, so it does not need to be writable.
+ *
+ * Note:
+ *      This port function is called by jerry-core when JERRY_JIT is enabled.
+ *
+ * @param code_p pointer returned by jerry_port_jit_alloc.
+ * @param size size passed to jerry_port_jit_alloc.
+ *
+ * @return true, if the memory is executable, false otherwise.
+ */
+bool jerry_port_jit_make_executable (void *code_p, size_t size);
+
+/**
+ * Free the memory returned by jerry_port_jit_alloc.
+ *
+ * Note:
+ *      This port function is called by jerry-core when JERRY_JIT is enabled.
+ *
+ * @param code_p pointer returned by jerry_port_jit_alloc.
+ * @param size size passed to jerry_port_jit_alloc.
+ */
+void jerry_port_jit_free (void *code_p, size_t size);
+
 /**
  * @}
  */
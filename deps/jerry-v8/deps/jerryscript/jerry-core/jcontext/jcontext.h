@@ -142,6 +142,8 @@ struct jerry_context_t
   jmem_cpointer_t symbol_list_first_cp; /**< first item of the global symbol list */
 #endif /* ENABLED (JERRY_ESNEXT) */
   jmem_cpointer_t number_list_first_cp; /**< first item of the literal number list */
+  ecma_lit_hash_table_t string_hash_table; /**< hash table of the literal string list */
+  ecma_lit_hash_table_t number_hash_table; /**< hash table of the literal number list */
   jmem_cpointer_t ecma_global_env_cp; /**< global lexical environment */
 #if ENABLED (JERRY_ESNEXT)
   jmem_cpointer_t ecma_global_scope_cp; /**< global lexical scope */
@@ -189,6 +191,15 @@ struct jerry_context_t
                                                  *   ECMAScript execution should be stopped */
 #endif /* ENABLED (JERRY_VM_EXEC_STOP) */
 
+#if ENABLED (JERRY_VM_INTERRUPT)
+  void *vm_interrupt_user_p; /**< user pointer for vm_interrupt_cb */
+  ecma_vm_interrupt_callback_t vm_interrupt_cb; /**< user function which is called when
+                                                 *   an interrupt request is serviced */
+  volatile uint32_t vm_interrupt_pending; /**< non-zero if an interrupt is requested, this is
+                                           *   the only member which may be written from another
+                                           *   thread or from a signal handler */
+#endif /* ENABLED (JERRY_VM_INTERRUPT) */
+
 #if (JERRY_STACK_LIMIT != 0)
   uintptr_t stack_base;  /**< stack base marker */
 #endif /* (JERRY_STACK_LIMIT != 0) */
@@ -214,6 +225,26 @@ struct jerry_context_t
   jmem_heap_stats_t jmem_heap_stats; /**< heap's memory usage statistics */
 #endif /* ENABLED (JERRY_MEM_STATS) */
 
+#if ENABLED (JERRY_INLINE_CACHE)
+  ecma_inline_cache_t **inline_cache_buckets_p; /**< inline caches hashed by their byte code */
+  uint32_t inline_cache_bucket_count; /**< number of buckets (power of 2) */
+  uint32_t inline_cache_count; /**< number of inline caches */
+  uint32_t inline_cache_epoch; /**< changed whenever a cached property might be freed */
+  ecma_inline_cache_stats_t inline_cache_stats; /**< inline cache statistics */
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  jmem_cpointer_t *shape_buckets_p; /**< transition table of the shapes, hashed by their parent and last name */
+  uint32_t shape_bucket_count; /**< number of buckets (power of 2) */
+  uint32_t shape_count; /**< number of shapes */
+  uint32_t shape_unused_count; /**< number of shapes which are not used by any object or shape */
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
+#if ENABLED (JERRY_JIT)
+  vm_jit_code_t **jit_code_table_p; /**< compiled codes indexed by the jit counter of their byte code */
+  uint32_t jit_code_table_size; /**< size of the table */
+#endif /* ENABLED (JERRY_JIT) */
+
   /* This must be at the end of the context for performance reasons */
 #if ENABLED (JERRY_LCACHE)
   /** hash table for caching the last access of properties */
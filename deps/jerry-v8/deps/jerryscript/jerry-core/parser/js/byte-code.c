@@ -27,10 +27,10 @@ JERRY_STATIC_ASSERT ((sizeof (cbc_uint16_arguments_t) % sizeof (jmem_cpointer_t)
  */
 JERRY_STATIC_ASSERT (CBC_END == 238,
                      number_of_cbc_opcodes_changed);
-JERRY_STATIC_ASSERT (CBC_EXT_END == 135,
+JERRY_STATIC_ASSERT (CBC_EXT_END == 138,
                      number_of_cbc_ext_opcodes_changed);
 
-#if ENABLED (JERRY_PARSER)
+#if ENABLED (JERRY_PARSER) || ENABLED (JERRY_JIT)
 
 /** \addtogroup parser Parser
  * @{
@@ -96,4 +96,4 @@ const char * const cbc_ext_names[] =
  * @}
  */
 
-#endif /* ENABLED (JERRY_PARSER) */
+#endif /* ENABLED (JERRY_PARSER) || ENABLED (JERRY_JIT) */
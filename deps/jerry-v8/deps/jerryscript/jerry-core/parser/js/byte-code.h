@@ -622,6 +622,12 @@
               VM_OC_SET_FUNCTION_NAME) \
   CBC_OPCODE (CBC_EXT_SET_COMPUTED_SETTER_NAME, CBC_NO_FLAG, 0, \
               VM_OC_SET_FUNCTION_NAME) \
+  CBC_OPCODE (CBC_EXT_CREATE_ARGUMENTS, CBC_HAS_LITERAL_ARG, 0, \
+              VM_OC_CREATE_ARGUMENTS) \
+  CBC_OPCODE (CBC_EXT_PUSH_ARGUMENTS_LENGTH, CBC_HAS_LITERAL_ARG, 1, \
+              VM_OC_PUSH_ARGUMENTS | VM_OC_PUT_STACK) \
+  CBC_OPCODE (CBC_EXT_PUSH_ARGUMENTS_ELEMENT, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 1, \
+              VM_OC_PUSH_ARGUMENTS | VM_OC_PUT_STACK) \
   \
   /* Computed / class property related opcodes. */ \
   CBC_OPCODE (CBC_EXT_SET_COMPUTED_PROPERTY, CBC_NO_FLAG, -2, \
@@ -822,6 +828,12 @@ typedef struct
   uint8_t ident_end;                /**< end position of the identifier group */
   uint8_t const_literal_end;        /**< end position of the const literal group */
   uint8_t literal_end;              /**< end position of the literal group */
+#if ENABLED (JERRY_JIT)
+  uint16_t jit_counter;             /**< execution counter or compiled code index of the JIT */
+  uint16_t padding;                 /**< aligns the literal table to 8 bytes */
+#elif ENABLED (JERRY_VALUE_64_BIT)
+  uint32_t padding;                 /**< aligns the literal table to 8 bytes */
+#endif /* ENABLED (JERRY_JIT) */
 } cbc_uint8_arguments_t;
 
 /**
@@ -836,7 +848,14 @@ typedef struct
   uint16_t ident_end;               /**< end position of the identifier group */
   uint16_t const_literal_end;       /**< end position of the const literal group */
   uint16_t literal_end;             /**< end position of the literal group */
+#if ENABLED (JERRY_JIT)
+  uint16_t jit_counter;             /**< execution counter or compiled code index of the JIT */
+#else /* !ENABLED (JERRY_JIT) */
   uint16_t padding;                 /**< an unused value */
+#endif /* ENABLED (JERRY_JIT) */
+#if ENABLED (JERRY_VALUE_64_BIT)
+  uint32_t padding_64;              /**< aligns the literal table to 8 bytes */
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
 } cbc_uint16_arguments_t;
 
 /**
@@ -855,12 +874,52 @@ typedef enum
   CBC_CODE_FLAGS_REST_PARAMETER = (1u << 8), /**< this function has rest parameter */
   CBC_CODE_FLAGS_HAS_TAGGED_LITERALS = (1u << 9), /**< this function has tagged template literal list */
   CBC_CODE_FLAGS_LEXICAL_BLOCK_NEEDED = (1u << 10), /**< compiled code needs a lexical block */
+  CBC_CODE_FLAGS_LAZY_FUNCTION = (1u << 11), /**< compiled code is a cbc_lazy_function_t whose
+                                              *   body is compiled on the first call */
 
   /* Bits from bit 12 is reserved for function types (see CBC_FUNCTION_TYPE_SHIFT).
    * Note: the last bits are used for type flags because < and >= operators can be used to
            check a range of types without decoding the actual type. */
 } cbc_code_flags_t;
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+
+/**
+ * Source code shared by the lazily compiled functions of a script.
+ * The UTF-8 source code follows this header.
+ */
+typedef struct
+{
+  uint32_t refs;                    /**< reference counter */
+  uint32_t size;                    /**< size of the source code */
+} cbc_lazy_source_t;
+
+/**
+ * Function whose body is compiled on its first call.
+ *
+ * Note:
+ *   the header is a valid cbc_uint16_arguments_t with a single literal (the resource name),
+ *   so the properties of the function (e.g. length, name) can be resolved without compiling
+ *   its body. The function name is stored after the structure as usual.
+ */
+typedef struct
+{
+  cbc_uint16_arguments_t header;    /**< compiled code header */
+  ecma_value_t resource_name;       /**< resource name (the only literal of the header) */
+  jmem_cpointer_t source_cp;        /**< shared source code (cbc_lazy_source_t) */
+  jmem_cpointer_t compiled_code_cp; /**< compiled code of the function, JMEM_CP_NULL before the first call */
+  uint32_t arguments_start;         /**< start offset of the argument list in the source code */
+  uint32_t arguments_end;           /**< end offset of the argument list in the source code */
+  uint32_t body_start;              /**< start offset of the function body in the source code */
+  uint32_t body_end;                /**< end offset of the function body in the source code */
+  uint32_t arguments_line;          /**< line of the argument list start */
+  uint32_t arguments_column;        /**< column of the argument list start */
+  uint32_t body_line;               /**< line of the function body start */
+  uint32_t body_column;             /**< column of the function body start */
+} cbc_lazy_function_t;
+
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 /**
  * Compact byte code function types.
  */
@@ -2695,6 +2695,44 @@ lexer_construct_function_object (parser_context_t *context_p, /**< context */
   return result_index;
 } /* lexer_construct_function_object */
 
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+
+/**
+ * Compile the pattern of a regular expression literal.
+ *
+ * @return compiled RegExp byte code
+ */
+static ecma_compiled_code_t *
+lexer_compile_regexp (parser_context_t *context_p, /**< context */
+                      const uint8_t *regex_start_p, /**< start of the pattern */
+                      lit_utf8_size_t length, /**< length of the pattern */
+                      uint16_t flags) /**< RegExp flags */
+{
+  ecma_string_t *pattern_str_p = NULL;
+
+  if (lit_is_valid_cesu8_string (regex_start_p, length))
+  {
+    pattern_str_p = ecma_new_ecma_string_from_utf8 (regex_start_p, length);
+  }
+  else
+  {
+    JERRY_ASSERT (lit_is_valid_utf8_string (regex_start_p, length));
+    pattern_str_p = ecma_new_ecma_string_from_utf8_converted_to_cesu8 (regex_start_p, length);
+  }
+
+  re_compiled_code_t *re_bytecode_p = re_compile_bytecode (pattern_str_p, flags);
+  ecma_deref_ecma_string (pattern_str_p);
+
+  if (JERRY_UNLIKELY (re_bytecode_p == NULL))
+  {
+    parser_raise_error (context_p, PARSER_ERR_INVALID_REGEXP);
+  }
+
+  return (ecma_compiled_code_t *) re_bytecode_p;
+} /* lexer_compile_regexp */
+
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+
 /**
  * Construct a regular expression object.
  */
@@ -2851,6 +2889,15 @@ lexer_construct_regexp_object (parser_context_t *context_p, /**< context */
 
   if (parse_only)
   {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+    /* The bodies of lazily compiled functions are not parsed before their
+     * first call, so the scanner must report the invalid patterns. The
+     * compiled pattern is kept by the RegExp cache. */
+    if (context_p->lazy_source_start_p != NULL)
+    {
+      ecma_bytecode_deref (lexer_compile_regexp (context_p, regex_start_p, length, current_flags));
+    }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
     return;
   }
 
@@ -2867,28 +2914,8 @@ lexer_construct_regexp_object (parser_context_t *context_p, /**< context */
   context_p->literal_count++;
 
   /* Compile the RegExp literal and store the RegExp bytecode pointer */
-  ecma_string_t *pattern_str_p = NULL;
-
-  if (lit_is_valid_cesu8_string (regex_start_p, length))
-  {
-    pattern_str_p = ecma_new_ecma_string_from_utf8 (regex_start_p, length);
-  }
-  else
-  {
-    JERRY_ASSERT (lit_is_valid_utf8_string (regex_start_p, length));
-    pattern_str_p = ecma_new_ecma_string_from_utf8_converted_to_cesu8 (regex_start_p, length);
-  }
-
-  re_compiled_code_t *re_bytecode_p = re_compile_bytecode (pattern_str_p, current_flags);
-  ecma_deref_ecma_string (pattern_str_p);
-
-  if (JERRY_UNLIKELY (re_bytecode_p == NULL))
-  {
-    parser_raise_error (context_p, PARSER_ERR_INVALID_REGEXP);
-  }
-
+  literal_p->u.bytecode_p = lexer_compile_regexp (context_p, regex_start_p, length, current_flags);
   literal_p->type = LEXER_REGEXP_LITERAL;
-  literal_p->u.bytecode_p = (ecma_compiled_code_t *) re_bytecode_p;
 
   context_p->token.type = LEXER_LITERAL;
   context_p->token.keyword_type = LEXER_EOS;
@@ -232,6 +232,34 @@ parser_emit_ident_reference (parser_context_t *context_p, /**< context */
   parser_emit_cbc_literal (context_p, opcode, literal_index);
 } /* parser_emit_ident_reference */
 
+/**
+ * Split the last push literal byte code when its last literal is the arguments
+ * object stored in a register, so the property access which follows it can be
+ * replaced by a direct access of the arguments list.
+ */
+static void
+parser_split_arguments_register_push (parser_context_t *context_p) /**< context */
+{
+  uint16_t arguments_register = context_p->arguments_register;
+
+  if (context_p->last_cbc_opcode == CBC_PUSH_TWO_LITERALS
+      && context_p->last_cbc.value == arguments_register)
+  {
+    context_p->last_cbc_opcode = CBC_PUSH_LITERAL;
+  }
+  else if (context_p->last_cbc_opcode == CBC_PUSH_THREE_LITERALS
+           && context_p->last_cbc.third_literal_index == arguments_register)
+  {
+    context_p->last_cbc_opcode = CBC_PUSH_TWO_LITERALS;
+  }
+  else
+  {
+    return;
+  }
+
+  parser_emit_cbc_literal (context_p, CBC_PUSH_LITERAL, arguments_register);
+} /* parser_split_arguments_register_push */
+
 /**
  * Generate byte code for operators with lvalue.
  */
@@ -1366,6 +1394,7 @@ parser_parse_function_expression (parser_context_t *context_p, /**< context */
   uint16_t literal2 = 0;
   uint16_t function_literal_index;
   int32_t function_name_index = -1;
+  bool needs_name_env = true;
 
 #if !ENABLED (JERRY_ESNEXT)
   JERRY_ASSERT (status_flags & PARSER_IS_FUNC_EXPRESSION);
@@ -1457,6 +1486,18 @@ parser_parse_function_expression (parser_context_t *context_p, /**< context */
     context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
   }
 
+  if (function_name_index != -1)
+  {
+    JERRY_ASSERT (context_p->next_scanner_info_p->type == SCANNER_TYPE_FUNCTION);
+
+    if (context_p->next_scanner_info_p->u8_arg & SCANNER_FUNCTION_NAME_UNUSED)
+    {
+      /* The function body does not reference its own name, so the
+       * lexical environment which binds the name can be omitted. */
+      needs_name_env = false;
+    }
+  }
+
   function_literal_index = lexer_construct_function_object (context_p, status_flags);
 
   JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
@@ -1487,7 +1528,7 @@ parser_parse_function_expression (parser_context_t *context_p, /**< context */
                              CBC_PUSH_LITERAL,
                              function_literal_index);
 
-    if (function_name_index != -1)
+    if (function_name_index != -1 && needs_name_env)
     {
       context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_NAMED_FUNC_EXPRESSION);
       context_p->last_cbc.value = (uint16_t) function_name_index;
@@ -2131,6 +2172,11 @@ parser_process_unary_expression (parser_context_t *context_p, /**< context */
       {
         parser_push_result (context_p);
 
+        if (JERRY_UNLIKELY (context_p->status_flags & PARSER_ARGUMENTS_REGISTER))
+        {
+          parser_split_arguments_register_push (context_p);
+        }
+
         lexer_expect_identifier (context_p, LEXER_STRING_LITERAL);
         JERRY_ASSERT (context_p->token.type == LEXER_LITERAL
                       && context_p->lit_object.literal_p->type == LEXER_STRING_LITERAL);
@@ -2167,6 +2213,11 @@ parser_process_unary_expression (parser_context_t *context_p, /**< context */
       {
         parser_push_result (context_p);
 
+        if (JERRY_UNLIKELY (context_p->status_flags & PARSER_ARGUMENTS_REGISTER))
+        {
+          parser_split_arguments_register_push (context_p);
+        }
+
 #if ENABLED (JERRY_ESNEXT)
         uint16_t last_cbc_opcode = context_p->last_cbc_opcode;
 
@@ -2192,6 +2243,15 @@ parser_process_unary_expression (parser_context_t *context_p, /**< context */
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
 
+        if (JERRY_UNLIKELY (context_p->status_flags & PARSER_ARGUMENTS_REGISTER)
+            && context_p->last_cbc.literal_index == context_p->arguments_register
+            && (context_p->last_cbc_opcode == PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_LITERAL_PUSH_NUMBER_0)
+                || context_p->last_cbc_opcode == PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_LITERAL_PUSH_NUMBER_POS_BYTE)))
+        {
+          /* Constant index of the arguments object: the literal form is replaced by a direct access. */
+          lexer_convert_push_number_to_push_literal (context_p);
+        }
+
         if (PARSER_IS_MUTABLE_PUSH_LITERAL (context_p->last_cbc_opcode))
         {
           context_p->last_cbc_opcode = PARSER_PUSH_LITERAL_TO_PUSH_PROP_LITERAL (context_p->last_cbc_opcode);
@@ -3543,19 +3603,12 @@ parser_process_ternary_expression (parser_context_t *context_p) /**< context */
 {
   JERRY_ASSERT (context_p->token.type == LEXER_QUESTION_MARK);
 
-  cbc_opcode_t opcode = CBC_BRANCH_IF_FALSE_FORWARD;
   parser_branch_t cond_branch;
   parser_branch_t uncond_branch;
 
   parser_push_result (context_p);
 
-  if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT)
-  {
-    context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
-    opcode = CBC_BRANCH_IF_TRUE_FORWARD;
-  }
-
-  parser_emit_cbc_forward_branch (context_p, (uint16_t) opcode, &cond_branch);
+  parser_emit_cbc_forward_branch (context_p, CBC_BRANCH_IF_FALSE_FORWARD, &cond_branch);
 
   lexer_next_token (context_p);
   parser_parse_expression (context_p, PARSE_EXPR_NO_COMMA);
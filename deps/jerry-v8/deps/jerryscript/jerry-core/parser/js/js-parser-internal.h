@@ -80,6 +80,8 @@ typedef enum
   PARSER_MODULE_DEFAULT_CLASS_OR_FUNC = (1u << 24),  /**< parsing a function or class default export */
   PARSER_MODULE_STORE_IDENT = (1u << 25),     /**< store identifier of the current export statement */
 #endif /* ENABLED (JERRY_MODULE_SYSTEM) */
+  PARSER_ARGUMENTS_REGISTER = (1u << 26),     /**< arguments object is stored in a register
+                                               *   and it is created on demand */
   PARSER_HAS_LATE_LIT_INIT = (1u << 30),      /**< there are identifier or string literals which construction
                                                *   is postponed after the local parser data is freed */
 #ifndef JERRY_NDEBUG
@@ -140,6 +142,23 @@ typedef enum
  */
 #define PARSER_FUNCTION_CLOSURE (PARSER_IS_FUNCTION | PARSER_IS_CLOSURE)
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+/**
+ * Functions with any of these status flags are compiled eagerly,
+ * even if the scanner marked their body for lazy compilation.
+ */
+#if ENABLED (JERRY_ESNEXT)
+#define PARSER_LAZY_FUNCTION_EAGER_FLAGS \
+  (PARSER_INSIDE_WITH | PARSER_IS_PROPERTY_GETTER | PARSER_IS_PROPERTY_SETTER \
+   | PARSER_LEXICAL_BLOCK_NEEDED | PARSER_IS_ARROW_FUNCTION | PARSER_IS_GENERATOR_FUNCTION \
+   | PARSER_IS_ASYNC_FUNCTION | PARSER_FUNCTION_HAS_COMPLEX_ARGUMENT | PARSER_CLASS_CONSTRUCTOR \
+   | PARSER_ALLOW_SUPER)
+#else /* !ENABLED (JERRY_ESNEXT) */
+#define PARSER_LAZY_FUNCTION_EAGER_FLAGS \
+  (PARSER_INSIDE_WITH | PARSER_IS_PROPERTY_GETTER | PARSER_IS_PROPERTY_SETTER)
+#endif /* ENABLED (JERRY_ESNEXT) */
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 #if PARSER_MAXIMUM_CODE_SIZE <= UINT16_MAX
 /**
  * Maximum number of bytes for branch target.
@@ -495,6 +514,7 @@ typedef struct parser_saved_context_t
   uint16_t scope_stack_size;                  /**< size of scope stack */
   uint16_t scope_stack_top;                   /**< preserved top of scope stack */
   uint16_t scope_stack_reg_top;               /**< preserved top register of scope stack */
+  uint16_t arguments_register;                /**< preserved register of the arguments object */
 #if ENABLED (JERRY_ESNEXT)
   uint16_t scope_stack_global_end;            /**< end of global declarations of a function */
   ecma_value_t tagged_template_literal_cp;    /**< compessed pointer to the tagged template literal collection */
@@ -567,6 +587,8 @@ typedef struct
   uint16_t scope_stack_size;                  /**< size of scope stack */
   uint16_t scope_stack_top;                   /**< current top of scope stack */
   uint16_t scope_stack_reg_top;               /**< current top register of scope stack */
+  uint16_t arguments_register;                /**< register of the arguments object
+                                               *   (valid if PARSER_ARGUMENTS_REGISTER is set) */
 #if ENABLED (JERRY_ESNEXT)
   uint16_t scope_stack_global_end;            /**< end of global declarations of a function */
   ecma_value_t tagged_template_literal_cp;    /**< compessed pointer to the tagged template literal collection */
@@ -596,6 +618,15 @@ typedef struct
 #if ENABLED (JERRY_LINE_INFO)
   parser_line_counter_t last_line_info_line;  /**< last line where line info has been inserted */
 #endif /* ENABLED (JERRY_LINE_INFO) */
+
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  const uint8_t *lazy_source_start_p;         /**< start of the source buffer referenced by lazy functions
+                                               *   (NULL if lazy compilation is disabled) */
+  cbc_lazy_source_t *lazy_source_p;           /**< source buffer shared by the lazy functions of a lazily
+                                               *   compiled body (NULL for scripts, where every lazy
+                                               *   function copies its own source) */
+  const cbc_lazy_function_t *lazy_function_p; /**< lazy function which is compiled (NULL for scripts) */
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 } parser_context_t;
 
 /**
@@ -787,6 +818,10 @@ void scanner_release_switch_cases (scanner_case_info_t *case_p);
 void scanner_seek (parser_context_t *context_p);
 void scanner_reverse_info_list (parser_context_t *context_p);
 void scanner_cleanup (parser_context_t *context_p);
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+void scanner_release_function_body (parser_context_t *context_p, const uint8_t *end_p);
+void scanner_get_lazy_function_end (parser_context_t *context_p, scanner_location_t *location_p);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 
 bool scanner_is_context_needed (parser_context_t *context_p, parser_check_context_type_t check_type);
 #if ENABLED (JERRY_ESNEXT)
@@ -798,6 +833,7 @@ void scanner_create_variables (parser_context_t *context_p, uint32_t option_flag
 
 void scanner_get_location (scanner_location_t *location_p, parser_context_t *context_p);
 void scanner_set_location (parser_context_t *context_p, scanner_location_t *location_p);
+void scanner_set_start_position (parser_context_t *context_p, bool is_function_body);
 uint16_t scanner_decode_map_to (parser_scope_stack_t *stack_item_p);
 #if ENABLED (JERRY_ESNEXT)
 bool scanner_literal_is_const_reg (parser_context_t *context_p, uint16_t literal_index);
@@ -93,6 +93,15 @@
 
 #endif /* !PARSER_MAXIMUM_STACK_LIMIT */
 
+/**
+ * Minimum source size of a function (from its argument list to the end
+ * of its body) which is compiled lazily. Smaller functions are compiled
+ * eagerly, since their byte code is not larger than a lazy function header.
+ */
+#ifndef PARSER_LAZY_FUNCTION_MIN_SOURCE_SIZE
+#define PARSER_LAZY_FUNCTION_MIN_SOURCE_SIZE 64
+#endif /* !PARSER_LAZY_FUNCTION_MIN_SOURCE_SIZE */
+
 /* Checks. */
 
 #if (PARSER_MAXIMUM_STRING_LENGTH < 1) || (PARSER_MAXIMUM_STRING_LENGTH > PARSER_MAXIMUM_STRING_LIMIT)
@@ -966,12 +966,7 @@ parser_parse_do_while_statement_end (parser_context_t *context_p) /**< context *
   if (context_p->last_cbc_opcode != CBC_PUSH_FALSE)
   {
     cbc_opcode_t opcode = CBC_BRANCH_IF_TRUE_BACKWARD;
-    if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT)
-    {
-      context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
-      opcode = CBC_BRANCH_IF_FALSE_BACKWARD;
-    }
-    else if (context_p->last_cbc_opcode == CBC_PUSH_TRUE)
+    if (context_p->last_cbc_opcode == CBC_PUSH_TRUE)
     {
       context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
       opcode = CBC_JUMP_BACKWARD;
@@ -1083,12 +1078,7 @@ parser_parse_while_statement_end (parser_context_t *context_p) /**< context */
   }
 
   opcode = CBC_BRANCH_IF_TRUE_BACKWARD;
-  if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT)
-  {
-    context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
-    opcode = CBC_BRANCH_IF_FALSE_BACKWARD;
-  }
-  else if (context_p->last_cbc_opcode == CBC_PUSH_TRUE)
+  if (context_p->last_cbc_opcode == CBC_PUSH_TRUE)
   {
     context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
     opcode = CBC_JUMP_BACKWARD;
@@ -1665,12 +1655,7 @@ parser_parse_for_statement_end (parser_context_t *context_p) /**< context */
     }
 
     opcode = CBC_BRANCH_IF_TRUE_BACKWARD;
-    if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT)
-    {
-      context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
-      opcode = CBC_BRANCH_IF_FALSE_BACKWARD;
-    }
-    else if (context_p->last_cbc_opcode == CBC_PUSH_TRUE)
+    if (context_p->last_cbc_opcode == CBC_PUSH_TRUE)
     {
       context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
       opcode = CBC_JUMP_BACKWARD;
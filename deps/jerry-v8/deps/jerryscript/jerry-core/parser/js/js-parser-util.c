@@ -139,6 +139,71 @@ parser_print_literal (parser_context_t *context_p, /**< context */
 
 #endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
 
+/**
+ * Handle the uses of an arguments object which is stored in a register: the length and
+ * element reads are replaced by opcodes which access the arguments list directly, and
+ * any other use is preceded by an instruction which creates the arguments object.
+ */
+static void
+parser_flush_arguments_register (parser_context_t *context_p) /**< context */
+{
+  uint16_t last_opcode = context_p->last_cbc_opcode;
+  uint16_t arguments_register = context_p->arguments_register;
+
+  if (last_opcode == PARSER_TO_EXT_OPCODE (CBC_EXT_CREATE_ARGUMENTS))
+  {
+    return;
+  }
+
+  if (last_opcode == CBC_PUSH_PROP_LITERAL_LITERAL
+      && context_p->last_cbc.literal_index == arguments_register
+      && context_p->last_cbc.value != arguments_register)
+  {
+    uint16_t property_index = context_p->last_cbc.value;
+
+    if (property_index < PARSER_REGISTER_START)
+    {
+      lexer_literal_t *literal_p = PARSER_GET_LITERAL (property_index);
+
+      if (literal_p->type == LEXER_STRING_LITERAL
+          && literal_p->prop.length == 6
+          && memcmp (literal_p->u.char_p, "length", 6) == 0)
+      {
+        context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_ARGUMENTS_LENGTH);
+        return;
+      }
+    }
+
+    context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_ARGUMENTS_ELEMENT);
+    return;
+  }
+
+  uint8_t flags = (PARSER_IS_BASIC_OPCODE (last_opcode) ? cbc_flags[last_opcode]
+                                                        : cbc_ext_flags[PARSER_GET_EXT_OPCODE (last_opcode)]);
+
+  if (!(flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2)))
+  {
+    return;
+  }
+
+  if (context_p->last_cbc.literal_index != arguments_register
+      && (!(flags & CBC_HAS_LITERAL_ARG2)
+          || (context_p->last_cbc.value != arguments_register
+              && ((flags & CBC_HAS_LITERAL_ARG) || context_p->last_cbc.third_literal_index != arguments_register))))
+  {
+    return;
+  }
+
+  cbc_argument_t last_cbc = context_p->last_cbc;
+
+  context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (CBC_EXT_CREATE_ARGUMENTS);
+  context_p->last_cbc.literal_index = arguments_register;
+  parser_flush_cbc (context_p);
+
+  context_p->last_cbc_opcode = last_opcode;
+  context_p->last_cbc = last_cbc;
+} /* parser_flush_arguments_register */
+
 /**
  * Append the current byte code to the stream
  */
@@ -153,6 +218,12 @@ parser_flush_cbc (parser_context_t *context_p) /**< context */
     return;
   }
 
+  if (JERRY_UNLIKELY (context_p->status_flags & PARSER_ARGUMENTS_REGISTER))
+  {
+    parser_flush_arguments_register (context_p);
+    last_opcode = context_p->last_cbc_opcode;
+  }
+
   JERRY_ASSERT (last_opcode != PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_SUPER));
 
   context_p->status_flags |= PARSER_NO_END_LABEL;
@@ -509,6 +580,65 @@ parser_emit_line_info (parser_context_t *context_p, /**< context */
 
 #endif /* ENABLED (JERRY_LINE_INFO) */
 
+/**
+ * Fold a pending logical not operator into the conditional branch which follows it.
+ *
+ * The branch pops the value, so "!value; branch if true" is replaced by
+ * "branch if false" and vice versa. When the operand of the logical not
+ * is a literal, only the literal is pushed.
+ *
+ * @return the inverted opcode if the logical not is folded, the original opcode otherwise
+ */
+static uint16_t
+parser_fold_logical_not (parser_context_t *context_p, /**< context */
+                         uint16_t opcode) /**< branch opcode */
+{
+  uint16_t inverted_opcode;
+
+  switch (opcode)
+  {
+    case CBC_BRANCH_IF_TRUE_FORWARD:
+    {
+      inverted_opcode = CBC_BRANCH_IF_FALSE_FORWARD;
+      break;
+    }
+    case CBC_BRANCH_IF_FALSE_FORWARD:
+    {
+      inverted_opcode = CBC_BRANCH_IF_TRUE_FORWARD;
+      break;
+    }
+    case CBC_BRANCH_IF_TRUE_BACKWARD:
+    {
+      inverted_opcode = CBC_BRANCH_IF_FALSE_BACKWARD;
+      break;
+    }
+    case CBC_BRANCH_IF_FALSE_BACKWARD:
+    {
+      inverted_opcode = CBC_BRANCH_IF_TRUE_BACKWARD;
+      break;
+    }
+    default:
+    {
+      return opcode;
+    }
+  }
+
+  if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT)
+  {
+    context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+    return inverted_opcode;
+  }
+
+  if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT_LITERAL)
+  {
+    JERRY_ASSERT (CBC_SAME_ARGS (CBC_LOGICAL_NOT_LITERAL, CBC_PUSH_LITERAL));
+    context_p->last_cbc_opcode = CBC_PUSH_LITERAL;
+    return inverted_opcode;
+  }
+
+  return opcode;
+} /* parser_fold_logical_not */
+
 /**
  * Append a byte code with a branch argument
  */
@@ -520,6 +650,8 @@ parser_emit_cbc_forward_branch (parser_context_t *context_p, /**< context */
   uint8_t flags;
   uint32_t extra_byte_code_increase;
 
+  opcode = parser_fold_logical_not (context_p, opcode);
+
   if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
   {
     parser_flush_cbc (context_p);
@@ -623,6 +755,8 @@ parser_emit_cbc_backward_branch (parser_context_t *context_p, /**< context */
   const char *name;
 #endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
 
+  opcode = parser_fold_logical_not (context_p, opcode);
+
   if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
   {
     parser_flush_cbc (context_p);
@@ -1310,6 +1310,9 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     args_p->ident_end = ident_end;
     args_p->const_literal_end = const_literal_end;
     args_p->literal_end = context_p->literal_count;
+#if ENABLED (JERRY_JIT)
+    args_p->jit_counter = 0;
+#endif /* ENABLED (JERRY_JIT) */
 
     compiled_code_p->status_flags |= CBC_CODE_FLAGS_UINT16_ARGUMENTS;
     byte_code_p += sizeof (cbc_uint16_arguments_t);
@@ -1324,6 +1327,9 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     args_p->ident_end = (uint8_t) ident_end;
     args_p->const_literal_end = (uint8_t) const_literal_end;
     args_p->literal_end = (uint8_t) context_p->literal_count;
+#if ENABLED (JERRY_JIT)
+    args_p->jit_counter = 0;
+#endif /* ENABLED (JERRY_JIT) */
 
     byte_code_p += sizeof (cbc_uint8_arguments_t);
   }
@@ -2070,7 +2076,9 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
                      size_t source_size, /**< size of the source code */
                      ecma_value_t resource_name, /**< resource name */
                      uint32_t parse_opts, /**< ecma_parse_opts_t option bits */
-                     parser_error_location_t *error_location_p) /**< error location */
+                     parser_error_location_t *error_location_p, /**< error location */
+                     const ecma_compiled_code_t *lazy_code_p) /**< lazy function whose body is compiled
+                                                               *   (NULL for scripts) */
 {
   parser_context_t context;
   ecma_compiled_code_t *compiled_code_p;
@@ -2119,6 +2127,36 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
   JERRY_UNUSED (resource_name);
 #endif /* !ENABLED (JERRY_RESOURCE_NAME) */
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  context.lazy_source_start_p = NULL;
+  context.lazy_source_p = NULL;
+  context.lazy_function_p = (const cbc_lazy_function_t *) lazy_code_p;
+
+  bool allow_lazy_functions = !(parse_opts & (ECMA_PARSE_MODULE | ECMA_PARSE_EVAL | ECMA_PARSE_NO_LAZY_FUNCTIONS));
+
+#if ENABLED (JERRY_DEBUGGER)
+  if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
+  {
+    allow_lazy_functions = false;
+  }
+#endif /* ENABLED (JERRY_DEBUGGER) */
+
+  if (allow_lazy_functions)
+  {
+    if (lazy_code_p != NULL)
+    {
+      context.lazy_source_p = ECMA_GET_NON_NULL_POINTER (cbc_lazy_source_t, context.lazy_function_p->source_cp);
+      context.lazy_source_start_p = (const uint8_t *) (context.lazy_source_p + 1);
+    }
+    else if (arg_list_p == NULL)
+    {
+      context.lazy_source_start_p = source_p;
+    }
+  }
+#else /* !ENABLED (JERRY_LAZY_FUNCTIONS) */
+  JERRY_UNUSED (lazy_code_p);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
   scanner_info_t scanner_info_end;
   scanner_info_end.next_p = NULL;
   scanner_info_end.source_p = NULL;
@@ -2143,6 +2181,7 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
   context.scope_stack_size = 0;
   context.scope_stack_top = 0;
   context.scope_stack_reg_top = 0;
+  context.arguments_register = 0;
 #if ENABLED (JERRY_ESNEXT)
   context.scope_stack_global_end = 0;
   context.tagged_template_literal_cp = JMEM_CP_NULL;
@@ -2195,8 +2234,7 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
   }
 
   context.u.allocated_buffer_p = NULL;
-  context.line = 1;
-  context.column = 1;
+  scanner_set_start_position (&context, false);
   context.token.flags = 0;
 
   parser_stack_init (&context);
@@ -2233,8 +2271,7 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
 
       context.source_p = source_p;
       context.source_end_p = source_p + source_size;
-      context.line = 1;
-      context.column = 1;
+      scanner_set_start_position (&context, true);
 
       lexer_next_token (&context);
     }
@@ -2395,6 +2432,7 @@ parser_save_context (parser_context_t *context_p, /**< context */
   saved_context_p->scope_stack_size = context_p->scope_stack_size;
   saved_context_p->scope_stack_top = context_p->scope_stack_top;
   saved_context_p->scope_stack_reg_top = context_p->scope_stack_reg_top;
+  saved_context_p->arguments_register = context_p->arguments_register;
 #if ENABLED (JERRY_ESNEXT)
   saved_context_p->scope_stack_global_end = context_p->scope_stack_global_end;
   saved_context_p->tagged_template_literal_cp = context_p->tagged_template_literal_cp;
@@ -2468,6 +2506,7 @@ parser_restore_context (parser_context_t *context_p, /**< context */
   context_p->scope_stack_size = saved_context_p->scope_stack_size;
   context_p->scope_stack_top = saved_context_p->scope_stack_top;
   context_p->scope_stack_reg_top = saved_context_p->scope_stack_reg_top;
+  context_p->arguments_register = saved_context_p->arguments_register;
 #if ENABLED (JERRY_ESNEXT)
   context_p->scope_stack_global_end = saved_context_p->scope_stack_global_end;
   context_p->tagged_template_literal_cp = saved_context_p->tagged_template_literal_cp;
@@ -2478,6 +2517,136 @@ parser_restore_context (parser_context_t *context_p, /**< context */
 #endif /* !JERRY_NDEBUG */
 } /* parser_restore_context */
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+
+/**
+ * Size of a lazy function header including the function name.
+ */
+#if ENABLED (JERRY_ESNEXT)
+#define PARSER_LAZY_FUNCTION_SIZE \
+  JERRY_ALIGNUP (sizeof (cbc_lazy_function_t) + sizeof (ecma_value_t), JMEM_ALIGNMENT)
+#else /* !ENABLED (JERRY_ESNEXT) */
+#define PARSER_LAZY_FUNCTION_SIZE JERRY_ALIGNUP (sizeof (cbc_lazy_function_t), JMEM_ALIGNMENT)
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+/**
+ * Skip the body of a function and create a lazy function header for it.
+ * The argument list of the function is already parsed, the current
+ * token is the left brace of the function body.
+ *
+ * @return compiled code
+ */
+static ecma_compiled_code_t *
+parser_create_lazy_function (parser_context_t *context_p, /**< context */
+                             const scanner_location_t *arguments_start_p, /**< start of the argument list */
+                             const uint8_t *arguments_end_p, /**< end of the argument list */
+                             const scanner_location_t *body_start_p, /**< start of the function body */
+                             scanner_location_t *body_end_p) /**< closing brace of the function body */
+{
+  JERRY_ASSERT (context_p->token.type == LEXER_LEFT_BRACE);
+  JERRY_ASSERT (context_p->lazy_source_start_p != NULL);
+
+  /* The code generated for the argument list is not needed. */
+  scanner_release_function_body (context_p, body_end_p->source_p);
+  parser_free_literals (&context_p->literal_pool);
+  parser_list_reset (&context_p->literal_pool);
+  parser_cbc_stream_free (&context_p->byte_code);
+  parser_cbc_stream_init (&context_p->byte_code);
+  context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+
+  scanner_set_location (context_p, body_end_p);
+  lexer_next_token (context_p);
+  JERRY_ASSERT (context_p->token.type == LEXER_RIGHT_BRACE);
+
+  const size_t total_size = PARSER_LAZY_FUNCTION_SIZE;
+  cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) parser_malloc (context_p, total_size);
+  cbc_lazy_source_t *lazy_source_p = context_p->lazy_source_p;
+  const uint8_t *source_start_p = context_p->lazy_source_start_p;
+
+  if (lazy_source_p == NULL)
+  {
+    /* Functions of a script copy only their own source: the source buffer of the
+     * script may be released after parsing, and the top-level code, which runs
+     * only once, should not be kept alive by the functions it creates. The
+     * functions created by a lazily compiled body share the source of that body. */
+    source_start_p = arguments_start_p->source_p;
+    size_t source_size = (size_t) (body_end_p->source_p - source_start_p);
+
+    lazy_source_p = (cbc_lazy_source_t *) jmem_heap_alloc_block_null_on_error (sizeof (cbc_lazy_source_t)
+                                                                                + source_size);
+
+    if (lazy_source_p == NULL)
+    {
+      parser_free (lazy_function_p, total_size);
+      parser_raise_error (context_p, PARSER_ERR_OUT_OF_MEMORY);
+    }
+
+    lazy_source_p->refs = 0;
+    lazy_source_p->size = (uint32_t) source_size;
+    memcpy (lazy_source_p + 1, source_start_p, source_size);
+  }
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_allocate_byte_code_bytes (total_size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  ecma_compiled_code_t *compiled_code_p = &lazy_function_p->header.header;
+  uint16_t status_flags = (CBC_FUNCTION_TO_TYPE_BITS (CBC_FUNCTION_NORMAL)
+                           | CBC_CODE_FLAGS_UINT16_ARGUMENTS
+                           | CBC_CODE_FLAGS_LAZY_FUNCTION);
+
+  if (context_p->status_flags & PARSER_IS_STRICT)
+  {
+    status_flags |= CBC_CODE_FLAGS_STRICT_MODE;
+  }
+
+  compiled_code_p->size = (uint16_t) (total_size >> JMEM_ALIGNMENT_LOG);
+  compiled_code_p->refs = 1;
+  compiled_code_p->status_flags = status_flags;
+
+  /* Only the resource name is stored in the literal pool. */
+  lazy_function_p->header.stack_limit = 0;
+  lazy_function_p->header.argument_end = context_p->argument_count;
+  lazy_function_p->header.register_end = context_p->argument_count;
+  lazy_function_p->header.ident_end = context_p->argument_count;
+  lazy_function_p->header.const_literal_end = (uint16_t) (context_p->argument_count + 1);
+  lazy_function_p->header.literal_end = (uint16_t) (context_p->argument_count + 1);
+
+#if ENABLED (JERRY_RESOURCE_NAME)
+  lazy_function_p->resource_name = context_p->resource_name;
+#else /* !ENABLED (JERRY_RESOURCE_NAME) */
+  lazy_function_p->resource_name = ecma_make_magic_string_value (LIT_MAGIC_STRING_RESOURCE_ANON);
+#endif /* ENABLED (JERRY_RESOURCE_NAME) */
+
+  lazy_source_p->refs++;
+  ECMA_SET_NON_NULL_POINTER (lazy_function_p->source_cp, lazy_source_p);
+  lazy_function_p->compiled_code_cp = JMEM_CP_NULL;
+
+  lazy_function_p->arguments_start = (uint32_t) (arguments_start_p->source_p - source_start_p);
+  lazy_function_p->arguments_end = (uint32_t) (arguments_end_p - source_start_p);
+  lazy_function_p->body_start = (uint32_t) (body_start_p->source_p - source_start_p);
+  lazy_function_p->body_end = (uint32_t) (body_end_p->source_p - source_start_p);
+  lazy_function_p->arguments_line = arguments_start_p->line;
+  lazy_function_p->arguments_column = arguments_start_p->column;
+  lazy_function_p->body_line = body_start_p->line;
+  lazy_function_p->body_column = body_start_p->column;
+
+#if ENABLED (JERRY_ESNEXT)
+  *ecma_compiled_code_resolve_function_name (compiled_code_p) = ECMA_VALUE_EMPTY;
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+#if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
+  if (context_p->is_show_opcodes)
+  {
+    JERRY_DEBUG_MSG ("  Note: function body is compiled on the first call\n\n");
+  }
+#endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
+
+  return compiled_code_p;
+} /* parser_create_lazy_function */
+
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 /**
  * Parse function code
  *
@@ -2524,9 +2693,32 @@ parser_parse_function (parser_context_t *context_p, /**< context */
     parser_raise_error (context_p, PARSER_ERR_ARGUMENT_LIST_EXPECTED);
   }
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  scanner_location_t arguments_start;
+  scanner_location_t body_end;
+  const uint8_t *arguments_end_p = NULL;
+
+  scanner_get_location (&arguments_start, context_p);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
   lexer_next_token (context_p);
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  uint8_t function_info_flags = context_p->next_scanner_info_p->u8_arg;
+  bool is_lazy = (function_info_flags & SCANNER_FUNCTION_LAZY) != 0;
+
+  if (is_lazy)
+  {
+    scanner_get_lazy_function_end (context_p, &body_end);
+  }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
   parser_parse_function_arguments (context_p, LEXER_RIGHT_PAREN);
+
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  arguments_end_p = context_p->source_p - 1;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
   lexer_next_token (context_p);
 
   if ((context_p->status_flags & PARSER_IS_PROPERTY_GETTER)
@@ -2554,9 +2746,33 @@ parser_parse_function (parser_context_t *context_p, /**< context */
     parser_raise_error (context_p, PARSER_ERR_LEFT_BRACE_EXPECTED);
   }
 
-  lexer_next_token (context_p);
-  parser_parse_statements (context_p);
-  compiled_code_p = parser_post_processing (context_p);
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  if (is_lazy && !(context_p->status_flags & PARSER_LAZY_FUNCTION_EAGER_FLAGS))
+  {
+    scanner_location_t body_start;
+    scanner_get_location (&body_start, context_p);
+
+    if (function_info_flags & SCANNER_FUNCTION_IS_STRICT)
+    {
+      /* The body starts with a "use strict" directive. */
+      context_p->status_flags |= PARSER_IS_STRICT;
+    }
+
+    compiled_code_p = parser_create_lazy_function (context_p,
+                                                   &arguments_start,
+                                                   arguments_end_p,
+                                                   &body_start,
+                                                   &body_end);
+  }
+  else
+  {
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+    lexer_next_token (context_p);
+    parser_parse_statements (context_p);
+    compiled_code_p = parser_post_processing (context_p);
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 
 #if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
   if (context_p->is_show_opcodes)
@@ -2860,6 +3076,119 @@ parser_raise_error (parser_context_t *context_p, /**< context */
   JERRY_ASSERT (0);
 } /* parser_raise_error */
 
+/**
+ * Raise the exception which corresponds to a parse error.
+ */
+static void
+parser_raise_parse_error (parser_error_location_t *parser_error_p, /**< parse error */
+                          ecma_value_t resource_name) /**< resource name */
+{
+  if (parser_error_p->error == PARSER_ERR_OUT_OF_MEMORY)
+  {
+    /* It is unlikely that memory can be allocated in an out-of-memory
+     * situation. However, a simple value can still be thrown. */
+    jcontext_raise_exception (ECMA_VALUE_NULL);
+    return;
+  }
+
+  if (parser_error_p->error == PARSER_ERR_INVALID_REGEXP)
+  {
+    /* The RegExp compiler has already raised an exception. */
+    JERRY_ASSERT (jcontext_has_pending_exception ());
+    return;
+  }
+
+#if ENABLED (JERRY_ERROR_MESSAGES)
+  const lit_utf8_byte_t *err_bytes_p = (const lit_utf8_byte_t *) parser_error_to_string (parser_error_p->error);
+  lit_utf8_size_t err_bytes_size = lit_zt_utf8_string_size (err_bytes_p);
+
+  ecma_string_t *err_str_p = ecma_new_ecma_string_from_utf8 (err_bytes_p, err_bytes_size);
+  ecma_value_t err_str_val = ecma_make_string_value (err_str_p);
+  ecma_value_t line_str_val = ecma_make_uint32_value (parser_error_p->line);
+  ecma_value_t col_str_val = ecma_make_uint32_value (parser_error_p->column);
+
+  ecma_raise_standard_error_with_format (ECMA_ERROR_SYNTAX,
+                                         "% [%:%:%]",
+                                         err_str_val,
+                                         resource_name,
+                                         line_str_val,
+                                         col_str_val);
+
+  ecma_free_value (col_str_val);
+  ecma_free_value (line_str_val);
+  ecma_free_value (err_str_val);
+#else /* !ENABLED (JERRY_ERROR_MESSAGES) */
+  JERRY_UNUSED (resource_name);
+  ecma_raise_syntax_error ("");
+#endif /* ENABLED (JERRY_ERROR_MESSAGES) */
+} /* parser_raise_parse_error */
+
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+
+/**
+ * Compile the body of a lazy function. The compiled code is cached
+ * in the lazy function, so the body is compiled only once.
+ *
+ * Note:
+ *      an exception is raised if the function body has a syntax error
+ *
+ * @return pointer to compiled byte code - if success
+ *         NULL - otherwise
+ */
+ecma_compiled_code_t *
+parser_compile_lazy_function (ecma_compiled_code_t *lazy_code_p) /**< lazy function */
+{
+  JERRY_ASSERT (lazy_code_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION);
+
+  cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) lazy_code_p;
+
+  if (lazy_function_p->compiled_code_cp != JMEM_CP_NULL)
+  {
+    return ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t, lazy_function_p->compiled_code_cp);
+  }
+
+  cbc_lazy_source_t *lazy_source_p = ECMA_GET_NON_NULL_POINTER (cbc_lazy_source_t, lazy_function_p->source_cp);
+  const uint8_t *source_p = (const uint8_t *) (lazy_source_p + 1);
+  uint32_t parse_opts = ECMA_PARSE_NO_OPTS;
+
+  if (lazy_code_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE)
+  {
+    parse_opts |= ECMA_PARSE_STRICT_MODE;
+  }
+
+#if ENABLED (JERRY_ESNEXT)
+  parse_opts |= ECMA_PARSE_ALLOW_NEW_TARGET;
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+  parser_error_location_t parser_error;
+  ecma_compiled_code_t *compiled_code_p;
+
+  compiled_code_p = parser_parse_source (source_p + lazy_function_p->arguments_start,
+                                         lazy_function_p->arguments_end - lazy_function_p->arguments_start,
+                                         source_p + lazy_function_p->body_start,
+                                         lazy_function_p->body_end - lazy_function_p->body_start,
+                                         lazy_function_p->resource_name,
+                                         parse_opts,
+                                         &parser_error,
+                                         lazy_code_p);
+
+  if (JERRY_UNLIKELY (compiled_code_p == NULL))
+  {
+    parser_raise_parse_error (&parser_error, lazy_function_p->resource_name);
+    return NULL;
+  }
+
+#if ENABLED (JERRY_ESNEXT)
+  *ecma_compiled_code_resolve_function_name (compiled_code_p) = *ecma_compiled_code_resolve_function_name (lazy_code_p);
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+  /* The lazy function keeps the reference of the compiled code. */
+  ECMA_SET_NON_NULL_POINTER (lazy_function_p->compiled_code_cp, compiled_code_p);
+  return compiled_code_p;
+} /* parser_compile_lazy_function */
+
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 #endif /* ENABLED (JERRY_PARSER) */
 
 /**
@@ -2899,7 +3228,8 @@ parser_parse_script (const uint8_t *arg_list_p, /**< function argument list */
                                                           source_size,
                                                           resource_name,
                                                           parse_opts,
-                                                          &parser_error);
+                                                          &parser_error,
+                                                          NULL);
 
   if (JERRY_UNLIKELY (bytecode_p == NULL))
   {
@@ -2916,44 +3246,7 @@ parser_parse_script (const uint8_t *arg_list_p, /**< function argument list */
     }
 #endif /* ENABLED (JERRY_DEBUGGER) */
 
-    if (parser_error.error == PARSER_ERR_OUT_OF_MEMORY)
-    {
-      /* It is unlikely that memory can be allocated in an out-of-memory
-       * situation. However, a simple value can still be thrown. */
-      jcontext_raise_exception (ECMA_VALUE_NULL);
-      return NULL;
-    }
-
-    if (parser_error.error == PARSER_ERR_INVALID_REGEXP)
-    {
-      /* The RegExp compiler has already raised an exception. */
-      JERRY_ASSERT (jcontext_has_pending_exception ());
-      return NULL;
-    }
-
-#if ENABLED (JERRY_ERROR_MESSAGES)
-    const lit_utf8_byte_t *err_bytes_p = (const lit_utf8_byte_t *) parser_error_to_string (parser_error.error);
-    lit_utf8_size_t err_bytes_size = lit_zt_utf8_string_size (err_bytes_p);
-
-    ecma_string_t *err_str_p = ecma_new_ecma_string_from_utf8 (err_bytes_p, err_bytes_size);
-    ecma_value_t err_str_val = ecma_make_string_value (err_str_p);
-    ecma_value_t line_str_val = ecma_make_uint32_value (parser_error.line);
-    ecma_value_t col_str_val = ecma_make_uint32_value (parser_error.column);
-
-    ecma_raise_standard_error_with_format (ECMA_ERROR_SYNTAX,
-                                           "% [%:%:%]",
-                                           err_str_val,
-                                           resource_name,
-                                           line_str_val,
-                                           col_str_val);
-
-    ecma_free_value (col_str_val);
-    ecma_free_value (line_str_val);
-    ecma_free_value (err_str_val);
-#else /* !ENABLED (JERRY_ERROR_MESSAGES) */
-    ecma_raise_syntax_error ("");
-#endif /* ENABLED (JERRY_ERROR_MESSAGES) */
-
+    parser_raise_parse_error (&parser_error, resource_name);
     return NULL;
   }
 
@@ -199,6 +199,10 @@ parser_parse_script (const uint8_t *arg_list_p,
                      ecma_value_t resource_name,
                      uint32_t parse_opts);
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+ecma_compiled_code_t *parser_compile_lazy_function (ecma_compiled_code_t *lazy_code_p);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 #if ENABLED (JERRY_ERROR_MESSAGES)
 const char *parser_error_to_string (parser_error_t);
 #endif /* ENABLED (JERRY_ERROR_MESSAGES) */
@@ -69,6 +69,9 @@ typedef enum
   SCAN_STACK_WITH_EXPRESSION,              /**< expression part of "with" statements */
   SCAN_STACK_DO_STATEMENT,                 /**< statement part of "do" statements */
   SCAN_STACK_DO_EXPRESSION,                /**< expression part of "do" statements */
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  SCAN_STACK_LOOP_STATEMENT,               /**< statement part of "while" and "for" iterators */
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
   SCAN_STACK_WHILE_EXPRESSION,             /**< expression part of "while" iterator */
   SCAN_STACK_PAREN_EXPRESSION,             /**< expression in brackets */
   SCAN_STACK_STATEMENT_WITH_EXPR,          /**< statement which starts with expression enclosed in brackets */
@@ -131,6 +134,11 @@ typedef enum
 #if ENABLED (JERRY_DEBUGGER)
   SCANNER_CONTEXT_DEBUGGER_ENABLED = (1 << 1), /**< debugger is enabled */
 #endif /* ENABLED (JERRY_DEBUGGER) */
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  SCANNER_CONTEXT_SINGLE_STATEMENT = (1 << 2), /**< the next statement is the body of an if, else
+                                                *   or iteration statement */
+  SCANNER_CONTEXT_FOR_INITIALIZER = (1 << 3), /**< the declaration of a for statement has an initializer */
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 } scanner_context_flags_t;
 
 /**
@@ -290,6 +298,15 @@ typedef enum
   SCANNER_LITERAL_POOL_ASYNC = (1 << 11), /**< async function */
   SCANNER_LITERAL_POOL_HAS_SUPER_REFERENCE = (1 << 12), /**< function body contains super reference */
 #endif /* ENABLED (JERRY_ESNEXT) */
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  SCANNER_LITERAL_POOL_LAZY_BODY = (1 << 13), /**< the function body ends at the current right brace token
+                                               *   and it can be compiled lazily */
+  SCANNER_LITERAL_POOL_EAGER_BODY = (1 << 14), /**< the function body must be compiled eagerly: it is likely
+                                                *   called immediately, or it contains constructs whose early
+                                                *   errors are only detected by the parser */
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+  SCANNER_LITERAL_POOL_NAMED_FUNCTION = (1 << 15), /**< named function expression whose name has
+                                                    *   not been referenced so far */
 } scanner_literal_pool_flags_t;
 
 /**
@@ -316,6 +333,41 @@ typedef enum
 #define SCANNER_FROM_COMPUTED_TO_LITERAL_POOL(mode) \
   (((mode) - SCAN_STACK_COMPUTED_PROPERTY) << 10)
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+
+/**
+ * Assignment target types of the expression ending at a token.
+ */
+typedef enum
+{
+  SCANNER_TARGET_NONE, /**< not a valid assignment target */
+  SCANNER_TARGET_IDENTIFIER, /**< identifier reference */
+  SCANNER_TARGET_PROPERTY, /**< property reference */
+  SCANNER_TARGET_OBJECT, /**< can only be the base of a property reference (e.g. this, eval) */
+} scanner_target_types_t;
+
+/**
+ * Checks whether the target type is a valid assignment target.
+ */
+#define SCANNER_IS_ASSIGNMENT_TARGET(type) \
+  ((type) == SCANNER_TARGET_IDENTIFIER || (type) == SCANNER_TARGET_PROPERTY)
+
+/**
+ * Operators which precede the current operand of an expression. Used
+ * for detecting the invalid assignment targets reported by the parser.
+ */
+typedef enum
+{
+  SCANNER_OPERAND_NO_FLAGS = 0, /**< no operators */
+  SCANNER_OPERAND_AFTER_OPERATOR = (1 << 0), /**< the operand follows a unary or a non-assignment binary operator */
+  SCANNER_OPERAND_UPDATE = (1 << 1), /**< the operand follows a prefix increment or decrement */
+  SCANNER_OPERAND_DELETE = (1 << 2), /**< the operand follows a delete operator */
+  SCANNER_OPERAND_PROPERTY_BASE = (1 << 3), /**< the base of a property accessor is a reference
+                                             *   (only stored on the scanner stack) */
+} scanner_operand_flags_t;
+
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 /**
  * Local literal pool.
  */
@@ -326,6 +378,12 @@ typedef struct scanner_literal_pool_t
   parser_list_t literal_pool; /**< list of literal */
   uint16_t status_flags; /**< combination of scanner_literal_pool_flags_t flags */
   uint16_t no_declarations; /**< size of scope stack required during parsing */
+  lexer_lit_location_t function_name; /**< name of a named function expression
+                                       *   (valid only if SCANNER_LITERAL_POOL_NAMED_FUNCTION is set) */
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  uint16_t iteration_depth; /**< number of enclosing iteration statements in the current function */
+  uint16_t switch_depth; /**< number of enclosing switch statements in the current function */
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 } scanner_literal_pool_t;
 
 /**
@@ -348,6 +406,11 @@ struct scanner_context_t
 #if ENABLED (JERRY_ESNEXT)
   const uint8_t *async_source_p; /**< source position for async functions */
 #endif /* ENABLED (JERRY_ESNEXT) */
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  uint8_t operand_flags; /**< combination of scanner_operand_flags_t flags */
+  uint8_t target_type; /**< assignment target type of the current token */
+  uint8_t prev_target_type; /**< assignment target type of the previous token */
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 };
 
 /* Scanner utils. */
@@ -367,6 +430,11 @@ scanner_info_t *scanner_insert_info_before (parser_context_t *context_p, const u
 scanner_literal_pool_t *scanner_push_literal_pool (parser_context_t *context_p, scanner_context_t *scanner_context_p,
                                                    uint16_t status_flags);
 void scanner_pop_literal_pool (parser_context_t *context_p, scanner_context_t *scanner_context_p);
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+void scanner_check_lazy_function (parser_context_t *context_p, scanner_context_t *scanner_context_p);
+void scanner_require_eager_function (parser_context_t *context_p, scanner_context_t *scanner_context_p);
+void scanner_set_identifier_target (parser_context_t *context_p, scanner_context_t *scanner_context_p);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 #if ENABLED (JERRY_ESNEXT)
 void scanner_construct_global_block (parser_context_t *context_p, scanner_context_t *scanner_context_p);
 #endif /* ENABLED (JERRY_ESNEXT) */
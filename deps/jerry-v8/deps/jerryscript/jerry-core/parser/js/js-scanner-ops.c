@@ -183,6 +183,7 @@ scanner_check_arrow_arg (parser_context_t *context_p, /**< context */
 
   if (context_p->token.type == LEXER_THREE_DOTS)
   {
+    scanner_context_p->active_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_HAS_COMPLEX_ARGUMENT;
     lexer_next_token (context_p);
   }
 
@@ -211,6 +212,9 @@ scanner_check_arrow_arg (parser_context_t *context_p, /**< context */
       lexer_lit_location_t *argument_literal_p = scanner_append_argument (context_p, scanner_context_p);
 
       scanner_detect_eval_call (context_p, scanner_context_p);
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_set_identifier_target (context_p, scanner_context_p);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 
       lexer_next_token (context_p);
 
@@ -224,6 +228,8 @@ scanner_check_arrow_arg (parser_context_t *context_p, /**< context */
         break;
       }
 
+      scanner_context_p->active_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_HAS_COMPLEX_ARGUMENT;
+
       if (argument_literal_p->type & SCANNER_LITERAL_IS_USED)
       {
         JERRY_ASSERT (argument_literal_p->type & SCANNER_LITERAL_EARLY_CREATE);
@@ -240,6 +246,7 @@ scanner_check_arrow_arg (parser_context_t *context_p, /**< context */
     case LEXER_LEFT_SQUARE:
     case LEXER_LEFT_BRACE:
     {
+      scanner_context_p->active_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_HAS_COMPLEX_ARGUMENT;
       scanner_append_hole (context_p, scanner_context_p);
       scanner_push_destructuring_pattern (context_p, scanner_context_p, SCANNER_BINDING_ARROW_ARG, false);
 
@@ -343,6 +350,9 @@ scanner_check_function_after_if (parser_context_t *context_p, /**< context */
 {
   lexer_next_token (context_p);
   scanner_context_p->mode = SCAN_MODE_STATEMENT;
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  scanner_context_p->status_flags |= SCANNER_CONTEXT_SINGLE_STATEMENT;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 
   if (JERRY_UNLIKELY (context_p->token.type == LEXER_KEYW_FUNCTION))
   {
@@ -447,12 +447,112 @@ scanner_push_literal_pool (parser_context_t *context_p, /**< context */
   literal_pool_p->status_flags = status_flags;
   literal_pool_p->no_declarations = 0;
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  literal_pool_p->iteration_depth = 0;
+  literal_pool_p->switch_depth = 0;
+
+  if (!(status_flags & SCANNER_LITERAL_POOL_FUNCTION))
+  {
+    literal_pool_p->iteration_depth = prev_literal_pool_p->iteration_depth;
+    literal_pool_p->switch_depth = prev_literal_pool_p->switch_depth;
+  }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
   literal_pool_p->prev_p = prev_literal_pool_p;
   scanner_context_p->active_literal_pool_p = literal_pool_p;
 
   return literal_pool_p;
 } /* scanner_push_literal_pool */
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+
+/**
+ * Mark the body of the active function literal pool as lazily compiled
+ * when the function is eligible. The current token must be the closing
+ * brace of the function body.
+ */
+void
+scanner_check_lazy_function (parser_context_t *context_p, /**< context */
+                             scanner_context_t *scanner_context_p) /**< scanner context */
+{
+  scanner_literal_pool_t *literal_pool_p = scanner_context_p->active_literal_pool_p;
+
+  JERRY_ASSERT (literal_pool_p->status_flags & SCANNER_LITERAL_POOL_FUNCTION);
+  JERRY_ASSERT (context_p->token.type == LEXER_RIGHT_BRACE);
+
+  if (context_p->lazy_source_start_p == NULL || literal_pool_p->source_p == NULL)
+  {
+    return;
+  }
+
+#if ENABLED (JERRY_ESNEXT)
+  const uint16_t eager_flags = (SCANNER_LITERAL_POOL_EAGER_BODY
+                                | SCANNER_LITERAL_POOL_HAS_COMPLEX_ARGUMENT
+                                | SCANNER_LITERAL_POOL_ARROW
+                                | SCANNER_LITERAL_POOL_GENERATOR
+                                | SCANNER_LITERAL_POOL_ASYNC
+                                | SCANNER_LITERAL_POOL_HAS_SUPER_REFERENCE);
+#else /* !ENABLED (JERRY_ESNEXT) */
+  const uint16_t eager_flags = SCANNER_LITERAL_POOL_EAGER_BODY;
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+  if ((literal_pool_p->status_flags & eager_flags)
+      || (size_t) (context_p->source_p - literal_pool_p->source_p) < PARSER_LAZY_FUNCTION_MIN_SOURCE_SIZE)
+  {
+    return;
+  }
+
+  literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_LAZY_BODY;
+} /* scanner_check_lazy_function */
+
+/**
+ * Compile the bodies of the enclosing functions eagerly. Called when the scanner
+ * finds a construct whose early errors are only detected by the parser: skipping
+ * any of these bodies would delay these errors until the first call.
+ */
+void
+scanner_require_eager_function (parser_context_t *context_p, /**< context */
+                                scanner_context_t *scanner_context_p) /**< scanner context */
+{
+  if (context_p->lazy_source_start_p == NULL)
+  {
+    return;
+  }
+
+  scanner_literal_pool_t *literal_pool_p = scanner_context_p->active_literal_pool_p;
+  while (literal_pool_p != NULL)
+  {
+    if (literal_pool_p->status_flags & SCANNER_LITERAL_POOL_FUNCTION)
+    {
+      literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_EAGER_BODY;
+    }
+
+    literal_pool_p = literal_pool_p->prev_p;
+  }
+} /* scanner_require_eager_function */
+
+/**
+ * Sets the assignment target type of an identifier reference.
+ */
+void
+scanner_set_identifier_target (parser_context_t *context_p, /**< context */
+                               scanner_context_t *scanner_context_p) /**< scanner context */
+{
+  lexer_lit_location_t *literal_p = &context_p->token.lit_location;
+  uint8_t target_type = SCANNER_TARGET_IDENTIFIER;
+
+  /* Assigning these identifiers is a syntax error in strict mode. */
+  if (lexer_compare_identifier_to_string (literal_p, (const uint8_t *) "eval", 4)
+      || lexer_compare_identifier_to_string (literal_p, (const uint8_t *) "arguments", 9))
+  {
+    target_type = SCANNER_TARGET_OBJECT;
+  }
+
+  scanner_context_p->target_type = target_type;
+} /* scanner_set_identifier_target */
+
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 JERRY_STATIC_ASSERT (PARSER_MAXIMUM_IDENT_LENGTH <= UINT8_MAX,
                      maximum_ident_length_must_fit_in_a_byte);
 
@@ -499,10 +599,33 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
   uint16_t status_flags = literal_pool_p->status_flags;
   bool arguments_required = ((status_flags & (SCANNER_LITERAL_POOL_CAN_EVAL | SCANNER_LITERAL_POOL_NO_ARGUMENTS))
                              == SCANNER_LITERAL_POOL_CAN_EVAL);
+  bool arguments_no_reg = false;
+
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  bool require_eager = false;
+
+#if ENABLED (JERRY_ESNEXT)
+  const uint16_t unchecked_flags = (SCANNER_LITERAL_POOL_HAS_COMPLEX_ARGUMENT
+                                    | SCANNER_LITERAL_POOL_GENERATOR
+                                    | SCANNER_LITERAL_POOL_ASYNC
+                                    | SCANNER_LITERAL_POOL_HAS_SUPER_REFERENCE);
+
+  /* The scanner does not check the early errors of these functions, and
+   * the parser only parses them together with the enclosing function. */
+  if ((status_flags & SCANNER_LITERAL_POOL_FUNCTION) && (status_flags & unchecked_flags))
+  {
+    require_eager = true;
+  }
+#endif /* ENABLED (JERRY_ESNEXT) */
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 
   uint8_t can_eval_types = 0;
 #if ENABLED (JERRY_ESNEXT)
-  if (prev_literal_pool_p == NULL && !(context_p->global_status_flags & ECMA_PARSE_DIRECT_EVAL))
+  if (prev_literal_pool_p == NULL
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      && context_p->lazy_function_p == NULL
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+      && !(context_p->global_status_flags & ECMA_PARSE_DIRECT_EVAL))
   {
     can_eval_types |= SCANNER_LITERAL_IS_FUNC;
   }
@@ -522,6 +645,28 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
   }
 #endif /* ENABLED (JERRY_DEBUGGER) */
 
+  if (status_flags & SCANNER_LITERAL_POOL_NAMED_FUNCTION)
+  {
+    if (status_flags & SCANNER_LITERAL_POOL_CAN_EVAL)
+    {
+      status_flags &= (uint16_t) ~SCANNER_LITERAL_POOL_NAMED_FUNCTION;
+    }
+    else
+    {
+      parser_list_iterator_init (&literal_pool_p->literal_pool, &literal_iterator);
+
+      while ((literal_p = (lexer_lit_location_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
+      {
+        if (lexer_compare_identifiers (context_p, literal_p, &literal_pool_p->function_name))
+        {
+          /* The name is referenced (or redeclared) in the function body. */
+          status_flags &= (uint16_t) ~SCANNER_LITERAL_POOL_NAMED_FUNCTION;
+          break;
+        }
+      }
+    }
+  }
+
   parser_list_iterator_init (&literal_pool_p->literal_pool, &literal_iterator);
 
   const uint8_t *prev_source_p = literal_pool_p->source_p - 1;
@@ -537,6 +682,22 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
       continue;
     }
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+    const uint8_t declaration_types = (SCANNER_LITERAL_IS_ARG
+                                       | SCANNER_LITERAL_IS_VAR
+                                       | SCANNER_LITERAL_IS_FUNC
+                                       | SCANNER_LITERAL_IS_LOCAL);
+
+    /* Declaring these identifiers is a syntax error in strict mode. */
+    if ((type & declaration_types)
+        && (scanner_literal_is_arguments (literal_p)
+            || lexer_compare_identifier_to_string (literal_p, (const uint8_t *) "eval", 4)))
+    {
+      status_flags &= (uint16_t) ~SCANNER_LITERAL_POOL_LAZY_BODY;
+      require_eager = true;
+    }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
     if (!(status_flags & SCANNER_LITERAL_POOL_NO_ARGUMENTS) && scanner_literal_is_arguments (literal_p))
     {
       status_flags |= SCANNER_LITERAL_POOL_NO_ARGUMENTS;
@@ -547,6 +708,8 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
       }
       else
       {
+        /* The arguments object is accessed by an inner arrow function. */
+        arguments_no_reg = (type & SCANNER_LITERAL_NO_REG) != 0;
         literal_p->type = 0;
         arguments_required = true;
         continue;
@@ -686,20 +849,36 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
     }
   }
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  if (require_eager)
+  {
+    scanner_require_eager_function (context_p, scanner_context_p);
+  }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
   if ((status_flags & SCANNER_LITERAL_POOL_FUNCTION) || (compressed_size > 1))
   {
     compressed_size += sizeof (scanner_info_t);
 
+    size_t info_size = compressed_size;
+
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+    if (status_flags & SCANNER_LITERAL_POOL_LAZY_BODY)
+    {
+      info_size += sizeof (scanner_location_t);
+    }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
     scanner_info_t *info_p;
 
     if (prev_literal_pool_p != NULL || scanner_context_p->end_arguments_p == NULL)
     {
-      info_p = scanner_insert_info (context_p, literal_pool_p->source_p, compressed_size);
+      info_p = scanner_insert_info (context_p, literal_pool_p->source_p, info_size);
     }
     else
     {
       scanner_info_t *start_info_p = scanner_context_p->end_arguments_p;
-      info_p = scanner_insert_info_before (context_p, literal_pool_p->source_p, start_info_p, compressed_size);
+      info_p = scanner_insert_info_before (context_p, literal_pool_p->source_p, start_info_p, info_size);
     }
 
     if (no_declarations > PARSER_MAXIMUM_DEPTH_OF_SCOPE_STACK)
@@ -751,12 +930,29 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
           u8_arg |= SCANNER_FUNCTION_STATEMENT;
         }
       }
+#endif /* ENABLED (JERRY_ESNEXT) */
 
-      if (status_flags & SCANNER_LITERAL_POOL_CAN_EVAL)
+      if ((status_flags & SCANNER_LITERAL_POOL_CAN_EVAL) || arguments_no_reg)
       {
         u8_arg |= SCANNER_FUNCTION_LEXICAL_ENV_NEEDED;
       }
-#endif /* ENABLED (JERRY_ESNEXT) */
+
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      if (status_flags & SCANNER_LITERAL_POOL_LAZY_BODY)
+      {
+        u8_arg |= SCANNER_FUNCTION_LAZY;
+
+        if (status_flags & SCANNER_LITERAL_POOL_IS_STRICT)
+        {
+          u8_arg |= SCANNER_FUNCTION_IS_STRICT;
+        }
+      }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
+      if (status_flags & SCANNER_LITERAL_POOL_NAMED_FUNCTION)
+      {
+        u8_arg |= SCANNER_FUNCTION_NAME_UNUSED;
+      }
 
       info_p->u8_arg = u8_arg;
       info_p->u16_arg = (uint16_t) no_declarations;
@@ -913,6 +1109,21 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
     data_p[0] = SCANNER_STREAM_TYPE_END;
 
     JERRY_ASSERT (((uint8_t *) info_p) + compressed_size == data_p + 1);
+
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+    if (status_flags & SCANNER_LITERAL_POOL_LAZY_BODY)
+    {
+      /* The current token is the closing brace of the function body. */
+      scanner_location_t end_location;
+
+      JERRY_ASSERT (context_p->token.type == LEXER_RIGHT_BRACE);
+
+      end_location.source_p = context_p->source_p - 1;
+      end_location.line = context_p->token.line;
+      end_location.column = context_p->token.column;
+      memcpy (data_p + 1, &end_location, sizeof (scanner_location_t));
+    }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
   }
 
   if (!(status_flags & SCANNER_LITERAL_POOL_FUNCTION)
@@ -974,9 +1185,15 @@ scanner_filter_arguments (parser_context_t *context_p, /**< context */
   bool can_eval = (literal_pool_p->status_flags & SCANNER_LITERAL_POOL_CAN_EVAL) != 0;
   bool has_arguments = (literal_pool_p->status_flags & SCANNER_LITERAL_POOL_NO_ARGUMENTS) == 0;
 
-  if (can_eval && prev_literal_pool_p != NULL)
+  if (can_eval)
   {
-    prev_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_CAN_EVAL;
+    if (prev_literal_pool_p != NULL)
+    {
+      prev_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_CAN_EVAL;
+    }
+
+    /* The name of the function expression may be referenced by the eval call. */
+    literal_pool_p->status_flags &= (uint16_t) ~SCANNER_LITERAL_POOL_NAMED_FUNCTION;
   }
 
   literal_pool_p->status_flags &= (uint16_t) ~SCANNER_LITERAL_POOL_CAN_EVAL;
@@ -1077,6 +1294,13 @@ scanner_filter_arguments (parser_context_t *context_p, /**< context */
     }
     else if (prev_literal_pool_p != NULL)
     {
+      if ((new_literal_pool_p->status_flags & SCANNER_LITERAL_POOL_NAMED_FUNCTION)
+          && lexer_compare_identifiers (context_p, literal_p, &new_literal_pool_p->function_name))
+      {
+        /* The name is referenced by the argument list. */
+        new_literal_pool_p->status_flags &= (uint16_t) ~SCANNER_LITERAL_POOL_NAMED_FUNCTION;
+      }
+
       /* Propagate literal to upper level. */
       lexer_lit_location_t *literal_location_p = scanner_add_custom_literal (context_p,
                                                                              prev_literal_pool_p,
@@ -1269,6 +1493,11 @@ scanner_append_argument (parser_context_t *context_p, /**< context */
   {
     literal_p->length = 0;
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+    /* Duplicated arguments are reported by the parser. */
+    scanner_require_eager_function (context_p, scanner_context_p);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 #if ENABLED (JERRY_ESNEXT)
     if (literal_p->type & SCANNER_LITERAL_IS_USED)
     {
@@ -1471,6 +1700,11 @@ scanner_push_class_declaration (parser_context_t *context_p, /**< context */
 {
   JERRY_ASSERT (context_p->token.type == LEXER_KEYW_CLASS);
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  /* Class definitions are only checked by the parser. */
+  scanner_require_eager_function (context_p, scanner_context_p);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
   parser_stack_push_uint8 (context_p, stack_mode);
   scanner_source_start_t source_start;
   source_start.source_p = context_p->source_p;
@@ -1603,6 +1837,73 @@ scanner_reverse_info_list (parser_context_t *context_p) /**< context */
   context_p->next_scanner_info_p = last_scanner_info_p;
 } /* scanner_reverse_info_list */
 
+/**
+ * Release a scanner info block which is not processed by the parser.
+ */
+static void
+scanner_free_info (scanner_info_t *scanner_info_p) /**< scanner info block */
+{
+  size_t size = sizeof (scanner_info_t);
+
+  switch (scanner_info_p->type)
+  {
+    case SCANNER_TYPE_FUNCTION:
+    case SCANNER_TYPE_BLOCK:
+    {
+      size = scanner_get_stream_size (scanner_info_p, sizeof (scanner_info_t));
+
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      if (scanner_info_p->type == SCANNER_TYPE_FUNCTION
+          && (scanner_info_p->u8_arg & SCANNER_FUNCTION_LAZY))
+      {
+        size += sizeof (scanner_location_t);
+      }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+      break;
+    }
+    case SCANNER_TYPE_WHILE:
+    case SCANNER_TYPE_FOR_IN:
+#if ENABLED (JERRY_ESNEXT)
+    case SCANNER_TYPE_FOR_OF:
+#endif /* ENABLED (JERRY_ESNEXT) */
+    case SCANNER_TYPE_CASE:
+#if ENABLED (JERRY_ESNEXT)
+    case SCANNER_TYPE_INITIALIZER:
+#endif /* ENABLED (JERRY_ESNEXT) */
+    {
+      size = sizeof (scanner_location_info_t);
+      break;
+    }
+    case SCANNER_TYPE_FOR:
+    {
+      size = sizeof (scanner_for_info_t);
+      break;
+    }
+    case SCANNER_TYPE_SWITCH:
+    {
+      scanner_release_switch_cases (((scanner_switch_info_t *) scanner_info_p)->case_p);
+      size = sizeof (scanner_switch_info_t);
+      break;
+    }
+    default:
+    {
+#if ENABLED (JERRY_ESNEXT)
+      JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS
+                    || scanner_info_p->type == SCANNER_TYPE_LET_EXPRESSION
+                    || scanner_info_p->type == SCANNER_TYPE_CLASS_CONSTRUCTOR
+                    || scanner_info_p->type == SCANNER_TYPE_OBJECT_LITERAL_WITH_SUPER
+                    || scanner_info_p->type == SCANNER_TYPE_ERR_REDECLARED
+                    || scanner_info_p->type == SCANNER_TYPE_ERR_ASYNC_FUNCTION);
+#else /* !ENABLED (JERRY_ESNEXT) */
+      JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS);
+#endif /* ENABLED (JERRY_ESNEXT) */
+      break;
+    }
+  }
+
+  scanner_free (scanner_info_p, size);
+} /* scanner_free_info */
+
 /**
  * Release unused scanner info blocks.
  * This should happen only if an error is occured.
@@ -1623,62 +1924,13 @@ scanner_cleanup (parser_context_t *context_p) /**< context */
   {
     scanner_info_t *next_scanner_info_p = scanner_info_p->next_p;
 
-    size_t size = sizeof (scanner_info_t);
-
-    switch (scanner_info_p->type)
+    if (scanner_info_p->type == SCANNER_TYPE_END)
     {
-      case SCANNER_TYPE_END:
-      {
-        scanner_info_p = context_p->active_scanner_info_p;
-        continue;
-      }
-      case SCANNER_TYPE_FUNCTION:
-      case SCANNER_TYPE_BLOCK:
-      {
-        size = scanner_get_stream_size (scanner_info_p, sizeof (scanner_info_t));
-        break;
-      }
-      case SCANNER_TYPE_WHILE:
-      case SCANNER_TYPE_FOR_IN:
-#if ENABLED (JERRY_ESNEXT)
-      case SCANNER_TYPE_FOR_OF:
-#endif /* ENABLED (JERRY_ESNEXT) */
-      case SCANNER_TYPE_CASE:
-#if ENABLED (JERRY_ESNEXT)
-      case SCANNER_TYPE_INITIALIZER:
-#endif /* ENABLED (JERRY_ESNEXT) */
-      {
-        size = sizeof (scanner_location_info_t);
-        break;
-      }
-      case SCANNER_TYPE_FOR:
-      {
-        size = sizeof (scanner_for_info_t);
-        break;
-      }
-      case SCANNER_TYPE_SWITCH:
-      {
-        scanner_release_switch_cases (((scanner_switch_info_t *) scanner_info_p)->case_p);
-        size = sizeof (scanner_switch_info_t);
-        break;
-      }
-      default:
-      {
-#if ENABLED (JERRY_ESNEXT)
-        JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS
-                      || scanner_info_p->type == SCANNER_TYPE_LET_EXPRESSION
-                      || scanner_info_p->type == SCANNER_TYPE_CLASS_CONSTRUCTOR
-                      || scanner_info_p->type == SCANNER_TYPE_OBJECT_LITERAL_WITH_SUPER
-                      || scanner_info_p->type == SCANNER_TYPE_ERR_REDECLARED
-                      || scanner_info_p->type == SCANNER_TYPE_ERR_ASYNC_FUNCTION);
-#else /* !ENABLED (JERRY_ESNEXT) */
-        JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS);
-#endif /* ENABLED (JERRY_ESNEXT) */
-        break;
-      }
+      scanner_info_p = context_p->active_scanner_info_p;
+      continue;
     }
 
-    scanner_free (scanner_info_p, size);
+    scanner_free_info (scanner_info_p);
     scanner_info_p = next_scanner_info_p;
   }
 
@@ -1686,6 +1938,48 @@ scanner_cleanup (parser_context_t *context_p) /**< context */
   context_p->active_scanner_info_p = NULL;
 } /* scanner_cleanup */
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+
+/**
+ * Release the scanner info blocks of a function body which is not parsed.
+ */
+void
+scanner_release_function_body (parser_context_t *context_p, /**< context */
+                               const uint8_t *end_p) /**< end of the function body */
+{
+  scanner_info_t *scanner_info_p = context_p->next_scanner_info_p;
+
+  while (scanner_info_p->type != SCANNER_TYPE_END
+         && scanner_info_p->source_p != NULL
+         && scanner_info_p->source_p < end_p)
+  {
+    scanner_info_t *next_scanner_info_p = scanner_info_p->next_p;
+
+    scanner_free_info (scanner_info_p);
+    scanner_info_p = next_scanner_info_p;
+  }
+
+  context_p->next_scanner_info_p = scanner_info_p;
+} /* scanner_release_function_body */
+
+/**
+ * Get the location of the closing brace of a lazily compiled function body.
+ * The next scanner info must be the info block of the function.
+ */
+void
+scanner_get_lazy_function_end (parser_context_t *context_p, /**< context */
+                               scanner_location_t *location_p) /**< [out] location */
+{
+  scanner_info_t *info_p = context_p->next_scanner_info_p;
+
+  JERRY_ASSERT (info_p->type == SCANNER_TYPE_FUNCTION && (info_p->u8_arg & SCANNER_FUNCTION_LAZY));
+
+  const uint8_t *data_p = ((const uint8_t *) info_p) + scanner_get_stream_size (info_p, sizeof (scanner_info_t));
+  memcpy (location_p, data_p, sizeof (scanner_location_t));
+} /* scanner_get_lazy_function_end */
+
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 /**
  * Checks whether a context needs to be created for a block.
  *
@@ -2440,16 +2734,45 @@ scanner_create_variables (parser_context_t *context_p, /**< context */
       parser_raise_error (context_p, PARSER_ERR_SCOPE_STACK_LIMIT_REACHED);
     }
 
-    context_p->status_flags |= PARSER_ARGUMENTS_NEEDED | PARSER_LEXICAL_ENV_NEEDED;
-
     lexer_construct_literal_object (context_p, &lexer_arguments_literal, lexer_arguments_literal.type);
 
     scope_stack_p->map_from = context_p->lit_object.index;
+
 #if ENABLED (JERRY_ESNEXT)
-    scope_stack_p->map_to = 0;
+    const uint32_t no_register_flags = (PARSER_IS_GENERATOR_FUNCTION | PARSER_IS_ASYNC_FUNCTION);
 #else /* !ENABLED (JERRY_ESNEXT) */
-    scope_stack_p->map_to = context_p->lit_object.index;
+    const uint32_t no_register_flags = 0;
 #endif /* ENABLED (JERRY_ESNEXT) */
+
+    if ((context_p->status_flags & (PARSER_IS_STRICT | no_register_flags)) == PARSER_IS_STRICT
+        && !(info_u8_arg & SCANNER_FUNCTION_LEXICAL_ENV_NEEDED)
+        && scope_stack_reg_top < PARSER_MAXIMUM_NUMBER_OF_REGISTERS)
+    {
+      /* The unmapped arguments object is only accessed by the function body, so it is
+       * stored in a register and created when it is first used as an object. Reading
+       * its length or its elements is performed directly on the arguments list. */
+      context_p->status_flags |= PARSER_ARGUMENTS_REGISTER;
+      context_p->arguments_register = (uint16_t) (PARSER_REGISTER_START + scope_stack_reg_top);
+
+#if ENABLED (JERRY_ESNEXT)
+      scope_stack_p->map_to = (uint16_t) (scope_stack_reg_top + 1);
+#else /* !ENABLED (JERRY_ESNEXT) */
+      scope_stack_p->map_to = context_p->arguments_register;
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+      scope_stack_reg_top++;
+    }
+    else
+    {
+      context_p->status_flags |= PARSER_ARGUMENTS_NEEDED | PARSER_LEXICAL_ENV_NEEDED;
+
+#if ENABLED (JERRY_ESNEXT)
+      scope_stack_p->map_to = 0;
+#else /* !ENABLED (JERRY_ESNEXT) */
+      scope_stack_p->map_to = context_p->lit_object.index;
+#endif /* ENABLED (JERRY_ESNEXT) */
+    }
+
     scope_stack_p++;
   }
 
@@ -2470,7 +2793,16 @@ scanner_create_variables (parser_context_t *context_p, /**< context */
 
   if (!(option_flags & SCANNER_CREATE_VARS_IS_FUNCTION_ARGS))
   {
-    scanner_release_next (context_p, (size_t) (next_data_p + 1 - ((const uint8_t *) info_p)));
+    size_t info_size = (size_t) (next_data_p + 1 - ((const uint8_t *) info_p));
+
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+    if (info_type == SCANNER_TYPE_FUNCTION && (info_u8_arg & SCANNER_FUNCTION_LAZY))
+    {
+      info_size += sizeof (scanner_location_t);
+    }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
+    scanner_release_next (context_p, info_size);
   }
   parser_flush_cbc (context_p);
 } /* scanner_create_variables */
@@ -2487,6 +2819,38 @@ scanner_get_location (scanner_location_t *location_p, /**< location */
   location_p->column = context_p->column;
 } /* scanner_get_location */
 
+/**
+ * Set the line and column of the first character of the source code or the function body.
+ */
+void
+scanner_set_start_position (parser_context_t *context_p, /**< context */
+                            bool is_function_body) /**< function body is started */
+{
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  const cbc_lazy_function_t *lazy_function_p = context_p->lazy_function_p;
+
+  if (lazy_function_p != NULL)
+  {
+    if (is_function_body)
+    {
+      context_p->line = (parser_line_counter_t) lazy_function_p->body_line;
+      context_p->column = (parser_line_counter_t) lazy_function_p->body_column;
+    }
+    else
+    {
+      context_p->line = (parser_line_counter_t) lazy_function_p->arguments_line;
+      context_p->column = (parser_line_counter_t) lazy_function_p->arguments_column;
+    }
+    return;
+  }
+#else /* !ENABLED (JERRY_LAZY_FUNCTIONS) */
+  JERRY_UNUSED (is_function_body);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
+  context_p->line = 1;
+  context_p->column = 1;
+} /* scanner_set_start_position */
+
 /**
  * Set context location.
  */
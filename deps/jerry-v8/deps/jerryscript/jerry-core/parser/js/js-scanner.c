@@ -66,6 +66,139 @@ JERRY_STATIC_ASSERT (SCANNER_FROM_COMPUTED_TO_LITERAL_POOL (SCAN_STACK_COMPUTED_
 
 #endif /* ENABLED (JERRY_ESNEXT) */
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+
+/**
+ * Checks whether the current function keyword is preceded by a left paren or a
+ * logical not operator. Such function expressions are usually invoked immediately,
+ * so compiling them lazily would only parse their body twice.
+ *
+ * @return true - if the function expression is likely invoked immediately,
+ *         false - otherwise
+ */
+static bool
+scanner_function_is_parenthesized (parser_context_t *context_p) /**< context */
+{
+  const uint8_t *source_start_p = context_p->lazy_source_start_p;
+  const uint8_t *source_p = context_p->source_p - (sizeof ("function") - 1);
+
+  if (source_start_p == NULL)
+  {
+    return false;
+  }
+
+  while (source_p > source_start_p)
+  {
+    source_p--;
+
+    switch (*source_p)
+    {
+      case LIT_CHAR_SP:
+      case LIT_CHAR_TAB:
+      case LIT_CHAR_LF:
+      case LIT_CHAR_CR:
+      {
+        continue;
+      }
+      case LIT_CHAR_LEFT_PAREN:
+      case LIT_CHAR_EXCLAMATION:
+      {
+        return true;
+      }
+      default:
+      {
+        return false;
+      }
+    }
+  }
+
+  return false;
+} /* scanner_function_is_parenthesized */
+
+/**
+ * Checks the statement of an if, else or iteration statement. The parser
+ * reports a syntax error for most declarations in these positions.
+ */
+static void
+scanner_check_single_statement (parser_context_t *context_p, /**< context */
+                                scanner_context_t *scanner_context_p) /**< scanner context */
+{
+  switch (context_p->token.type)
+  {
+    case LEXER_KEYW_FUNCTION:
+#if ENABLED (JERRY_ESNEXT)
+    case LEXER_KEYW_LET:
+    case LEXER_KEYW_CONST:
+    case LEXER_KEYW_CLASS:
+#endif /* ENABLED (JERRY_ESNEXT) */
+    {
+      break;
+    }
+#if ENABLED (JERRY_ESNEXT)
+    case LEXER_LITERAL:
+    {
+      if (lexer_token_is_let (context_p) || lexer_token_is_async (context_p))
+      {
+        break;
+      }
+      return;
+    }
+#endif /* ENABLED (JERRY_ESNEXT) */
+    default:
+    {
+      return;
+    }
+  }
+
+  scanner_require_eager_function (context_p, scanner_context_p);
+} /* scanner_check_single_statement */
+
+/**
+ * Checks the operand of a prefix increment, decrement or delete operator
+ * when the operand ends before the current token.
+ */
+static void
+scanner_check_operand_end (parser_context_t *context_p, /**< context */
+                           scanner_context_t *scanner_context_p) /**< scanner context */
+{
+  uint8_t operand_flags = scanner_context_p->operand_flags;
+  uint8_t target_type = scanner_context_p->prev_target_type;
+
+  if (operand_flags & SCANNER_OPERAND_UPDATE)
+  {
+    if (!SCANNER_IS_ASSIGNMENT_TARGET (target_type))
+    {
+      scanner_require_eager_function (context_p, scanner_context_p);
+    }
+  }
+  else if ((operand_flags & SCANNER_OPERAND_DELETE)
+           && (target_type == SCANNER_TARGET_IDENTIFIER || target_type == SCANNER_TARGET_OBJECT))
+  {
+    /* Deleting an identifier is a syntax error in strict mode. */
+    scanner_require_eager_function (context_p, scanner_context_p);
+  }
+
+  scanner_context_p->operand_flags = (uint8_t) (operand_flags & ~(SCANNER_OPERAND_UPDATE | SCANNER_OPERAND_DELETE));
+} /* scanner_check_operand_end */
+
+/**
+ * Checks the left hand side expression of an assignment or a for-in / for-of
+ * statement which ends before the current token.
+ */
+static void
+scanner_check_assignment_target (parser_context_t *context_p, /**< context */
+                                 scanner_context_t *scanner_context_p, /**< scanner context */
+                                 uint8_t operand_flags) /**< operand flags of the expression */
+{
+  if (!SCANNER_IS_ASSIGNMENT_TARGET (scanner_context_p->prev_target_type)
+      || (operand_flags & SCANNER_OPERAND_AFTER_OPERATOR))
+  {
+    scanner_require_eager_function (context_p, scanner_context_p);
+  }
+} /* scanner_check_assignment_target */
+
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 /**
  * Scan primary expression.
  *
@@ -77,15 +210,35 @@ scanner_scan_primary_expression (parser_context_t *context_p, /**< context */
                                  lexer_token_type_t type, /**< current token type */
                                  scan_stack_modes_t stack_top) /**< current stack top */
 {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  if (scanner_context_p->operand_flags & (SCANNER_OPERAND_UPDATE | SCANNER_OPERAND_DELETE))
+  {
+    bool is_reference = (type == LEXER_KEYW_THIS
+                         || type == LEXER_KEYW_SUPER
+                         || (type == LEXER_LITERAL && context_p->token.lit_location.type == LEXER_IDENT_LITERAL));
+
+    if ((scanner_context_p->operand_flags & SCANNER_OPERAND_UPDATE) ? !is_reference : (type == LEXER_LEFT_PAREN))
+    {
+      scanner_require_eager_function (context_p, scanner_context_p);
+    }
+  }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
   switch (type)
   {
     case LEXER_KEYW_NEW:
     {
       scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION_AFTER_NEW;
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_context_p->operand_flags |= SCANNER_OPERAND_AFTER_OPERATOR;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 
 #if ENABLED (JERRY_ESNEXT)
       if (scanner_try_scan_new_target (context_p))
       {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+        scanner_require_eager_function (context_p, scanner_context_p);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
         scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
       }
 #endif /* ENABLED (JERRY_ESNEXT) */
@@ -102,6 +255,13 @@ scanner_scan_primary_expression (parser_context_t *context_p, /**< context */
     {
       uint16_t status_flags = SCANNER_LITERAL_POOL_FUNCTION;
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      if (scanner_function_is_parenthesized (context_p))
+      {
+        status_flags |= SCANNER_LITERAL_POOL_EAGER_BODY;
+      }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 #if ENABLED (JERRY_ESNEXT)
       if (scanner_context_p->async_source_p != NULL)
       {
@@ -114,13 +274,15 @@ scanner_scan_primary_expression (parser_context_t *context_p, /**< context */
       }
 #endif /* ENABLED (JERRY_ESNEXT) */
 
-      scanner_push_literal_pool (context_p, scanner_context_p, status_flags);
+      scanner_literal_pool_t *literal_pool_p = scanner_push_literal_pool (context_p, scanner_context_p, status_flags);
 
       lexer_next_token (context_p);
 
       if (context_p->token.type == LEXER_LITERAL
           && context_p->token.lit_location.type == LEXER_IDENT_LITERAL)
       {
+        literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_NAMED_FUNCTION;
+        literal_pool_p->function_name = context_p->token.lit_location;
         lexer_next_token (context_p);
       }
 
@@ -130,6 +292,9 @@ scanner_scan_primary_expression (parser_context_t *context_p, /**< context */
     }
     case LEXER_LEFT_PAREN:
     {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_context_p->operand_flags = SCANNER_OPERAND_NO_FLAGS;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       scanner_scan_bracket (context_p, scanner_context_p);
       return SCAN_KEEP_TOKEN;
     }
@@ -189,6 +354,9 @@ scanner_scan_primary_expression (parser_context_t *context_p, /**< context */
       if (context_p->token.lit_location.type == LEXER_IDENT_LITERAL)
       {
         scanner_add_reference (context_p, scanner_context_p);
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+        scanner_set_identifier_target (context_p, scanner_context_p);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       }
       /* FALLTHRU */
     }
@@ -197,12 +365,21 @@ scanner_scan_primary_expression (parser_context_t *context_p, /**< context */
     case LEXER_LIT_FALSE:
     case LEXER_LIT_NULL:
     {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      if (type == LEXER_KEYW_THIS)
+      {
+        scanner_context_p->target_type = SCANNER_TARGET_OBJECT;
+      }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
       break;
     }
 #if ENABLED (JERRY_ESNEXT)
     case LEXER_KEYW_SUPER:
     {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_context_p->target_type = SCANNER_TARGET_OBJECT;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       scanner_context_p->active_literal_pool_p->status_flags |= SCANNER_LITERAL_POOL_HAS_SUPER_REFERENCE;
       scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
       break;
@@ -314,10 +491,24 @@ scanner_scan_post_primary_expression (parser_context_t *context_p, /**< context
         scanner_raise_error (context_p);
       }
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      if (scanner_context_p->prev_target_type != SCANNER_TARGET_NONE)
+      {
+        scanner_context_p->target_type = SCANNER_TARGET_PROPERTY;
+      }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       return true;
     }
     case LEXER_LEFT_PAREN:
     {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      if (scanner_context_p->operand_flags & SCANNER_OPERAND_UPDATE)
+      {
+        scanner_require_eager_function (context_p, scanner_context_p);
+      }
+
+      scanner_context_p->operand_flags = SCANNER_OPERAND_NO_FLAGS;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       parser_stack_push_uint8 (context_p, SCAN_STACK_PAREN_EXPRESSION);
       scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
       return true;
@@ -325,6 +516,14 @@ scanner_scan_post_primary_expression (parser_context_t *context_p, /**< context
 #if ENABLED (JERRY_ESNEXT)
     case LEXER_TEMPLATE_LITERAL:
     {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      if (scanner_context_p->operand_flags & SCANNER_OPERAND_UPDATE)
+      {
+        scanner_require_eager_function (context_p, scanner_context_p);
+      }
+
+      scanner_context_p->operand_flags = SCANNER_OPERAND_NO_FLAGS;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       if (JERRY_UNLIKELY (context_p->source_p[-1] != LIT_CHAR_GRAVE_ACCENT))
       {
         scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
@@ -335,6 +534,17 @@ scanner_scan_post_primary_expression (parser_context_t *context_p, /**< context
 #endif /* ENABLED (JERRY_ESNEXT) */
     case LEXER_LEFT_SQUARE:
     {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      uint8_t saved_flags = scanner_context_p->operand_flags;
+
+      if (scanner_context_p->prev_target_type != SCANNER_TARGET_NONE)
+      {
+        saved_flags |= SCANNER_OPERAND_PROPERTY_BASE;
+      }
+
+      parser_stack_push_uint8 (context_p, saved_flags);
+      scanner_context_p->operand_flags = SCANNER_OPERAND_NO_FLAGS;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       parser_stack_push_uint8 (context_p, SCAN_STACK_PROPERTY_ACCESSOR);
       scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
       return true;
@@ -349,6 +559,17 @@ scanner_scan_post_primary_expression (parser_context_t *context_p, /**< context
         return false;
       }
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      if (!SCANNER_IS_ASSIGNMENT_TARGET (scanner_context_p->prev_target_type)
+          || (scanner_context_p->operand_flags & SCANNER_OPERAND_UPDATE))
+      {
+        scanner_require_eager_function (context_p, scanner_context_p);
+      }
+
+      scanner_context_p->operand_flags &= (uint8_t) ~(SCANNER_OPERAND_UPDATE | SCANNER_OPERAND_DELETE);
+      scanner_context_p->prev_target_type = SCANNER_TARGET_NONE;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
       lexer_next_token (context_p);
       type = (lexer_token_type_t) context_p->token.type;
 
@@ -360,6 +581,10 @@ scanner_scan_post_primary_expression (parser_context_t *context_p, /**< context
     }
     case LEXER_QUESTION_MARK:
     {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_check_operand_end (context_p, scanner_context_p);
+      scanner_context_p->operand_flags = SCANNER_OPERAND_NO_FLAGS;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       parser_stack_push_uint8 (context_p, SCAN_STACK_COLON_EXPRESSION);
       scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
       return true;
@@ -373,6 +598,26 @@ scanner_scan_post_primary_expression (parser_context_t *context_p, /**< context
   if (LEXER_IS_BINARY_OP_TOKEN (type)
       && (type != LEXER_KEYW_IN || !SCANNER_IS_FOR_START (stack_top)))
   {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+    if (LEXER_IS_BINARY_LVALUE_TOKEN (type))
+    {
+      scanner_check_assignment_target (context_p, scanner_context_p, scanner_context_p->operand_flags);
+      scanner_context_p->operand_flags = SCANNER_OPERAND_NO_FLAGS;
+    }
+    else
+    {
+#if ENABLED (JERRY_ESNEXT)
+      /* The parser rejects mixing ?? with || or &&, and unary expressions before **. */
+      if (type == LEXER_NULLISH_COALESCING || type == LEXER_EXPONENTIATION)
+      {
+        scanner_require_eager_function (context_p, scanner_context_p);
+      }
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+      scanner_check_operand_end (context_p, scanner_context_p);
+      scanner_context_p->operand_flags |= SCANNER_OPERAND_AFTER_OPERATOR;
+    }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
     scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
     return true;
   }
@@ -391,6 +636,12 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
                                      lexer_token_type_t type, /**< current token type */
                                      scan_stack_modes_t stack_top) /**< current stack top */
 {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  /* The expression after the current token starts with a new operand. */
+  uint8_t operand_flags = scanner_context_p->operand_flags;
+  scanner_context_p->operand_flags = SCANNER_OPERAND_NO_FLAGS;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
   if (type == LEXER_COMMA)
   {
     switch (stack_top)
@@ -512,6 +763,11 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
 
       scanner_get_location (&location_info_p->location, context_p);
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_context_p->status_flags |= SCANNER_CONTEXT_SINGLE_STATEMENT;
+      scanner_context_p->active_literal_pool_p->iteration_depth++;
+      parser_stack_push_uint8 (context_p, SCAN_STACK_LOOP_STATEMENT);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       scanner_context_p->mode = SCAN_MODE_STATEMENT;
       return SCAN_NEXT_TOKEN;
     }
@@ -551,6 +807,9 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
       }
 #endif /* ENABLED (JERRY_ESNEXT) */
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_context_p->status_flags |= SCANNER_CONTEXT_SINGLE_STATEMENT;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       scanner_context_p->mode = SCAN_MODE_STATEMENT;
       return SCAN_NEXT_TOKEN;
     }
@@ -639,6 +898,20 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
       {
         scanner_for_statement_t for_statement;
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+        if (stack_top == SCAN_STACK_FOR_START)
+        {
+          scanner_check_assignment_target (context_p, scanner_context_p, operand_flags);
+        }
+        else if (scanner_context_p->status_flags & SCANNER_CONTEXT_FOR_INITIALIZER)
+        {
+          /* Initializers of for-in and for-of declarations are reported by the parser. */
+          scanner_require_eager_function (context_p, scanner_context_p);
+        }
+
+        scanner_context_p->status_flags &= (uint16_t) ~SCANNER_CONTEXT_FOR_INITIALIZER;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
         parser_stack_pop_uint8 (context_p);
         parser_stack_pop (context_p, &for_statement, sizeof (scanner_for_statement_t));
 
@@ -659,6 +932,10 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
 
         scanner_get_location (&location_info->location, context_p);
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+        scanner_context_p->active_literal_pool_p->iteration_depth++;
+        parser_stack_push_uint8 (context_p, SCAN_STACK_LOOP_STATEMENT);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
         parser_stack_push_uint8 (context_p, SCAN_STACK_STATEMENT_WITH_EXPR);
         scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION;
         return SCAN_NEXT_TOKEN;
@@ -671,6 +948,10 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
 
       scanner_for_statement_t for_statement;
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_context_p->status_flags &= (uint16_t) ~SCANNER_CONTEXT_FOR_INITIALIZER;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
       parser_stack_pop_uint8 (context_p);
       parser_stack_pop (context_p, NULL, sizeof (scanner_for_statement_t));
 
@@ -747,6 +1028,11 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
 
       scanner_get_location (&for_statement.u.for_info_p->end_location, context_p);
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_context_p->status_flags |= SCANNER_CONTEXT_SINGLE_STATEMENT;
+      scanner_context_p->active_literal_pool_p->iteration_depth++;
+      parser_stack_push_uint8 (context_p, SCAN_STACK_LOOP_STATEMENT);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       scanner_context_p->mode = SCAN_MODE_STATEMENT;
       return SCAN_NEXT_TOKEN;
     }
@@ -775,6 +1061,9 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
       scanner_switch_statement_t switch_statement = scanner_context_p->active_switch_statement;
       parser_stack_push (context_p, &switch_statement, sizeof (scanner_switch_statement_t));
       parser_stack_push_uint8 (context_p, SCAN_STACK_SWITCH_BLOCK);
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_context_p->active_literal_pool_p->switch_depth++;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 
       scanner_switch_info_t *switch_info_p;
       switch_info_p = (scanner_switch_info_t *) scanner_insert_info (context_p,
@@ -880,6 +1169,17 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
           scanner_pop_binding_list (scanner_context_p);
         }
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+        if (binding_type != SCANNER_BINDING_NONE
+            && (context_p->stack_top_uint8 == SCAN_STACK_VAR
+                || context_p->stack_top_uint8 == SCAN_STACK_LET
+                || context_p->stack_top_uint8 == SCAN_STACK_CONST))
+        {
+          /* Missing initializers of destructuring declarations are reported by the parser. */
+          scanner_require_eager_function (context_p, scanner_context_p);
+        }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 #if ENABLED (JERRY_ESNEXT)
         if (stack_top == SCAN_STACK_OBJECT_LITERAL_WITH_SUPER)
         {
@@ -891,6 +1191,19 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
         return SCAN_KEEP_TOKEN;
       }
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      if (binding_type == SCANNER_BINDING_NONE || binding_type == SCANNER_BINDING_ARROW_ARG)
+      {
+        /* Invalid destructuring assignment targets are reported by the parser. */
+        scanner_require_eager_function (context_p, scanner_context_p);
+      }
+
+      if (SCANNER_IS_FOR_START (context_p->stack_top_uint8))
+      {
+        scanner_context_p->status_flags |= SCANNER_CONTEXT_FOR_INITIALIZER;
+      }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
       scanner_location_info_t *location_info_p;
       location_info_p = (scanner_location_info_t *) scanner_insert_info (context_p,
                                                                          source_start.source_p,
@@ -925,6 +1238,21 @@ scanner_scan_primary_expression_end (parser_context_t *context_p, /**< context *
 
       scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
       parser_stack_pop_uint8 (context_p);
+
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      if (stack_top == SCAN_STACK_PROPERTY_ACCESSOR)
+      {
+        uint8_t saved_flags = context_p->stack_top_uint8;
+        parser_stack_pop_uint8 (context_p);
+
+        if (saved_flags & SCANNER_OPERAND_PROPERTY_BASE)
+        {
+          scanner_context_p->target_type = SCANNER_TARGET_PROPERTY;
+        }
+
+        scanner_context_p->operand_flags = (uint8_t) (saved_flags & ~SCANNER_OPERAND_PROPERTY_BASE);
+      }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       return SCAN_NEXT_TOKEN;
     }
 #if !ENABLED (JERRY_ESNEXT)
@@ -1123,6 +1451,10 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
     }
     case LEXER_KEYW_DO:
     {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_context_p->status_flags |= SCANNER_CONTEXT_SINGLE_STATEMENT;
+      scanner_context_p->active_literal_pool_p->iteration_depth++;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       scanner_context_p->mode = SCAN_MODE_STATEMENT;
       parser_stack_push_uint8 (context_p, SCAN_STACK_DO_STATEMENT);
       return SCAN_NEXT_TOKEN;
@@ -1157,6 +1489,14 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
     case LEXER_KEYW_WITH:
     case LEXER_KEYW_SWITCH:
     {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      if (type == LEXER_KEYW_WITH)
+      {
+        /* The with statement is a syntax error in strict mode. */
+        scanner_require_eager_function (context_p, scanner_context_p);
+      }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
       lexer_next_token (context_p);
       if (context_p->token.type != LEXER_LEFT_PAREN)
       {
@@ -1216,6 +1556,15 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
         scanner_raise_error (context_p);
       }
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      if (scanner_context_p->status_flags & SCANNER_CONTEXT_FOR_INITIALIZER)
+      {
+        /* A for statement nested into the initializer of another for statement. */
+        scanner_require_eager_function (context_p, scanner_context_p);
+        scanner_context_p->status_flags &= (uint16_t) ~SCANNER_CONTEXT_FOR_INITIALIZER;
+      }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
       scanner_for_statement_t for_statement;
       for_statement.u.source_p = context_p->source_p;
       uint8_t stack_mode = SCAN_STACK_FOR_START;
@@ -1348,6 +1697,15 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
     case LEXER_KEYW_BREAK:
     case LEXER_KEYW_CONTINUE:
     {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_literal_pool_t *literal_pool_p = scanner_context_p->active_literal_pool_p;
+      uint32_t target_depth = literal_pool_p->iteration_depth;
+
+      if (type == LEXER_KEYW_BREAK)
+      {
+        target_depth += literal_pool_p->switch_depth;
+      }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       lexer_next_token (context_p);
       scanner_context_p->mode = SCAN_MODE_STATEMENT_END;
 
@@ -1355,8 +1713,20 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
           && context_p->token.type == LEXER_LITERAL
           && context_p->token.lit_location.type == LEXER_IDENT_LITERAL)
       {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+        /* Label references are only resolved by the parser. */
+        scanner_require_eager_function (context_p, scanner_context_p);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
         return SCAN_NEXT_TOKEN;
       }
+
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      if (target_depth == 0)
+      {
+        /* Break and continue statements without a target are reported by the parser. */
+        scanner_require_eager_function (context_p, scanner_context_p);
+      }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       return SCAN_KEEP_TOKEN;
     }
     case LEXER_KEYW_CASE:
@@ -1826,6 +2196,9 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
   {
     if (JERRY_UNLIKELY (lexer_check_next_character (context_p, LIT_CHAR_COLON)))
     {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_require_eager_function (context_p, scanner_context_p);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
       lexer_consume_next_character (context_p);
       scanner_context_p->mode = SCAN_MODE_STATEMENT;
       return SCAN_NEXT_TOKEN;
@@ -1890,6 +2263,9 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
 #endif /* ENABLED (JERRY_ESNEXT) */
 
     scanner_add_reference (context_p, scanner_context_p);
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+    scanner_set_identifier_target (context_p, scanner_context_p);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 
     scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
     return SCAN_NEXT_TOKEN;
@@ -1942,6 +2318,13 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
           break;
         }
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+        if (context_p->stack_top_uint8 == SCAN_STACK_FUNCTION_STATEMENT)
+        {
+          scanner_check_lazy_function (context_p, scanner_context_p);
+        }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 #if ENABLED (JERRY_ESNEXT)
         if (context_p->stack_top_uint8 != SCAN_STACK_CLASS_STATEMENT)
         {
@@ -1977,6 +2360,13 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+        if (context_p->stack_top_uint8 == SCAN_STACK_FUNCTION_EXPRESSION)
+        {
+          scanner_check_lazy_function (context_p, scanner_context_p);
+        }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
         scanner_pop_literal_pool (context_p, scanner_context_p);
         parser_stack_pop_uint8 (context_p);
         return SCAN_NEXT_TOKEN;
@@ -2041,6 +2431,10 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
 
         scanner_context_p->active_switch_statement = switch_statement;
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+        scanner_context_p->active_literal_pool_p->switch_depth--;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 #if ENABLED (JERRY_ESNEXT)
         scanner_pop_literal_pool (context_p, scanner_context_p);
 #endif /* ENABLED (JERRY_ESNEXT) */
@@ -2060,6 +2454,9 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
           scanner_check_function_after_if (context_p, scanner_context_p);
           return SCAN_KEEP_TOKEN;
 #else /* !ENABLED (JERRY_ESNEXT) */
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+          scanner_context_p->status_flags |= SCANNER_CONTEXT_SINGLE_STATEMENT;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
           scanner_context_p->mode = SCAN_MODE_STATEMENT;
           return SCAN_NEXT_TOKEN;
 #endif /* ENABLED (JERRY_ESNEXT) */
@@ -2085,6 +2482,9 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
       case SCAN_STACK_DO_STATEMENT:
       {
         parser_stack_pop_uint8 (context_p);
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+        scanner_context_p->active_literal_pool_p->iteration_depth--;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 
         if (type != LEXER_KEYW_WHILE
             || (!terminator_found && !(context_p->token.flags & LEXER_WAS_NEWLINE)))
@@ -2108,6 +2508,14 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
         terminator_found = true;
         continue;
       }
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      case SCAN_STACK_LOOP_STATEMENT:
+      {
+        parser_stack_pop_uint8 (context_p);
+        scanner_context_p->active_literal_pool_p->iteration_depth--;
+        continue;
+      }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 #if ENABLED (JERRY_ESNEXT)
       case SCAN_STACK_PRIVATE_BLOCK_EARLY:
       {
@@ -2306,6 +2714,10 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
 #if ENABLED (JERRY_ESNEXT)
   scanner_context.async_source_p = NULL;
 #endif /* ENABLED (JERRY_ESNEXT) */
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  scanner_context.operand_flags = SCANNER_OPERAND_NO_FLAGS;
+  scanner_context.target_type = SCANNER_TARGET_NONE;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
 
   /* This assignment must be here because of Apple compilers. */
   context_p->u.scanner_context_p = &scanner_context;
@@ -2314,8 +2726,7 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
 
   PARSER_TRY (context_p->try_buffer)
   {
-    context_p->line = 1;
-    context_p->column = 1;
+    scanner_set_start_position (context_p, false);
 
     if (arg_list_p == NULL)
     {
@@ -2375,6 +2786,11 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
       lexer_token_type_t type = (lexer_token_type_t) context_p->token.type;
       scan_stack_modes_t stack_top = (scan_stack_modes_t) context_p->stack_top_uint8;
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+      scanner_context.prev_target_type = scanner_context.target_type;
+      scanner_context.target_type = SCANNER_TARGET_NONE;
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
       switch (scanner_context.mode)
       {
         case SCAN_MODE_PRIMARY_EXPRESSION:
@@ -2383,6 +2799,18 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
               || type == LEXER_SUBTRACT
               || LEXER_IS_UNARY_OP_TOKEN (type))
           {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+            scanner_context.operand_flags |= SCANNER_OPERAND_AFTER_OPERATOR;
+
+            if (type == LEXER_INCREASE || type == LEXER_DECREASE)
+            {
+              scanner_context.operand_flags |= SCANNER_OPERAND_UPDATE;
+            }
+            else if (type == LEXER_KEYW_DELETE)
+            {
+              scanner_context.operand_flags |= SCANNER_OPERAND_DELETE;
+            }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
             break;
           }
           /* FALLTHRU */
@@ -2542,6 +2970,9 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
         }
         case SCAN_MODE_PRIMARY_EXPRESSION_END:
         {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+          scanner_check_operand_end (context_p, &scanner_context);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
           if (scanner_scan_primary_expression_end (context_p, &scanner_context, type, stack_top) != SCAN_NEXT_TOKEN)
           {
             continue;
@@ -2559,6 +2990,15 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
         }
         case SCAN_MODE_STATEMENT:
         {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+          scanner_context.operand_flags = SCANNER_OPERAND_NO_FLAGS;
+
+          if (scanner_context.status_flags & SCANNER_CONTEXT_SINGLE_STATEMENT)
+          {
+            scanner_context.status_flags &= (uint16_t) ~SCANNER_CONTEXT_SINGLE_STATEMENT;
+            scanner_check_single_statement (context_p, &scanner_context);
+          }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
           if (scanner_scan_statement (context_p, &scanner_context, type, stack_top) != SCAN_NEXT_TOKEN)
           {
             continue;
@@ -2681,10 +3121,24 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
           }
 #endif /* ENABLED (JERRY_MODULE_SYSTEM) */
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS) && ENABLED (JERRY_ESNEXT)
+          if (stack_top == SCAN_STACK_CONST && context_p->token.type != LEXER_ASSIGN)
+          {
+            /* Missing const initializers are reported by the parser. */
+            scanner_require_eager_function (context_p, &scanner_context);
+          }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) && ENABLED (JERRY_ESNEXT) */
+
           switch (context_p->token.type)
           {
             case LEXER_ASSIGN:
             {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+              if (SCANNER_IS_FOR_START (stack_top))
+              {
+                scanner_context.status_flags |= SCANNER_CONTEXT_FOR_INITIALIZER;
+              }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
               scanner_context.mode = SCAN_MODE_PRIMARY_EXPRESSION;
               /* FALLTHRU */
             }
@@ -2872,8 +3326,7 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
             context_p->next_scanner_info_p = scanner_info_p;
             context_p->source_p = source_p;
             context_p->source_end_p = source_end_p;
-            context_p->line = 1;
-            context_p->column = 1;
+            scanner_set_start_position (context_p, true);
 
             scanner_filter_arguments (context_p, &scanner_context);
             lexer_next_token (context_p);
@@ -2947,6 +3400,15 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
           {
             uint16_t literal_pool_flags = SCANNER_LITERAL_POOL_FUNCTION;
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+            if (context_p->token.type == LEXER_PROPERTY_GETTER || context_p->token.type == LEXER_PROPERTY_SETTER)
+            {
+              /* The number of accessor arguments is checked by the parser. */
+              scanner_require_eager_function (context_p, &scanner_context);
+              literal_pool_flags |= SCANNER_LITERAL_POOL_EAGER_BODY;
+            }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 #if ENABLED (JERRY_ESNEXT)
             if (context_p->token.type == LEXER_MULTIPLY)
             {
@@ -2990,6 +3452,14 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
             scanner_raise_error (context_p);
           }
 
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+          if (lexer_compare_identifier_to_string (&context_p->token.lit_location, (const uint8_t *) "__proto__", 9))
+          {
+            /* Duplicated __proto__ properties are reported by the parser. */
+            scanner_require_eager_function (context_p, &scanner_context);
+          }
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+
 #if ENABLED (JERRY_ESNEXT)
           parser_line_counter_t start_line = context_p->token.line;
           parser_line_counter_t start_column = context_p->token.column;
@@ -3039,6 +3509,10 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
 
             if (context_p->token.type == LEXER_ASSIGN)
             {
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+              /* Initializers are only valid in destructuring patterns, which are checked by the parser. */
+              scanner_require_eager_function (context_p, &scanner_context);
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
               scanner_context.mode = SCAN_MODE_PRIMARY_EXPRESSION;
               break;
             }
@@ -3221,6 +3695,14 @@ scan_completed:
 
     if (JERRY_UNLIKELY (context_p->error != PARSER_ERR_OUT_OF_MEMORY))
     {
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+      if (context_p->error == PARSER_ERR_INVALID_REGEXP)
+      {
+        /* The parser compiles the pattern again and raises the exception. */
+        jcontext_release_exception ();
+      }
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+
       /* Ignore the errors thrown by the lexer. */
       context_p->error = PARSER_ERR_NO_ERROR;
 
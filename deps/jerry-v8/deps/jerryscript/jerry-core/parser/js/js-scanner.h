@@ -219,12 +219,20 @@ typedef enum
 {
   SCANNER_FUNCTION_ARGUMENTS_NEEDED = (1 << 0), /**< arguments object needs to be created */
   SCANNER_FUNCTION_HAS_COMPLEX_ARGUMENT = (1 << 1), /**< function has complex (ES2015+) argument definition */
+  SCANNER_FUNCTION_LEXICAL_ENV_NEEDED = (1 << 2), /**< lexical environment is needed for the function body
+                                                   *   (e.g. the arguments object must be stored in it) */
 #if ENABLED (JERRY_ESNEXT)
-  SCANNER_FUNCTION_LEXICAL_ENV_NEEDED = (1 << 2), /**< lexical environment is needed for the function body */
   SCANNER_FUNCTION_STATEMENT = (1 << 3), /**< function is function statement (not arrow expression)
                                           *   this flag must be combined with the type of function (e.g. async) */
   SCANNER_FUNCTION_ASYNC = (1 << 4), /**< function is async function */
 #endif /* ENABLED (JERRY_ESNEXT) */
+#if ENABLED (JERRY_LAZY_FUNCTIONS)
+  SCANNER_FUNCTION_LAZY = (1 << 5), /**< function body can be compiled lazily, the location of
+                                     *   its closing brace is stored after the stream */
+  SCANNER_FUNCTION_IS_STRICT = (1 << 6), /**< function body is strict mode code */
+#endif /* ENABLED (JERRY_LAZY_FUNCTIONS) */
+  SCANNER_FUNCTION_NAME_UNUSED = (1 << 7), /**< the name of a named function expression is not referenced
+                                            *   by its body, so no lexical environment is created for it */
 } scanner_function_flags_t;
 
 /**
@@ -28,6 +28,7 @@
 #include "ecma-objects.h"
 #include "ecma-promise-object.h"
 #include "ecma-proxy-object.h"
+#include "ecma-shape.h"
 #include "ecma-try-catch-macro.h"
 #include "jcontext.h"
 #include "opcodes.h"
@@ -1237,6 +1238,13 @@ static void
 opfunc_set_class_attributes (ecma_object_t *obj_p, /**< object */
                              ecma_object_t *parent_env_p) /**< parent environment */
 {
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  if (ECMA_OBJECT_HAS_SHAPE (obj_p))
+  {
+    ecma_shape_convert_to_normal (obj_p, NULL);
+  }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
   jmem_cpointer_t prop_iter_cp = obj_p->u1.property_list_cp;
 
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
@@ -47,8 +47,14 @@ typedef struct vm_frame_ctx_t
   ecma_value_t *literal_start_p;                      /**< literal list start pointer */
   ecma_object_t *lex_env_p;                           /**< current lexical environment */
   struct vm_frame_ctx_t *prev_context_p;              /**< previous context */
+#if ENABLED (JERRY_INLINE_CACHE)
+  ecma_inline_cache_t *inline_cache_p;                /**< inline cache of the byte code, NULL until
+                                                       *   the first property access */
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+  const ecma_value_t *arg_list_p;                     /**< arguments list of the function call */
   ecma_value_t this_binding;                          /**< this binding */
   ecma_value_t block_result;                          /**< block result */
+  uint32_t arg_list_len;                              /**< length of the arguments list */
 #if ENABLED (JERRY_LINE_INFO)
   uint32_t current_line;                              /**< currently executed line */
 #endif /* ENABLED (JERRY_LINE_INFO) */
@@ -83,6 +89,31 @@ typedef struct
   vm_frame_ctx_t frame_ctx; /**< frame context part */
 } vm_executable_object_t;
 
+#if ENABLED (JERRY_JIT)
+
+/**
+ * Entry point of a compiled byte code.
+ */
+typedef struct
+{
+  uint32_t byte_code_offset; /**< offset of the byte code instruction */
+  uint32_t code_offset; /**< offset of the machine code from the start of the code */
+} vm_jit_entry_t;
+
+/**
+ * Compiled code of a byte code. The header is followed by the entry
+ * points sorted by their byte code offset, and the machine code.
+ */
+typedef struct
+{
+  size_t size; /**< size of the whole memory block */
+  uint32_t byte_code_size; /**< upper bound of the byte code size */
+  uint32_t entry_count; /**< number of entry points */
+  uint32_t code_offset; /**< start of the machine code from the start of the header */
+} vm_jit_code_t;
+
+#endif /* ENABLED (JERRY_JIT) */
+
 /**
  * @}
  * @}
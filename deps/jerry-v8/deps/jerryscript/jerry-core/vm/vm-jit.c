@@ -0,0 +1,2936 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "byte-code.h"
+#include "ecma-comparison.h"
+#include "ecma-conversion.h"
+#include "ecma-helpers.h"
+#include "ecma-lex-env.h"
+#include "ecma-reference.h"
+#include "jcontext.h"
+#include "jmem.h"
+#include "opcodes.h"
+#include "vm.h"
+#include "vm-jit.h"
+
+#if ENABLED (JERRY_JIT)
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_jit Baseline JIT compiler
+ * @{
+ *
+ * The compiler translates each byte code instruction into a fixed machine code
+ * template which keeps the interpreter's frame layout: the registers and the
+ * value stack stay in the frame context, so the interpreter can continue the
+ * execution at any instruction. Instructions without a template are executed
+ * by the interpreter: the compiled code stores the byte code position into the
+ * frame and returns (side exit), and the interpreter enters the compiled code
+ * again at the next backward branch, or when vm_loop is resumed after an
+ * operation which is performed outside of it (e.g. spread calls).
+ *
+ * Register usage of the compiled code:
+ *   r12: frame context, rbx: top of the value stack,
+ *   r14: left operand, r15: right operand, r13: result
+ */
+
+/**
+ * Machine registers.
+ */
+typedef enum
+{
+  VM_JIT_RAX = 0, /**< rax */
+  VM_JIT_RCX = 1, /**< rcx */
+  VM_JIT_RDX = 2, /**< rdx */
+  VM_JIT_RBX = 3, /**< rbx */
+  VM_JIT_RSI = 6, /**< rsi */
+  VM_JIT_RDI = 7, /**< rdi */
+  VM_JIT_R8 = 8, /**< r8 */
+  VM_JIT_R9 = 9, /**< r9 */
+  VM_JIT_R12 = 12, /**< r12 */
+  VM_JIT_R13 = 13, /**< r13 */
+  VM_JIT_R14 = 14, /**< r14 */
+  VM_JIT_R15 = 15, /**< r15 */
+} vm_jit_reg_t;
+
+/**
+ * Register of the frame context.
+ */
+#define VM_JIT_FRAME VM_JIT_R12
+
+/**
+ * Register of the stack top.
+ */
+#define VM_JIT_STACK VM_JIT_RBX
+
+/**
+ * Register of the result value.
+ */
+#define VM_JIT_RESULT VM_JIT_R13
+
+/**
+ * Register of the left operand.
+ */
+#define VM_JIT_LEFT VM_JIT_R14
+
+/**
+ * Register of the right operand.
+ */
+#define VM_JIT_RIGHT VM_JIT_R15
+
+/**
+ * Condition codes.
+ */
+typedef enum
+{
+  VM_JIT_CC_O = 0x0, /**< overflow */
+  VM_JIT_CC_E = 0x4, /**< equal */
+  VM_JIT_CC_NE = 0x5, /**< not equal */
+  VM_JIT_CC_L = 0xc, /**< signed less */
+  VM_JIT_CC_GE = 0xd, /**< signed greater or equal */
+  VM_JIT_CC_LE = 0xe, /**< signed less or equal */
+  VM_JIT_CC_G = 0xf, /**< signed greater */
+} vm_jit_cc_t;
+
+/**
+ * Opcodes of two operand arithmetic instructions.
+ */
+typedef enum
+{
+  VM_JIT_OP_ADD = 0, /**< add */
+  VM_JIT_OP_OR = 1, /**< or */
+  VM_JIT_OP_AND = 4, /**< and */
+  VM_JIT_OP_SUB = 5, /**< sub */
+  VM_JIT_OP_XOR = 6, /**< xor */
+  VM_JIT_OP_CMP = 7, /**< cmp */
+} vm_jit_op_t;
+
+/**
+ * Operand size prefix of ecma values.
+ */
+#if ENABLED (JERRY_VALUE_64_BIT)
+#define VM_JIT_VALUE_WIDE 1
+#else /* !ENABLED (JERRY_VALUE_64_BIT) */
+#define VM_JIT_VALUE_WIDE 0
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+
+/**
+ * Operand size prefix of pointers.
+ */
+#define VM_JIT_POINTER_WIDE 1
+
+/**
+ * Size of an ecma value on the stack.
+ */
+#define VM_JIT_VALUE_SIZE ((int32_t) sizeof (ecma_value_t))
+
+/**
+ * Offset of a field of the frame context.
+ */
+#define VM_JIT_FRAME_OFFSET(field) ((int32_t) offsetof (vm_frame_ctx_t, field))
+
+/**
+ * Offset of a register in the frame context.
+ */
+#define VM_JIT_REGISTER_OFFSET(index) \
+  ((int32_t) (sizeof (vm_frame_ctx_t) + (size_t) (index) * sizeof (ecma_value_t)))
+
+/**
+ * Flags of the byte code offsets.
+ */
+typedef enum
+{
+  VM_JIT_INFO_REACHABLE = (1u << 0), /**< an instruction starts at this offset */
+  VM_JIT_INFO_VISITED = (1u << 1), /**< the instruction is decoded */
+  VM_JIT_INFO_ENTRY = (1u << 2), /**< the interpreter may enter the compiled code here */
+  VM_JIT_INFO_SUPPORTED = (1u << 3), /**< the instruction has a machine code template */
+  VM_JIT_INFO_RESUME = (1u << 4), /**< entry point candidate where vm_loop might be resumed */
+  VM_JIT_INFO_BRANCH = (1u << 5), /**< the instruction is a supported branch */
+} vm_jit_info_flags_t;
+
+/**
+ * Minimum number of supported instructions after a resume point which makes
+ * entering the compiled code worth the cost of the transition.
+ */
+#define VM_JIT_MIN_RESUME_LENGTH 4
+
+/**
+ * Shift of the machine code offset in the byte code offset info.
+ */
+#define VM_JIT_INFO_SHIFT 8
+
+/**
+ * Maximum size of the machine code.
+ */
+#define VM_JIT_MAX_CODE_SIZE (1u << (32 - VM_JIT_INFO_SHIFT))
+
+/**
+ * Operands of the current instruction which must be freed on error.
+ */
+typedef enum
+{
+  VM_JIT_LIVE_LEFT = (1u << 0), /**< left operand is live */
+  VM_JIT_LIVE_RIGHT = (1u << 1), /**< right operand is live */
+} vm_jit_live_t;
+
+/**
+ * Shared code blocks at the end of the machine code.
+ */
+typedef enum
+{
+  VM_JIT_STUB_ERROR_NONE, /**< return with error */
+  VM_JIT_STUB_ERROR_LEFT, /**< free left operand and return with error */
+  VM_JIT_STUB_ERROR_RIGHT, /**< free right operand and return with error */
+  VM_JIT_STUB_ERROR_BOTH, /**< free both operands and return with error */
+  VM_JIT_STUB_EXIT, /**< continue the execution in the interpreter */
+  VM_JIT_STUB__COUNT, /**< number of stubs */
+} vm_jit_stub_t;
+
+/**
+ * Decoded byte code instruction.
+ */
+typedef struct
+{
+  uint32_t offset; /**< offset of the instruction */
+  uint32_t length; /**< length of the instruction */
+  uint32_t opcode_data; /**< decoded vm opcode data */
+  uint32_t branch_target; /**< offset of the branch target */
+  uint32_t line; /**< line number of a line info instruction */
+  uint16_t literals[3]; /**< literal arguments */
+  uint8_t opcode; /**< opcode, or extended opcode if is_ext is set */
+  uint8_t literal_count; /**< number of literal arguments */
+  uint8_t byte_arg; /**< byte argument */
+  bool is_ext; /**< extended opcode */
+  bool has_branch; /**< branch_target is valid */
+} vm_jit_instruction_t;
+
+/**
+ * Compiler state.
+ */
+typedef struct
+{
+  const ecma_compiled_code_t *bytecode_header_p; /**< compiled byte code */
+  const uint8_t *byte_code_start_p; /**< start of the byte code instructions */
+  ecma_value_t *literal_start_p; /**< start of the literals (same as in the frame context) */
+  const uint16_t *decode_table_p; /**< opcode decode table of the interpreter */
+  uint32_t *info_p; /**< flags and machine code offset of each byte code offset */
+  uint8_t *code_p; /**< machine code buffer, NULL while the code size is measured */
+  uint32_t byte_code_size; /**< upper bound of the byte code size */
+  uint32_t code_size; /**< size of the emitted machine code */
+  uint32_t stubs[VM_JIT_STUB__COUNT]; /**< machine code offsets of the stubs */
+  uint16_t encoding_limit; /**< literal encoding limit */
+  uint16_t encoding_delta; /**< literal encoding delta */
+  uint16_t register_end; /**< end of the registers */
+  uint16_t ident_end; /**< end of the identifiers */
+  uint16_t const_literal_end; /**< end of the constant literals */
+  uint8_t live; /**< live operands (vm_jit_live_t) */
+  bool is_strict; /**< strict mode code */
+} vm_jit_compiler_t;
+
+/**
+ * Signature of the compiled code.
+ */
+typedef ecma_value_t (*vm_jit_function_t) (vm_frame_ctx_t *frame_ctx_p, ecma_value_t *stack_top_p,
+                                           const uint8_t *entry_p);
+
+/**
+ * Emit a byte.
+ */
+static void
+vm_jit_emit_byte (vm_jit_compiler_t *compiler_p, /**< compiler */
+                  uint32_t byte) /**< byte */
+{
+  if (compiler_p->code_p != NULL)
+  {
+    compiler_p->code_p[compiler_p->code_size] = (uint8_t) byte;
+  }
+
+  compiler_p->code_size++;
+} /* vm_jit_emit_byte */
+
+/**
+ * Emit a 32 bit little endian value.
+ */
+static void
+vm_jit_emit_int32 (vm_jit_compiler_t *compiler_p, /**< compiler */
+                   uint32_t value) /**< value */
+{
+  for (uint32_t i = 0; i < 4; i++)
+  {
+    vm_jit_emit_byte (compiler_p, (value >> (i * 8)) & 0xff);
+  }
+} /* vm_jit_emit_int32 */
+
+/**
+ * Emit a REX prefix.
+ */
+static void
+vm_jit_emit_rex (vm_jit_compiler_t *compiler_p, /**< compiler */
+                 uint32_t is_wide, /**< 64 bit operand size */
+                 uint32_t reg, /**< reg field */
+                 uint32_t rm) /**< rm field */
+{
+  vm_jit_emit_byte (compiler_p, 0x40 | (is_wide << 3) | ((reg >> 3) << 2) | (rm >> 3));
+} /* vm_jit_emit_rex */
+
+/**
+ * Emit a register-register ModRM byte.
+ */
+static void
+vm_jit_emit_modrm_reg (vm_jit_compiler_t *compiler_p, /**< compiler */
+                       uint32_t reg, /**< reg field */
+                       uint32_t rm) /**< rm field */
+{
+  vm_jit_emit_byte (compiler_p, 0xc0 | ((reg & 0x7) << 3) | (rm & 0x7));
+} /* vm_jit_emit_modrm_reg */
+
+/**
+ * Emit a [base + disp32] memory operand.
+ */
+static void
+vm_jit_emit_modrm_mem (vm_jit_compiler_t *compiler_p, /**< compiler */
+                       uint32_t reg, /**< reg field */
+                       uint32_t base, /**< base register */
+                       int32_t disp) /**< displacement */
+{
+  vm_jit_emit_byte (compiler_p, 0x80 | ((reg & 0x7) << 3) | (base & 0x7));
+
+  if ((base & 0x7) == 0x4)
+  {
+    /* The rsp and r12 base registers require a SIB byte. */
+    vm_jit_emit_byte (compiler_p, 0x24);
+  }
+
+  vm_jit_emit_int32 (compiler_p, (uint32_t) disp);
+} /* vm_jit_emit_modrm_mem */
+
+/**
+ * Emit a two operand instruction between registers: op dst, src
+ */
+static void
+vm_jit_emit_op_rr (vm_jit_compiler_t *compiler_p, /**< compiler */
+                   uint32_t is_wide, /**< 64 bit operand size */
+                   uint32_t opcode, /**< opcode with r/m destination */
+                   vm_jit_reg_t dst, /**< destination register */
+                   vm_jit_reg_t src) /**< source register */
+{
+  vm_jit_emit_rex (compiler_p, is_wide, src, dst);
+  vm_jit_emit_byte (compiler_p, opcode);
+  vm_jit_emit_modrm_reg (compiler_p, src, dst);
+} /* vm_jit_emit_op_rr */
+
+/**
+ * Emit a register move: mov dst, src
+ */
+static void
+vm_jit_emit_mov_rr (vm_jit_compiler_t *compiler_p, /**< compiler */
+                    vm_jit_reg_t dst, /**< destination register */
+                    vm_jit_reg_t src) /**< source register */
+{
+  vm_jit_emit_op_rr (compiler_p, VM_JIT_POINTER_WIDE, 0x89, dst, src);
+} /* vm_jit_emit_mov_rr */
+
+/**
+ * Emit a two operand instruction with an immediate: op reg, imm32
+ */
+static void
+vm_jit_emit_op_ri (vm_jit_compiler_t *compiler_p, /**< compiler */
+                   uint32_t is_wide, /**< 64 bit operand size */
+                   vm_jit_op_t op, /**< operation */
+                   vm_jit_reg_t reg, /**< register */
+                   int32_t imm) /**< immediate */
+{
+  vm_jit_emit_rex (compiler_p, is_wide, 0, reg);
+  vm_jit_emit_byte (compiler_p, 0x81);
+  vm_jit_emit_modrm_reg (compiler_p, op, reg);
+  vm_jit_emit_int32 (compiler_p, (uint32_t) imm);
+} /* vm_jit_emit_op_ri */
+
+/**
+ * Emit a load: mov reg, [base + disp]
+ */
+static void
+vm_jit_emit_load (vm_jit_compiler_t *compiler_p, /**< compiler */
+                  uint32_t is_wide, /**< 64 bit operand size */
+                  vm_jit_reg_t reg, /**< destination register */
+                  vm_jit_reg_t base, /**< base register */
+                  int32_t disp) /**< displacement */
+{
+  vm_jit_emit_rex (compiler_p, is_wide, reg, base);
+  vm_jit_emit_byte (compiler_p, 0x8b);
+  vm_jit_emit_modrm_mem (compiler_p, reg, base, disp);
+} /* vm_jit_emit_load */
+
+/**
+ * Emit a store: mov [base + disp], reg
+ */
+static void
+vm_jit_emit_store (vm_jit_compiler_t *compiler_p, /**< compiler */
+                   uint32_t is_wide, /**< 64 bit operand size */
+                   vm_jit_reg_t base, /**< base register */
+                   int32_t disp, /**< displacement */
+                   vm_jit_reg_t reg) /**< source register */
+{
+  vm_jit_emit_rex (compiler_p, is_wide, reg, base);
+  vm_jit_emit_byte (compiler_p, 0x89);
+  vm_jit_emit_modrm_mem (compiler_p, reg, base, disp);
+} /* vm_jit_emit_store */
+
+/**
+ * Emit an immediate store: mov [base + disp], imm32
+ */
+static void
+vm_jit_emit_store_imm (vm_jit_compiler_t *compiler_p, /**< compiler */
+                       uint32_t is_wide, /**< 64 bit operand size */
+                       vm_jit_reg_t base, /**< base register */
+                       int32_t disp, /**< displacement */
+                       int32_t imm) /**< immediate */
+{
+  vm_jit_emit_rex (compiler_p, is_wide, 0, base);
+  vm_jit_emit_byte (compiler_p, 0xc7);
+  vm_jit_emit_modrm_mem (compiler_p, 0, base, disp);
+  vm_jit_emit_int32 (compiler_p, (uint32_t) imm);
+} /* vm_jit_emit_store_imm */
+
+/**
+ * Emit a constant load: mov reg, imm
+ */
+static void
+vm_jit_emit_mov_imm (vm_jit_compiler_t *compiler_p, /**< compiler */
+                     vm_jit_reg_t reg, /**< destination register */
+                     uint64_t imm) /**< immediate */
+{
+  if (imm <= UINT32_MAX)
+  {
+    /* The upper half of the register is cleared. */
+    vm_jit_emit_rex (compiler_p, 0, 0, reg);
+    vm_jit_emit_byte (compiler_p, 0xb8 | (reg & 0x7));
+    vm_jit_emit_int32 (compiler_p, (uint32_t) imm);
+    return;
+  }
+
+  vm_jit_emit_rex (compiler_p, 1, 0, reg);
+  vm_jit_emit_byte (compiler_p, 0xb8 | (reg & 0x7));
+  vm_jit_emit_int32 (compiler_p, (uint32_t) imm);
+  vm_jit_emit_int32 (compiler_p, (uint32_t) (imm >> 32));
+} /* vm_jit_emit_mov_imm */
+
+/**
+ * Emit a test of the low byte of a register: test reg8, imm8
+ */
+static void
+vm_jit_emit_test_imm8 (vm_jit_compiler_t *compiler_p, /**< compiler */
+                       vm_jit_reg_t reg, /**< register */
+                       uint32_t imm) /**< immediate */
+{
+  vm_jit_emit_rex (compiler_p, 0, 0, reg);
+  vm_jit_emit_byte (compiler_p, 0xf6);
+  vm_jit_emit_modrm_reg (compiler_p, 0, reg);
+  vm_jit_emit_byte (compiler_p, imm);
+} /* vm_jit_emit_test_imm8 */
+
+/**
+ * Emit a sign extension of the lower half of a register if ecma values are 64 bit wide.
+ */
+static void
+vm_jit_emit_extend_int (vm_jit_compiler_t *compiler_p, /**< compiler */
+                        vm_jit_reg_t reg) /**< register */
+{
+#if ENABLED (JERRY_VALUE_64_BIT)
+  /* movsxd reg, reg32 */
+  vm_jit_emit_rex (compiler_p, 1, reg, reg);
+  vm_jit_emit_byte (compiler_p, 0x63);
+  vm_jit_emit_modrm_reg (compiler_p, reg, reg);
+#else /* !ENABLED (JERRY_VALUE_64_BIT) */
+  JERRY_UNUSED (compiler_p);
+  JERRY_UNUSED (reg);
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+} /* vm_jit_emit_extend_int */
+
+/**
+ * Emit a conditional move of 32 bit registers: cmovcc dst, src
+ */
+static void
+vm_jit_emit_cmov (vm_jit_compiler_t *compiler_p, /**< compiler */
+                  vm_jit_cc_t cc, /**< condition */
+                  vm_jit_reg_t dst, /**< destination register */
+                  vm_jit_reg_t src) /**< source register */
+{
+  vm_jit_emit_rex (compiler_p, 0, dst, src);
+  vm_jit_emit_byte (compiler_p, 0x0f);
+  vm_jit_emit_byte (compiler_p, 0x40 | cc);
+  vm_jit_emit_modrm_reg (compiler_p, dst, src);
+} /* vm_jit_emit_cmov */
+
+/**
+ * Emit a relative jump or conditional jump with an unknown target.
+ *
+ * @return position of the displacement, which must be patched later
+ */
+static uint32_t
+vm_jit_emit_jump (vm_jit_compiler_t *compiler_p, /**< compiler */
+                  int32_t cc) /**< condition, or -1 for unconditional jumps */
+{
+  if (cc < 0)
+  {
+    vm_jit_emit_byte (compiler_p, 0xe9);
+  }
+  else
+  {
+    vm_jit_emit_byte (compiler_p, 0x0f);
+    vm_jit_emit_byte (compiler_p, 0x80 | (uint32_t) cc);
+  }
+
+  uint32_t position = compiler_p->code_size;
+  vm_jit_emit_int32 (compiler_p, 0);
+  return position;
+} /* vm_jit_emit_jump */
+
+/**
+ * Set the target of a jump.
+ */
+static void
+vm_jit_patch_jump (vm_jit_compiler_t *compiler_p, /**< compiler */
+                   uint32_t position, /**< position of the displacement */
+                   uint32_t target) /**< target offset */
+{
+  if (compiler_p->code_p == NULL)
+  {
+    return;
+  }
+
+  uint32_t disp = target - (position + 4);
+
+  for (uint32_t i = 0; i < 4; i++)
+  {
+    compiler_p->code_p[position + i] = (uint8_t) (disp >> (i * 8));
+  }
+} /* vm_jit_patch_jump */
+
+/**
+ * Set the target of a jump to the current position.
+ */
+static void
+vm_jit_patch_jump_here (vm_jit_compiler_t *compiler_p, /**< compiler */
+                        uint32_t position) /**< position of the displacement */
+{
+  vm_jit_patch_jump (compiler_p, position, compiler_p->code_size);
+} /* vm_jit_patch_jump_here */
+
+/**
+ * Emit a jump with a known target.
+ */
+static void
+vm_jit_emit_jump_to (vm_jit_compiler_t *compiler_p, /**< compiler */
+                     int32_t cc, /**< condition, or -1 for unconditional jumps */
+                     uint32_t target) /**< target offset */
+{
+  vm_jit_patch_jump (compiler_p, vm_jit_emit_jump (compiler_p, cc), target);
+} /* vm_jit_emit_jump_to */
+
+/**
+ * Emit a call of a C function.
+ */
+static void
+vm_jit_emit_call (vm_jit_compiler_t *compiler_p, /**< compiler */
+                  uintptr_t function) /**< function address */
+{
+  /* The function addresses are not in the rel32 range of the code. */
+  vm_jit_emit_rex (compiler_p, 1, 0, VM_JIT_RAX);
+  vm_jit_emit_byte (compiler_p, 0xb8);
+  vm_jit_emit_int32 (compiler_p, (uint32_t) function);
+  vm_jit_emit_int32 (compiler_p, (uint32_t) ((uint64_t) function >> 32));
+
+  /* call rax */
+  vm_jit_emit_byte (compiler_p, 0xff);
+  vm_jit_emit_byte (compiler_p, 0xd0);
+} /* vm_jit_emit_call */
+
+/**
+ * Emit a jump to the error stub which frees the live operands.
+ */
+static void
+vm_jit_emit_jump_to_error (vm_jit_compiler_t *compiler_p, /**< compiler */
+                           int32_t cc) /**< condition, or -1 for unconditional jumps */
+{
+  vm_jit_stub_t stub = VM_JIT_STUB_ERROR_NONE;
+
+  if (compiler_p->live == (VM_JIT_LIVE_LEFT | VM_JIT_LIVE_RIGHT))
+  {
+    stub = VM_JIT_STUB_ERROR_BOTH;
+  }
+  else if (compiler_p->live == VM_JIT_LIVE_LEFT)
+  {
+    stub = VM_JIT_STUB_ERROR_LEFT;
+  }
+  else if (compiler_p->live == VM_JIT_LIVE_RIGHT)
+  {
+    stub = VM_JIT_STUB_ERROR_RIGHT;
+  }
+
+  vm_jit_emit_jump_to (compiler_p, cc, compiler_p->stubs[stub]);
+} /* vm_jit_emit_jump_to_error */
+
+/**
+ * Emit an error check of the value returned by a helper.
+ */
+static void
+vm_jit_emit_check_error (vm_jit_compiler_t *compiler_p) /**< compiler */
+{
+  vm_jit_emit_op_ri (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_OP_CMP, VM_JIT_RAX, (int32_t) ECMA_VALUE_ERROR);
+  vm_jit_emit_jump_to_error (compiler_p, VM_JIT_CC_E);
+} /* vm_jit_emit_check_error */
+
+/**
+ * Emit ecma_free_value for a register, which is skipped for direct values.
+ */
+static void
+vm_jit_emit_free (vm_jit_compiler_t *compiler_p, /**< compiler */
+                  vm_jit_reg_t reg) /**< register */
+{
+  vm_jit_emit_test_imm8 (compiler_p, reg, ECMA_VALUE_TYPE_MASK);
+  uint32_t skip = vm_jit_emit_jump (compiler_p, VM_JIT_CC_E);
+  vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, reg);
+  vm_jit_emit_call (compiler_p, (uintptr_t) &ecma_free_value);
+  vm_jit_patch_jump_here (compiler_p, skip);
+} /* vm_jit_emit_free */
+
+/**
+ * Emit ecma_copy_value for a register, which is skipped for direct values.
+ */
+static void
+vm_jit_emit_copy (vm_jit_compiler_t *compiler_p, /**< compiler */
+                  vm_jit_reg_t reg) /**< register */
+{
+  vm_jit_emit_test_imm8 (compiler_p, reg, ECMA_VALUE_TYPE_MASK);
+  uint32_t skip = vm_jit_emit_jump (compiler_p, VM_JIT_CC_E);
+  vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, reg);
+  vm_jit_emit_call (compiler_p, (uintptr_t) &ecma_copy_value);
+  vm_jit_emit_mov_rr (compiler_p, reg, VM_JIT_RAX);
+  vm_jit_patch_jump_here (compiler_p, skip);
+} /* vm_jit_emit_copy */
+
+/**
+ * Emit a push onto the value stack.
+ */
+static void
+vm_jit_emit_push (vm_jit_compiler_t *compiler_p, /**< compiler */
+                  vm_jit_reg_t reg) /**< register */
+{
+  vm_jit_emit_store (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_STACK, 0, reg);
+  vm_jit_emit_op_ri (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_OP_ADD, VM_JIT_STACK, VM_JIT_VALUE_SIZE);
+} /* vm_jit_emit_push */
+
+/**
+ * Emit a push of a direct value onto the value stack.
+ */
+static void
+vm_jit_emit_push_imm (vm_jit_compiler_t *compiler_p, /**< compiler */
+                      ecma_value_t value) /**< direct value */
+{
+  /* The immediate is sign extended, which matches the encoding of negative integers. */
+  vm_jit_emit_store_imm (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_STACK, 0, (int32_t) value);
+  vm_jit_emit_op_ri (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_OP_ADD, VM_JIT_STACK, VM_JIT_VALUE_SIZE);
+} /* vm_jit_emit_push_imm */
+
+/**
+ * Emit a pop from the value stack.
+ */
+static void
+vm_jit_emit_pop (vm_jit_compiler_t *compiler_p, /**< compiler */
+                 vm_jit_reg_t reg) /**< register */
+{
+  vm_jit_emit_op_ri (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_OP_SUB, VM_JIT_STACK, VM_JIT_VALUE_SIZE);
+  vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, reg, VM_JIT_STACK, 0);
+} /* vm_jit_emit_pop */
+
+/**
+ * Emit the load of a copy of the this binding.
+ */
+static void
+vm_jit_emit_load_this (vm_jit_compiler_t *compiler_p, /**< compiler */
+                       vm_jit_reg_t reg) /**< destination register */
+{
+  vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, reg, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (this_binding));
+  vm_jit_emit_copy (compiler_p, reg);
+} /* vm_jit_emit_load_this */
+
+/**
+ * Emit the load of a literal. The literal index must be less than const_literal_end.
+ */
+static void
+vm_jit_emit_load_literal (vm_jit_compiler_t *compiler_p, /**< compiler */
+                          uint16_t literal_index, /**< literal index */
+                          vm_jit_reg_t reg) /**< destination register */
+{
+  JERRY_ASSERT (literal_index < compiler_p->const_literal_end);
+
+  if (literal_index < compiler_p->register_end)
+  {
+    vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, reg, VM_JIT_FRAME, VM_JIT_REGISTER_OFFSET (literal_index));
+    vm_jit_emit_copy (compiler_p, reg);
+    return;
+  }
+
+  ecma_value_t literal = compiler_p->literal_start_p[literal_index];
+
+  if (literal_index < compiler_p->ident_end)
+  {
+    vm_jit_emit_load (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_RDI, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (lex_env_p));
+    vm_jit_emit_mov_imm (compiler_p, VM_JIT_RSI, (uintptr_t) ecma_get_string_from_value (literal));
+    vm_jit_emit_call (compiler_p, (uintptr_t) &ecma_op_resolve_reference_value);
+    vm_jit_emit_check_error (compiler_p);
+    vm_jit_emit_mov_rr (compiler_p, reg, VM_JIT_RAX);
+    return;
+  }
+
+  if (ecma_is_value_direct (literal))
+  {
+    vm_jit_emit_mov_imm (compiler_p, reg, literal);
+    return;
+  }
+
+  vm_jit_emit_mov_imm (compiler_p, VM_JIT_RDI, literal);
+  vm_jit_emit_call (compiler_p, (uintptr_t) &ecma_copy_value);
+  vm_jit_emit_mov_rr (compiler_p, reg, VM_JIT_RAX);
+} /* vm_jit_emit_load_literal */
+
+/**
+ * Emit the check of a backward branch: the execution can be stopped
+ * by the vm_exec_stop callback or by a vm interrupt request.
+ */
+static void
+vm_jit_emit_backward_check (vm_jit_compiler_t *compiler_p) /**< compiler */
+{
+#if ENABLED (JERRY_VM_EXEC_STOP)
+  vm_jit_emit_call (compiler_p, (uintptr_t) &vm_jit_backward_branch);
+  vm_jit_emit_check_error (compiler_p);
+#elif ENABLED (JERRY_VM_INTERRUPT)
+  /* cmp dword [rax], 0 */
+  vm_jit_emit_mov_imm (compiler_p, VM_JIT_RAX, (uintptr_t) &JERRY_CONTEXT (vm_interrupt_pending));
+  vm_jit_emit_rex (compiler_p, 0, 0, VM_JIT_RAX);
+  vm_jit_emit_byte (compiler_p, 0x81);
+  vm_jit_emit_modrm_mem (compiler_p, VM_JIT_OP_CMP, VM_JIT_RAX, 0);
+  vm_jit_emit_int32 (compiler_p, 0);
+
+  uint32_t skip = vm_jit_emit_jump (compiler_p, VM_JIT_CC_E);
+  vm_jit_emit_call (compiler_p, (uintptr_t) &vm_jit_backward_branch);
+  vm_jit_emit_check_error (compiler_p);
+  vm_jit_patch_jump_here (compiler_p, skip);
+#else /* !ENABLED (JERRY_VM_EXEC_STOP) && !ENABLED (JERRY_VM_INTERRUPT) */
+  JERRY_UNUSED (compiler_p);
+#endif /* ENABLED (JERRY_VM_EXEC_STOP) */
+} /* vm_jit_emit_backward_check */
+
+/**
+ * Get the machine code offset of a byte code instruction.
+ *
+ * @return machine code offset (unknown forward targets are zero in the measuring pass)
+ */
+static uint32_t
+vm_jit_get_label (vm_jit_compiler_t *compiler_p, /**< compiler */
+                  uint32_t offset) /**< byte code offset */
+{
+  return compiler_p->info_p[offset] >> VM_JIT_INFO_SHIFT;
+} /* vm_jit_get_label */
+
+/**
+ * Emit a branch to a byte code instruction.
+ */
+static void
+vm_jit_emit_branch (vm_jit_compiler_t *compiler_p, /**< compiler */
+                    int32_t cc, /**< condition, or -1 for unconditional branches */
+                    const vm_jit_instruction_t *instr_p) /**< branch instruction */
+{
+  JERRY_ASSERT (instr_p->has_branch && compiler_p->live == 0);
+
+  uint32_t target = vm_jit_get_label (compiler_p, instr_p->branch_target);
+
+  if (!(instr_p->opcode_data & VM_OC_BACKWARD_BRANCH))
+  {
+    vm_jit_emit_jump_to (compiler_p, cc, target);
+    return;
+  }
+
+  uint32_t skip = 0;
+
+  if (cc >= 0)
+  {
+    /* Inverted condition. */
+    skip = vm_jit_emit_jump (compiler_p, cc ^ 0x1);
+  }
+
+  vm_jit_emit_backward_check (compiler_p);
+  vm_jit_emit_jump_to (compiler_p, -1, target);
+
+  if (cc >= 0)
+  {
+    vm_jit_patch_jump_here (compiler_p, skip);
+  }
+} /* vm_jit_emit_branch */
+
+/**
+ * Emit the storing of a byte code position into the frame context.
+ */
+static void
+vm_jit_emit_store_byte_code_p (vm_jit_compiler_t *compiler_p, /**< compiler */
+                               uint32_t offset) /**< byte code offset */
+{
+  vm_jit_emit_rex (compiler_p, 1, 0, VM_JIT_RAX);
+  vm_jit_emit_byte (compiler_p, 0xb8);
+  uint64_t byte_code_p = (uint64_t) (uintptr_t) (compiler_p->byte_code_start_p + offset);
+  vm_jit_emit_int32 (compiler_p, (uint32_t) byte_code_p);
+  vm_jit_emit_int32 (compiler_p, (uint32_t) (byte_code_p >> 32));
+
+  vm_jit_emit_store (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (byte_code_p), VM_JIT_RAX);
+} /* vm_jit_emit_store_byte_code_p */
+
+/**
+ * Emit a side exit: the interpreter continues the execution at the given instruction.
+ */
+static void
+vm_jit_emit_side_exit (vm_jit_compiler_t *compiler_p, /**< compiler */
+                       uint32_t offset) /**< byte code offset */
+{
+  vm_jit_emit_store_byte_code_p (compiler_p, offset);
+  vm_jit_emit_jump_to (compiler_p, -1, compiler_p->stubs[VM_JIT_STUB_EXIT]);
+} /* vm_jit_emit_side_exit */
+
+/**
+ * Decode a byte code instruction.
+ *
+ * @return true - if the instruction is valid,
+ *         false - otherwise
+ */
+static bool
+vm_jit_decode (vm_jit_compiler_t *compiler_p, /**< compiler */
+               uint32_t offset, /**< byte code offset */
+               vm_jit_instruction_t *instr_p) /**< [out] decoded instruction */
+{
+  const uint8_t *byte_code_p = compiler_p->byte_code_start_p + offset;
+  const uint8_t *byte_code_end_p = compiler_p->byte_code_start_p + compiler_p->byte_code_size;
+  uint8_t flags;
+  uint32_t decode_index;
+
+  memset (instr_p, 0, sizeof (vm_jit_instruction_t));
+  instr_p->offset = offset;
+  instr_p->opcode = *byte_code_p++;
+  decode_index = instr_p->opcode;
+
+  if (instr_p->opcode == CBC_EXT_OPCODE)
+  {
+    if (byte_code_p >= byte_code_end_p)
+    {
+      return false;
+    }
+
+    instr_p->is_ext = true;
+    instr_p->opcode = *byte_code_p++;
+
+    if (instr_p->opcode >= CBC_EXT_END)
+    {
+      return false;
+    }
+
+    flags = cbc_ext_flags[instr_p->opcode];
+    decode_index = (uint32_t) (CBC_END + 1 + instr_p->opcode);
+  }
+  else
+  {
+    if (instr_p->opcode >= CBC_END)
+    {
+      return false;
+    }
+
+    flags = cbc_flags[instr_p->opcode];
+  }
+
+  instr_p->opcode_data = compiler_p->decode_table_p[decode_index];
+
+#if ENABLED (JERRY_LINE_INFO)
+  if (instr_p->is_ext && instr_p->opcode == CBC_EXT_LINE)
+  {
+    uint8_t byte;
+
+    do
+    {
+      if (byte_code_p >= byte_code_end_p)
+      {
+        return false;
+      }
+
+      byte = *byte_code_p++;
+      instr_p->line = (instr_p->line << 7) | (byte & CBC_LOWER_SEVEN_BIT_MASK);
+    }
+    while (byte & CBC_HIGHEST_BIT_MASK);
+  }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
+  if (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
+  {
+    instr_p->literal_count = 1;
+
+    if (flags & CBC_HAS_LITERAL_ARG2)
+    {
+      instr_p->literal_count = (flags & CBC_HAS_LITERAL_ARG) ? 2 : 3;
+    }
+  }
+
+  for (uint32_t i = 0; i < instr_p->literal_count; i++)
+  {
+    if (byte_code_p >= byte_code_end_p)
+    {
+      return false;
+    }
+
+    uint16_t literal_index = *byte_code_p++;
+
+    if (literal_index >= compiler_p->encoding_limit)
+    {
+      if (byte_code_p >= byte_code_end_p)
+      {
+        return false;
+      }
+
+      literal_index = (uint16_t) (((literal_index << 8) | *byte_code_p++) - compiler_p->encoding_delta);
+    }
+
+    instr_p->literals[i] = literal_index;
+  }
+
+  if (flags & CBC_HAS_BYTE_ARG)
+  {
+    if (byte_code_p >= byte_code_end_p)
+    {
+      return false;
+    }
+
+    instr_p->byte_arg = *byte_code_p++;
+  }
+
+  if (flags & CBC_HAS_BRANCH_ARG)
+  {
+    uint32_t branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (instr_p->opcode);
+    uint32_t branch_offset = 0;
+
+    if (branch_offset_length == 0 || byte_code_p + branch_offset_length > byte_code_end_p)
+    {
+      return false;
+    }
+
+    while (branch_offset_length-- > 0)
+    {
+      branch_offset = (branch_offset << 8) | *byte_code_p++;
+    }
+
+    if (CBC_BRANCH_IS_FORWARD (flags))
+    {
+      instr_p->branch_target = offset + branch_offset;
+    }
+    else
+    {
+      if (branch_offset > offset)
+      {
+        return false;
+      }
+
+      instr_p->branch_target = offset - branch_offset;
+    }
+
+    if (instr_p->branch_target >= compiler_p->byte_code_size)
+    {
+      return false;
+    }
+
+    instr_p->has_branch = true;
+  }
+
+  instr_p->length = (uint32_t) (byte_code_p - (compiler_p->byte_code_start_p + offset));
+  return true;
+} /* vm_jit_decode */
+
+/**
+ * Checks whether the execution never continues with the next instruction.
+ *
+ * @return true - if the instruction does not fall through,
+ *         false - otherwise
+ */
+static bool
+vm_jit_is_terminal (const vm_jit_instruction_t *instr_p) /**< instruction */
+{
+  switch (VM_OC_GROUP_GET_INDEX (instr_p->opcode_data))
+  {
+    case VM_OC_JUMP:
+    case VM_OC_RETURN:
+    case VM_OC_THROW:
+    case VM_OC_THROW_REFERENCE_ERROR:
+    case VM_OC_ERROR:
+    case VM_OC_JUMP_AND_EXIT_CONTEXT:
+    case VM_OC_SET_BYTECODE_PTR:
+#if ENABLED (JERRY_ESNEXT)
+    case VM_OC_THROW_CONST_ERROR:
+    case VM_OC_EXT_RETURN:
+    case VM_OC_ASYNC_EXIT:
+#endif /* ENABLED (JERRY_ESNEXT) */
+    case VM_OC_NONE:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* vm_jit_is_terminal */
+
+/**
+ * Find the reachable instructions of the byte code. The end of the byte
+ * code is not stored, so the instructions are discovered by following the
+ * control flow from the first instruction.
+ *
+ * @return true - if all reachable instructions are valid,
+ *         false - otherwise
+ */
+static bool
+vm_jit_discover (vm_jit_compiler_t *compiler_p) /**< compiler */
+{
+  uint32_t *info_p = compiler_p->info_p;
+  bool has_backward_branch = true;
+
+  info_p[0] |= VM_JIT_INFO_REACHABLE;
+
+  while (has_backward_branch)
+  {
+    has_backward_branch = false;
+
+    for (uint32_t offset = 0; offset < compiler_p->byte_code_size; offset++)
+    {
+      if ((info_p[offset] & (VM_JIT_INFO_REACHABLE | VM_JIT_INFO_VISITED)) != VM_JIT_INFO_REACHABLE)
+      {
+        continue;
+      }
+
+      vm_jit_instruction_t instr;
+
+      if (!vm_jit_decode (compiler_p, offset, &instr))
+      {
+        return false;
+      }
+
+      info_p[offset] |= VM_JIT_INFO_VISITED;
+
+      if (instr.has_branch)
+      {
+        if (instr.branch_target < offset
+            && !(info_p[instr.branch_target] & VM_JIT_INFO_REACHABLE))
+        {
+          has_backward_branch = true;
+        }
+
+        info_p[instr.branch_target] |= VM_JIT_INFO_REACHABLE;
+      }
+
+      if (!vm_jit_is_terminal (&instr))
+      {
+        if (offset + instr.length >= compiler_p->byte_code_size)
+        {
+          return false;
+        }
+
+        info_p[offset + instr.length] |= VM_JIT_INFO_REACHABLE;
+      }
+    }
+  }
+
+  return true;
+} /* vm_jit_discover */
+
+/**
+ * Emit the loading of the operands. The operands are stored in the left and right registers.
+ *
+ * @return number of literals used by the operands
+ */
+static uint32_t
+vm_jit_emit_get_operands (vm_jit_compiler_t *compiler_p, /**< compiler */
+                          const vm_jit_instruction_t *instr_p) /**< instruction */
+{
+  switch (VM_OC_GET_ARGS_INDEX (instr_p->opcode_data))
+  {
+    case VM_OC_GET_STACK:
+    {
+      vm_jit_emit_pop (compiler_p, VM_JIT_LEFT);
+      compiler_p->live = VM_JIT_LIVE_LEFT;
+      return 0;
+    }
+    case VM_OC_GET_STACK_STACK:
+    {
+      vm_jit_emit_pop (compiler_p, VM_JIT_RIGHT);
+      vm_jit_emit_pop (compiler_p, VM_JIT_LEFT);
+      compiler_p->live = VM_JIT_LIVE_LEFT | VM_JIT_LIVE_RIGHT;
+      return 0;
+    }
+    case VM_OC_GET_LITERAL:
+    {
+      vm_jit_emit_load_literal (compiler_p, instr_p->literals[0], VM_JIT_LEFT);
+      compiler_p->live = VM_JIT_LIVE_LEFT;
+      return 1;
+    }
+    case VM_OC_GET_LITERAL_LITERAL:
+    {
+      vm_jit_emit_load_literal (compiler_p, instr_p->literals[0], VM_JIT_LEFT);
+      compiler_p->live = VM_JIT_LIVE_LEFT;
+      vm_jit_emit_load_literal (compiler_p, instr_p->literals[1], VM_JIT_RIGHT);
+      compiler_p->live = VM_JIT_LIVE_LEFT | VM_JIT_LIVE_RIGHT;
+      return 2;
+    }
+    case VM_OC_GET_STACK_LITERAL:
+    {
+      vm_jit_emit_load_literal (compiler_p, instr_p->literals[0], VM_JIT_RIGHT);
+      vm_jit_emit_pop (compiler_p, VM_JIT_LEFT);
+      compiler_p->live = VM_JIT_LIVE_LEFT | VM_JIT_LIVE_RIGHT;
+      return 1;
+    }
+    case VM_OC_GET_THIS_LITERAL:
+    {
+      vm_jit_emit_load_literal (compiler_p, instr_p->literals[0], VM_JIT_RIGHT);
+      compiler_p->live = VM_JIT_LIVE_RIGHT;
+      vm_jit_emit_load_this (compiler_p, VM_JIT_LEFT);
+      compiler_p->live = VM_JIT_LIVE_LEFT | VM_JIT_LIVE_RIGHT;
+      return 1;
+    }
+    default:
+    {
+      return 0;
+    }
+  }
+} /* vm_jit_emit_get_operands */
+
+/**
+ * Emit the freeing of the live operands.
+ */
+static void
+vm_jit_emit_free_operands (vm_jit_compiler_t *compiler_p) /**< compiler */
+{
+  if (compiler_p->live & VM_JIT_LIVE_RIGHT)
+  {
+    vm_jit_emit_free (compiler_p, VM_JIT_RIGHT);
+  }
+
+  if (compiler_p->live & VM_JIT_LIVE_LEFT)
+  {
+    vm_jit_emit_free (compiler_p, VM_JIT_LEFT);
+  }
+
+  compiler_p->live = 0;
+} /* vm_jit_emit_free_operands */
+
+/**
+ * Emit the storing of the result register, which is owned by the emitted code.
+ */
+static void
+vm_jit_emit_put_result (vm_jit_compiler_t *compiler_p, /**< compiler */
+                        const vm_jit_instruction_t *instr_p, /**< instruction */
+                        uint32_t opcode_data, /**< opcode data */
+                        uint16_t literal_index) /**< literal index of the identifier */
+{
+  uint32_t keep_value = (opcode_data & (VM_OC_PUT_STACK | VM_OC_PUT_BLOCK)) ? VM_JIT_PUT_KEEP_VALUE : 0;
+
+  if (opcode_data & VM_OC_PUT_IDENT)
+  {
+    if (literal_index < compiler_p->register_end)
+    {
+      int32_t disp = VM_JIT_REGISTER_OFFSET (literal_index);
+
+      vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_RDI, VM_JIT_FRAME, disp);
+      vm_jit_emit_store (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_FRAME, disp, VM_JIT_RESULT);
+      vm_jit_emit_free (compiler_p, VM_JIT_RDI);
+
+      if (keep_value)
+      {
+        vm_jit_emit_copy (compiler_p, VM_JIT_RESULT);
+      }
+    }
+    else
+    {
+      ecma_string_t *name_p = ecma_get_string_from_value (compiler_p->literal_start_p[literal_index]);
+      uint32_t flags = keep_value | (compiler_p->is_strict ? VM_JIT_PUT_STRICT : 0);
+
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+      vm_jit_emit_mov_imm (compiler_p, VM_JIT_RSI, (uintptr_t) name_p);
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDX, VM_JIT_RESULT);
+      vm_jit_emit_mov_imm (compiler_p, VM_JIT_RCX, flags);
+      vm_jit_emit_call (compiler_p, (uintptr_t) &vm_jit_put_ident);
+      vm_jit_emit_check_error (compiler_p);
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RESULT, VM_JIT_RAX);
+    }
+  }
+  else if (opcode_data & VM_OC_PUT_REFERENCE)
+  {
+    uint32_t flags = keep_value | (compiler_p->is_strict ? VM_JIT_PUT_STRICT : 0);
+
+    vm_jit_emit_op_ri (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_OP_SUB, VM_JIT_STACK, 2 * VM_JIT_VALUE_SIZE);
+    vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+    vm_jit_emit_mov_imm (compiler_p, VM_JIT_RSI, (uintptr_t) (compiler_p->byte_code_start_p + instr_p->offset));
+    vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_RDX, VM_JIT_STACK, 0);
+    vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_RCX, VM_JIT_STACK, VM_JIT_VALUE_SIZE);
+    vm_jit_emit_mov_rr (compiler_p, VM_JIT_R8, VM_JIT_RESULT);
+    vm_jit_emit_mov_imm (compiler_p, VM_JIT_R9, flags);
+    vm_jit_emit_call (compiler_p, (uintptr_t) &vm_jit_put_reference);
+    vm_jit_emit_check_error (compiler_p);
+    vm_jit_emit_mov_rr (compiler_p, VM_JIT_RESULT, VM_JIT_RAX);
+  }
+
+  if (opcode_data & VM_OC_PUT_STACK)
+  {
+    vm_jit_emit_push (compiler_p, VM_JIT_RESULT);
+  }
+  else if (opcode_data & VM_OC_PUT_BLOCK)
+  {
+    int32_t disp = VM_JIT_FRAME_OFFSET (block_result);
+
+    vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_RDI, VM_JIT_FRAME, disp);
+    vm_jit_emit_store (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_FRAME, disp, VM_JIT_RESULT);
+    vm_jit_emit_free (compiler_p, VM_JIT_RDI);
+  }
+
+  vm_jit_emit_free_operands (compiler_p);
+} /* vm_jit_emit_put_result */
+
+/**
+ * Emit the increment and decrement operators. The value is in the left register.
+ */
+static void
+vm_jit_emit_incr_decr (vm_jit_compiler_t *compiler_p, /**< compiler */
+                       const vm_jit_instruction_t *instr_p) /**< instruction */
+{
+  uint32_t opcode_data = instr_p->opcode_data;
+  uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
+
+  JERRY_ASSERT (compiler_p->live == VM_JIT_LIVE_LEFT);
+
+  /* Fast path: integer value without overflow. */
+  vm_jit_emit_test_imm8 (compiler_p, VM_JIT_LEFT, ECMA_DIRECT_TYPE_MASK);
+  uint32_t slow_path = vm_jit_emit_jump (compiler_p, VM_JIT_CC_NE);
+
+  int32_t increase = (opcode_flags & VM_OC_DECREMENT_OPERATOR_FLAG) ? -(1 << ECMA_DIRECT_SHIFT) : (1 << ECMA_DIRECT_SHIFT);
+  vm_jit_emit_op_rr (compiler_p, 0, 0x89, VM_JIT_RESULT, VM_JIT_LEFT);
+  vm_jit_emit_op_ri (compiler_p, 0, VM_JIT_OP_ADD, VM_JIT_RESULT, increase);
+  uint32_t overflow = vm_jit_emit_jump (compiler_p, VM_JIT_CC_O);
+  vm_jit_emit_extend_int (compiler_p, VM_JIT_RESULT);
+
+  if (opcode_flags & VM_OC_POST_INCR_DECR_OPERATOR_FLAG)
+  {
+    if (opcode_data & VM_OC_PUT_STACK)
+    {
+      if (opcode_flags & VM_OC_IDENT_INCR_DECR_OPERATOR_FLAG)
+      {
+        vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+      }
+      else
+      {
+        /* The unmodified value is stored below the base and property of the reference. */
+        vm_jit_emit_op_ri (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_OP_ADD, VM_JIT_STACK, VM_JIT_VALUE_SIZE);
+        vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_RAX, VM_JIT_STACK, -2 * VM_JIT_VALUE_SIZE);
+        vm_jit_emit_store (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_STACK, -VM_JIT_VALUE_SIZE, VM_JIT_RAX);
+        vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_RAX, VM_JIT_STACK, -3 * VM_JIT_VALUE_SIZE);
+        vm_jit_emit_store (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_STACK, -2 * VM_JIT_VALUE_SIZE, VM_JIT_RAX);
+        vm_jit_emit_store (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_STACK, -3 * VM_JIT_VALUE_SIZE, VM_JIT_LEFT);
+      }
+    }
+    else if (opcode_data & VM_OC_PUT_BLOCK)
+    {
+      int32_t disp = VM_JIT_FRAME_OFFSET (block_result);
+
+      vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_RDI, VM_JIT_FRAME, disp);
+      vm_jit_emit_store (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_FRAME, disp, VM_JIT_LEFT);
+      vm_jit_emit_free (compiler_p, VM_JIT_RDI);
+    }
+  }
+
+  uint32_t done = vm_jit_emit_jump (compiler_p, -1);
+
+  /* Slow path: the helper consumes the value and updates the stack in the frame context. */
+  vm_jit_patch_jump_here (compiler_p, slow_path);
+  vm_jit_patch_jump_here (compiler_p, overflow);
+
+  vm_jit_emit_store (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (stack_top_p), VM_JIT_STACK);
+  vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+  vm_jit_emit_mov_rr (compiler_p, VM_JIT_RSI, VM_JIT_LEFT);
+  vm_jit_emit_mov_imm (compiler_p, VM_JIT_RDX, opcode_data);
+  vm_jit_emit_call (compiler_p, (uintptr_t) &vm_jit_incr_decr);
+  vm_jit_emit_load (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_STACK, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (stack_top_p));
+  compiler_p->live = 0;
+  vm_jit_emit_check_error (compiler_p);
+  vm_jit_emit_mov_rr (compiler_p, VM_JIT_RESULT, VM_JIT_RAX);
+
+  vm_jit_patch_jump_here (compiler_p, done);
+
+  if (opcode_flags & VM_OC_POST_INCR_DECR_OPERATOR_FLAG)
+  {
+    if (opcode_data & VM_OC_PUT_STACK)
+    {
+      opcode_data &= (uint32_t) ~VM_OC_PUT_STACK;
+    }
+    else
+    {
+      opcode_data &= (uint32_t) ~VM_OC_PUT_BLOCK;
+    }
+  }
+
+  /* Ident forms store the result into their only literal. */
+  vm_jit_emit_put_result (compiler_p, instr_p, opcode_data, instr_p->literals[0]);
+} /* vm_jit_emit_incr_decr */
+
+/**
+ * Emit a call of the binary operation helper. The result is in rax.
+ */
+static void
+vm_jit_emit_binary_helper (vm_jit_compiler_t *compiler_p, /**< compiler */
+                           uint32_t group) /**< opcode group */
+{
+  vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_LEFT);
+  vm_jit_emit_mov_rr (compiler_p, VM_JIT_RSI, VM_JIT_RIGHT);
+  vm_jit_emit_mov_imm (compiler_p, VM_JIT_RDX, group);
+  vm_jit_emit_call (compiler_p, (uintptr_t) &vm_jit_binary_operation);
+  compiler_p->live = 0;
+  vm_jit_emit_check_error (compiler_p);
+} /* vm_jit_emit_binary_helper */
+
+/**
+ * Emit a type check which jumps if any of the masked bits of the operands is set.
+ *
+ * @return position of the jump
+ */
+static uint32_t
+vm_jit_emit_check_operands (vm_jit_compiler_t *compiler_p, /**< compiler */
+                            uint32_t mask) /**< tested bits */
+{
+  vm_jit_emit_op_rr (compiler_p, 0, 0x89, VM_JIT_RAX, VM_JIT_LEFT);
+  vm_jit_emit_op_rr (compiler_p, 0, 0x09, VM_JIT_RAX, VM_JIT_RIGHT);
+  vm_jit_emit_test_imm8 (compiler_p, VM_JIT_RAX, mask);
+  return vm_jit_emit_jump (compiler_p, VM_JIT_CC_NE);
+} /* vm_jit_emit_check_operands */
+
+/**
+ * Emit an arithmetic or bitwise operation.
+ */
+static void
+vm_jit_emit_arithmetic (vm_jit_compiler_t *compiler_p, /**< compiler */
+                        uint32_t group) /**< opcode group */
+{
+  uint32_t slow_path = vm_jit_emit_check_operands (compiler_p, ECMA_DIRECT_TYPE_MASK);
+  uint32_t overflow = UINT32_MAX;
+  uint32_t zero = UINT32_MAX;
+
+  switch (group)
+  {
+    case VM_OC_ADD:
+    case VM_OC_SUB:
+    {
+      /* The shifted integers fit into 32 bits, so the overflow flag is exact. */
+      vm_jit_emit_op_rr (compiler_p, 0, 0x89, VM_JIT_RESULT, VM_JIT_LEFT);
+      vm_jit_emit_op_rr (compiler_p, 0, (group == VM_OC_ADD) ? 0x01 : 0x29, VM_JIT_RESULT, VM_JIT_RIGHT);
+      overflow = vm_jit_emit_jump (compiler_p, VM_JIT_CC_O);
+      vm_jit_emit_extend_int (compiler_p, VM_JIT_RESULT);
+      break;
+    }
+    case VM_OC_MUL:
+    {
+      /* mov eax, left; sar eax, 4; imul eax, right */
+      vm_jit_emit_op_rr (compiler_p, 0, 0x89, VM_JIT_RAX, VM_JIT_LEFT);
+      vm_jit_emit_rex (compiler_p, 0, 0, VM_JIT_RAX);
+      vm_jit_emit_byte (compiler_p, 0xc1);
+      vm_jit_emit_modrm_reg (compiler_p, 7, VM_JIT_RAX);
+      vm_jit_emit_byte (compiler_p, ECMA_DIRECT_SHIFT);
+      vm_jit_emit_rex (compiler_p, 0, VM_JIT_RAX, VM_JIT_RIGHT);
+      vm_jit_emit_byte (compiler_p, 0x0f);
+      vm_jit_emit_byte (compiler_p, 0xaf);
+      vm_jit_emit_modrm_reg (compiler_p, VM_JIT_RAX, VM_JIT_RIGHT);
+      overflow = vm_jit_emit_jump (compiler_p, VM_JIT_CC_O);
+
+      /* Zero results might be negative zero. */
+      vm_jit_emit_op_rr (compiler_p, 0, 0x85, VM_JIT_RAX, VM_JIT_RAX);
+      zero = vm_jit_emit_jump (compiler_p, VM_JIT_CC_E);
+      vm_jit_emit_op_rr (compiler_p, 0, 0x89, VM_JIT_RESULT, VM_JIT_RAX);
+      vm_jit_emit_extend_int (compiler_p, VM_JIT_RESULT);
+      break;
+    }
+    default:
+    {
+      uint32_t opcode = 0x31;
+
+      if (group == VM_OC_BIT_AND)
+      {
+        opcode = 0x21;
+      }
+      else if (group == VM_OC_BIT_OR)
+      {
+        opcode = 0x09;
+      }
+
+      JERRY_ASSERT (group == VM_OC_BIT_AND || group == VM_OC_BIT_OR || group == VM_OC_BIT_XOR);
+
+      /* The type bits of the integers are zero, so they are unchanged. */
+      vm_jit_emit_op_rr (compiler_p, VM_JIT_VALUE_WIDE, 0x89, VM_JIT_RESULT, VM_JIT_LEFT);
+      vm_jit_emit_op_rr (compiler_p, VM_JIT_VALUE_WIDE, opcode, VM_JIT_RESULT, VM_JIT_RIGHT);
+      break;
+    }
+  }
+
+  uint32_t done = vm_jit_emit_jump (compiler_p, -1);
+
+  vm_jit_patch_jump_here (compiler_p, slow_path);
+
+  if (overflow != UINT32_MAX)
+  {
+    vm_jit_patch_jump_here (compiler_p, overflow);
+  }
+
+  if (zero != UINT32_MAX)
+  {
+    vm_jit_patch_jump_here (compiler_p, zero);
+  }
+
+  vm_jit_emit_binary_helper (compiler_p, group);
+  vm_jit_emit_mov_rr (compiler_p, VM_JIT_RESULT, VM_JIT_RAX);
+
+  vm_jit_patch_jump_here (compiler_p, done);
+  vm_jit_emit_push (compiler_p, VM_JIT_RESULT);
+
+  /* Both paths consumed the operands: integers are not freed. */
+  compiler_p->live = 0;
+} /* vm_jit_emit_arithmetic */
+
+/**
+ * Emit a comparison, which is fused with the next conditional branch if possible.
+ */
+static void
+vm_jit_emit_compare (vm_jit_compiler_t *compiler_p, /**< compiler */
+                     uint32_t group, /**< opcode group */
+                     const vm_jit_instruction_t *branch_p) /**< next branch instruction or NULL */
+{
+  vm_jit_cc_t cc;
+  uint32_t mask = ECMA_DIRECT_TYPE_MASK;
+  uint32_t is_wide = 0;
+
+  switch (group)
+  {
+    case VM_OC_EQUAL:
+    {
+      cc = VM_JIT_CC_E;
+      break;
+    }
+    case VM_OC_NOT_EQUAL:
+    {
+      cc = VM_JIT_CC_NE;
+      break;
+    }
+    case VM_OC_STRICT_EQUAL:
+    case VM_OC_STRICT_NOT_EQUAL:
+    {
+      /* Direct values are strictly equal if their encoding is the same. */
+      cc = (group == VM_OC_STRICT_EQUAL) ? VM_JIT_CC_E : VM_JIT_CC_NE;
+      mask = ECMA_VALUE_TYPE_MASK;
+      is_wide = VM_JIT_VALUE_WIDE;
+      break;
+    }
+    case VM_OC_LESS:
+    {
+      cc = VM_JIT_CC_L;
+      break;
+    }
+    case VM_OC_GREATER:
+    {
+      cc = VM_JIT_CC_G;
+      break;
+    }
+    case VM_OC_LESS_EQUAL:
+    {
+      cc = VM_JIT_CC_LE;
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (group == VM_OC_GREATER_EQUAL);
+      cc = VM_JIT_CC_GE;
+      break;
+    }
+  }
+
+  uint32_t slow_path = vm_jit_emit_check_operands (compiler_p, mask);
+  vm_jit_emit_op_rr (compiler_p, is_wide, 0x39, VM_JIT_LEFT, VM_JIT_RIGHT);
+  compiler_p->live = 0;
+
+  uint32_t done;
+
+  if (branch_p != NULL)
+  {
+    bool is_false = VM_OC_GROUP_GET_INDEX (branch_p->opcode_data) == VM_OC_BRANCH_IF_FALSE;
+    uint32_t next = vm_jit_get_label (compiler_p, branch_p->offset + branch_p->length);
+
+    vm_jit_emit_branch (compiler_p, is_false ? (int32_t) (cc ^ 0x1) : (int32_t) cc, branch_p);
+    vm_jit_emit_jump_to (compiler_p, -1, next);
+
+    compiler_p->live = VM_JIT_LIVE_LEFT | VM_JIT_LIVE_RIGHT;
+    vm_jit_patch_jump_here (compiler_p, slow_path);
+    vm_jit_emit_binary_helper (compiler_p, group);
+
+    vm_jit_emit_op_ri (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_OP_CMP, VM_JIT_RAX, (int32_t) ECMA_VALUE_TRUE);
+    vm_jit_emit_branch (compiler_p, is_false ? VM_JIT_CC_NE : VM_JIT_CC_E, branch_p);
+    vm_jit_emit_jump_to (compiler_p, -1, next);
+    return;
+  }
+
+  vm_jit_emit_mov_imm (compiler_p, VM_JIT_RESULT, ECMA_VALUE_FALSE);
+  vm_jit_emit_mov_imm (compiler_p, VM_JIT_RAX, ECMA_VALUE_TRUE);
+  vm_jit_emit_cmov (compiler_p, cc, VM_JIT_RESULT, VM_JIT_RAX);
+  done = vm_jit_emit_jump (compiler_p, -1);
+
+  compiler_p->live = VM_JIT_LIVE_LEFT | VM_JIT_LIVE_RIGHT;
+  vm_jit_patch_jump_here (compiler_p, slow_path);
+  vm_jit_emit_binary_helper (compiler_p, group);
+  vm_jit_emit_mov_rr (compiler_p, VM_JIT_RESULT, VM_JIT_RAX);
+
+  vm_jit_patch_jump_here (compiler_p, done);
+  vm_jit_emit_push (compiler_p, VM_JIT_RESULT);
+} /* vm_jit_emit_compare */
+
+/**
+ * Emit a conditional branch on the top of the stack.
+ */
+static void
+vm_jit_emit_conditional_branch (vm_jit_compiler_t *compiler_p, /**< compiler */
+                                const vm_jit_instruction_t *instr_p) /**< instruction */
+{
+  uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (instr_p->opcode_data) - VM_OC_BRANCH_IF_TRUE;
+  bool is_false = (opcode_flags & VM_OC_BRANCH_IF_FALSE_FLAG) != 0;
+  bool is_logical = (opcode_flags & VM_OC_LOGICAL_BRANCH_FLAG) != 0;
+
+  vm_jit_emit_pop (compiler_p, VM_JIT_LEFT);
+
+  /* Booleans are direct values, so they do not need to be freed. */
+  vm_jit_emit_op_ri (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_OP_CMP, VM_JIT_LEFT, (int32_t) ECMA_VALUE_TRUE);
+  uint32_t is_true = vm_jit_emit_jump (compiler_p, VM_JIT_CC_E);
+  vm_jit_emit_op_ri (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_OP_CMP, VM_JIT_LEFT, (int32_t) ECMA_VALUE_FALSE);
+  uint32_t is_false_value = vm_jit_emit_jump (compiler_p, VM_JIT_CC_E);
+
+  vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_LEFT);
+  vm_jit_emit_call (compiler_p, (uintptr_t) &ecma_op_to_boolean);
+  /* test al, al */
+  vm_jit_emit_byte (compiler_p, 0x84);
+  vm_jit_emit_byte (compiler_p, 0xc0);
+  uint32_t is_taken = vm_jit_emit_jump (compiler_p, is_false ? VM_JIT_CC_E : VM_JIT_CC_NE);
+  vm_jit_emit_free (compiler_p, VM_JIT_LEFT);
+  uint32_t not_taken = vm_jit_emit_jump (compiler_p, -1);
+
+  vm_jit_patch_jump_here (compiler_p, is_taken);
+
+  if (!is_logical)
+  {
+    vm_jit_emit_free (compiler_p, VM_JIT_LEFT);
+  }
+
+  uint32_t boolean_taken = compiler_p->code_size;
+
+  if (is_logical)
+  {
+    /* "Push" the value back to the stack. */
+    vm_jit_emit_op_ri (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_OP_ADD, VM_JIT_STACK, VM_JIT_VALUE_SIZE);
+  }
+
+  vm_jit_emit_branch (compiler_p, -1, instr_p);
+
+  vm_jit_patch_jump (compiler_p, is_true, is_false ? compiler_p->code_size : boolean_taken);
+  vm_jit_patch_jump (compiler_p, is_false_value, is_false ? boolean_taken : compiler_p->code_size);
+  vm_jit_patch_jump_here (compiler_p, not_taken);
+} /* vm_jit_emit_conditional_branch */
+
+/**
+ * Emit the machine code template of an instruction.
+ *
+ * @return true - if the instruction has a template,
+ *         false - otherwise (nothing useful is emitted)
+ */
+static bool
+vm_jit_emit_instruction (vm_jit_compiler_t *compiler_p, /**< compiler */
+                         const vm_jit_instruction_t *instr_p, /**< instruction */
+                         const vm_jit_instruction_t *next_p) /**< next instruction or NULL */
+{
+  uint32_t opcode_data = instr_p->opcode_data;
+  uint32_t group = VM_OC_GROUP_GET_INDEX (opcode_data);
+  uint32_t literal_index;
+
+  /* Template literals are constructed by the interpreter. */
+  for (uint32_t i = 0; i < instr_p->literal_count; i++)
+  {
+    if (instr_p->literals[i] >= compiler_p->const_literal_end)
+    {
+      return false;
+    }
+  }
+
+  compiler_p->live = 0;
+
+  switch (group)
+  {
+    case VM_OC_POP:
+    {
+      vm_jit_emit_pop (compiler_p, VM_JIT_RDI);
+      vm_jit_emit_free (compiler_p, VM_JIT_RDI);
+      return true;
+    }
+    case VM_OC_POP_BLOCK:
+    {
+      int32_t disp = VM_JIT_FRAME_OFFSET (block_result);
+
+      vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_RDI, VM_JIT_FRAME, disp);
+      vm_jit_emit_pop (compiler_p, VM_JIT_RAX);
+      vm_jit_emit_store (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_FRAME, disp, VM_JIT_RAX);
+      vm_jit_emit_free (compiler_p, VM_JIT_RDI);
+      return true;
+    }
+    case VM_OC_PUSH:
+    case VM_OC_PUSH_TWO:
+    {
+      vm_jit_emit_get_operands (compiler_p, instr_p);
+      vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+
+      if (group == VM_OC_PUSH_TWO)
+      {
+        vm_jit_emit_push (compiler_p, VM_JIT_RIGHT);
+      }
+      return true;
+    }
+    case VM_OC_PUSH_THREE:
+    {
+      if (instr_p->literal_count != 3)
+      {
+        return false;
+      }
+
+      vm_jit_emit_get_operands (compiler_p, instr_p);
+      vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+      compiler_p->live = VM_JIT_LIVE_RIGHT;
+      vm_jit_emit_load_literal (compiler_p, instr_p->literals[2], VM_JIT_LEFT);
+      vm_jit_emit_push (compiler_p, VM_JIT_RIGHT);
+      vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+      return true;
+    }
+    case VM_OC_PUSH_UNDEFINED:
+    {
+      vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_UNDEFINED);
+      return true;
+    }
+    case VM_OC_PUSH_TRUE:
+    {
+      vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_TRUE);
+      return true;
+    }
+    case VM_OC_PUSH_FALSE:
+    {
+      vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_FALSE);
+      return true;
+    }
+    case VM_OC_PUSH_NULL:
+    {
+      vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_NULL);
+      return true;
+    }
+    case VM_OC_PUSH_THIS:
+    {
+      vm_jit_emit_load_this (compiler_p, VM_JIT_RAX);
+      vm_jit_emit_push (compiler_p, VM_JIT_RAX);
+      return true;
+    }
+    case VM_OC_PUSH_0:
+    case VM_OC_PUSH_LIT_0:
+    case VM_OC_PUSH_POS_BYTE:
+    case VM_OC_PUSH_LIT_POS_BYTE:
+    case VM_OC_PUSH_NEG_BYTE:
+    case VM_OC_PUSH_LIT_NEG_BYTE:
+    {
+      ecma_integer_value_t number = 0;
+
+      if (group == VM_OC_PUSH_POS_BYTE || group == VM_OC_PUSH_LIT_POS_BYTE)
+      {
+        number = instr_p->byte_arg + 1;
+      }
+      else if (group == VM_OC_PUSH_NEG_BYTE || group == VM_OC_PUSH_LIT_NEG_BYTE)
+      {
+        number = -(instr_p->byte_arg + 1);
+      }
+
+      if (group == VM_OC_PUSH_LIT_0 || group == VM_OC_PUSH_LIT_POS_BYTE || group == VM_OC_PUSH_LIT_NEG_BYTE)
+      {
+        vm_jit_emit_get_operands (compiler_p, instr_p);
+        vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+      }
+
+      vm_jit_emit_push_imm (compiler_p, ecma_make_integer_value (number));
+      return true;
+    }
+    case VM_OC_PROP_GET:
+    {
+      vm_jit_emit_get_operands (compiler_p, instr_p);
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+      vm_jit_emit_mov_imm (compiler_p, VM_JIT_RSI, (uintptr_t) (compiler_p->byte_code_start_p + instr_p->offset));
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDX, VM_JIT_LEFT);
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RCX, VM_JIT_RIGHT);
+      vm_jit_emit_call (compiler_p, (uintptr_t) &vm_jit_get_value);
+      vm_jit_emit_check_error (compiler_p);
+      vm_jit_emit_push (compiler_p, VM_JIT_RAX);
+      vm_jit_emit_free_operands (compiler_p);
+      return true;
+    }
+    case VM_OC_CREATE_ARGUMENTS:
+    {
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+      vm_jit_emit_mov_imm (compiler_p, VM_JIT_RSI, instr_p->literals[0]);
+      vm_jit_emit_call (compiler_p, (uintptr_t) &vm_jit_create_arguments);
+      return true;
+    }
+    case VM_OC_PUSH_ARGUMENTS:
+    {
+      if (instr_p->opcode == CBC_EXT_PUSH_ARGUMENTS_ELEMENT)
+      {
+        vm_jit_emit_load_literal (compiler_p, instr_p->literals[1], VM_JIT_RIGHT);
+        compiler_p->live = VM_JIT_LIVE_RIGHT;
+        vm_jit_emit_mov_rr (compiler_p, VM_JIT_RCX, VM_JIT_RIGHT);
+      }
+      else
+      {
+        vm_jit_emit_mov_imm (compiler_p, VM_JIT_RCX, ecma_make_magic_string_value (LIT_MAGIC_STRING_LENGTH));
+      }
+
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+      vm_jit_emit_mov_imm (compiler_p, VM_JIT_RSI, (uintptr_t) (compiler_p->byte_code_start_p + instr_p->offset));
+      vm_jit_emit_mov_imm (compiler_p, VM_JIT_RDX, instr_p->literals[0]);
+      vm_jit_emit_call (compiler_p, (uintptr_t) &vm_jit_get_arguments_property);
+      vm_jit_emit_check_error (compiler_p);
+      vm_jit_emit_push (compiler_p, VM_JIT_RAX);
+      vm_jit_emit_free_operands (compiler_p);
+      return true;
+    }
+    case VM_OC_PROP_REFERENCE:
+    case VM_OC_PROP_PRE_INCR:
+    case VM_OC_PROP_PRE_DECR:
+    case VM_OC_PROP_POST_INCR:
+    case VM_OC_PROP_POST_DECR:
+    {
+      if (instr_p->is_ext)
+      {
+        return false;
+      }
+
+      vm_jit_emit_get_operands (compiler_p, instr_p);
+
+      if (group == VM_OC_PROP_REFERENCE)
+      {
+        /* Forms with reference requires preserving the base and offset. */
+        if (instr_p->opcode == CBC_PUSH_PROP_REFERENCE)
+        {
+          vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_LEFT, VM_JIT_STACK, -2 * VM_JIT_VALUE_SIZE);
+          vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_RIGHT, VM_JIT_STACK, -VM_JIT_VALUE_SIZE);
+        }
+        else if (instr_p->opcode == CBC_PUSH_PROP_LITERAL_REFERENCE)
+        {
+          vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+          vm_jit_emit_mov_rr (compiler_p, VM_JIT_RIGHT, VM_JIT_LEFT);
+          vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_LEFT, VM_JIT_STACK, -2 * VM_JIT_VALUE_SIZE);
+        }
+        else
+        {
+          JERRY_ASSERT (instr_p->opcode == CBC_PUSH_PROP_LITERAL_LITERAL_REFERENCE
+                        || instr_p->opcode == CBC_PUSH_PROP_THIS_LITERAL_REFERENCE);
+          vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+          vm_jit_emit_push (compiler_p, VM_JIT_RIGHT);
+        }
+
+        /* The operands are owned by the stack. */
+        compiler_p->live = 0;
+      }
+
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+      vm_jit_emit_mov_imm (compiler_p, VM_JIT_RSI, (uintptr_t) (compiler_p->byte_code_start_p + instr_p->offset));
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDX, VM_JIT_LEFT);
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RCX, VM_JIT_RIGHT);
+      vm_jit_emit_call (compiler_p, (uintptr_t) &vm_jit_get_value);
+      vm_jit_emit_check_error (compiler_p);
+
+      if (group == VM_OC_PROP_REFERENCE)
+      {
+        vm_jit_emit_mov_rr (compiler_p, VM_JIT_RESULT, VM_JIT_RAX);
+        vm_jit_emit_put_result (compiler_p, instr_p, opcode_data, 0);
+        return true;
+      }
+
+      /* The base and property stays on the stack for the put operation. */
+      vm_jit_emit_op_ri (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_OP_ADD, VM_JIT_STACK, 2 * VM_JIT_VALUE_SIZE);
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_LEFT, VM_JIT_RAX);
+      compiler_p->live = VM_JIT_LIVE_LEFT;
+      vm_jit_emit_incr_decr (compiler_p, instr_p);
+      return true;
+    }
+    case VM_OC_PRE_INCR:
+    case VM_OC_PRE_DECR:
+    case VM_OC_POST_INCR:
+    case VM_OC_POST_DECR:
+    {
+      vm_jit_emit_get_operands (compiler_p, instr_p);
+      vm_jit_emit_incr_decr (compiler_p, instr_p);
+      return true;
+    }
+    case VM_OC_MOV_IDENT:
+    {
+      literal_index = vm_jit_emit_get_operands (compiler_p, instr_p);
+
+      if (literal_index >= instr_p->literal_count
+          || instr_p->literals[literal_index] >= compiler_p->register_end)
+      {
+        return false;
+      }
+
+      int32_t disp = VM_JIT_REGISTER_OFFSET (instr_p->literals[literal_index]);
+
+      vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_RDI, VM_JIT_FRAME, disp);
+      vm_jit_emit_store (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_FRAME, disp, VM_JIT_LEFT);
+      vm_jit_emit_free (compiler_p, VM_JIT_RDI);
+      return true;
+    }
+    case VM_OC_ASSIGN:
+    case VM_OC_ASSIGN_PROP:
+    case VM_OC_ASSIGN_PROP_THIS:
+    {
+      literal_index = vm_jit_emit_get_operands (compiler_p, instr_p);
+
+      if ((opcode_data & VM_OC_PUT_IDENT) && literal_index >= instr_p->literal_count)
+      {
+        return false;
+      }
+
+      if (group == VM_OC_ASSIGN)
+      {
+        vm_jit_emit_mov_rr (compiler_p, VM_JIT_RESULT, VM_JIT_LEFT);
+      }
+      else if (group == VM_OC_ASSIGN_PROP)
+      {
+        vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_RESULT, VM_JIT_STACK, -VM_JIT_VALUE_SIZE);
+        vm_jit_emit_store (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_STACK, -VM_JIT_VALUE_SIZE, VM_JIT_LEFT);
+      }
+      else
+      {
+        vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_RESULT, VM_JIT_STACK, -VM_JIT_VALUE_SIZE);
+        vm_jit_emit_load_this (compiler_p, VM_JIT_RAX);
+        vm_jit_emit_store (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_STACK, -VM_JIT_VALUE_SIZE, VM_JIT_RAX);
+        vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+      }
+
+      compiler_p->live = 0;
+      vm_jit_emit_put_result (compiler_p, instr_p, opcode_data,
+                              (opcode_data & VM_OC_PUT_IDENT) ? instr_p->literals[literal_index] : 0);
+      return true;
+    }
+    case VM_OC_CALL:
+    case VM_OC_NEW:
+    {
+      if (instr_p->is_ext)
+      {
+        return false;
+      }
+
+      /* The call operations of the interpreter read their arguments from the frame context. */
+      vm_jit_emit_store (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (stack_top_p), VM_JIT_STACK);
+      vm_jit_emit_store_byte_code_p (compiler_p, instr_p->offset);
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+      vm_jit_emit_mov_imm (compiler_p, VM_JIT_RSI, group == VM_OC_NEW);
+      vm_jit_emit_call (compiler_p, (uintptr_t) &vm_jit_call);
+      vm_jit_emit_load (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_STACK, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (stack_top_p));
+      vm_jit_emit_check_error (compiler_p);
+      return true;
+    }
+    case VM_OC_JUMP:
+    {
+      vm_jit_emit_branch (compiler_p, -1, instr_p);
+      return true;
+    }
+    case VM_OC_BRANCH_IF_STRICT_EQUAL:
+    {
+      vm_jit_emit_pop (compiler_p, VM_JIT_LEFT);
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_LEFT);
+      vm_jit_emit_load (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_RSI, VM_JIT_STACK, -VM_JIT_VALUE_SIZE);
+      vm_jit_emit_call (compiler_p, (uintptr_t) &ecma_op_strict_equality_compare);
+      /* test al, al */
+      vm_jit_emit_byte (compiler_p, 0x84);
+      vm_jit_emit_byte (compiler_p, 0xc0);
+      uint32_t not_equal = vm_jit_emit_jump (compiler_p, VM_JIT_CC_E);
+
+      vm_jit_emit_pop (compiler_p, VM_JIT_RDI);
+      vm_jit_emit_free (compiler_p, VM_JIT_RDI);
+      vm_jit_emit_free (compiler_p, VM_JIT_LEFT);
+      vm_jit_emit_branch (compiler_p, -1, instr_p);
+
+      vm_jit_patch_jump_here (compiler_p, not_equal);
+      vm_jit_emit_free (compiler_p, VM_JIT_LEFT);
+      return true;
+    }
+    case VM_OC_BRANCH_IF_TRUE:
+    case VM_OC_BRANCH_IF_FALSE:
+    case VM_OC_BRANCH_IF_LOGICAL_TRUE:
+    case VM_OC_BRANCH_IF_LOGICAL_FALSE:
+    {
+      vm_jit_emit_conditional_branch (compiler_p, instr_p);
+      return true;
+    }
+    case VM_OC_NOT:
+    {
+      vm_jit_emit_get_operands (compiler_p, instr_p);
+
+      vm_jit_emit_mov_imm (compiler_p, VM_JIT_RESULT, ECMA_VALUE_FALSE);
+      vm_jit_emit_op_ri (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_OP_CMP, VM_JIT_LEFT, (int32_t) ECMA_VALUE_TRUE);
+      uint32_t is_true = vm_jit_emit_jump (compiler_p, VM_JIT_CC_E);
+      vm_jit_emit_mov_imm (compiler_p, VM_JIT_RESULT, ECMA_VALUE_TRUE);
+      vm_jit_emit_op_ri (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_OP_CMP, VM_JIT_LEFT, (int32_t) ECMA_VALUE_FALSE);
+      uint32_t is_false = vm_jit_emit_jump (compiler_p, VM_JIT_CC_E);
+
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_LEFT);
+      vm_jit_emit_call (compiler_p, (uintptr_t) &ecma_op_to_boolean);
+      /* test al, al */
+      vm_jit_emit_byte (compiler_p, 0x84);
+      vm_jit_emit_byte (compiler_p, 0xc0);
+      vm_jit_emit_mov_imm (compiler_p, VM_JIT_RAX, ECMA_VALUE_FALSE);
+      vm_jit_emit_cmov (compiler_p, VM_JIT_CC_NE, VM_JIT_RESULT, VM_JIT_RAX);
+      vm_jit_emit_free (compiler_p, VM_JIT_LEFT);
+
+      vm_jit_patch_jump_here (compiler_p, is_true);
+      vm_jit_patch_jump_here (compiler_p, is_false);
+      vm_jit_emit_push (compiler_p, VM_JIT_RESULT);
+      compiler_p->live = 0;
+      return true;
+    }
+    case VM_OC_BIT_NOT:
+    {
+      JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
+                           direct_type_mask_must_fill_all_bits_before_the_value_starts);
+
+      vm_jit_emit_get_operands (compiler_p, instr_p);
+      vm_jit_emit_test_imm8 (compiler_p, VM_JIT_LEFT, ECMA_DIRECT_TYPE_MASK);
+      uint32_t slow_path = vm_jit_emit_jump (compiler_p, VM_JIT_CC_NE);
+
+      /* not result; and result, ~mask */
+      vm_jit_emit_op_rr (compiler_p, VM_JIT_VALUE_WIDE, 0x89, VM_JIT_RESULT, VM_JIT_LEFT);
+      vm_jit_emit_rex (compiler_p, VM_JIT_VALUE_WIDE, 0, VM_JIT_RESULT);
+      vm_jit_emit_byte (compiler_p, 0xf7);
+      vm_jit_emit_modrm_reg (compiler_p, 2, VM_JIT_RESULT);
+      vm_jit_emit_op_ri (compiler_p, VM_JIT_VALUE_WIDE, VM_JIT_OP_AND, VM_JIT_RESULT, ~(int32_t) ECMA_DIRECT_TYPE_MASK);
+      uint32_t done = vm_jit_emit_jump (compiler_p, -1);
+
+      vm_jit_patch_jump_here (compiler_p, slow_path);
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_LEFT);
+      vm_jit_emit_mov_imm (compiler_p, VM_JIT_RSI, group);
+      vm_jit_emit_call (compiler_p, (uintptr_t) &vm_jit_unary_operation);
+      compiler_p->live = 0;
+      vm_jit_emit_check_error (compiler_p);
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RESULT, VM_JIT_RAX);
+
+      vm_jit_patch_jump_here (compiler_p, done);
+      vm_jit_emit_push (compiler_p, VM_JIT_RESULT);
+      return true;
+    }
+    case VM_OC_PLUS:
+    case VM_OC_MINUS:
+    case VM_OC_TYPEOF:
+    {
+      vm_jit_emit_get_operands (compiler_p, instr_p);
+      vm_jit_emit_mov_rr (compiler_p, VM_JIT_RDI, VM_JIT_LEFT);
+      vm_jit_emit_mov_imm (compiler_p, VM_JIT_RSI, group);
+      vm_jit_emit_call (compiler_p, (uintptr_t) &vm_jit_unary_operation);
+      compiler_p->live = 0;
+      vm_jit_emit_check_error (compiler_p);
+      vm_jit_emit_push (compiler_p, VM_JIT_RAX);
+      return true;
+    }
+    case VM_OC_VOID:
+    {
+      vm_jit_emit_get_operands (compiler_p, instr_p);
+      vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_UNDEFINED);
+      vm_jit_emit_free_operands (compiler_p);
+      return true;
+    }
+    case VM_OC_ADD:
+    case VM_OC_SUB:
+    case VM_OC_MUL:
+    case VM_OC_BIT_OR:
+    case VM_OC_BIT_XOR:
+    case VM_OC_BIT_AND:
+    {
+      vm_jit_emit_get_operands (compiler_p, instr_p);
+      vm_jit_emit_arithmetic (compiler_p, group);
+      return true;
+    }
+    case VM_OC_DIV:
+    case VM_OC_MOD:
+#if ENABLED (JERRY_ESNEXT)
+    case VM_OC_EXP:
+#endif /* ENABLED (JERRY_ESNEXT) */
+    case VM_OC_LEFT_SHIFT:
+    case VM_OC_RIGHT_SHIFT:
+    case VM_OC_UNS_RIGHT_SHIFT:
+    case VM_OC_IN:
+    case VM_OC_INSTANCEOF:
+    {
+      vm_jit_emit_get_operands (compiler_p, instr_p);
+      vm_jit_emit_binary_helper (compiler_p, group);
+      vm_jit_emit_push (compiler_p, VM_JIT_RAX);
+      return true;
+    }
+    case VM_OC_EQUAL:
+    case VM_OC_NOT_EQUAL:
+    case VM_OC_STRICT_EQUAL:
+    case VM_OC_STRICT_NOT_EQUAL:
+    case VM_OC_LESS:
+    case VM_OC_GREATER:
+    case VM_OC_LESS_EQUAL:
+    case VM_OC_GREATER_EQUAL:
+    {
+      if (next_p != NULL
+          && (next_p->is_ext
+              || (VM_OC_GROUP_GET_INDEX (next_p->opcode_data) != VM_OC_BRANCH_IF_TRUE
+                  && VM_OC_GROUP_GET_INDEX (next_p->opcode_data) != VM_OC_BRANCH_IF_FALSE)))
+      {
+        next_p = NULL;
+      }
+
+      vm_jit_emit_get_operands (compiler_p, instr_p);
+      vm_jit_emit_compare (compiler_p, group, next_p);
+      return true;
+    }
+#if ENABLED (JERRY_LINE_INFO)
+    case VM_OC_LINE:
+    {
+      vm_jit_emit_store_imm (compiler_p, 0, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (current_line), (int32_t) instr_p->line);
+      return true;
+    }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+    default:
+    {
+      return false;
+    }
+  }
+} /* vm_jit_emit_instruction */
+
+/**
+ * Emit a push or pop of a callee saved register.
+ */
+static void
+vm_jit_emit_push_pop_reg (vm_jit_compiler_t *compiler_p, /**< compiler */
+                          uint32_t opcode, /**< 0x50 for push, 0x58 for pop */
+                          vm_jit_reg_t reg) /**< register */
+{
+  if (reg >= VM_JIT_R8)
+  {
+    vm_jit_emit_byte (compiler_p, 0x41);
+  }
+
+  vm_jit_emit_byte (compiler_p, opcode | (reg & 0x7));
+} /* vm_jit_emit_push_pop_reg */
+
+/**
+ * Emit the return from the compiled code.
+ */
+static void
+vm_jit_emit_return (vm_jit_compiler_t *compiler_p, /**< compiler */
+                    ecma_value_t value) /**< return value */
+{
+  vm_jit_emit_store (compiler_p, VM_JIT_POINTER_WIDE, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (stack_top_p), VM_JIT_STACK);
+  vm_jit_emit_mov_imm (compiler_p, VM_JIT_RAX, value);
+  vm_jit_emit_push_pop_reg (compiler_p, 0x58, VM_JIT_R15);
+  vm_jit_emit_push_pop_reg (compiler_p, 0x58, VM_JIT_R14);
+  vm_jit_emit_push_pop_reg (compiler_p, 0x58, VM_JIT_R13);
+  vm_jit_emit_push_pop_reg (compiler_p, 0x58, VM_JIT_R12);
+  vm_jit_emit_push_pop_reg (compiler_p, 0x58, VM_JIT_RBX);
+  vm_jit_emit_byte (compiler_p, 0xc3);
+} /* vm_jit_emit_return */
+
+/**
+ * Emit the machine code of the reachable instructions.
+ *
+ * @return true - if the machine code is not too large,
+ *         false - otherwise
+ */
+static bool
+vm_jit_emit_code (vm_jit_compiler_t *compiler_p) /**< compiler */
+{
+  uint32_t *info_p = compiler_p->info_p;
+
+  compiler_p->code_size = 0;
+
+  /* Prologue: the stack is 16 byte aligned after the five pushes. */
+  vm_jit_emit_push_pop_reg (compiler_p, 0x50, VM_JIT_RBX);
+  vm_jit_emit_push_pop_reg (compiler_p, 0x50, VM_JIT_R12);
+  vm_jit_emit_push_pop_reg (compiler_p, 0x50, VM_JIT_R13);
+  vm_jit_emit_push_pop_reg (compiler_p, 0x50, VM_JIT_R14);
+  vm_jit_emit_push_pop_reg (compiler_p, 0x50, VM_JIT_R15);
+  vm_jit_emit_mov_rr (compiler_p, VM_JIT_FRAME, VM_JIT_RDI);
+  vm_jit_emit_mov_rr (compiler_p, VM_JIT_STACK, VM_JIT_RSI);
+  /* jmp rdx */
+  vm_jit_emit_byte (compiler_p, 0xff);
+  vm_jit_emit_byte (compiler_p, 0xe2);
+
+  for (uint32_t offset = 0; offset < compiler_p->byte_code_size; offset++)
+  {
+    if (!(info_p[offset] & VM_JIT_INFO_VISITED))
+    {
+      continue;
+    }
+
+    if (compiler_p->code_size >= VM_JIT_MAX_CODE_SIZE)
+    {
+      return false;
+    }
+
+    JERRY_ASSERT (compiler_p->code_p == NULL
+                  || (info_p[offset] >> VM_JIT_INFO_SHIFT) == compiler_p->code_size);
+
+    info_p[offset] = (info_p[offset] & ((1u << VM_JIT_INFO_SHIFT) - 1)) | (compiler_p->code_size << VM_JIT_INFO_SHIFT);
+
+    vm_jit_instruction_t instr;
+    vm_jit_instruction_t next_instr;
+    vm_jit_instruction_t *next_p = NULL;
+    bool is_valid = vm_jit_decode (compiler_p, offset, &instr);
+
+    JERRY_ASSERT (is_valid);
+    JERRY_UNUSED (is_valid);
+
+    uint32_t next_offset = offset + instr.length;
+
+    if (next_offset < compiler_p->byte_code_size
+        && (info_p[next_offset] & VM_JIT_INFO_VISITED)
+        && vm_jit_decode (compiler_p, next_offset, &next_instr))
+    {
+      next_p = &next_instr;
+    }
+
+    uint32_t code_start = compiler_p->code_size;
+
+    if (vm_jit_emit_instruction (compiler_p, &instr, next_p))
+    {
+      info_p[offset] |= VM_JIT_INFO_SUPPORTED;
+
+      if (instr.has_branch)
+      {
+        info_p[offset] |= VM_JIT_INFO_BRANCH;
+
+        if (instr.opcode_data & VM_OC_BACKWARD_BRANCH)
+        {
+          /* The interpreter enters the compiled code at backward branches and their targets. */
+          info_p[offset] |= VM_JIT_INFO_ENTRY;
+          info_p[instr.branch_target] |= VM_JIT_INFO_ENTRY;
+        }
+      }
+      continue;
+    }
+
+    compiler_p->code_size = code_start;
+    vm_jit_emit_side_exit (compiler_p, offset);
+
+    if (next_p != NULL)
+    {
+      /* Unsupported call-like operations resume vm_loop at the next instruction. */
+      info_p[next_offset] |= VM_JIT_INFO_RESUME;
+    }
+  }
+
+  compiler_p->live = 0;
+
+  compiler_p->stubs[VM_JIT_STUB_ERROR_BOTH] = compiler_p->code_size;
+  vm_jit_emit_free (compiler_p, VM_JIT_RIGHT);
+  compiler_p->stubs[VM_JIT_STUB_ERROR_LEFT] = compiler_p->code_size;
+  vm_jit_emit_free (compiler_p, VM_JIT_LEFT);
+  compiler_p->stubs[VM_JIT_STUB_ERROR_NONE] = compiler_p->code_size;
+  vm_jit_emit_return (compiler_p, ECMA_VALUE_ERROR);
+  compiler_p->stubs[VM_JIT_STUB_ERROR_RIGHT] = compiler_p->code_size;
+  vm_jit_emit_free (compiler_p, VM_JIT_RIGHT);
+  vm_jit_emit_jump_to (compiler_p, -1, compiler_p->stubs[VM_JIT_STUB_ERROR_NONE]);
+  compiler_p->stubs[VM_JIT_STUB_EXIT] = compiler_p->code_size;
+  vm_jit_emit_return (compiler_p, ECMA_VALUE_EMPTY);
+
+  return compiler_p->code_size < VM_JIT_MAX_CODE_SIZE;
+} /* vm_jit_emit_code */
+
+/**
+ * Get the code table entry of a compiled byte code.
+ *
+ * @return compiled code
+ */
+static vm_jit_code_t *
+vm_jit_get_code (uint16_t counter) /**< counter of the byte code */
+{
+  JERRY_ASSERT (counter >= VM_JIT_COUNTER_COMPILED
+                && (uint32_t) (counter - VM_JIT_COUNTER_COMPILED) < JERRY_CONTEXT (jit_code_table_size));
+
+  vm_jit_code_t *code_p = JERRY_CONTEXT (jit_code_table_p)[counter - VM_JIT_COUNTER_COMPILED];
+
+  JERRY_ASSERT (code_p != NULL);
+  return code_p;
+} /* vm_jit_get_code */
+
+/**
+ * Insert the compiled code into the code table.
+ *
+ * @return true - if successful,
+ *         false - otherwise
+ */
+static bool
+vm_jit_register_code (vm_jit_code_t *code_p, /**< compiled code */
+                      uint16_t *counter_p) /**< [out] counter of the byte code */
+{
+  vm_jit_code_t **table_p = JERRY_CONTEXT (jit_code_table_p);
+  uint32_t table_size = JERRY_CONTEXT (jit_code_table_size);
+  uint32_t index = 0;
+
+  while (index < table_size && table_p[index] != NULL)
+  {
+    index++;
+  }
+
+  if (index == table_size)
+  {
+    uint32_t new_size = (table_size == 0) ? 16 : (table_size * 2);
+
+    if (new_size > VM_JIT_COUNTER_COMPILED)
+    {
+      new_size = VM_JIT_COUNTER_COMPILED;
+
+      if (table_size == new_size)
+      {
+        return false;
+      }
+    }
+
+    vm_jit_code_t **new_table_p;
+    new_table_p = (vm_jit_code_t **) jmem_heap_alloc_block_null_on_error (new_size * sizeof (vm_jit_code_t *));
+
+    if (new_table_p == NULL)
+    {
+      return false;
+    }
+
+    memset (new_table_p, 0, new_size * sizeof (vm_jit_code_t *));
+
+    if (table_p != NULL)
+    {
+      memcpy (new_table_p, table_p, table_size * sizeof (vm_jit_code_t *));
+      jmem_heap_free_block (table_p, table_size * sizeof (vm_jit_code_t *));
+    }
+
+    table_p = new_table_p;
+    JERRY_CONTEXT (jit_code_table_p) = new_table_p;
+    JERRY_CONTEXT (jit_code_table_size) = new_size;
+  }
+
+  table_p[index] = code_p;
+  *counter_p = (uint16_t) (VM_JIT_COUNTER_COMPILED + index);
+  return true;
+} /* vm_jit_register_code */
+
+/**
+ * Generate the machine code after the instructions are discovered.
+ *
+ * @return true - if successful,
+ *         false - otherwise
+ */
+static bool
+vm_jit_generate (vm_jit_compiler_t *compiler_p, /**< compiler */
+                 uint16_t *counter_p) /**< [out] counter of the byte code */
+{
+  /* The first pass computes the machine code offsets of the instructions. */
+  if (!vm_jit_emit_code (compiler_p))
+  {
+    return false;
+  }
+
+  uint32_t *info_p = compiler_p->info_p;
+  const uint32_t entry_flags = VM_JIT_INFO_VISITED | VM_JIT_INFO_ENTRY | VM_JIT_INFO_SUPPORTED;
+  uint32_t entry_count = 0;
+
+  uint32_t length = 0;
+
+  info_p[0] |= VM_JIT_INFO_RESUME;
+
+  /* Short instruction sequences are executed faster by the interpreter. */
+  for (uint32_t offset = compiler_p->byte_code_size; offset-- > 0;)
+  {
+    if (!(info_p[offset] & VM_JIT_INFO_VISITED))
+    {
+      continue;
+    }
+
+    if (!(info_p[offset] & VM_JIT_INFO_SUPPORTED))
+    {
+      length = 0;
+      continue;
+    }
+
+    length = (info_p[offset] & VM_JIT_INFO_BRANCH) ? VM_JIT_MIN_RESUME_LENGTH : (length + 1);
+
+    if ((info_p[offset] & VM_JIT_INFO_RESUME) && length >= VM_JIT_MIN_RESUME_LENGTH)
+    {
+      info_p[offset] |= VM_JIT_INFO_ENTRY;
+    }
+  }
+
+  for (uint32_t offset = 0; offset < compiler_p->byte_code_size; offset++)
+  {
+    if ((info_p[offset] & entry_flags) == entry_flags)
+    {
+      entry_count++;
+    }
+  }
+
+  if (entry_count == 0)
+  {
+    return false;
+  }
+
+  uint32_t code_size = compiler_p->code_size;
+  uint32_t code_offset = (uint32_t) (sizeof (vm_jit_code_t) + entry_count * sizeof (vm_jit_entry_t));
+  code_offset = (code_offset + 15) & ~(uint32_t) 15;
+
+  size_t size = code_offset + code_size;
+  uint8_t *memory_p = (uint8_t *) jerry_port_jit_alloc (size);
+
+  if (memory_p == NULL)
+  {
+    return false;
+  }
+
+  vm_jit_code_t *code_p = (vm_jit_code_t *) memory_p;
+  vm_jit_entry_t *entry_p = (vm_jit_entry_t *) (code_p + 1);
+
+  code_p->size = size;
+  code_p->byte_code_size = compiler_p->byte_code_size;
+  code_p->entry_count = entry_count;
+  code_p->code_offset = code_offset;
+
+  for (uint32_t offset = 0; offset < compiler_p->byte_code_size; offset++)
+  {
+    if ((info_p[offset] & entry_flags) == entry_flags)
+    {
+      entry_p->byte_code_offset = offset;
+      entry_p->code_offset = info_p[offset] >> VM_JIT_INFO_SHIFT;
+      entry_p++;
+    }
+  }
+
+  /* The second pass emits the same code with resolved forward jumps. */
+  compiler_p->code_p = memory_p + code_offset;
+
+  if (!vm_jit_emit_code (compiler_p)
+      || compiler_p->code_size != code_size
+      || !jerry_port_jit_make_executable (memory_p, size)
+      || !vm_jit_register_code (code_p, counter_p))
+  {
+    JERRY_ASSERT (compiler_p->code_size == code_size);
+    jerry_port_jit_free (memory_p, size);
+    return false;
+  }
+
+  return true;
+} /* vm_jit_generate */
+
+/**
+ * Get the JIT counter of a byte code.
+ *
+ * @return pointer to the counter - if the byte code can be compiled,
+ *         NULL - otherwise
+ */
+uint16_t *
+vm_jit_get_counter (const ecma_compiled_code_t *bytecode_header_p) /**< byte code */
+{
+#if ENABLED (JERRY_SNAPSHOT_EXEC)
+  /* Static snapshot functions are stored in read-only memory. */
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION)
+  {
+    return NULL;
+  }
+#endif /* ENABLED (JERRY_SNAPSHOT_EXEC) */
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    return &((cbc_uint16_arguments_t *) bytecode_header_p)->jit_counter;
+  }
+
+  return &((cbc_uint8_arguments_t *) bytecode_header_p)->jit_counter;
+} /* vm_jit_get_counter */
+
+/**
+ * Compile a byte code. The counter of the byte code is set to the index
+ * of the compiled code, or VM_JIT_COUNTER_DISABLED if the compilation fails.
+ *
+ * @return true - if successful,
+ *         false - otherwise
+ */
+bool
+vm_jit_compile (const ecma_compiled_code_t *bytecode_header_p, /**< byte code */
+                const uint16_t *decode_table_p) /**< opcode decode table of the interpreter */
+{
+  uint16_t *counter_p = vm_jit_get_counter (bytecode_header_p);
+  vm_jit_compiler_t compiler;
+  size_t header_size;
+  uint16_t literal_end;
+
+  JERRY_ASSERT (counter_p != NULL && *counter_p < VM_JIT_COUNTER_COMPILED);
+
+  *counter_p = VM_JIT_COUNTER_DISABLED;
+
+  memset (&compiler, 0, sizeof (vm_jit_compiler_t));
+  compiler.bytecode_header_p = bytecode_header_p;
+  compiler.decode_table_p = decode_table_p;
+  compiler.is_strict = (bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0;
+
+  if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING))
+  {
+    compiler.encoding_limit = CBC_SMALL_LITERAL_ENCODING_LIMIT;
+    compiler.encoding_delta = CBC_SMALL_LITERAL_ENCODING_DELTA;
+  }
+  else
+  {
+    compiler.encoding_limit = CBC_FULL_LITERAL_ENCODING_LIMIT;
+    compiler.encoding_delta = CBC_FULL_LITERAL_ENCODING_DELTA;
+  }
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
+    compiler.register_end = args_p->register_end;
+    compiler.ident_end = args_p->ident_end;
+    compiler.const_literal_end = args_p->const_literal_end;
+    literal_end = args_p->literal_end;
+    header_size = sizeof (cbc_uint16_arguments_t);
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
+    compiler.register_end = args_p->register_end;
+    compiler.ident_end = args_p->ident_end;
+    compiler.const_literal_end = args_p->const_literal_end;
+    literal_end = args_p->literal_end;
+    header_size = sizeof (cbc_uint8_arguments_t);
+  }
+
+  uint8_t *literal_p = (uint8_t *) bytecode_header_p + header_size;
+  compiler.literal_start_p = ((ecma_value_t *) literal_p) - compiler.register_end;
+  compiler.byte_code_start_p = (const uint8_t *) (compiler.literal_start_p + literal_end);
+
+  size_t total_size = ((size_t) bytecode_header_p->size) << JMEM_ALIGNMENT_LOG;
+  size_t byte_code_offset = (size_t) (compiler.byte_code_start_p - (const uint8_t *) bytecode_header_p);
+
+  if (total_size <= byte_code_offset || total_size - byte_code_offset > VM_JIT_MAX_BYTE_CODE_SIZE)
+  {
+    return false;
+  }
+
+  compiler.byte_code_size = (uint32_t) (total_size - byte_code_offset);
+
+  size_t info_size = compiler.byte_code_size * sizeof (uint32_t);
+  compiler.info_p = (uint32_t *) jmem_heap_alloc_block_null_on_error (info_size);
+
+  if (compiler.info_p == NULL)
+  {
+    return false;
+  }
+
+  memset (compiler.info_p, 0, info_size);
+
+  bool is_compiled = vm_jit_discover (&compiler) && vm_jit_generate (&compiler, counter_p);
+
+  jmem_heap_free_block (compiler.info_p, info_size);
+  return is_compiled;
+} /* vm_jit_compile */
+
+/**
+ * Find the machine code of a byte code instruction.
+ *
+ * @return machine code address - if the instruction is an entry point,
+ *         NULL - otherwise
+ */
+const uint8_t *
+vm_jit_find_entry (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                   uint16_t counter, /**< counter of the byte code */
+                   const uint8_t *byte_code_p) /**< byte code instruction */
+{
+  vm_jit_code_t *code_p = vm_jit_get_code (counter);
+
+  /* Resumed executable objects might point outside of the byte code. */
+  uintptr_t offset = (uintptr_t) byte_code_p - (uintptr_t) frame_ctx_p->byte_code_start_p;
+
+  if (offset >= code_p->byte_code_size)
+  {
+    return NULL;
+  }
+
+  const vm_jit_entry_t *entries_p = (const vm_jit_entry_t *) (code_p + 1);
+  uint32_t lower = 0;
+  uint32_t upper = code_p->entry_count;
+
+  while (lower < upper)
+  {
+    uint32_t middle = (lower + upper) >> 1;
+
+    if (entries_p[middle].byte_code_offset < offset)
+    {
+      lower = middle + 1;
+    }
+    else
+    {
+      upper = middle;
+    }
+  }
+
+  if (lower == code_p->entry_count || entries_p[lower].byte_code_offset != offset)
+  {
+    return NULL;
+  }
+
+  return ((const uint8_t *) code_p) + code_p->code_offset + entries_p[lower].code_offset;
+} /* vm_jit_find_entry */
+
+/**
+ * Run the compiled code from an entry point. The frame context contains
+ * the byte code position where the interpreter continues the execution.
+ *
+ * @return ECMA_VALUE_ERROR - if an exception is thrown,
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+ecma_value_t
+vm_jit_run (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+            uint16_t counter, /**< counter of the byte code */
+            ecma_value_t *stack_top_p, /**< stack top */
+            const uint8_t *entry_p) /**< entry point returned by vm_jit_find_entry */
+{
+  vm_jit_code_t *code_p = vm_jit_get_code (counter);
+  const uint8_t *code_start_p = ((const uint8_t *) code_p) + code_p->code_offset;
+  vm_jit_function_t function;
+
+  JERRY_STATIC_ASSERT (sizeof (vm_jit_function_t) == sizeof (const uint8_t *),
+                       function_pointers_must_have_the_same_size_as_data_pointers);
+
+  /* ISO C does not allow casting data pointers to function pointers. */
+  memcpy (&function, &code_start_p, sizeof (vm_jit_function_t));
+  return function (frame_ctx_p, stack_top_p, entry_p);
+} /* vm_jit_run */
+
+/**
+ * Free the compiled code of a byte code.
+ */
+void
+vm_jit_free (const ecma_compiled_code_t *bytecode_header_p) /**< byte code */
+{
+  uint16_t *counter_p = vm_jit_get_counter (bytecode_header_p);
+
+  if (counter_p == NULL || *counter_p < VM_JIT_COUNTER_COMPILED)
+  {
+    return;
+  }
+
+  vm_jit_code_t *code_p = vm_jit_get_code (*counter_p);
+
+  JERRY_CONTEXT (jit_code_table_p)[*counter_p - VM_JIT_COUNTER_COMPILED] = NULL;
+  *counter_p = VM_JIT_COUNTER_DISABLED;
+  jerry_port_jit_free (code_p, code_p->size);
+} /* vm_jit_free */
+
+/**
+ * Free all compiled code and the code table.
+ */
+void
+vm_jit_finalize (void)
+{
+  vm_jit_code_t **table_p = JERRY_CONTEXT (jit_code_table_p);
+  uint32_t table_size = JERRY_CONTEXT (jit_code_table_size);
+
+  if (table_p == NULL)
+  {
+    return;
+  }
+
+  for (uint32_t i = 0; i < table_size; i++)
+  {
+    if (table_p[i] != NULL)
+    {
+      jerry_port_jit_free (table_p[i], table_p[i]->size);
+    }
+  }
+
+  jmem_heap_free_block (table_p, table_size * sizeof (vm_jit_code_t *));
+  JERRY_CONTEXT (jit_code_table_p) = NULL;
+  JERRY_CONTEXT (jit_code_table_size) = 0;
+} /* vm_jit_finalize */
+
+/**
+ * Binary operations of the compiled code which are not handled by the
+ * machine code. The operands are freed.
+ *
+ * @return result of the operation
+ */
+ecma_value_t
+vm_jit_binary_operation (ecma_value_t left_value, /**< left operand */
+                         ecma_value_t right_value, /**< right operand */
+                         uint32_t group) /**< opcode group */
+{
+  ecma_value_t result = ECMA_VALUE_EMPTY;
+
+  if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+  {
+    ecma_number_t left_number = ecma_get_number_from_value (left_value);
+    ecma_number_t right_number = ecma_get_number_from_value (right_value);
+
+    switch (group)
+    {
+      case VM_OC_ADD:
+      {
+        result = ecma_make_number_value (left_number + right_number);
+        break;
+      }
+      case VM_OC_SUB:
+      {
+        result = ecma_make_number_value (left_number - right_number);
+        break;
+      }
+      case VM_OC_MUL:
+      {
+        result = ecma_make_number_value (left_number * right_number);
+        break;
+      }
+      case VM_OC_DIV:
+      {
+        result = ecma_make_number_value (left_number / right_number);
+        break;
+      }
+      case VM_OC_EQUAL:
+      case VM_OC_STRICT_EQUAL:
+      {
+        result = ecma_make_boolean_value (left_number == right_number);
+        break;
+      }
+      case VM_OC_NOT_EQUAL:
+      case VM_OC_STRICT_NOT_EQUAL:
+      {
+        result = ecma_make_boolean_value (left_number != right_number);
+        break;
+      }
+      case VM_OC_LESS:
+      {
+        result = ecma_make_boolean_value (left_number < right_number);
+        break;
+      }
+      case VM_OC_GREATER:
+      {
+        result = ecma_make_boolean_value (left_number > right_number);
+        break;
+      }
+      case VM_OC_LESS_EQUAL:
+      {
+        result = ecma_make_boolean_value (left_number <= right_number);
+        break;
+      }
+      case VM_OC_GREATER_EQUAL:
+      {
+        result = ecma_make_boolean_value (left_number >= right_number);
+        break;
+      }
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+  if (result == ECMA_VALUE_EMPTY)
+  {
+    switch (group)
+    {
+      case VM_OC_ADD:
+      {
+        result = opfunc_addition (left_value, right_value);
+        break;
+      }
+      case VM_OC_SUB:
+      {
+        result = do_number_arithmetic (NUMBER_ARITHMETIC_SUBTRACTION, left_value, right_value);
+        break;
+      }
+      case VM_OC_MUL:
+      {
+        result = do_number_arithmetic (NUMBER_ARITHMETIC_MULTIPLICATION, left_value, right_value);
+        break;
+      }
+      case VM_OC_DIV:
+      {
+        result = do_number_arithmetic (NUMBER_ARITHMETIC_DIVISION, left_value, right_value);
+        break;
+      }
+      case VM_OC_MOD:
+      {
+        result = do_number_arithmetic (NUMBER_ARITHMETIC_REMAINDER, left_value, right_value);
+        break;
+      }
+#if ENABLED (JERRY_ESNEXT)
+      case VM_OC_EXP:
+      {
+        result = do_number_arithmetic (NUMBER_ARITHMETIC_EXPONENTIATION, left_value, right_value);
+        break;
+      }
+#endif /* ENABLED (JERRY_ESNEXT) */
+      case VM_OC_EQUAL:
+      {
+        result = opfunc_equality (left_value, right_value);
+        break;
+      }
+      case VM_OC_NOT_EQUAL:
+      {
+        result = opfunc_equality (left_value, right_value);
+
+        if (!ECMA_IS_VALUE_ERROR (result))
+        {
+          result = ecma_invert_boolean_value (result);
+        }
+        break;
+      }
+      case VM_OC_STRICT_EQUAL:
+      {
+        result = ecma_make_boolean_value (ecma_op_strict_equality_compare (left_value, right_value));
+        break;
+      }
+      case VM_OC_STRICT_NOT_EQUAL:
+      {
+        result = ecma_make_boolean_value (!ecma_op_strict_equality_compare (left_value, right_value));
+        break;
+      }
+      case VM_OC_LESS:
+      {
+        result = opfunc_relation (left_value, right_value, true, false);
+        break;
+      }
+      case VM_OC_GREATER:
+      {
+        result = opfunc_relation (left_value, right_value, false, false);
+        break;
+      }
+      case VM_OC_LESS_EQUAL:
+      {
+        result = opfunc_relation (left_value, right_value, false, true);
+        break;
+      }
+      case VM_OC_GREATER_EQUAL:
+      {
+        result = opfunc_relation (left_value, right_value, true, true);
+        break;
+      }
+      case VM_OC_IN:
+      {
+        result = opfunc_in (left_value, right_value);
+        break;
+      }
+      case VM_OC_INSTANCEOF:
+      {
+        result = opfunc_instanceof (left_value, right_value);
+        break;
+      }
+      case VM_OC_BIT_OR:
+      {
+        result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_OR, left_value, right_value);
+        break;
+      }
+      case VM_OC_BIT_XOR:
+      {
+        result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_XOR, left_value, right_value);
+        break;
+      }
+      case VM_OC_BIT_AND:
+      {
+        result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_AND, left_value, right_value);
+        break;
+      }
+      case VM_OC_LEFT_SHIFT:
+      {
+        result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_LEFT, left_value, right_value);
+        break;
+      }
+      case VM_OC_RIGHT_SHIFT:
+      {
+        result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_RIGHT, left_value, right_value);
+        break;
+      }
+      default:
+      {
+        JERRY_ASSERT (group == VM_OC_UNS_RIGHT_SHIFT);
+        result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_URIGHT, left_value, right_value);
+        break;
+      }
+    }
+  }
+
+  ecma_free_value (left_value);
+  ecma_free_value (right_value);
+  return result;
+} /* vm_jit_binary_operation */
+
+/**
+ * Unary operations of the compiled code which are not handled by the
+ * machine code. The operand is freed.
+ *
+ * @return result of the operation
+ */
+ecma_value_t
+vm_jit_unary_operation (ecma_value_t value, /**< operand */
+                        uint32_t group) /**< opcode group */
+{
+  ecma_value_t result;
+
+  switch (group)
+  {
+    case VM_OC_PLUS:
+    case VM_OC_MINUS:
+    {
+      result = opfunc_unary_operation (value, group == VM_OC_PLUS);
+      break;
+    }
+    case VM_OC_BIT_NOT:
+    {
+      result = do_number_bitwise_logic (NUMBER_BITWISE_NOT, value, value);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (group == VM_OC_TYPEOF);
+      result = opfunc_typeof (value);
+      break;
+    }
+  }
+
+  ecma_free_value (value);
+  return result;
+} /* vm_jit_unary_operation */
+
+/**
+ * Increment and decrement operators of the compiled code on non-integer values
+ * or on integer overflow. The value is freed. Postfix operators store the
+ * unmodified number like the interpreter, and update the stack top of the frame.
+ *
+ * @return the updated number
+ */
+ecma_value_t
+vm_jit_incr_decr (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                  ecma_value_t value, /**< operand */
+                  uint32_t opcode_data) /**< opcode data */
+{
+  uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
+  ecma_value_t result = value;
+
+  if (!ecma_is_value_number (value))
+  {
+    result = ecma_op_to_number (value);
+    ecma_free_value (value);
+
+    if (ECMA_IS_VALUE_ERROR (result))
+    {
+      return result;
+    }
+  }
+
+  ecma_number_t increase = ECMA_NUMBER_ONE;
+  ecma_number_t result_number = ecma_get_number_from_value (result);
+
+  if (opcode_flags & VM_OC_DECREMENT_OPERATOR_FLAG)
+  {
+    increase = ECMA_NUMBER_MINUS_ONE;
+  }
+
+  if (opcode_flags & VM_OC_POST_INCR_DECR_OPERATOR_FLAG)
+  {
+    if (opcode_data & VM_OC_PUT_STACK)
+    {
+      ecma_value_t *stack_top_p = frame_ctx_p->stack_top_p;
+
+      if (opcode_flags & VM_OC_IDENT_INCR_DECR_OPERATOR_FLAG)
+      {
+        *stack_top_p++ = ecma_copy_value (result);
+      }
+      else
+      {
+        stack_top_p++;
+        stack_top_p[-1] = stack_top_p[-2];
+        stack_top_p[-2] = stack_top_p[-3];
+        stack_top_p[-3] = ecma_copy_value (result);
+      }
+
+      frame_ctx_p->stack_top_p = stack_top_p;
+    }
+    else if (opcode_data & VM_OC_PUT_BLOCK)
+    {
+      ecma_free_value (frame_ctx_p->block_result);
+      frame_ctx_p->block_result = ecma_copy_value (result);
+    }
+  }
+
+  if (ecma_is_value_integer_number (result))
+  {
+    return ecma_make_number_value (result_number + increase);
+  }
+
+  return ecma_update_float_number (result, result_number + increase);
+} /* vm_jit_incr_decr */
+
+/**
+ * Store a value into a variable which is not a register.
+ *
+ * @return ECMA_VALUE_ERROR - if the operation fails (the value is freed),
+ *         the value - if VM_JIT_PUT_KEEP_VALUE is set,
+ *         ECMA_VALUE_EMPTY - otherwise (the value is freed)
+ */
+ecma_value_t
+vm_jit_put_ident (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                  ecma_string_t *name_p, /**< variable name */
+                  ecma_value_t value, /**< value */
+                  uint32_t flags) /**< vm_jit_put_flags_t */
+{
+  ecma_value_t put_value_result = ecma_op_put_value_lex_env_base (frame_ctx_p->lex_env_p,
+                                                                  name_p,
+                                                                  (flags & VM_JIT_PUT_STRICT) != 0,
+                                                                  value);
+
+  if (ECMA_IS_VALUE_ERROR (put_value_result))
+  {
+    ecma_free_value (value);
+    return put_value_result;
+  }
+
+  if (!(flags & VM_JIT_PUT_KEEP_VALUE))
+  {
+    ecma_fast_free_value (value);
+    return ECMA_VALUE_EMPTY;
+  }
+
+  return value;
+} /* vm_jit_put_ident */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* ENABLED (JERRY_JIT) */
@@ -0,0 +1,93 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_JIT_H
+#define VM_JIT_H
+
+#include "ecma-globals.h"
+#include "vm-defines.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_jit Baseline JIT compiler
+ * @{
+ */
+
+#if ENABLED (JERRY_JIT)
+
+/**
+ * Number of invocations and backward branches after which a byte code is compiled.
+ */
+#define VM_JIT_THRESHOLD 1000
+
+/**
+ * Counter value of byte codes which cannot be compiled.
+ */
+#define VM_JIT_COUNTER_DISABLED 0x7fff
+
+/**
+ * Counter values starting from this value are compiled code indicies.
+ */
+#define VM_JIT_COUNTER_COMPILED 0x8000
+
+/**
+ * Maximum size of a byte code which is compiled.
+ */
+#define VM_JIT_MAX_BYTE_CODE_SIZE (16 * 1024)
+
+/**
+ * Flags of vm_jit_put_ident.
+ */
+typedef enum
+{
+  VM_JIT_PUT_KEEP_VALUE = (1u << 0), /**< the value is returned after it is stored */
+  VM_JIT_PUT_STRICT = (1u << 1), /**< the byte code is strict mode code */
+} vm_jit_put_flags_t;
+
+uint16_t *vm_jit_get_counter (const ecma_compiled_code_t *bytecode_header_p);
+bool vm_jit_compile (const ecma_compiled_code_t *bytecode_header_p, const uint16_t *decode_table_p);
+const uint8_t *vm_jit_find_entry (vm_frame_ctx_t *frame_ctx_p, uint16_t counter, const uint8_t *byte_code_p);
+ecma_value_t vm_jit_run (vm_frame_ctx_t *frame_ctx_p, uint16_t counter, ecma_value_t *stack_top_p,
+                         const uint8_t *entry_p);
+void vm_jit_free (const ecma_compiled_code_t *bytecode_header_p);
+void vm_jit_finalize (void);
+
+/* Helpers called by the compiled code. */
+ecma_value_t vm_jit_binary_operation (ecma_value_t left_value, ecma_value_t right_value, uint32_t group);
+ecma_value_t vm_jit_unary_operation (ecma_value_t value, uint32_t group);
+ecma_value_t vm_jit_incr_decr (vm_frame_ctx_t *frame_ctx_p, ecma_value_t value, uint32_t opcode_data);
+ecma_value_t vm_jit_put_ident (vm_frame_ctx_t *frame_ctx_p, ecma_string_t *name_p, ecma_value_t value,
+                               uint32_t flags);
+
+/* Helpers defined by the interpreter. */
+ecma_value_t vm_jit_get_value (vm_frame_ctx_t *frame_ctx_p, const uint8_t *byte_code_p,
+                               ecma_value_t object, ecma_value_t property);
+ecma_value_t vm_jit_put_reference (vm_frame_ctx_t *frame_ctx_p, const uint8_t *byte_code_p,
+                                   ecma_value_t base, ecma_value_t property, ecma_value_t value, uint32_t flags);
+ecma_value_t vm_jit_create_arguments (vm_frame_ctx_t *frame_ctx_p, uint32_t register_index);
+ecma_value_t vm_jit_get_arguments_property (vm_frame_ctx_t *frame_ctx_p, const uint8_t *byte_code_p,
+                                            uint32_t register_index, ecma_value_t property);
+ecma_value_t vm_jit_backward_branch (void);
+ecma_value_t vm_jit_call (vm_frame_ctx_t *frame_ctx_p, uint32_t is_construct);
+
+#endif /* ENABLED (JERRY_JIT) */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !VM_JIT_H */
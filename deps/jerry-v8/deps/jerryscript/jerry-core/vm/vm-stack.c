@@ -107,7 +107,7 @@ vm_stack_context_abort (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
 
       ecma_value_t *buffer_p = collection_p->buffer_p;
 
-      for (uint32_t index = vm_stack_top_p[-3]; index < collection_p->item_count; index++)
+      for (uint32_t index = (uint32_t) vm_stack_top_p[-3]; index < collection_p->item_count; index++)
       {
         ecma_free_value (buffer_p[index]);
       }
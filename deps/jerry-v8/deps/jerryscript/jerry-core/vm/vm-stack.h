@@ -44,7 +44,7 @@
 /**
  * Get the end position of a vm context.
  */
-#define VM_GET_CONTEXT_END(value) ((value) >> 7)
+#define VM_GET_CONTEXT_END(value) ((uint32_t) ((value) >> 7))
 
 /**
  * This flag is set if the context has a lexical environment.
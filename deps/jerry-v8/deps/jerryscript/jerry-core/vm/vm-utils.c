@@ -51,6 +51,42 @@ vm_is_direct_eval_form_call (void)
   return (JERRY_CONTEXT (status_flags) & ECMA_STATUS_DIRECT_EVAL) != 0;
 } /* vm_is_direct_eval_form_call */
 
+#if ENABLED (JERRY_LINE_INFO)
+
+/**
+ * Append the "resource:line" position string of a frame to a backtrace array.
+ */
+static void
+vm_backtrace_append_frame (ecma_object_t *array_p, /**< backtrace array */
+                           uint32_t index, /**< index of the frame */
+                           const ecma_compiled_code_t *bytecode_header_p, /**< byte code of the frame */
+                           uint32_t line) /**< line of the frame */
+{
+  ecma_value_t resource_name = ecma_get_resource_name (bytecode_header_p);
+  ecma_string_t *str_p = ecma_get_string_from_value (resource_name);
+  ecma_stringbuilder_t builder = ecma_stringbuilder_create ();
+
+  if (ecma_string_is_empty (str_p))
+  {
+    ecma_stringbuilder_append_raw (&builder, (const lit_utf8_byte_t *)"<unknown>:", 10);
+  }
+  else
+  {
+    ecma_stringbuilder_append (&builder, str_p);
+    ecma_stringbuilder_append_byte (&builder, LIT_CHAR_COLON);
+  }
+
+  ecma_string_t *line_str_p = ecma_new_ecma_string_from_uint32 (line);
+  ecma_stringbuilder_append (&builder, line_str_p);
+  ecma_deref_ecma_string (line_str_p);
+
+  ecma_string_t *builder_str_p = ecma_stringbuilder_finalize (&builder);
+  ecma_fast_array_set_property (array_p, index, ecma_make_string_value (builder_str_p));
+  ecma_deref_ecma_string (builder_str_p);
+} /* vm_backtrace_append_frame */
+
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
 /**
  * Get backtrace. The backtrace is an array of strings where
  * each string contains the position of the corresponding frame.
@@ -76,27 +112,7 @@ vm_get_backtrace (uint32_t max_depth) /**< maximum backtrace depth, 0 = unlimite
 
   while (context_p != NULL)
   {
-    ecma_value_t resource_name = ecma_get_resource_name (context_p->bytecode_header_p);
-    ecma_string_t *str_p = ecma_get_string_from_value (resource_name);
-    ecma_stringbuilder_t builder = ecma_stringbuilder_create ();
-
-    if (ecma_string_is_empty (str_p))
-    {
-      ecma_stringbuilder_append_raw (&builder, (const lit_utf8_byte_t *)"<unknown>:", 10);
-    }
-    else
-    {
-      ecma_stringbuilder_append (&builder, str_p);
-      ecma_stringbuilder_append_byte (&builder, LIT_CHAR_COLON);
-    }
-
-    ecma_string_t *line_str_p = ecma_new_ecma_string_from_uint32 (context_p->current_line);
-    ecma_stringbuilder_append (&builder, line_str_p);
-    ecma_deref_ecma_string (line_str_p);
-
-    ecma_string_t *builder_str_p = ecma_stringbuilder_finalize (&builder);
-    ecma_fast_array_set_property (array_p, index, ecma_make_string_value (builder_str_p));
-    ecma_deref_ecma_string (builder_str_p);
+    vm_backtrace_append_frame (array_p, index, context_p->bytecode_header_p, context_p->current_line);
 
     context_p = context_p->prev_context_p;
     index++;
@@ -114,3 +130,108 @@ vm_get_backtrace (uint32_t max_depth) /**< maximum backtrace depth, 0 = unlimite
   return ecma_op_create_array_object (NULL, 0, false);
 #endif /* ENABLED (JERRY_LINE_INFO) */
 } /* vm_get_backtrace */
+
+#if ENABLED (JERRY_LINE_INFO)
+
+/**
+ * Capture the byte code and line of each frame of the current backtrace.
+ *
+ * Note:
+ *   the position strings are not created here, since most thrown errors are
+ *   caught without reading their backtrace, see vm_backtrace_to_array
+ *
+ * @return captured backtrace, which must be freed by vm_free_backtrace - if successful
+ *         NULL - if the backtrace must be created by vm_get_backtrace instead
+ */
+vm_backtrace_t *
+vm_capture_backtrace (void)
+{
+  uint32_t frame_count = 0;
+  uint32_t max_refs = 0;
+
+  for (vm_frame_ctx_t *context_p = JERRY_CONTEXT (vm_top_context_p);
+       context_p != NULL;
+       context_p = context_p->prev_context_p)
+  {
+    if (context_p->bytecode_header_p->refs > max_refs)
+    {
+      max_refs = context_p->bytecode_header_p->refs;
+    }
+
+    frame_count++;
+  }
+
+  /* Each frame references its byte code, and the number of byte code
+   * references is limited, so deep or many backtraces are not deferred. */
+  if (max_refs + frame_count >= (UINT16_MAX / 2))
+  {
+    return NULL;
+  }
+
+  size_t size = sizeof (vm_backtrace_t) + frame_count * sizeof (vm_backtrace_frame_t);
+  vm_backtrace_t *backtrace_p = (vm_backtrace_t *) jmem_heap_alloc_block (size);
+  vm_backtrace_frame_t *frame_p = backtrace_p->frames;
+
+  backtrace_p->frame_count = frame_count;
+
+  for (vm_frame_ctx_t *context_p = JERRY_CONTEXT (vm_top_context_p);
+       context_p != NULL;
+       context_p = context_p->prev_context_p)
+  {
+    const ecma_compiled_code_t *bytecode_header_p = context_p->bytecode_header_p;
+
+    if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION))
+    {
+      ecma_bytecode_ref ((ecma_compiled_code_t *) bytecode_header_p);
+    }
+
+    frame_p->bytecode_header_p = bytecode_header_p;
+    frame_p->line = context_p->current_line;
+    frame_p++;
+  }
+
+  return backtrace_p;
+} /* vm_capture_backtrace */
+
+/**
+ * Convert a captured backtrace to an array of position strings.
+ *
+ * @return array ecma value
+ */
+ecma_value_t
+vm_backtrace_to_array (const vm_backtrace_t *backtrace_p) /**< captured backtrace */
+{
+  ecma_value_t result_array = ecma_op_create_array_object (NULL, 0, false);
+  ecma_object_t *array_p = ecma_get_object_from_value (result_array);
+  JERRY_ASSERT (ecma_op_object_is_fast_array (array_p));
+
+  for (uint32_t i = 0; i < backtrace_p->frame_count; i++)
+  {
+    const vm_backtrace_frame_t *frame_p = backtrace_p->frames + i;
+    vm_backtrace_append_frame (array_p, i, frame_p->bytecode_header_p, frame_p->line);
+  }
+
+  return result_array;
+} /* vm_backtrace_to_array */
+
+/**
+ * Free a captured backtrace and release the byte codes referenced by it.
+ */
+void
+vm_free_backtrace (vm_backtrace_t *backtrace_p) /**< captured backtrace */
+{
+  for (uint32_t i = 0; i < backtrace_p->frame_count; i++)
+  {
+    const ecma_compiled_code_t *bytecode_header_p = backtrace_p->frames[i].bytecode_header_p;
+
+    if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION))
+    {
+      ecma_bytecode_deref ((ecma_compiled_code_t *) bytecode_header_p);
+    }
+  }
+
+  size_t size = sizeof (vm_backtrace_t) + backtrace_p->frame_count * sizeof (vm_backtrace_frame_t);
+  jmem_heap_free_block (backtrace_p, size);
+} /* vm_free_backtrace */
+
+#endif /* ENABLED (JERRY_LINE_INFO) */
@@ -25,17 +25,21 @@
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
+#include "ecma-inline-cache.h"
 #include "ecma-iterator-object.h"
 #include "ecma-lcache.h"
 #include "ecma-lex-env.h"
 #include "ecma-objects.h"
+#include "ecma-objects-arguments.h"
 #include "ecma-objects-general.h"
 #include "ecma-promise-object.h"
 #include "ecma-regexp-object.h"
+#include "ecma-shape.h"
 #include "ecma-try-catch-macro.h"
 #include "jcontext.h"
 #include "opcodes.h"
 #include "vm.h"
+#include "vm-jit.h"
 #include "vm-stack.h"
 
 /** \addtogroup vm Virtual machine
@@ -50,15 +54,255 @@
  */
 #define VM_DIRECT_EVAL ((void *) 0x1)
 
+#if ENABLED (JERRY_INLINE_CACHE)
+
+/**
+ * Get the inline cache slot of a property access instruction.
+ *
+ * @return pointer to the slot - if the properties accessed by the instruction can be cached
+ *         NULL - otherwise
+ */
+static inline ecma_inline_cache_slot_t * JERRY_ATTR_ALWAYS_INLINE
+vm_get_inline_cache_slot (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                          const uint8_t *byte_code_p) /**< start of the instruction */
+{
+  if (JERRY_UNLIKELY (frame_ctx_p->inline_cache_p == NULL))
+  {
+    frame_ctx_p->inline_cache_p = ecma_inline_cache_get (frame_ctx_p->bytecode_header_p);
+
+    if (frame_ctx_p->inline_cache_p == NULL)
+    {
+      return NULL;
+    }
+  }
+
+  /* The offset is relative to the header, since the byte code of static
+   * snapshot functions is not necessarily stored after their header. */
+  uint32_t site = (uint32_t) ((uintptr_t) byte_code_p - (uintptr_t) frame_ctx_p->bytecode_header_p);
+  return ecma_inline_cache_get_slot (frame_ctx_p->inline_cache_p, site);
+} /* vm_get_inline_cache_slot */
+
+/**
+ * Check whether the properties of an object can be cached by the inline caches.
+ *
+ * Only the named data properties of ordinary objects are cached, since the
+ * other objects might have virtual or lazily instantiated properties.
+ *
+ * @return true - if the properties of the object can be cached
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+vm_is_inline_cacheable (ecma_object_t *object_p) /**< object */
+{
+  return (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL
+          && !ecma_get_object_is_builtin (object_p));
+} /* vm_is_inline_cacheable */
+
+/**
+ * Continue the lookup of object[property] on the prototype chain when the object
+ * has no such own property, ecma_op_object_get would repeat the own property search.
+ *
+ * @return ecma value
+ */
+static ecma_value_t
+vm_inline_cache_get_prototype_value (ecma_object_t *object_p, /**< base object */
+                                     ecma_string_t *property_name_p) /**< property name */
+{
+  jmem_cpointer_t proto_cp = ecma_op_ordinary_object_get_prototype_of (object_p);
+
+  if (proto_cp == JMEM_CP_NULL)
+  {
+    return ECMA_VALUE_UNDEFINED;
+  }
+
+  return ecma_op_object_get_with_receiver (ECMA_GET_NON_NULL_POINTER (ecma_object_t, proto_cp),
+                                           property_name_p,
+                                           ecma_make_object_value (object_p));
+} /* vm_inline_cache_get_prototype_value */
+
+/**
+ * Get the value of object[property] using the inline cache of the instruction.
+ *
+ * @return ECMA_VALUE_NOT_FOUND - if the generic lookup must be used
+ *         ecma value - otherwise
+ */
+static ecma_value_t
+vm_inline_cache_get_value (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                           const uint8_t *byte_code_p, /**< start of the instruction */
+                           ecma_object_t *object_p, /**< base object */
+                           ecma_string_t *property_name_p) /**< property name */
+{
+  JERRY_ASSERT (vm_is_inline_cacheable (object_p));
+
+  ecma_inline_cache_slot_t *slot_p = vm_get_inline_cache_slot (frame_ctx_p, byte_code_p);
+
+  if (slot_p == NULL)
+  {
+    JERRY_CONTEXT (inline_cache_stats).load_misses++;
+    return ECMA_VALUE_NOT_FOUND;
+  }
+
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  if (ECMA_OBJECT_HAS_SHAPE (object_p))
+  {
+    ecma_shape_values_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t,
+                                                               object_p->u1.property_list_cp);
+    ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, values_p->header.next_property_cp);
+    uint32_t index = ecma_inline_cache_lookup_shape (slot_p, shape_p, property_name_p);
+
+    if (JERRY_LIKELY (index != ECMA_SHAPE_PROPERTY_NOT_FOUND))
+    {
+      JERRY_CONTEXT (inline_cache_stats).load_hits++;
+      return ecma_fast_copy_value (ECMA_SHAPE_VALUES (values_p)[index].value);
+    }
+
+    JERRY_CONTEXT (inline_cache_stats).load_misses++;
+    index = ecma_shape_find_property (shape_p, property_name_p);
+
+    if (index == ECMA_SHAPE_PROPERTY_NOT_FOUND)
+    {
+      return vm_inline_cache_get_prototype_value (object_p, property_name_p);
+    }
+
+    ecma_inline_cache_insert_shape (slot_p, shape_p, property_name_p, index);
+    return ecma_fast_copy_value (ECMA_SHAPE_VALUES (values_p)[index].value);
+  }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
+  ecma_property_t *property_p = ecma_inline_cache_lookup (slot_p, object_p, property_name_p);
+
+  if (JERRY_LIKELY (property_p != NULL)
+      && ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+  {
+    JERRY_CONTEXT (inline_cache_stats).load_hits++;
+    return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+  }
+
+  JERRY_CONTEXT (inline_cache_stats).load_misses++;
+  property_p = ecma_find_named_property (object_p, property_name_p);
+
+  if (property_p == NULL)
+  {
+    return vm_inline_cache_get_prototype_value (object_p, property_name_p);
+  }
+
+  if (ECMA_PROPERTY_GET_TYPE (*property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA)
+  {
+    return ECMA_VALUE_NOT_FOUND;
+  }
+
+  ecma_inline_cache_insert (slot_p, object_p, property_name_p, property_p);
+  return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+} /* vm_inline_cache_get_value */
+
+/**
+ * Assign the value of an existing writable object[property] using the inline cache
+ * of the instruction.
+ *
+ * @return true - if the value is assigned
+ *         false - if the generic assignment must be used
+ */
+static bool
+vm_inline_cache_put_value (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                           const uint8_t *byte_code_p, /**< start of the instruction */
+                           ecma_object_t *object_p, /**< base object */
+                           ecma_string_t *property_name_p, /**< property name */
+                           ecma_value_t value) /**< ecma value */
+{
+  if (!vm_is_inline_cacheable (object_p))
+  {
+    return false;
+  }
+
+  ecma_inline_cache_slot_t *slot_p = vm_get_inline_cache_slot (frame_ctx_p, byte_code_p);
+
+  if (slot_p == NULL)
+  {
+    JERRY_CONTEXT (inline_cache_stats).store_misses++;
+    return false;
+  }
+
+#if ENABLED (JERRY_HIDDEN_CLASSES)
+  if (ECMA_OBJECT_HAS_SHAPE (object_p))
+  {
+    ecma_shape_values_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t,
+                                                               object_p->u1.property_list_cp);
+    ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, values_p->header.next_property_cp);
+    uint32_t index = ecma_inline_cache_lookup_shape (slot_p, shape_p, property_name_p);
+
+    if (JERRY_LIKELY (index != ECMA_SHAPE_PROPERTY_NOT_FOUND))
+    {
+      JERRY_CONTEXT (inline_cache_stats).store_hits++;
+    }
+    else
+    {
+      JERRY_CONTEXT (inline_cache_stats).store_misses++;
+      index = ecma_shape_find_property (shape_p, property_name_p);
+
+      if (index == ECMA_SHAPE_PROPERTY_NOT_FOUND)
+      {
+        return false;
+      }
+
+      ecma_inline_cache_insert_shape (slot_p, shape_p, property_name_p, index);
+    }
+
+    /* The properties of shapes are always writable. */
+    ecma_named_data_property_assign_value (object_p, ECMA_SHAPE_VALUES (values_p) + index, value);
+    return true;
+  }
+#endif /* ENABLED (JERRY_HIDDEN_CLASSES) */
+
+  ecma_property_t *property_p = ecma_inline_cache_lookup (slot_p, object_p, property_name_p);
+
+  if (JERRY_LIKELY (property_p != NULL))
+  {
+    if (ECMA_PROPERTY_GET_TYPE (*property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA
+        || !ecma_is_property_writable (*property_p))
+    {
+      JERRY_CONTEXT (inline_cache_stats).store_misses++;
+      return false;
+    }
+
+    JERRY_CONTEXT (inline_cache_stats).store_hits++;
+  }
+  else
+  {
+    JERRY_CONTEXT (inline_cache_stats).store_misses++;
+    property_p = ecma_find_named_property (object_p, property_name_p);
+
+    if (property_p == NULL
+        || ECMA_PROPERTY_GET_TYPE (*property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA
+        || !ecma_is_property_writable (*property_p))
+    {
+      return false;
+    }
+
+    ecma_inline_cache_insert (slot_p, object_p, property_name_p, property_p);
+  }
+
+  ecma_named_data_property_assign_value (object_p, ECMA_PROPERTY_VALUE_PTR (property_p), value);
+  return true;
+} /* vm_inline_cache_put_value */
+
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
 /**
  * Get the value of object[property].
  *
  * @return ecma value
  */
 static ecma_value_t
-vm_op_get_value (ecma_value_t object, /**< base object */
+vm_op_get_value (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                 const uint8_t *byte_code_p, /**< start of the instruction */
+                 ecma_value_t object, /**< base object */
                  ecma_value_t property) /**< property name */
 {
+#if !ENABLED (JERRY_INLINE_CACHE)
+  JERRY_UNUSED (frame_ctx_p);
+  JERRY_UNUSED (byte_code_p);
+#endif /* !ENABLED (JERRY_INLINE_CACHE) */
+
   if (ecma_is_value_object (object))
   {
     ecma_object_t *object_p = ecma_get_object_from_value (object);
@@ -104,6 +348,18 @@ vm_op_get_value (ecma_value_t object, /**< base object */
 
     if (property_name_p != NULL)
     {
+#if ENABLED (JERRY_INLINE_CACHE)
+      if (vm_is_inline_cacheable (object_p))
+      {
+        ecma_value_t result = vm_inline_cache_get_value (frame_ctx_p, byte_code_p, object_p, property_name_p);
+
+        if (result != ECMA_VALUE_NOT_FOUND)
+        {
+          return result;
+        }
+      }
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
 #if ENABLED (JERRY_LCACHE)
       ecma_property_t *property_p = ecma_lcache_lookup (object_p, property_name_p);
 
@@ -155,11 +411,18 @@ vm_op_get_value (ecma_value_t object, /**< base object */
  *         if the property setting is unsuccessful
  */
 static ecma_value_t
-vm_op_set_value (ecma_value_t base, /**< base object */
+vm_op_set_value (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                 const uint8_t *byte_code_p, /**< start of the instruction */
+                 ecma_value_t base, /**< base object */
                  ecma_value_t property, /**< property name */
                  ecma_value_t value, /**< ecma value */
                  bool is_strict) /**< strict mode */
 {
+#if !ENABLED (JERRY_INLINE_CACHE)
+  JERRY_UNUSED (frame_ctx_p);
+  JERRY_UNUSED (byte_code_p);
+#endif /* !ENABLED (JERRY_INLINE_CACHE) */
+
   ecma_value_t result = ECMA_VALUE_EMPTY;
   ecma_object_t *object_p;
   ecma_string_t *property_p;
@@ -232,6 +495,15 @@ vm_op_set_value (ecma_value_t base, /**< base object */
 
     if (!ecma_is_lexical_environment (object_p))
     {
+#if ENABLED (JERRY_INLINE_CACHE)
+      if (vm_inline_cache_put_value (frame_ctx_p, byte_code_p, object_p, property_p, value))
+      {
+        ecma_deref_object (object_p);
+        ecma_deref_ecma_string (property_p);
+        return ECMA_VALUE_TRUE;
+      }
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
       result = ecma_op_object_put_with_receiver (object_p,
                                                  property_p,
                                                  value,
@@ -252,6 +524,71 @@ vm_op_set_value (ecma_value_t base, /**< base object */
   return result;
 } /* vm_op_set_value */
 
+/**
+ * Get the arguments object of a function whose arguments object is stored in a register.
+ * The object is created when it is first requested.
+ *
+ * @return arguments object (owned by the register)
+ */
+static ecma_value_t
+vm_get_arguments_object (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                         uint32_t register_index) /**< register of the arguments object */
+{
+  ecma_value_t *register_p = &VM_GET_REGISTER (frame_ctx_p, register_index);
+
+  if (*register_p == ECMA_VALUE_UNDEFINED)
+  {
+    JERRY_ASSERT (frame_ctx_p->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE);
+
+    ecma_object_t *arguments_p = ecma_op_new_arguments_object (NULL,
+                                                               NULL,
+                                                               frame_ctx_p->arg_list_p,
+                                                               frame_ctx_p->arg_list_len,
+                                                               frame_ctx_p->bytecode_header_p);
+    *register_p = ecma_make_object_value (arguments_p);
+  }
+
+  JERRY_ASSERT (ecma_is_value_object (*register_p));
+  return *register_p;
+} /* vm_get_arguments_object */
+
+/**
+ * Get the length or an element of the arguments object stored in a register. These
+ * values are read from the arguments list until the arguments object is created.
+ *
+ * @return ecma value
+ */
+static ecma_value_t
+vm_get_arguments_property (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                           const uint8_t *byte_code_p, /**< start of the instruction */
+                           uint32_t register_index, /**< register of the arguments object */
+                           ecma_value_t property) /**< property name */
+{
+  ecma_value_t arguments = VM_GET_REGISTER (frame_ctx_p, register_index);
+
+  if (JERRY_LIKELY (arguments == ECMA_VALUE_UNDEFINED))
+  {
+    if (property == ecma_make_magic_string_value (LIT_MAGIC_STRING_LENGTH))
+    {
+      return ecma_make_uint32_value (frame_ctx_p->arg_list_len);
+    }
+
+    if (ecma_is_value_integer_number (property))
+    {
+      ecma_integer_value_t index = ecma_get_integer_from_value (property);
+
+      if (index >= 0 && (uint32_t) index < frame_ctx_p->arg_list_len)
+      {
+        return ecma_fast_copy_value (frame_ctx_p->arg_list_p[index]);
+      }
+    }
+
+    arguments = vm_get_arguments_object (frame_ctx_p, register_index);
+  }
+
+  return vm_op_get_value (frame_ctx_p, byte_code_p, arguments, property);
+} /* vm_get_arguments_property */
+
 /** Compact bytecode define */
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg4,
 
@@ -952,6 +1289,354 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   } \
   while (0)
 
+#if ENABLED (JERRY_VM_THREADED_DISPATCH) && (defined (__GNUC__) || defined (__clang__))
+
+/**
+ * The opcode groups of vm_loop are dispatched through a table of label
+ * addresses (labels as values) instead of the switch statement.
+ */
+#define VM_THREADED_DISPATCH 1
+
+/**
+ * Start the handler of an opcode group.
+ *
+ * Note:
+ *      the switch statement is kept, so the handlers can still leave
+ *      it with break, but it is only entered through the labels
+ */
+#define VM_CASE(group) case group: vm_label_ ## group
+
+/**
+ * Entry of the dispatch table of vm_loop.
+ */
+#define VM_DISPATCH_ENTRY(group) [group] = __extension__ &&vm_label_ ## group
+
+/**
+ * Jump to the handler of the opcode group of an opcode.
+ */
+#define VM_DISPATCH(opcode_data) \
+  __extension__ ({ goto *vm_dispatch_table[VM_OC_GROUP_GET_INDEX (opcode_data)]; })
+
+/**
+ * Decode the next opcode and jump to its handler.
+ *
+ * Each handler has its own copy of this tail, so the indirect jumps are
+ * predicted from the handler which precedes the opcode. Opcodes without
+ * arguments go straight to their handler, the others continue with the
+ * argument decoder at the start of the internal loop of vm_loop.
+ */
+#define VM_DISPATCH_NEXT() \
+  do \
+  { \
+    byte_code_start_p = byte_code_p; \
+    opcode = *byte_code_p++; \
+    opcode_data = opcode; \
+    \
+    if (opcode == CBC_EXT_OPCODE) \
+    { \
+      opcode = *byte_code_p++; \
+      opcode_data = (uint32_t) ((CBC_END + 1) + opcode); \
+    } \
+    \
+    opcode_data = vm_decode_table[opcode_data]; \
+    \
+    if (!VM_OC_HAS_GET_ARGS (opcode_data)) \
+    { \
+      left_value = ECMA_VALUE_UNDEFINED; \
+      right_value = ECMA_VALUE_UNDEFINED; \
+      VM_DISPATCH (opcode_data); \
+    } \
+    goto vm_get_operands; \
+  } \
+  while (0)
+
+#else /* !ENABLED (JERRY_VM_THREADED_DISPATCH) || (!__GNUC__ && !__clang__) */
+
+/**
+ * Start the handler of an opcode group.
+ */
+#define VM_CASE(group) case group
+
+/**
+ * The handler is selected by the switch statement of vm_loop.
+ */
+#define VM_DISPATCH(opcode_data)
+
+/**
+ * Continue with the next opcode.
+ */
+#define VM_DISPATCH_NEXT() continue
+
+#endif /* ENABLED (JERRY_VM_THREADED_DISPATCH) && (__GNUC__ || __clang__) */
+
+#if ENABLED (JERRY_VM_INTERRUPT)
+
+/**
+ * Service a pending vm interrupt request.
+ *
+ * Note:
+ *      the caller must check JERRY_CONTEXT (vm_interrupt_pending) first,
+ *      so the non-interrupted path costs a single load and branch
+ *
+ * @return ECMA_VALUE_ERROR - if the interrupt callback requested the execution to stop
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static ecma_value_t JERRY_ATTR_NOINLINE
+vm_handle_interrupt (void)
+{
+  JERRY_CONTEXT (vm_interrupt_pending) = 0;
+
+  if (JERRY_CONTEXT (vm_interrupt_cb) == NULL)
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+  ecma_value_t result = JERRY_CONTEXT (vm_interrupt_cb) (JERRY_CONTEXT (vm_interrupt_user_p));
+
+  if (ecma_is_value_undefined (result))
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+  /* The request stays pending, so the execution is stopped again
+   * if the exception is caught by native code and the vm is re-entered. */
+  JERRY_CONTEXT (vm_interrupt_pending) = 1;
+
+  if (ecma_is_value_error_reference (result))
+  {
+    ecma_raise_error_from_error_reference (result);
+  }
+  else
+  {
+    jcontext_raise_exception (result);
+  }
+
+  JERRY_ASSERT (jcontext_has_pending_exception ());
+  jcontext_set_abort_flag (true);
+  return ECMA_VALUE_ERROR;
+} /* vm_handle_interrupt */
+
+#endif /* ENABLED (JERRY_VM_INTERRUPT) */
+
+#if ENABLED (JERRY_VM_EXEC_STOP)
+
+/**
+ * Call the vm_exec_stop callback.
+ *
+ * @return ECMA_VALUE_ERROR - if the callback requested the execution to stop
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static ecma_value_t JERRY_ATTR_NOINLINE
+vm_handle_exec_stop (void)
+{
+  ecma_value_t result = JERRY_CONTEXT (vm_exec_stop_cb) (JERRY_CONTEXT (vm_exec_stop_user_p));
+
+  if (ecma_is_value_undefined (result))
+  {
+    JERRY_CONTEXT (vm_exec_stop_counter) = JERRY_CONTEXT (vm_exec_stop_frequency);
+    return ECMA_VALUE_EMPTY;
+  }
+
+  JERRY_CONTEXT (vm_exec_stop_counter) = 1;
+
+  if (ecma_is_value_error_reference (result))
+  {
+    ecma_raise_error_from_error_reference (result);
+  }
+  else
+  {
+    jcontext_raise_exception (result);
+  }
+
+  JERRY_ASSERT (jcontext_has_pending_exception ());
+  jcontext_set_abort_flag (true);
+  return ECMA_VALUE_ERROR;
+} /* vm_handle_exec_stop */
+
+#endif /* ENABLED (JERRY_VM_EXEC_STOP) */
+
+#if ENABLED (JERRY_JIT)
+
+/**
+ * Get the value of object[property] for the compiled code.
+ *
+ * @return ecma value
+ */
+ecma_value_t
+vm_jit_get_value (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                  const uint8_t *byte_code_p, /**< start of the instruction */
+                  ecma_value_t object, /**< base object */
+                  ecma_value_t property) /**< property name */
+{
+  return vm_op_get_value (frame_ctx_p, byte_code_p, object, property);
+} /* vm_jit_get_value */
+
+/**
+ * Create the arguments object stored in a register for the compiled code.
+ *
+ * @return ECMA_VALUE_EMPTY
+ */
+ecma_value_t
+vm_jit_create_arguments (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                         uint32_t register_index) /**< register of the arguments object */
+{
+  vm_get_arguments_object (frame_ctx_p, register_index);
+  return ECMA_VALUE_EMPTY;
+} /* vm_jit_create_arguments */
+
+/**
+ * Get the length or an element of the arguments object stored in a register for the compiled code.
+ *
+ * @return ecma value
+ */
+ecma_value_t
+vm_jit_get_arguments_property (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                               const uint8_t *byte_code_p, /**< start of the instruction */
+                               uint32_t register_index, /**< register of the arguments object */
+                               ecma_value_t property) /**< property name */
+{
+  return vm_get_arguments_property (frame_ctx_p, byte_code_p, register_index, property);
+} /* vm_jit_get_arguments_property */
+
+/**
+ * Store a value into a reference for the compiled code. The base and
+ * property are freed.
+ *
+ * @return ECMA_VALUE_ERROR - if the operation fails (the value is freed),
+ *         the value - if VM_JIT_PUT_KEEP_VALUE is set,
+ *         ECMA_VALUE_EMPTY - otherwise (the value is freed)
+ */
+ecma_value_t
+vm_jit_put_reference (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                      const uint8_t *byte_code_p, /**< start of the instruction */
+                      ecma_value_t base, /**< base object */
+                      ecma_value_t property, /**< property name */
+                      ecma_value_t value, /**< value */
+                      uint32_t flags) /**< vm_jit_put_flags_t */
+{
+  if (base == ECMA_VALUE_REGISTER_REF)
+  {
+    property = (ecma_value_t) ecma_get_integer_from_value (property);
+    ecma_fast_free_value (VM_GET_REGISTER (frame_ctx_p, property));
+    VM_GET_REGISTER (frame_ctx_p, property) = value;
+
+    return (flags & VM_JIT_PUT_KEEP_VALUE) ? ecma_fast_copy_value (value) : ECMA_VALUE_EMPTY;
+  }
+
+  ecma_value_t set_value_result = vm_op_set_value (frame_ctx_p,
+                                                   byte_code_p,
+                                                   base,
+                                                   property,
+                                                   value,
+                                                   (flags & VM_JIT_PUT_STRICT) != 0);
+
+  if (ECMA_IS_VALUE_ERROR (set_value_result))
+  {
+    ecma_free_value (value);
+    return set_value_result;
+  }
+
+  if (!(flags & VM_JIT_PUT_KEEP_VALUE))
+  {
+    ecma_fast_free_value (value);
+    return ECMA_VALUE_EMPTY;
+  }
+
+  return value;
+} /* vm_jit_put_reference */
+
+/**
+ * Backward branch checks of the compiled code.
+ *
+ * @return ECMA_VALUE_ERROR - if the execution must be stopped
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+ecma_value_t
+vm_jit_backward_branch (void)
+{
+#if ENABLED (JERRY_VM_EXEC_STOP)
+  if (JERRY_CONTEXT (vm_exec_stop_cb) != NULL
+      && --JERRY_CONTEXT (vm_exec_stop_counter) == 0
+      && ECMA_IS_VALUE_ERROR (vm_handle_exec_stop ()))
+  {
+    return ECMA_VALUE_ERROR;
+  }
+#endif /* ENABLED (JERRY_VM_EXEC_STOP) */
+
+#if ENABLED (JERRY_VM_INTERRUPT)
+  if (JERRY_CONTEXT (vm_interrupt_pending) != 0)
+  {
+    return vm_handle_interrupt ();
+  }
+#endif /* ENABLED (JERRY_VM_INTERRUPT) */
+
+  return ECMA_VALUE_EMPTY;
+} /* vm_jit_backward_branch */
+
+/**
+ * Call and construct operations of the compiled code. The byte code
+ * position and the stack top of the frame context must be up-to-date.
+ *
+ * @return ECMA_VALUE_ERROR - if the operation throws an exception
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+ecma_value_t
+vm_jit_call (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+             uint32_t is_construct) /**< construct operation */
+{
+  if (is_construct)
+  {
+    opfunc_construct (frame_ctx_p);
+  }
+  else
+  {
+    opfunc_call (frame_ctx_p);
+  }
+
+  return (frame_ctx_p->byte_code_p == vm_error_byte_code_p) ? ECMA_VALUE_ERROR : ECMA_VALUE_EMPTY;
+} /* vm_jit_call */
+
+/**
+ * Count an invocation or a backward branch of a byte code, and compile
+ * the byte code when it becomes hot.
+ *
+ * @return machine code address - if the byte code is compiled and
+ *                                the instruction is an entry point,
+ *         NULL - otherwise
+ */
+static inline const uint8_t * JERRY_ATTR_ALWAYS_INLINE
+vm_jit_tick (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+             uint16_t *counter_p, /**< jit counter of the byte code */
+             const uint8_t *byte_code_p) /**< next instruction */
+{
+  uint16_t counter = *counter_p;
+
+  if (JERRY_LIKELY (counter < VM_JIT_THRESHOLD))
+  {
+    *counter_p = (uint16_t) (counter + 1);
+    return NULL;
+  }
+
+  if (counter == VM_JIT_COUNTER_DISABLED)
+  {
+    return NULL;
+  }
+
+  if (counter < VM_JIT_COUNTER_COMPILED)
+  {
+    if (!vm_jit_compile (frame_ctx_p->bytecode_header_p, vm_decode_table))
+    {
+      return NULL;
+    }
+
+    counter = *counter_p;
+  }
+
+  return vm_jit_find_entry (frame_ctx_p, counter, byte_code_p);
+} /* vm_jit_tick */
+
+#endif /* ENABLED (JERRY_JIT) */
+
 /**
  * Run generic byte code.
  *
@@ -976,6 +1661,197 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   ecma_value_t right_value;
   ecma_value_t result = ECMA_VALUE_EMPTY;
   bool is_strict = ((frame_ctx_p->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0);
+#if ENABLED (JERRY_JIT)
+  uint16_t jit_disabled_counter = VM_JIT_COUNTER_DISABLED;
+  uint16_t *jit_counter_p = vm_jit_get_counter (bytecode_header_p);
+  const uint8_t *jit_entry_p;
+
+  if (jit_counter_p == NULL)
+  {
+    jit_counter_p = &jit_disabled_counter;
+  }
+#endif /* ENABLED (JERRY_JIT) */
+
+#ifdef VM_THREADED_DISPATCH
+  /* The entries must follow the opcode groups of vm_oc_types. */
+  static const void * const vm_dispatch_table[] =
+  {
+    VM_DISPATCH_ENTRY (VM_OC_POP),
+    VM_DISPATCH_ENTRY (VM_OC_POP_BLOCK),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_TWO),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_THREE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_UNDEFINED),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_TRUE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_FALSE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_NULL),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_THIS),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_0),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_POS_BYTE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_NEG_BYTE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_LIT_0),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_LIT_POS_BYTE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_LIT_NEG_BYTE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_OBJECT),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_NAMED_FUNC_EXPR),
+    VM_DISPATCH_ENTRY (VM_OC_SET_PROPERTY),
+    VM_DISPATCH_ENTRY (VM_OC_SET_GETTER),
+    VM_DISPATCH_ENTRY (VM_OC_SET_SETTER),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_ARRAY),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_ELISON),
+    VM_DISPATCH_ENTRY (VM_OC_APPEND_ARRAY),
+    VM_DISPATCH_ENTRY (VM_OC_IDENT_REFERENCE),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_REFERENCE),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_GET),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_PRE_INCR),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_PRE_DECR),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_POST_INCR),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_POST_DECR),
+    VM_DISPATCH_ENTRY (VM_OC_PRE_INCR),
+    VM_DISPATCH_ENTRY (VM_OC_PRE_DECR),
+    VM_DISPATCH_ENTRY (VM_OC_POST_INCR),
+    VM_DISPATCH_ENTRY (VM_OC_POST_DECR),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_DELETE),
+    VM_DISPATCH_ENTRY (VM_OC_DELETE),
+    VM_DISPATCH_ENTRY (VM_OC_MOV_IDENT),
+    VM_DISPATCH_ENTRY (VM_OC_ASSIGN),
+    VM_DISPATCH_ENTRY (VM_OC_ASSIGN_PROP),
+    VM_DISPATCH_ENTRY (VM_OC_ASSIGN_PROP_THIS),
+    VM_DISPATCH_ENTRY (VM_OC_RETURN),
+    VM_DISPATCH_ENTRY (VM_OC_THROW),
+    VM_DISPATCH_ENTRY (VM_OC_THROW_REFERENCE_ERROR),
+    VM_DISPATCH_ENTRY (VM_OC_EVAL),
+    VM_DISPATCH_ENTRY (VM_OC_CALL),
+    VM_DISPATCH_ENTRY (VM_OC_NEW),
+    VM_DISPATCH_ENTRY (VM_OC_RESOLVE_BASE_FOR_CALL),
+    VM_DISPATCH_ENTRY (VM_OC_ERROR),
+    VM_DISPATCH_ENTRY (VM_OC_JUMP),
+#if ENABLED (JERRY_ESNEXT)
+    VM_DISPATCH_ENTRY (VM_OC_BRANCH_IF_NULLISH),
+#endif /* ENABLED (JERRY_ESNEXT) */
+    VM_DISPATCH_ENTRY (VM_OC_BRANCH_IF_STRICT_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_BRANCH_IF_TRUE),
+    VM_DISPATCH_ENTRY (VM_OC_BRANCH_IF_FALSE),
+    VM_DISPATCH_ENTRY (VM_OC_BRANCH_IF_LOGICAL_TRUE),
+    VM_DISPATCH_ENTRY (VM_OC_BRANCH_IF_LOGICAL_FALSE),
+    VM_DISPATCH_ENTRY (VM_OC_PLUS),
+    VM_DISPATCH_ENTRY (VM_OC_MINUS),
+    VM_DISPATCH_ENTRY (VM_OC_NOT),
+    VM_DISPATCH_ENTRY (VM_OC_BIT_NOT),
+    VM_DISPATCH_ENTRY (VM_OC_VOID),
+    VM_DISPATCH_ENTRY (VM_OC_TYPEOF_IDENT),
+    VM_DISPATCH_ENTRY (VM_OC_TYPEOF),
+    VM_DISPATCH_ENTRY (VM_OC_ADD),
+    VM_DISPATCH_ENTRY (VM_OC_SUB),
+    VM_DISPATCH_ENTRY (VM_OC_MUL),
+    VM_DISPATCH_ENTRY (VM_OC_DIV),
+    VM_DISPATCH_ENTRY (VM_OC_MOD),
+#if ENABLED (JERRY_ESNEXT)
+    VM_DISPATCH_ENTRY (VM_OC_EXP),
+#endif /* ENABLED (JERRY_ESNEXT) */
+    VM_DISPATCH_ENTRY (VM_OC_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_NOT_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_STRICT_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_STRICT_NOT_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_LESS),
+    VM_DISPATCH_ENTRY (VM_OC_GREATER),
+    VM_DISPATCH_ENTRY (VM_OC_LESS_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_GREATER_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_IN),
+    VM_DISPATCH_ENTRY (VM_OC_INSTANCEOF),
+    VM_DISPATCH_ENTRY (VM_OC_BIT_OR),
+    VM_DISPATCH_ENTRY (VM_OC_BIT_XOR),
+    VM_DISPATCH_ENTRY (VM_OC_BIT_AND),
+    VM_DISPATCH_ENTRY (VM_OC_LEFT_SHIFT),
+    VM_DISPATCH_ENTRY (VM_OC_RIGHT_SHIFT),
+    VM_DISPATCH_ENTRY (VM_OC_UNS_RIGHT_SHIFT),
+    VM_DISPATCH_ENTRY (VM_OC_BLOCK_CREATE_CONTEXT),
+    VM_DISPATCH_ENTRY (VM_OC_WITH),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_IN_INIT),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_IN_GET_NEXT),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_IN_HAS_NEXT),
+    VM_DISPATCH_ENTRY (VM_OC_TRY),
+    VM_DISPATCH_ENTRY (VM_OC_CATCH),
+    VM_DISPATCH_ENTRY (VM_OC_FINALLY),
+    VM_DISPATCH_ENTRY (VM_OC_CONTEXT_END),
+    VM_DISPATCH_ENTRY (VM_OC_JUMP_AND_EXIT_CONTEXT),
+    VM_DISPATCH_ENTRY (VM_OC_CREATE_BINDING),
+#if ENABLED (JERRY_SNAPSHOT_EXEC)
+    VM_DISPATCH_ENTRY (VM_OC_SET_BYTECODE_PTR),
+#else /* !ENABLED (JERRY_SNAPSHOT_EXEC) */
+    [VM_OC_SET_BYTECODE_PTR] = __extension__ &&vm_label_VM_OC_NONE,
+#endif /* ENABLED (JERRY_SNAPSHOT_EXEC) */
+    VM_DISPATCH_ENTRY (VM_OC_VAR_EVAL),
+#if ENABLED (JERRY_ESNEXT)
+    VM_DISPATCH_ENTRY (VM_OC_EXT_VAR_EVAL),
+#endif /* ENABLED (JERRY_ESNEXT) */
+    VM_DISPATCH_ENTRY (VM_OC_INIT_ARG_OR_FUNC),
+    VM_DISPATCH_ENTRY (VM_OC_CREATE_ARGUMENTS),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_ARGUMENTS),
+#if ENABLED (JERRY_DEBUGGER)
+    VM_DISPATCH_ENTRY (VM_OC_BREAKPOINT_ENABLED),
+    VM_DISPATCH_ENTRY (VM_OC_BREAKPOINT_DISABLED),
+#endif /* ENABLED (JERRY_DEBUGGER) */
+#if ENABLED (JERRY_LINE_INFO)
+    VM_DISPATCH_ENTRY (VM_OC_LINE),
+#endif /* ENABLED (JERRY_LINE_INFO) */
+#if ENABLED (JERRY_ESNEXT)
+    VM_DISPATCH_ENTRY (VM_OC_CHECK_VAR),
+    VM_DISPATCH_ENTRY (VM_OC_CHECK_LET),
+    VM_DISPATCH_ENTRY (VM_OC_ASSIGN_LET_CONST),
+    VM_DISPATCH_ENTRY (VM_OC_INIT_BINDING),
+    VM_DISPATCH_ENTRY (VM_OC_THROW_CONST_ERROR),
+    VM_DISPATCH_ENTRY (VM_OC_COPY_TO_GLOBAL),
+    VM_DISPATCH_ENTRY (VM_OC_COPY_FROM_ARG),
+    VM_DISPATCH_ENTRY (VM_OC_CLONE_CONTEXT),
+    VM_DISPATCH_ENTRY (VM_OC_COPY_DATA_PROPERTIES),
+    VM_DISPATCH_ENTRY (VM_OC_SET_COMPUTED_PROPERTY),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_OF_INIT),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_OF_GET_NEXT),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_OF_HAS_NEXT),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_AWAIT_OF_INIT),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_AWAIT_OF_HAS_NEXT),
+    VM_DISPATCH_ENTRY (VM_OC_LOCAL_EVAL),
+    VM_DISPATCH_ENTRY (VM_OC_SUPER_CALL),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_CLASS_ENVIRONMENT),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_IMPLICIT_CTOR),
+    VM_DISPATCH_ENTRY (VM_OC_INIT_CLASS),
+    VM_DISPATCH_ENTRY (VM_OC_FINALIZE_CLASS),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_SUPER_CONSTRUCTOR),
+    VM_DISPATCH_ENTRY (VM_OC_RESOLVE_LEXICAL_THIS),
+    VM_DISPATCH_ENTRY (VM_OC_SUPER_REFERENCE),
+    VM_DISPATCH_ENTRY (VM_OC_SET_HOME_OBJECT),
+    VM_DISPATCH_ENTRY (VM_OC_OBJECT_LITERAL_HOME_ENV),
+    VM_DISPATCH_ENTRY (VM_OC_SET_FUNCTION_NAME),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_SPREAD_ELEMENT),
+    VM_DISPATCH_ENTRY (VM_OC_GET_ITERATOR),
+    VM_DISPATCH_ENTRY (VM_OC_ITERATOR_STEP),
+    VM_DISPATCH_ENTRY (VM_OC_ITERATOR_CLOSE),
+    VM_DISPATCH_ENTRY (VM_OC_DEFAULT_INITIALIZER),
+    VM_DISPATCH_ENTRY (VM_OC_REST_INITIALIZER),
+    VM_DISPATCH_ENTRY (VM_OC_INITIALIZER_PUSH_PROP),
+    VM_DISPATCH_ENTRY (VM_OC_SPREAD_ARGUMENTS),
+    VM_DISPATCH_ENTRY (VM_OC_CREATE_GENERATOR),
+    VM_DISPATCH_ENTRY (VM_OC_YIELD),
+    VM_DISPATCH_ENTRY (VM_OC_ASYNC_YIELD),
+    VM_DISPATCH_ENTRY (VM_OC_ASYNC_YIELD_ITERATOR),
+    VM_DISPATCH_ENTRY (VM_OC_AWAIT),
+    VM_DISPATCH_ENTRY (VM_OC_GENERATOR_AWAIT),
+    VM_DISPATCH_ENTRY (VM_OC_EXT_RETURN),
+    VM_DISPATCH_ENTRY (VM_OC_ASYNC_EXIT),
+    VM_DISPATCH_ENTRY (VM_OC_STRING_CONCAT),
+    VM_DISPATCH_ENTRY (VM_OC_GET_TEMPLATE_OBJECT),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_NEW_TARGET),
+    VM_DISPATCH_ENTRY (VM_OC_REQUIRE_OBJECT_COERCIBLE),
+    VM_DISPATCH_ENTRY (VM_OC_ASSIGN_SUPER),
+    VM_DISPATCH_ENTRY (VM_OC_SET__PROTO__),
+#endif /* ENABLED (JERRY_ESNEXT) */
+    VM_DISPATCH_ENTRY (VM_OC_NONE),
+  };
+
+  JERRY_STATIC_ASSERT (sizeof (vm_dispatch_table) / sizeof (vm_dispatch_table[0]) == VM_OC_NONE + 1,
+                       vm_dispatch_table_must_have_an_entry_for_each_opcode_group);
+#endif /* VM_THREADED_DISPATCH */
 
   /* Prepare for byte code execution. */
   if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING))
@@ -1006,9 +1882,32 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
   stack_top_p = frame_ctx_p->stack_top_p;
 
+#if ENABLED (JERRY_JIT)
+  /* Both the first invocation and the returns from calls are counted. */
+  jit_entry_p = vm_jit_tick (frame_ctx_p, jit_counter_p, byte_code_p);
+#endif /* ENABLED (JERRY_JIT) */
+
   /* Outer loop for exception handling. */
   while (true)
   {
+#if ENABLED (JERRY_JIT)
+jit_enter:
+    if (jit_entry_p != NULL)
+    {
+      result = vm_jit_run (frame_ctx_p, *jit_counter_p, stack_top_p, jit_entry_p);
+      jit_entry_p = NULL;
+      byte_code_p = frame_ctx_p->byte_code_p;
+      stack_top_p = frame_ctx_p->stack_top_p;
+
+      if (ECMA_IS_VALUE_ERROR (result))
+      {
+        left_value = ECMA_VALUE_UNDEFINED;
+        right_value = ECMA_VALUE_UNDEFINED;
+        goto error;
+      }
+    }
+#endif /* ENABLED (JERRY_JIT) */
+
     /* Internal loop for byte code execution. */
     while (true)
     {
@@ -1024,6 +1923,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
       opcode_data = vm_decode_table[opcode_data];
 
+#ifdef VM_THREADED_DISPATCH
+vm_get_operands:
+#endif /* VM_THREADED_DISPATCH */
       left_value = ECMA_VALUE_UNDEFINED;
       right_value = ECMA_VALUE_UNDEFINED;
 
@@ -1063,6 +1965,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             }
           }
         }
+
+        VM_DISPATCH (opcode_data);
       }
       else if (operands >= VM_OC_GET_STACK)
       {
@@ -1078,6 +1982,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           right_value = left_value;
           left_value = *(--stack_top_p);
         }
+
+        VM_DISPATCH (opcode_data);
       }
       else if (operands == VM_OC_GET_BRANCH)
       {
@@ -1100,67 +2006,73 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
         if (opcode_data & VM_OC_BACKWARD_BRANCH)
         {
+#if ENABLED (JERRY_JIT)
+          jit_entry_p = vm_jit_tick (frame_ctx_p, jit_counter_p, byte_code_start_p);
+
+          if (jit_entry_p != NULL)
+          {
+            byte_code_p = byte_code_start_p;
+            goto jit_enter;
+          }
+#endif /* ENABLED (JERRY_JIT) */
 #if ENABLED (JERRY_VM_EXEC_STOP)
           if (JERRY_CONTEXT (vm_exec_stop_cb) != NULL
               && --JERRY_CONTEXT (vm_exec_stop_counter) == 0)
           {
-            result = JERRY_CONTEXT (vm_exec_stop_cb) (JERRY_CONTEXT (vm_exec_stop_user_p));
+            result = vm_handle_exec_stop ();
 
-            if (ecma_is_value_undefined (result))
+            if (ECMA_IS_VALUE_ERROR (result))
             {
-              JERRY_CONTEXT (vm_exec_stop_counter) = JERRY_CONTEXT (vm_exec_stop_frequency);
+              goto error;
             }
-            else
-            {
-              JERRY_CONTEXT (vm_exec_stop_counter) = 1;
-
-              if (ecma_is_value_error_reference (result))
-              {
-                ecma_raise_error_from_error_reference (result);
-              }
-              else
-              {
-                jcontext_raise_exception (result);
-              }
+          }
+#endif /* ENABLED (JERRY_VM_EXEC_STOP) */
+#if ENABLED (JERRY_VM_INTERRUPT)
+          if (JERRY_UNLIKELY (JERRY_CONTEXT (vm_interrupt_pending) != 0))
+          {
+            result = vm_handle_interrupt ();
 
-              JERRY_ASSERT (jcontext_has_pending_exception ());
-              jcontext_set_abort_flag (true);
-              result = ECMA_VALUE_ERROR;
+            if (ECMA_IS_VALUE_ERROR (result))
+            {
               goto error;
             }
           }
-#endif /* ENABLED (JERRY_VM_EXEC_STOP) */
+#endif /* ENABLED (JERRY_VM_INTERRUPT) */
 
           branch_offset = -branch_offset;
         }
+
+        VM_DISPATCH (opcode_data);
       }
 
+      VM_DISPATCH (opcode_data);
+
       switch (VM_OC_GROUP_GET_INDEX (opcode_data))
       {
-        case VM_OC_POP:
+        VM_CASE (VM_OC_POP):
         {
           JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
           ecma_free_value (*(--stack_top_p));
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_POP_BLOCK:
+        VM_CASE (VM_OC_POP_BLOCK):
         {
           ecma_fast_free_value (frame_ctx_p->block_result);
           frame_ctx_p->block_result = *(--stack_top_p);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH:
+        VM_CASE (VM_OC_PUSH):
         {
           *stack_top_p++ = left_value;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_TWO:
+        VM_CASE (VM_OC_PUSH_TWO):
         {
           *stack_top_p++ = left_value;
           *stack_top_p++ = right_value;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_THREE:
+        VM_CASE (VM_OC_PUSH_THREE):
         {
           uint16_t literal_index;
 
@@ -1172,83 +2084,83 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           *stack_top_p++ = right_value;
           *stack_top_p++ = left_value;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_UNDEFINED:
+        VM_CASE (VM_OC_PUSH_UNDEFINED):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_TRUE:
+        VM_CASE (VM_OC_PUSH_TRUE):
         {
           *stack_top_p++ = ECMA_VALUE_TRUE;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_FALSE:
+        VM_CASE (VM_OC_PUSH_FALSE):
         {
           *stack_top_p++ = ECMA_VALUE_FALSE;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_NULL:
+        VM_CASE (VM_OC_PUSH_NULL):
         {
           *stack_top_p++ = ECMA_VALUE_NULL;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_THIS:
+        VM_CASE (VM_OC_PUSH_THIS):
         {
           *stack_top_p++ = ecma_copy_value (frame_ctx_p->this_binding);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_0:
+        VM_CASE (VM_OC_PUSH_0):
         {
           *stack_top_p++ = ecma_make_integer_value (0);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (number + 1);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (-(number + 1));
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_LIT_0:
+        VM_CASE (VM_OC_PUSH_LIT_0):
         {
           stack_top_p[0] = left_value;
           stack_top_p[1] = ecma_make_integer_value (0);
           stack_top_p += 2;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_LIT_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
           stack_top_p[1] = ecma_make_integer_value (number + 1);
           stack_top_p += 2;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_LIT_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
           stack_top_p[1] = ecma_make_integer_value (-(number + 1));
           stack_top_p += 2;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_OBJECT:
+        VM_CASE (VM_OC_PUSH_OBJECT):
         {
           ecma_object_t *obj_p = ecma_create_object (ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE),
                                                      0,
                                                      ECMA_OBJECT_TYPE_GENERAL);
 
           *stack_top_p++ = ecma_make_object_value (obj_p);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_NAMED_FUNC_EXPR:
+        VM_CASE (VM_OC_PUSH_NAMED_FUNC_EXPR):
         {
           ecma_object_t *func_p = ecma_get_object_from_value (left_value);
 
@@ -1268,9 +2180,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_free_value (right_value);
           ecma_deref_object (name_lex_env);
           *stack_top_p++ = left_value;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_CREATE_BINDING:
+        VM_CASE (VM_OC_CREATE_BINDING):
         {
 #if !ENABLED (JERRY_ESNEXT)
           JERRY_ASSERT (opcode == CBC_CREATE_VAR);
@@ -1308,9 +2220,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_create_named_data_property (frame_ctx_p->lex_env_p, name_p, prop_attributes, NULL);
 #endif /* ENABLED (JERRY_ESNEXT) */
 
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_VAR_EVAL:
+        VM_CASE (VM_OC_VAR_EVAL):
         {
           uint32_t literal_index;
           ecma_value_t lit_value = ECMA_VALUE_UNDEFINED;
@@ -1372,10 +2284,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             }
           }
 
-          continue;
+          VM_DISPATCH_NEXT ();
         }
 #if ENABLED (JERRY_ESNEXT)
-        case VM_OC_EXT_VAR_EVAL:
+        VM_CASE (VM_OC_EXT_VAR_EVAL):
         {
           uint32_t literal_index;
           ecma_value_t lit_value = ECMA_VALUE_UNDEFINED;
@@ -1431,14 +2343,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
             if (lit_value == ECMA_VALUE_UNDEFINED)
             {
-              continue;
+              VM_DISPATCH_NEXT ();
             }
           }
           else
           {
             if (lit_value == ECMA_VALUE_UNDEFINED)
             {
-              continue;
+              VM_DISPATCH_NEXT ();
             }
 
             property_value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
@@ -1447,18 +2359,18 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           property_value_p->value = lit_value;
           ecma_deref_object (ecma_get_object_from_value (lit_value));
-          continue;
+          VM_DISPATCH_NEXT ();
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
 #if ENABLED (JERRY_SNAPSHOT_EXEC)
-        case VM_OC_SET_BYTECODE_PTR:
+        VM_CASE (VM_OC_SET_BYTECODE_PTR):
         {
           memcpy (&byte_code_p, byte_code_p++, sizeof (uint8_t *));
           frame_ctx_p->byte_code_start_p = byte_code_p;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
 #endif /* ENABLED (JERRY_SNAPSHOT_EXEC) */
-        case VM_OC_INIT_ARG_OR_FUNC:
+        VM_CASE (VM_OC_INIT_ARG_OR_FUNC):
         {
           uint32_t literal_index, value_index;
           ecma_value_t lit_value;
@@ -1484,7 +2396,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             ecma_fast_free_value (VM_GET_REGISTER (frame_ctx_p, literal_index));
             VM_GET_REGISTER (frame_ctx_p, literal_index) = lit_value;
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           ecma_string_t *name_p = ecma_get_string_from_value (literal_start_p[literal_index]);
@@ -1506,10 +2418,47 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_free_value (lit_value);
           }
 
-          continue;
+          VM_DISPATCH_NEXT ();
+        }
+        VM_CASE (VM_OC_CREATE_ARGUMENTS):
+        {
+          uint32_t literal_index;
+          READ_LITERAL_INDEX (literal_index);
+
+          JERRY_ASSERT (literal_index < register_end);
+          vm_get_arguments_object (frame_ctx_p, literal_index);
+          VM_DISPATCH_NEXT ();
+        }
+        VM_CASE (VM_OC_PUSH_ARGUMENTS):
+        {
+          uint32_t literal_index;
+          READ_LITERAL_INDEX (literal_index);
+          JERRY_ASSERT (literal_index < register_end);
+
+          if (opcode == CBC_EXT_PUSH_ARGUMENTS_ELEMENT)
+          {
+            uint16_t property_index;
+            READ_LITERAL_INDEX (property_index);
+            READ_LITERAL (property_index, right_value);
+          }
+          else
+          {
+            JERRY_ASSERT (opcode == CBC_EXT_PUSH_ARGUMENTS_LENGTH);
+            right_value = ecma_make_magic_string_value (LIT_MAGIC_STRING_LENGTH);
+          }
+
+          result = vm_get_arguments_property (frame_ctx_p, byte_code_start_p, literal_index, right_value);
+
+          if (ECMA_IS_VALUE_ERROR (result))
+          {
+            goto error;
+          }
+
+          *stack_top_p++ = result;
+          goto free_both_values;
         }
 #if ENABLED (JERRY_ESNEXT)
-        case VM_OC_CHECK_VAR:
+        VM_CASE (VM_OC_CHECK_VAR):
         {
           JERRY_ASSERT (ecma_get_global_scope () == frame_ctx_p->lex_env_p);
 
@@ -1518,7 +2467,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           if ((frame_ctx_p->lex_env_p->type_flags_refs & ECMA_OBJECT_FLAG_BLOCK) == 0)
           {
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           ecma_string_t *const literal_name_p = ecma_get_string_from_value (literal_start_p[literal_index]);
@@ -1530,9 +2479,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_CHECK_LET:
+        VM_CASE (VM_OC_CHECK_LET):
         {
           JERRY_ASSERT (ecma_get_global_scope () == frame_ctx_p->lex_env_p);
 
@@ -1572,9 +2521,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_ASSIGN_LET_CONST:
+        VM_CASE (VM_OC_ASSIGN_LET_CONST):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1595,9 +2544,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             ecma_deref_object (ecma_get_object_from_value (left_value));
           }
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_INIT_BINDING:
+        VM_CASE (VM_OC_INIT_BINDING):
         {
           uint32_t literal_index;
 
@@ -1633,14 +2582,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           property_value_p->value = value;
           ecma_deref_if_object (value);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_THROW_CONST_ERROR:
+        VM_CASE (VM_OC_THROW_CONST_ERROR):
         {
           result = ecma_raise_type_error (ECMA_ERR_MSG ("Constant bindings cannot be reassigned."));
           goto error;
         }
-        case VM_OC_COPY_TO_GLOBAL:
+        VM_CASE (VM_OC_COPY_TO_GLOBAL):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1697,7 +2646,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_COPY_FROM_ARG:
+        VM_CASE (VM_OC_COPY_FROM_ARG):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1724,17 +2673,17 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           ecma_property_value_t *arg_prop_value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
           property_value_p->value = ecma_copy_value_if_not_object (arg_prop_value_p->value);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_CLONE_CONTEXT:
+        VM_CASE (VM_OC_CLONE_CONTEXT):
         {
           JERRY_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE);
 
           bool copy_values = (byte_code_start_p[1] == CBC_EXT_CLONE_FULL_CONTEXT);
           frame_ctx_p->lex_env_p = ecma_clone_decl_lexical_environment (frame_ctx_p->lex_env_p, copy_values);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_SET__PROTO__:
+        VM_CASE (VM_OC_SET__PROTO__):
         {
           result = ecma_builtin_object_object_set_proto (stack_top_p[-1], left_value);
           if (ECMA_IS_VALUE_ERROR (result))
@@ -1743,13 +2692,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_COPY_DATA_PROPERTIES:
+        VM_CASE (VM_OC_COPY_DATA_PROPERTIES):
         {
           result = *(--stack_top_p);
 
           if (ecma_is_value_undefined (result) || ecma_is_value_null (result))
           {
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           if (!ecma_is_value_object (result))
@@ -1798,9 +2747,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           ecma_collection_free (names_p);
           ecma_deref_object (object_p);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_SET_COMPUTED_PROPERTY:
+        VM_CASE (VM_OC_SET_COMPUTED_PROPERTY):
         {
           /* Swap values. */
           left_value ^= right_value;
@@ -1809,7 +2758,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           /* FALLTHRU */
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
-        case VM_OC_SET_PROPERTY:
+        VM_CASE (VM_OC_SET_PROPERTY):
         {
           JERRY_STATIC_ASSERT (VM_OC_NON_STATIC_FLAG == VM_OC_BACKWARD_BRANCH,
                                vm_oc_non_static_flag_must_be_equal_to_vm_oc_backward_branch);
@@ -1844,8 +2793,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_SET_GETTER:
-        case VM_OC_SET_SETTER:
+        VM_CASE (VM_OC_SET_GETTER):
+        VM_CASE (VM_OC_SET_SETTER):
         {
           JERRY_ASSERT ((opcode_data >> VM_OC_NON_STATIC_SHIFT) <= 0x1);
 
@@ -1879,21 +2828,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_PUSH_ARRAY:
+        VM_CASE (VM_OC_PUSH_ARRAY):
         {
           // Note: this operation cannot throw an exception
           *stack_top_p++ = ecma_make_object_value (ecma_op_new_fast_array_object (0));
-          continue;
+          VM_DISPATCH_NEXT ();
         }
 #if ENABLED (JERRY_ESNEXT)
-        case VM_OC_LOCAL_EVAL:
+        VM_CASE (VM_OC_LOCAL_EVAL):
         {
           ECMA_CLEAR_LOCAL_PARSE_OPTS ();
           uint8_t parse_opts = *byte_code_p++;
           ECMA_SET_LOCAL_PARSE_OPTS (parse_opts);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_SUPER_CALL:
+        VM_CASE (VM_OC_SUPER_CALL):
         {
           uint8_t arguments_list_len = *byte_code_p++;
 
@@ -1921,17 +2870,17 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_PUSH_CLASS_ENVIRONMENT:
+        VM_CASE (VM_OC_PUSH_CLASS_ENVIRONMENT):
         {
           opfunc_push_class_environment (frame_ctx_p, &stack_top_p, left_value);
           goto free_left_value;
         }
-        case VM_OC_PUSH_IMPLICIT_CTOR:
+        VM_CASE (VM_OC_PUSH_IMPLICIT_CTOR):
         {
           *stack_top_p++ = opfunc_create_implicit_class_constructor (opcode);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_INIT_CLASS:
+        VM_CASE (VM_OC_INIT_CLASS):
         {
           result = opfunc_init_class (frame_ctx_p, stack_top_p);
 
@@ -1939,14 +2888,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             goto error;
           }
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_FINALIZE_CLASS:
+        VM_CASE (VM_OC_FINALIZE_CLASS):
         {
           opfunc_finalize_class (frame_ctx_p, &stack_top_p, left_value);
           goto free_left_value;
         }
-        case VM_OC_PUSH_SUPER_CONSTRUCTOR:
+        VM_CASE (VM_OC_PUSH_SUPER_CONSTRUCTOR):
         {
           result = ecma_op_function_get_super_constructor (JERRY_CONTEXT (current_function_obj_p));
 
@@ -1956,9 +2905,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           *stack_top_p++ = result;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_RESOLVE_LEXICAL_THIS:
+        VM_CASE (VM_OC_RESOLVE_LEXICAL_THIS):
         {
           result = ecma_op_get_this_binding (frame_ctx_p->lex_env_p);
 
@@ -1968,9 +2917,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           *stack_top_p++ = result;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_OBJECT_LITERAL_HOME_ENV:
+        VM_CASE (VM_OC_OBJECT_LITERAL_HOME_ENV):
         {
           if (opcode == CBC_EXT_PUSH_OBJECT_SUPER_ENVIRONMENT)
           {
@@ -1989,16 +2938,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             stack_top_p[-2] = stack_top_p[-1];
             stack_top_p--;
           }
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_SET_HOME_OBJECT:
+        VM_CASE (VM_OC_SET_HOME_OBJECT):
         {
           int offset = opcode == CBC_EXT_OBJECT_LITERAL_SET_HOME_OBJECT_COMPUTED ? -1 : 0;
           opfunc_set_home_object (ecma_get_object_from_value (stack_top_p[-1]),
                                   ecma_get_object_from_value (stack_top_p[-3 + offset]));
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_SUPER_REFERENCE:
+        VM_CASE (VM_OC_SUPER_REFERENCE):
         {
           result = opfunc_form_super_reference (&stack_top_p, frame_ctx_p, left_value, opcode);
 
@@ -2009,7 +2958,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_SET_FUNCTION_NAME:
+        VM_CASE (VM_OC_SET_FUNCTION_NAME):
         {
           char *prefix_p = NULL;
           lit_utf8_size_t prefix_size = 0;
@@ -2058,7 +3007,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           if (ecma_find_named_property (func_obj_p, ecma_get_magic_string (LIT_MAGIC_STRING_NAME)) != NULL)
           {
             ecma_free_value (left_value);
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           ecma_property_value_t *value_p;
@@ -2076,14 +3025,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                                                        prefix_p,
                                                        prefix_size);
           ecma_free_value (left_value);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_SPREAD_ELEMENT:
+        VM_CASE (VM_OC_PUSH_SPREAD_ELEMENT):
         {
           *stack_top_p++ = ECMA_VALUE_SPREAD_ELEMENT;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_GET_ITERATOR:
+        VM_CASE (VM_OC_GET_ITERATOR):
         {
           result = ecma_op_get_iterator (stack_top_p[-1], ECMA_VALUE_SYNC_ITERATOR, NULL);
 
@@ -2093,9 +3042,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           *stack_top_p++ = result;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_ITERATOR_STEP:
+        VM_CASE (VM_OC_ITERATOR_STEP):
         {
           JERRY_ASSERT (opcode >= CBC_EXT_ITERATOR_STEP && opcode <= CBC_EXT_ITERATOR_STEP_3);
           const uint8_t index = (uint8_t) (1 + (opcode - CBC_EXT_ITERATOR_STEP));
@@ -2121,9 +3070,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           *stack_top_p++ = value;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_ITERATOR_CLOSE:
+        VM_CASE (VM_OC_ITERATOR_CLOSE):
         {
           result = ecma_op_iterator_close (left_value);
 
@@ -2134,20 +3083,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_DEFAULT_INITIALIZER:
+        VM_CASE (VM_OC_DEFAULT_INITIALIZER):
         {
           JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
 
           if (stack_top_p[-1] != ECMA_VALUE_UNDEFINED)
           {
             byte_code_p = byte_code_start_p + branch_offset;
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           stack_top_p--;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_REST_INITIALIZER:
+        VM_CASE (VM_OC_REST_INITIALIZER):
         {
           JERRY_ASSERT (opcode >= CBC_EXT_REST_INITIALIZER && opcode <= CBC_EXT_REST_INITIALIZER_3);
           const uint8_t iterator_index = (uint8_t) (1 + (opcode - CBC_EXT_REST_INITIALIZER));
@@ -2186,11 +3135,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           *stack_top_p++ = ecma_make_object_value (array_p);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_INITIALIZER_PUSH_PROP:
+        VM_CASE (VM_OC_INITIALIZER_PUSH_PROP):
         {
-          result = vm_op_get_value (stack_top_p[-1], left_value);
+          result = vm_op_get_value (frame_ctx_p, byte_code_start_p, stack_top_p[-1], left_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2200,7 +3149,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_SPREAD_ARGUMENTS:
+        VM_CASE (VM_OC_SPREAD_ARGUMENTS):
         {
           uint8_t arguments_list_len = *byte_code_p++;
           stack_top_p -= arguments_list_len;
@@ -2221,7 +3170,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_CREATE_GENERATOR:
+        VM_CASE (VM_OC_CREATE_GENERATOR):
         {
           frame_ctx_p->call_operation = VM_EXEC_RETURN;
           frame_ctx_p->byte_code_p = byte_code_p;
@@ -2232,14 +3181,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           return ecma_make_object_value ((ecma_object_t *) executable_object_p);
         }
-        case VM_OC_YIELD:
+        VM_CASE (VM_OC_YIELD):
         {
           frame_ctx_p->call_operation = VM_EXEC_RETURN;
           frame_ctx_p->byte_code_p = byte_code_p;
           frame_ctx_p->stack_top_p = --stack_top_p;
           return *stack_top_p;
         }
-        case VM_OC_ASYNC_YIELD:
+        VM_CASE (VM_OC_ASYNC_YIELD):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2250,7 +3199,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = --stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_ASYNC_YIELD_ITERATOR:
+        VM_CASE (VM_OC_ASYNC_YIELD_ITERATOR):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2290,7 +3239,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_AWAIT:
+        VM_CASE (VM_OC_AWAIT):
         {
           if (JERRY_UNLIKELY (frame_ctx_p->block_result == ECMA_VALUE_UNDEFINED))
           {
@@ -2308,7 +3257,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_GENERATOR_AWAIT:
+        VM_CASE (VM_OC_GENERATOR_AWAIT):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2324,7 +3273,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_EXT_RETURN:
+        VM_CASE (VM_OC_EXT_RETURN):
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
@@ -2338,7 +3287,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto error;
         }
-        case VM_OC_ASYNC_EXIT:
+        VM_CASE (VM_OC_ASYNC_EXIT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -2384,7 +3333,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->call_operation = VM_NO_EXEC_OP;
           return result;
         }
-        case VM_OC_STRING_CONCAT:
+        VM_CASE (VM_OC_STRING_CONCAT):
         {
           ecma_string_t *left_str_p = ecma_op_to_string (left_value);
 
@@ -2408,16 +3357,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_string_value (result_str_p);
           goto free_both_values;
         }
-        case VM_OC_GET_TEMPLATE_OBJECT:
+        VM_CASE (VM_OC_GET_TEMPLATE_OBJECT):
         {
           uint8_t tagged_idx = *byte_code_p++;
           ecma_collection_t *collection_p = ecma_compiled_code_get_tagged_template_collection (bytecode_header_p);
           JERRY_ASSERT (tagged_idx < collection_p->item_count);
 
           *stack_top_p++ = ecma_copy_value (collection_p->buffer_p[tagged_idx]);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PUSH_NEW_TARGET:
+        VM_CASE (VM_OC_PUSH_NEW_TARGET):
         {
           ecma_object_t *new_target_object = JERRY_CONTEXT (current_new_target);
           if (new_target_object == NULL)
@@ -2429,9 +3378,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_ref_object (new_target_object);
             *stack_top_p++ = ecma_make_object_value (new_target_object);
           }
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_REQUIRE_OBJECT_COERCIBLE:
+        VM_CASE (VM_OC_REQUIRE_OBJECT_COERCIBLE):
         {
           result = ecma_op_check_object_coercible (stack_top_p[-1]);
 
@@ -2439,9 +3388,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             goto error;
           }
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_ASSIGN_SUPER:
+        VM_CASE (VM_OC_ASSIGN_SUPER):
         {
           result = opfunc_assign_super_reference (&stack_top_p, frame_ctx_p, opcode_data);
 
@@ -2449,15 +3398,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             goto error;
           }
-          continue;
+          VM_DISPATCH_NEXT ();
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
-        case VM_OC_PUSH_ELISON:
+        VM_CASE (VM_OC_PUSH_ELISON):
         {
           *stack_top_p++ = ECMA_VALUE_ARRAY_HOLE;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_APPEND_ARRAY:
+        VM_CASE (VM_OC_APPEND_ARRAY):
         {
           uint16_t values_length = *byte_code_p++;
           stack_top_p -= values_length;
@@ -2478,9 +3427,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 #else /* !ENABLED (JERRY_ESNEXT) */
           JERRY_ASSERT (ecma_is_value_empty (result));
 #endif /* ENABLED (JERRY_ESNEXT) */
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_IDENT_REFERENCE:
+        VM_CASE (VM_OC_IDENT_REFERENCE):
         {
           uint16_t literal_index;
 
@@ -2515,11 +3464,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             *stack_top_p++ = ecma_make_string_value (name_p);
             *stack_top_p++ = result;
           }
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PROP_GET:
+        VM_CASE (VM_OC_PROP_GET):
         {
-          result = vm_op_get_value (left_value, right_value);
+          result = vm_op_get_value (frame_ctx_p, byte_code_start_p, left_value, right_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2529,7 +3478,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_PROP_REFERENCE:
+        VM_CASE (VM_OC_PROP_REFERENCE):
         {
           /* Forms with reference requires preserving the base and offset. */
 
@@ -2553,12 +3502,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_PROP_PRE_INCR:
-        case VM_OC_PROP_PRE_DECR:
-        case VM_OC_PROP_POST_INCR:
-        case VM_OC_PROP_POST_DECR:
+        VM_CASE (VM_OC_PROP_PRE_INCR):
+        VM_CASE (VM_OC_PROP_PRE_DECR):
+        VM_CASE (VM_OC_PROP_POST_INCR):
+        VM_CASE (VM_OC_PROP_POST_DECR):
         {
-          result = vm_op_get_value (left_value,
+          result = vm_op_get_value (frame_ctx_p,
+                                    byte_code_start_p,
+                                    left_value,
                                     right_value);
 
           if (opcode < CBC_PRE_INCR)
@@ -2582,10 +3533,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           right_value = ECMA_VALUE_UNDEFINED;
           /* FALLTHRU */
         }
-        case VM_OC_PRE_INCR:
-        case VM_OC_PRE_DECR:
-        case VM_OC_POST_INCR:
-        case VM_OC_POST_DECR:
+        VM_CASE (VM_OC_PRE_INCR):
+        VM_CASE (VM_OC_PRE_DECR):
+        VM_CASE (VM_OC_POST_INCR):
+        VM_CASE (VM_OC_POST_DECR):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
 
@@ -2721,13 +3672,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_ASSIGN:
+        VM_CASE (VM_OC_ASSIGN):
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_MOV_IDENT:
+        VM_CASE (VM_OC_MOV_IDENT):
         {
           uint32_t literal_index;
 
@@ -2738,16 +3689,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           ecma_fast_free_value (VM_GET_REGISTER (frame_ctx_p, literal_index));
           VM_GET_REGISTER (frame_ctx_p, literal_index) = left_value;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_ASSIGN_PROP:
+        VM_CASE (VM_OC_ASSIGN_PROP):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_ASSIGN_PROP_THIS:
+        VM_CASE (VM_OC_ASSIGN_PROP_THIS):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = ecma_copy_value (frame_ctx_p->this_binding);
@@ -2755,7 +3706,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_RETURN:
+        VM_CASE (VM_OC_RETURN):
         {
           JERRY_ASSERT (opcode == CBC_RETURN
                         || opcode == CBC_RETURN_WITH_BLOCK
@@ -2771,7 +3722,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW:
+        VM_CASE (VM_OC_THROW):
         {
           jcontext_raise_exception (left_value);
 
@@ -2779,35 +3730,35 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW_REFERENCE_ERROR:
+        VM_CASE (VM_OC_THROW_REFERENCE_ERROR):
         {
           result = ecma_raise_reference_error (ECMA_ERR_MSG ("Undefined reference."));
           goto error;
         }
-        case VM_OC_EVAL:
+        VM_CASE (VM_OC_EVAL):
         {
           JERRY_CONTEXT (status_flags) |= ECMA_STATUS_DIRECT_EVAL;
           JERRY_ASSERT ((*byte_code_p >= CBC_CALL && *byte_code_p <= CBC_CALL2_PROP_BLOCK)
                         || (*byte_code_p == CBC_EXT_OPCODE
                             && byte_code_p[1] >= CBC_EXT_SPREAD_CALL
                             && byte_code_p[1] <= CBC_EXT_SPREAD_CALL_PROP_BLOCK));
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_CALL:
+        VM_CASE (VM_OC_CALL):
         {
           frame_ctx_p->call_operation = VM_EXEC_CALL;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_NEW:
+        VM_CASE (VM_OC_NEW):
         {
           frame_ctx_p->call_operation = VM_EXEC_CONSTRUCT;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_ERROR:
+        VM_CASE (VM_OC_ERROR):
         {
           JERRY_ASSERT (frame_ctx_p->byte_code_p[1] == CBC_EXT_ERROR);
 #if ENABLED (JERRY_DEBUGGER)
@@ -2817,7 +3768,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = ECMA_VALUE_ERROR;
           goto error;
         }
-        case VM_OC_RESOLVE_BASE_FOR_CALL:
+        VM_CASE (VM_OC_RESOLVE_BASE_FOR_CALL):
         {
           ecma_value_t this_value = stack_top_p[-3];
 
@@ -2833,9 +3784,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             stack_top_p[-3] = this_value;
           }
 
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_PROP_DELETE:
+        VM_CASE (VM_OC_PROP_DELETE):
         {
           result = vm_op_delete_prop (left_value, right_value, is_strict);
 
@@ -2849,7 +3800,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_DELETE:
+        VM_CASE (VM_OC_DELETE):
         {
           uint16_t literal_index;
 
@@ -2858,7 +3809,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           if (literal_index < register_end)
           {
             *stack_top_p++ = ECMA_VALUE_FALSE;
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           result = vm_op_delete_var (literal_start_p[literal_index],
@@ -2872,14 +3823,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (ecma_is_value_boolean (result));
 
           *stack_top_p++ = result;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_JUMP:
+        VM_CASE (VM_OC_JUMP):
         {
           byte_code_p = byte_code_start_p + branch_offset;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_BRANCH_IF_STRICT_EQUAL:
+        VM_CASE (VM_OC_BRANCH_IF_STRICT_EQUAL):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -2891,12 +3842,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_free_value (*--stack_top_p);
           }
           ecma_free_value (value);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_BRANCH_IF_TRUE:
-        case VM_OC_BRANCH_IF_FALSE:
-        case VM_OC_BRANCH_IF_LOGICAL_TRUE:
-        case VM_OC_BRANCH_IF_LOGICAL_FALSE:
+        VM_CASE (VM_OC_BRANCH_IF_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_FALSE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_FALSE):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_BRANCH_IF_TRUE;
           ecma_value_t value = *(--stack_top_p);
@@ -2915,29 +3866,29 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             {
               /* "Push" the value back to the stack. */
               ++stack_top_p;
-              continue;
+              VM_DISPATCH_NEXT ();
             }
           }
 
           ecma_fast_free_value (value);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
 #if ENABLED (JERRY_ESNEXT)
-        case VM_OC_BRANCH_IF_NULLISH:
+        VM_CASE (VM_OC_BRANCH_IF_NULLISH):
         {
           left_value = stack_top_p[-1];
 
           if (!ecma_is_value_null (left_value) && !ecma_is_value_undefined (left_value))
           {
             byte_code_p = byte_code_start_p + branch_offset;
-            continue;
+            VM_DISPATCH_NEXT ();
           }
           --stack_top_p;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
-        case VM_OC_PLUS:
-        case VM_OC_MINUS:
+        VM_CASE (VM_OC_PLUS):
+        VM_CASE (VM_OC_MINUS):
         {
           result = opfunc_unary_operation (left_value, VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_PLUS);
 
@@ -2949,20 +3900,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_NOT:
+        VM_CASE (VM_OC_NOT):
         {
           *stack_top_p++ = ecma_make_boolean_value (!ecma_op_to_boolean (left_value));
           JERRY_ASSERT (ecma_is_value_boolean (stack_top_p[-1]));
           goto free_left_value;
         }
-        case VM_OC_BIT_NOT:
+        VM_CASE (VM_OC_BIT_NOT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
 
           if (ecma_is_value_integer_number (left_value))
           {
-            *stack_top_p++ = (~left_value) & (ecma_value_t) (~ECMA_DIRECT_TYPE_MASK);
+            *stack_top_p++ = (~left_value) & ~((ecma_value_t) ECMA_DIRECT_TYPE_MASK);
             goto free_left_value;
           }
 
@@ -2978,12 +3929,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_VOID:
+        VM_CASE (VM_OC_VOID):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
           goto free_left_value;
         }
-        case VM_OC_TYPEOF_IDENT:
+        VM_CASE (VM_OC_TYPEOF_IDENT):
         {
           uint16_t literal_index;
 
@@ -3019,7 +3970,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_TYPEOF:
+        VM_CASE (VM_OC_TYPEOF):
         {
           result = opfunc_typeof (left_value);
 
@@ -3031,14 +3982,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_ADD:
+        VM_CASE (VM_OC_ADD):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
             *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer + right_integer));
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           if (ecma_is_value_float_number (left_value)
@@ -3049,7 +4000,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
             *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           if (ecma_is_value_float_number (right_value)
@@ -3059,7 +4010,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                                        ecma_get_float_from_value (right_value));
 
             *stack_top_p++ = ecma_update_float_number (right_value, new_value);
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           result = opfunc_addition (left_value, right_value);
@@ -3072,7 +4023,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_SUB:
+        VM_CASE (VM_OC_SUB):
         {
           JERRY_STATIC_ASSERT (ECMA_INTEGER_NUMBER_MAX * 2 <= INT32_MAX
                                && ECMA_INTEGER_NUMBER_MIN * 2 >= INT32_MIN,
@@ -3086,7 +4037,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
             *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer - right_integer));
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           if (ecma_is_value_float_number (left_value)
@@ -3097,7 +4048,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
             *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           if (ecma_is_value_float_number (right_value)
@@ -3107,7 +4058,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                                        ecma_get_float_from_value (right_value));
 
             *stack_top_p++ = ecma_update_float_number (right_value, new_value);
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           result = do_number_arithmetic (NUMBER_ARITHMETIC_SUBTRACTION,
@@ -3122,7 +4073,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_MUL:
+        VM_CASE (VM_OC_MUL):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
@@ -3144,12 +4095,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                 && right_value != 0)
             {
               *stack_top_p++ = ecma_integer_multiply (left_integer, right_integer);
-              continue;
+              VM_DISPATCH_NEXT ();
             }
 
             ecma_number_t multiply = (ecma_number_t) left_integer * (ecma_number_t) right_integer;
             *stack_top_p++ = ecma_make_number_value (multiply);
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           if (ecma_is_value_float_number (left_value)
@@ -3160,7 +4111,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
             *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           if (ecma_is_value_float_number (right_value)
@@ -3170,7 +4121,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                                        ecma_get_float_from_value (right_value));
 
             *stack_top_p++ = ecma_update_float_number (right_value, new_value);
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           result = do_number_arithmetic (NUMBER_ARITHMETIC_MULTIPLICATION,
@@ -3185,7 +4136,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_DIV:
+        VM_CASE (VM_OC_DIV):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
@@ -3202,7 +4153,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_MOD:
+        VM_CASE (VM_OC_MOD):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
@@ -3219,7 +4170,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               if (mod_result != 0 || left_integer >= 0)
               {
                 *stack_top_p++ = ecma_make_integer_value (mod_result);
-                continue;
+                VM_DISPATCH_NEXT ();
               }
             }
           }
@@ -3237,7 +4188,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           goto free_both_values;
         }
 #if ENABLED (JERRY_ESNEXT)
-        case VM_OC_EXP:
+        VM_CASE (VM_OC_EXP):
         {
           result = do_number_arithmetic (NUMBER_ARITHMETIC_EXPONENTIATION,
                                          left_value,
@@ -3252,7 +4203,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           goto free_both_values;
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
-        case VM_OC_EQUAL:
+        VM_CASE (VM_OC_EQUAL):
         {
           result = opfunc_equality (left_value, right_value);
 
@@ -3261,10 +4212,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          goto compare_result;
         }
-        case VM_OC_NOT_EQUAL:
+        VM_CASE (VM_OC_NOT_EQUAL):
         {
           result = opfunc_equality (left_value, right_value);
 
@@ -3273,28 +4223,24 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = ecma_invert_boolean_value (result);
-          goto free_both_values;
+          result = ecma_invert_boolean_value (result);
+          goto compare_result;
         }
-        case VM_OC_STRICT_EQUAL:
+        VM_CASE (VM_OC_STRICT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
           result = ecma_make_boolean_value (is_equal);
-
-          *stack_top_p++ = result;
-          goto free_both_values;
+          goto compare_result;
         }
-        case VM_OC_STRICT_NOT_EQUAL:
+        VM_CASE (VM_OC_STRICT_NOT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
           result = ecma_make_boolean_value (!is_equal);
-
-          *stack_top_p++ = result;
-          goto free_both_values;
+          goto compare_result;
         }
-        case VM_OC_BIT_OR:
+        VM_CASE (VM_OC_BIT_OR):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3302,7 +4248,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             *stack_top_p++ = left_value | right_value;
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_OR,
@@ -3317,15 +4263,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_XOR:
+        VM_CASE (VM_OC_BIT_XOR):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
 
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
-            *stack_top_p++ = (left_value ^ right_value) & (ecma_value_t) (~ECMA_DIRECT_TYPE_MASK);
-            continue;
+            *stack_top_p++ = (left_value ^ right_value) & ~((ecma_value_t) ECMA_DIRECT_TYPE_MASK);
+            VM_DISPATCH_NEXT ();
           }
 
           result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_XOR,
@@ -3340,7 +4286,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_AND:
+        VM_CASE (VM_OC_BIT_AND):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3348,7 +4294,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             *stack_top_p++ = left_value & right_value;
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_AND,
@@ -3363,7 +4309,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LEFT_SHIFT:
+        VM_CASE (VM_OC_LEFT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3373,7 +4319,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
             *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer << (right_integer & 0x1f)));
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_LEFT,
@@ -3388,7 +4334,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_RIGHT_SHIFT:
+        VM_CASE (VM_OC_RIGHT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3398,7 +4344,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
             *stack_top_p++ = ecma_make_integer_value (left_integer >> (right_integer & 0x1f));
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_RIGHT,
@@ -3413,7 +4359,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_UNS_RIGHT_SHIFT:
+        VM_CASE (VM_OC_UNS_RIGHT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3423,7 +4369,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             uint32_t left_uint32 = (uint32_t) ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
             *stack_top_p++ = ecma_make_uint32_value (left_uint32 >> (right_integer & 0x1f));
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_URIGHT,
@@ -3438,48 +4384,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LESS:
+        VM_CASE (VM_OC_LESS):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
-            bool is_less = (ecma_integer_value_t) left_value < (ecma_integer_value_t) right_value;
-#if !ENABLED (JERRY_VM_EXEC_STOP)
-            /* This is a lookahead to the next opcode to improve performance.
-             * If it is CBC_BRANCH_IF_TRUE_BACKWARD, execute it. */
-            if (*byte_code_p <= CBC_BRANCH_IF_TRUE_BACKWARD_3 && *byte_code_p >= CBC_BRANCH_IF_TRUE_BACKWARD)
-            {
-              byte_code_start_p = byte_code_p++;
-              branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (*byte_code_start_p);
-              JERRY_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);
-
-              if (is_less)
-              {
-                branch_offset = *(byte_code_p++);
-
-                if (JERRY_UNLIKELY (branch_offset_length != 1))
-                {
-                  branch_offset <<= 8;
-                  branch_offset |= *(byte_code_p++);
-                  if (JERRY_UNLIKELY (branch_offset_length == 3))
-                  {
-                    branch_offset <<= 8;
-                    branch_offset |= *(byte_code_p++);
-                  }
-                }
-
-                /* Note: The opcode is a backward branch. */
-                byte_code_p = byte_code_start_p - branch_offset;
-              }
-              else
-              {
-                byte_code_p += branch_offset_length;
-              }
+            ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
+            ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
 
-              continue;
-            }
-#endif /* !ENABLED (JERRY_VM_EXEC_STOP) */
-            *stack_top_p++ = ecma_make_boolean_value (is_less);
-            continue;
+            result = ecma_make_boolean_value (left_integer < right_integer);
+            goto compare_result;
           }
 
           if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
@@ -3487,8 +4400,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t left_number = ecma_get_number_from_value (left_value);
             ecma_number_t right_number = ecma_get_number_from_value (right_value);
 
-            *stack_top_p++ = ecma_make_boolean_value (left_number < right_number);
-            goto free_both_values;
+            result = ecma_make_boolean_value (left_number < right_number);
+            goto compare_result;
           }
 
           result = opfunc_relation (left_value, right_value, true, false);
@@ -3498,18 +4411,17 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          goto compare_result;
         }
-        case VM_OC_GREATER:
+        VM_CASE (VM_OC_GREATER):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
             ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
 
-            *stack_top_p++ = ecma_make_boolean_value (left_integer > right_integer);
-            continue;
+            result = ecma_make_boolean_value (left_integer > right_integer);
+            goto compare_result;
           }
 
           if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
@@ -3517,8 +4429,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t left_number = ecma_get_number_from_value (left_value);
             ecma_number_t right_number = ecma_get_number_from_value (right_value);
 
-            *stack_top_p++ = ecma_make_boolean_value (left_number > right_number);
-            goto free_both_values;
+            result = ecma_make_boolean_value (left_number > right_number);
+            goto compare_result;
           }
 
           result = opfunc_relation (left_value, right_value, false, false);
@@ -3528,18 +4440,17 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          goto compare_result;
         }
-        case VM_OC_LESS_EQUAL:
+        VM_CASE (VM_OC_LESS_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
             ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
 
-            *stack_top_p++ = ecma_make_boolean_value (left_integer <= right_integer);
-            continue;
+            result = ecma_make_boolean_value (left_integer <= right_integer);
+            goto compare_result;
           }
 
           if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
@@ -3547,8 +4458,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t left_number = ecma_get_number_from_value (left_value);
             ecma_number_t right_number = ecma_get_number_from_value (right_value);
 
-            *stack_top_p++ = ecma_make_boolean_value (left_number <= right_number);
-            goto free_both_values;
+            result = ecma_make_boolean_value (left_number <= right_number);
+            goto compare_result;
           }
 
           result = opfunc_relation (left_value, right_value, false, true);
@@ -3558,18 +4469,17 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          goto compare_result;
         }
-        case VM_OC_GREATER_EQUAL:
+        VM_CASE (VM_OC_GREATER_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
             ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
 
-            *stack_top_p++ = ecma_make_boolean_value (left_integer >= right_integer);
-            continue;
+            result = ecma_make_boolean_value (left_integer >= right_integer);
+            goto compare_result;
           }
 
           if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
@@ -3577,8 +4487,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t left_number = ecma_get_number_from_value (left_value);
             ecma_number_t right_number = ecma_get_number_from_value (right_value);
 
-            *stack_top_p++ = ecma_make_boolean_value (left_number >= right_number);
-            goto free_both_values;
+            result = ecma_make_boolean_value (left_number >= right_number);
+            goto compare_result;
           }
 
           result = opfunc_relation (left_value, right_value, true, true);
@@ -3588,10 +4498,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          goto compare_result;
         }
-        case VM_OC_IN:
+        VM_CASE (VM_OC_IN):
         {
           result = opfunc_in (left_value, right_value);
 
@@ -3603,7 +4512,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_INSTANCEOF:
+        VM_CASE (VM_OC_INSTANCEOF):
         {
           result = opfunc_instanceof (left_value, right_value);
 
@@ -3615,7 +4524,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BLOCK_CREATE_CONTEXT:
+        VM_CASE (VM_OC_BLOCK_CREATE_CONTEXT):
         {
 #if ENABLED (JERRY_ESNEXT)
           ecma_value_t *stack_context_top_p;
@@ -3662,9 +4571,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->lex_env_p = ecma_create_decl_lex_env (frame_ctx_p->lex_env_p);
           frame_ctx_p->lex_env_p->type_flags_refs |= (uint16_t) ECMA_OBJECT_FLAG_BLOCK;
 
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_WITH:
+        VM_CASE (VM_OC_WITH):
         {
           ecma_value_t value = *(--stack_top_p);
           ecma_object_t *object_p;
@@ -3696,9 +4605,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           with_env_p->type_flags_refs |= (uint16_t) ECMA_OBJECT_FLAG_BLOCK;
           frame_ctx_p->lex_env_p = with_env_p;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_FOR_IN_INIT:
+        VM_CASE (VM_OC_FOR_IN_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -3727,7 +4636,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             /* The collection is already released */
             byte_code_p = byte_code_start_p + branch_offset;
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
@@ -3746,9 +4655,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             byte_code_p += 2;
           }
 #endif /* ENABLED (JERRY_ESNEXT) */
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_FOR_IN_GET_NEXT:
+        VM_CASE (VM_OC_FOR_IN_GET_NEXT):
         {
           ecma_value_t *context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
 
@@ -3757,14 +4666,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_IN);
 
-          uint32_t index = context_top_p[-3];
+          uint32_t index = (uint32_t) context_top_p[-3];
           ecma_value_t *buffer_p = collection_p->buffer_p;
 
           *stack_top_p++ = buffer_p[index];
           context_top_p[-3]++;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_FOR_IN_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_IN_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -3775,7 +4684,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           ecma_value_t *buffer_p = collection_p->buffer_p;
           ecma_object_t *object_p = ecma_get_object_from_value (stack_top_p[-4]);
-          uint32_t index = stack_top_p[-3];
+          uint32_t index = (uint32_t) stack_top_p[-3];
 #if ENABLED (JERRY_BUILTIN_PROXY)
           JERRY_ASSERT (!ECMA_OBJECT_IS_PROXY (object_p));
 #endif /* ENABLED (JERRY_BUILTIN_PROXY) */
@@ -3807,10 +4716,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             stack_top_p[-3] = index;
           }
-          continue;
+          VM_DISPATCH_NEXT ();
         }
 #if ENABLED (JERRY_ESNEXT)
-        case VM_OC_FOR_OF_INIT:
+        VM_CASE (VM_OC_FOR_OF_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -3841,7 +4750,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_free_value (iterator);
             ecma_free_value (next_method);
             byte_code_p = byte_code_start_p + branch_offset;
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           ecma_value_t next_value = ecma_op_iterator_value (result);
@@ -3869,9 +4778,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             /* No need to duplicate the first context. */
             byte_code_p += 2;
           }
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_FOR_OF_GET_NEXT:
+        VM_CASE (VM_OC_FOR_OF_GET_NEXT):
         {
           ecma_value_t *context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_OF
@@ -3880,9 +4789,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           *stack_top_p++ = context_top_p[-2];
           context_top_p[-2] = ECMA_VALUE_UNDEFINED;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_FOR_OF_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_OF_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (stack_top_p[-1]) == VM_CONTEXT_FOR_OF);
@@ -3903,7 +4812,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_free_value (stack_top_p[-4]);
             VM_MINUS_EQUAL_U16 (frame_ctx_p->context_depth, PARSER_FOR_OF_CONTEXT_STACK_ALLOCATION);
             stack_top_p -= PARSER_FOR_OF_CONTEXT_STACK_ALLOCATION;
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           ecma_value_t next_value = ecma_op_iterator_value (result);
@@ -3919,9 +4828,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-1] |= VM_CONTEXT_CLOSE_ITERATOR;
           stack_top_p[-2] = next_value;
           byte_code_p = byte_code_start_p + branch_offset;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_FOR_AWAIT_OF_INIT:
+        VM_CASE (VM_OC_FOR_AWAIT_OF_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -3992,7 +4901,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           return result;
         }
-        case VM_OC_FOR_AWAIT_OF_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_AWAIT_OF_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (stack_top_p[-1]) == VM_CONTEXT_FOR_AWAIT_OF);
@@ -4024,7 +4933,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           return ECMA_VALUE_UNDEFINED;
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
-        case VM_OC_TRY:
+        VM_CASE (VM_OC_TRY):
         {
           /* Try opcode simply creates the try context. */
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
@@ -4035,18 +4944,18 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p += PARSER_TRY_CONTEXT_STACK_ALLOCATION;
 
           stack_top_p[-1] = VM_CREATE_CONTEXT (VM_CONTEXT_TRY, branch_offset);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_CATCH:
+        VM_CASE (VM_OC_CATCH):
         {
           /* Catches are ignored and turned to jumps. */
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (stack_top_p[-1]) == VM_CONTEXT_TRY);
 
           byte_code_p = byte_code_start_p + branch_offset;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_FINALLY:
+        VM_CASE (VM_OC_FINALLY):
         {
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
 
@@ -4068,9 +4977,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           stack_top_p[-1] = VM_CREATE_CONTEXT (VM_CONTEXT_FINALLY_JUMP, branch_offset);
           stack_top_p[-2] = (ecma_value_t) branch_offset;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_CONTEXT_END:
+        VM_CASE (VM_OC_CONTEXT_END):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (!(stack_top_p[-1] & VM_CONTEXT_CLOSE_ITERATOR));
@@ -4082,7 +4991,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             stack_top_p = vm_stack_context_abort (frame_ctx_p, stack_top_p);
 
             JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
 #if ENABLED (JERRY_ESNEXT)
@@ -4118,7 +5027,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           JERRY_ASSERT (context_type == VM_CONTEXT_FINALLY_JUMP);
 
-          uint32_t jump_target = *stack_top_p;
+          uint32_t jump_target = (uint32_t) *stack_top_p;
 
           vm_stack_found_type type = vm_stack_find_finally (frame_ctx_p,
                                                             stack_top_p,
@@ -4157,9 +5066,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_JUMP_AND_EXIT_CONTEXT:
+        VM_CASE (VM_OC_JUMP_AND_EXIT_CONTEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (!jcontext_has_pending_exception ());
@@ -4203,14 +5112,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
-          continue;
+          VM_DISPATCH_NEXT ();
         }
 #if ENABLED (JERRY_DEBUGGER)
-        case VM_OC_BREAKPOINT_ENABLED:
+        VM_CASE (VM_OC_BREAKPOINT_ENABLED):
         {
           if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_IGNORE)
           {
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           JERRY_ASSERT (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED);
@@ -4225,13 +5134,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             result = ECMA_VALUE_ERROR;
             goto error;
           }
-          continue;
+          VM_DISPATCH_NEXT ();
         }
-        case VM_OC_BREAKPOINT_DISABLED:
+        VM_CASE (VM_OC_BREAKPOINT_DISABLED):
         {
           if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_IGNORE)
           {
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           JERRY_ASSERT (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED);
@@ -4250,20 +5159,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               result = ECMA_VALUE_ERROR;
               goto error;
             }
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           if (JERRY_CONTEXT (debugger_message_delay) > 0)
           {
             JERRY_CONTEXT (debugger_message_delay)--;
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           JERRY_CONTEXT (debugger_message_delay) = JERRY_DEBUGGER_MESSAGE_FREQUENCY;
 
           if (jerry_debugger_receive (NULL))
           {
-            continue;
+            VM_DISPATCH_NEXT ();
           }
 
           if ((JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_STOP)
@@ -4277,11 +5186,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               goto error;
             }
           }
-          continue;
+          VM_DISPATCH_NEXT ();
         }
 #endif /* ENABLED (JERRY_DEBUGGER) */
 #if ENABLED (JERRY_LINE_INFO)
-        case VM_OC_LINE:
+        VM_CASE (VM_OC_LINE):
         {
           uint32_t value = 0;
           uint8_t byte;
@@ -4294,10 +5203,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           while (byte & CBC_HIGHEST_BIT_MASK);
 
           frame_ctx_p->current_line = value;
-          continue;
+          VM_DISPATCH_NEXT ();
         }
 #endif /* ENABLED (JERRY_LINE_INFO) */
-        case VM_OC_NONE:
+        VM_CASE (VM_OC_NONE):
         default:
         {
           JERRY_ASSERT (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_NONE);
@@ -4365,7 +5274,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         else
         {
-          ecma_value_t set_value_result = vm_op_set_value (base,
+          ecma_value_t set_value_result = vm_op_set_value (frame_ctx_p,
+                                                           byte_code_start_p,
+                                                           base,
                                                            property,
                                                            result,
                                                            is_strict);
@@ -4399,6 +5310,89 @@ free_both_values:
       ecma_fast_free_value (right_value);
 free_left_value:
       ecma_fast_free_value (left_value);
+      VM_DISPATCH_NEXT ();
+
+compare_result:
+      JERRY_ASSERT (ecma_is_value_boolean (result));
+
+#if !ENABLED (JERRY_VM_EXEC_STOP)
+      /* Comparisons are mostly followed by a conditional branch (if statements,
+       * loop conditions), so the branch is executed together with the comparison
+       * without pushing the result onto the stack. */
+      opcode_data = vm_decode_table[*byte_code_p];
+
+      if (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_BRANCH_IF_TRUE
+          || VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_BRANCH_IF_FALSE)
+      {
+        bool is_taken = ecma_is_value_true (result);
+
+        if (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_BRANCH_IF_FALSE)
+        {
+          is_taken = !is_taken;
+        }
+
+        byte_code_start_p = byte_code_p++;
+        branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (*byte_code_start_p);
+        JERRY_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);
+
+        if (!is_taken)
+        {
+          byte_code_p += branch_offset_length;
+          goto free_both_values;
+        }
+
+        branch_offset = *(byte_code_p++);
+
+        if (JERRY_UNLIKELY (branch_offset_length != 1))
+        {
+          branch_offset <<= 8;
+          branch_offset |= *(byte_code_p++);
+
+          if (JERRY_UNLIKELY (branch_offset_length == 3))
+          {
+            branch_offset <<= 8;
+            branch_offset |= *(byte_code_p++);
+          }
+        }
+
+        if (opcode_data & VM_OC_BACKWARD_BRANCH)
+        {
+#if ENABLED (JERRY_VM_INTERRUPT)
+          if (JERRY_UNLIKELY (JERRY_CONTEXT (vm_interrupt_pending) != 0))
+          {
+            result = vm_handle_interrupt ();
+
+            if (ECMA_IS_VALUE_ERROR (result))
+            {
+              goto error;
+            }
+          }
+#endif /* ENABLED (JERRY_VM_INTERRUPT) */
+
+          byte_code_p = byte_code_start_p - branch_offset;
+
+#if ENABLED (JERRY_JIT)
+          jit_entry_p = vm_jit_tick (frame_ctx_p, jit_counter_p, byte_code_p);
+
+          if (jit_entry_p != NULL)
+          {
+            ecma_fast_free_value (right_value);
+            ecma_fast_free_value (left_value);
+            goto jit_enter;
+          }
+#endif /* ENABLED (JERRY_JIT) */
+        }
+        else
+        {
+          byte_code_p = byte_code_start_p + branch_offset;
+        }
+
+        goto free_both_values;
+      }
+#endif /* !ENABLED (JERRY_VM_EXEC_STOP) */
+
+      *stack_top_p++ = result;
+      goto free_both_values;
     }
 
 error:
@@ -4590,11 +5584,16 @@ vm_init_exec (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
 {
   frame_ctx_p->prev_context_p = JERRY_CONTEXT (vm_top_context_p);
   frame_ctx_p->block_result = ECMA_VALUE_UNDEFINED;
+#if ENABLED (JERRY_INLINE_CACHE)
+  frame_ctx_p->inline_cache_p = NULL;
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
 #if ENABLED (JERRY_LINE_INFO)
   frame_ctx_p->current_line = 0;
 #endif /* ENABLED (JERRY_LINE_INFO) */
   frame_ctx_p->context_depth = 0;
   frame_ctx_p->is_eval_code = (arg_p == VM_DIRECT_EVAL);
+  frame_ctx_p->arg_list_p = arg_p;
+  frame_ctx_p->arg_list_len = arg_list_len;
 
   const ecma_compiled_code_t *bytecode_header_p = frame_ctx_p->bytecode_header_p;
   uint16_t argument_end, register_end;
@@ -4765,6 +5764,15 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
   vm_frame_ctx_t *frame_ctx_p;
   size_t frame_size;
 
+#if ENABLED (JERRY_VM_INTERRUPT)
+  /* Function entry is a safe point: nothing is allocated for the frame yet. */
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (vm_interrupt_pending) != 0)
+      && ECMA_IS_VALUE_ERROR (vm_handle_interrupt ()))
+  {
+    return ECMA_VALUE_ERROR;
+  }
+#endif /* ENABLED (JERRY_VM_INTERRUPT) */
+
   if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
   {
     cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
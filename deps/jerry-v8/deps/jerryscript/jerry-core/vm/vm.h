@@ -227,6 +227,8 @@ typedef enum
                                   *   functions with separate argument context */
 #endif /* ENABLED (JERRY_ESNEXT) */
   VM_OC_INIT_ARG_OR_FUNC,        /**< create and init a function or argument binding */
+  VM_OC_CREATE_ARGUMENTS,        /**< create the arguments object stored in a register */
+  VM_OC_PUSH_ARGUMENTS,          /**< push the length or an element of the arguments object */
 
 #if ENABLED (JERRY_DEBUGGER)
   VM_OC_BREAKPOINT_ENABLED,      /**< enabled breakpoint for debugger */
@@ -466,6 +468,33 @@ bool vm_is_direct_eval_form_call (void);
 
 ecma_value_t vm_get_backtrace (uint32_t max_depth);
 
+#if ENABLED (JERRY_LINE_INFO)
+
+/**
+ * Frame of a captured backtrace.
+ */
+typedef struct
+{
+  const ecma_compiled_code_t *bytecode_header_p; /**< byte code of the frame */
+  uint32_t line; /**< currently executed line of the frame */
+} vm_backtrace_frame_t;
+
+/**
+ * Backtrace captured when an error is created, which is
+ * converted to position strings when it is first read.
+ */
+typedef struct
+{
+  uint32_t frame_count; /**< number of frames */
+  vm_backtrace_frame_t frames[]; /**< frames */
+} vm_backtrace_t;
+
+vm_backtrace_t *vm_capture_backtrace (void);
+ecma_value_t vm_backtrace_to_array (const vm_backtrace_t *backtrace_p);
+void vm_free_backtrace (vm_backtrace_t *backtrace_p);
+
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
 /**
  * @}
  * @}
@@ -0,0 +1,214 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+
+#if defined (JERRY_JIT) && (JERRY_JIT == 1)
+
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/**
+ * Size of the arenas which hold the machine code of the compiled functions.
+ *
+ * Each compiled function would need at least a page and a separate memory
+ * mapping if it was mapped on its own. The code of many functions is packed
+ * into one arena instead, and only the pages of the code which is being
+ * written are switched back to writable.
+ */
+#define JERRY_PORT_JIT_ARENA_SIZE (256 * 1024)
+
+/**
+ * Alignment of the code allocated from an arena.
+ */
+#define JERRY_PORT_JIT_ALIGNMENT 16
+
+/**
+ * Descriptor of an arena. The descriptors are not stored in the arenas,
+ * because the pages of an arena are not writable most of the time.
+ */
+typedef struct jerry_port_jit_arena_t
+{
+  struct jerry_port_jit_arena_t *next_p; /**< next arena */
+  uint8_t *start_p; /**< start of the mapped memory */
+  size_t size; /**< size of the mapped memory */
+  size_t used; /**< size of the allocated part of the arena */
+  size_t live; /**< total size of the allocations which are not freed yet */
+} jerry_port_jit_arena_t;
+
+/**
+ * List of the arenas. The first arena is the current one, and new code is
+ * only allocated from it.
+ *
+ * Note:
+ *      like the rest of the default port, this is not thread safe
+ */
+static jerry_port_jit_arena_t *jerry_port_jit_arenas_p = NULL;
+
+/**
+ * Change the protection of the pages which hold a memory block.
+ *
+ * @return true - if successful,
+ *         false - otherwise
+ */
+static bool
+jerry_port_jit_protect (void *code_p, /**< start of the memory block */
+                        size_t size, /**< size of the memory block */
+                        int protection) /**< new protection of the pages */
+{
+  uintptr_t page_size = (uintptr_t) sysconf (_SC_PAGESIZE);
+  uintptr_t start = (uintptr_t) code_p & ~(page_size - 1);
+  uintptr_t end = ((uintptr_t) code_p + size + page_size - 1) & ~(page_size - 1);
+
+  return mprotect ((void *) start, (size_t) (end - start), protection) == 0;
+} /* jerry_port_jit_protect */
+
+/**
+ * Unmap an arena which has no allocations left.
+ */
+static void
+jerry_port_jit_free_arena (jerry_port_jit_arena_t *arena_p) /**< arena */
+{
+  jerry_port_jit_arena_t **prev_p = &jerry_port_jit_arenas_p;
+
+  while (*prev_p != arena_p)
+  {
+    prev_p = &(*prev_p)->next_p;
+  }
+
+  *prev_p = arena_p->next_p;
+  munmap (arena_p->start_p, arena_p->size);
+  free (arena_p);
+} /* jerry_port_jit_free_arena */
+
+/**
+ * Default implementation of jerry_port_jit_alloc. Allocates the memory from
+ * the current arena, or maps a new arena when it does not fit. The pages of
+ * the allocated memory are writable but not executable.
+ *
+ * @return pointer to the allocated memory - if successful,
+ *         NULL - otherwise
+ */
+void *
+jerry_port_jit_alloc (size_t size) /**< size of the memory */
+{
+  jerry_port_jit_arena_t *arena_p = jerry_port_jit_arenas_p;
+  size = (size + JERRY_PORT_JIT_ALIGNMENT - 1) & ~(size_t) (JERRY_PORT_JIT_ALIGNMENT - 1);
+
+  if (arena_p == NULL || arena_p->size - arena_p->used < size)
+  {
+    size_t page_size = (size_t) sysconf (_SC_PAGESIZE);
+    size_t arena_size = JERRY_PORT_JIT_ARENA_SIZE;
+
+    if (size > arena_size)
+    {
+      arena_size = (size + page_size - 1) & ~(page_size - 1);
+    }
+
+    jerry_port_jit_arena_t *new_arena_p = (jerry_port_jit_arena_t *) malloc (sizeof (jerry_port_jit_arena_t));
+
+    if (new_arena_p == NULL)
+    {
+      return NULL;
+    }
+
+    void *start_p = mmap (NULL, arena_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (start_p == MAP_FAILED)
+    {
+      free (new_arena_p);
+      return NULL;
+    }
+
+    new_arena_p->next_p = arena_p;
+    new_arena_p->start_p = (uint8_t *) start_p;
+    new_arena_p->size = arena_size;
+    new_arena_p->used = 0;
+    new_arena_p->live = 0;
+    jerry_port_jit_arenas_p = new_arena_p;
+
+    /* The previous arena is released when its last allocation is freed. */
+    if (arena_p != NULL && arena_p->live == 0)
+    {
+      jerry_port_jit_free_arena (arena_p);
+    }
+
+    arena_p = new_arena_p;
+  }
+
+  uint8_t *code_p = arena_p->start_p + arena_p->used;
+
+  /* The first page may hold the end of the previously allocated code. */
+  if (arena_p->used > 0 && !jerry_port_jit_protect (code_p, size, PROT_READ | PROT_WRITE))
+  {
+    return NULL;
+  }
+
+  arena_p->used += size;
+  arena_p->live += size;
+  return code_p;
+} /* jerry_port_jit_alloc */
+
+/**
+ * Default implementation of jerry_port_jit_make_executable. The pages are
+ * never writable and executable at the same time.
+ *
+ * @return true - if the protection of the pages is changed,
+ *         false - otherwise
+ */
+bool
+jerry_port_jit_make_executable (void *code_p, /**< memory returned by jerry_port_jit_alloc */
+                                size_t size) /**< size of the memory */
+{
+  return jerry_port_jit_protect (code_p, size, PROT_READ | PROT_EXEC);
+} /* jerry_port_jit_make_executable */
+
+/**
+ * Default implementation of jerry_port_jit_free. The space of the freed code
+ * is not reused, but an arena is unmapped once all of its code is freed.
+ */
+void
+jerry_port_jit_free (void *code_p, /**< memory returned by jerry_port_jit_alloc */
+                     size_t size) /**< size of the memory */
+{
+  jerry_port_jit_arena_t *arena_p = jerry_port_jit_arenas_p;
+  size = (size + JERRY_PORT_JIT_ALIGNMENT - 1) & ~(size_t) (JERRY_PORT_JIT_ALIGNMENT - 1);
+
+  while ((uint8_t *) code_p < arena_p->start_p || (uint8_t *) code_p >= arena_p->start_p + arena_p->size)
+  {
+    arena_p = arena_p->next_p;
+  }
+
+  arena_p->live -= size;
+
+  if (arena_p->live > 0)
+  {
+    return;
+  }
+
+  if (arena_p == jerry_port_jit_arenas_p)
+  {
+    /* The current arena is reused from its start. */
+    arena_p->used = 0;
+    jerry_port_jit_protect (arena_p->start_p, arena_p->size, PROT_READ | PROT_WRITE);
+    return;
+  }
+
+  jerry_port_jit_free_arena (arena_p);
+} /* jerry_port_jit_free */
+
+#endif /* defined (JERRY_JIT) && (JERRY_JIT == 1) */
@@ -0,0 +1,180 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+"use strict";
+
+function length_and_elements (a, b)
+{
+  assert (arguments.length === 3);
+  assert (arguments[0] === 1);
+  assert (arguments[1] === "x");
+  assert (arguments[2] === a);
+  assert (arguments[3] === undefined);
+  assert (arguments[-1] === undefined);
+  assert (arguments["length"] === 3);
+  assert (arguments[b] === undefined);
+
+  var sum = 0;
+  for (var i = 0; i < arguments.length; i++)
+  {
+    sum += typeof arguments[i] === "number" ? arguments[i] : 0;
+  }
+  return sum;
+}
+
+assert (length_and_elements (1, "x", 1) === 2);
+
+function no_arguments ()
+{
+  return arguments.length + ":" + arguments[0];
+}
+
+assert (no_arguments () === "0:undefined");
+
+/* The arguments object is created when it is used as an object. */
+function escape ()
+{
+  var len = arguments.length;
+  var args = arguments;
+
+  assert (args === arguments);
+  assert (Object.prototype.toString.call (args) === "[object Arguments]");
+  args[0] = "changed";
+  assert (arguments[0] === "changed");
+  args.length = 10;
+  assert (arguments.length === 10);
+  return len;
+}
+
+assert (escape (1, 2) === 2);
+
+function unmapped (a)
+{
+  a = 5;
+  assert (arguments[0] === 1);
+  arguments[0] = 6;
+  assert (a === 5);
+  return arguments[0];
+}
+
+assert (unmapped (1) === 6);
+
+function delete_element ()
+{
+  assert (arguments[1] === 2);
+  delete arguments[1];
+  assert (arguments[1] === undefined);
+  assert (arguments.length === 2);
+}
+
+delete_element (1, 2);
+
+function callee ()
+{
+  try
+  {
+    arguments.callee;
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof TypeError);
+  }
+}
+
+callee ();
+
+/* Elements which are not present are looked up in the prototype chain. */
+Object.prototype[4] = "proto";
+
+function prototype_element ()
+{
+  return arguments[4];
+}
+
+assert (prototype_element () === "proto");
+assert (prototype_element (1, 2, 3, 4, 5) === 5);
+delete Object.prototype[4];
+
+function pass_arguments ()
+{
+  return Array.prototype.slice.call (arguments, 1).join ();
+}
+
+assert (pass_arguments (1, 2, 3) === "2,3");
+assert (pass_arguments.apply (null, [4, 5, 6]) === "5,6");
+
+function emit (type)
+{
+  var handler = this[type];
+  var len = arguments.length;
+
+  switch (len)
+  {
+    case 1:
+      return handler.call (this);
+    case 2:
+      return handler.call (this, arguments[1]);
+    case 3:
+      return handler.call (this, arguments[1], arguments[2]);
+    default:
+      var args = new Array (len - 1);
+      for (var i = 1; i < len; i++)
+      {
+        args[i - 1] = arguments[i];
+      }
+      return handler.apply (this, args);
+  }
+}
+
+var emitter = {
+  join: function () { return Array.prototype.join.call (arguments, "+"); },
+  emit: emit
+};
+
+assert (emitter.emit ("join") === "");
+assert (emitter.emit ("join", 1) === "1");
+assert (emitter.emit ("join", 1, 2) === "1+2");
+assert (emitter.emit ("join", 1, 2, 3, 4) === "1+2+3+4");
+
+function with_eval ()
+{
+  return eval ("arguments.length") + arguments[0];
+}
+
+assert (with_eval (1, 2) === 3);
+
+function inner_function ()
+{
+  function inner ()
+  {
+    return arguments.length;
+  }
+
+  return inner (1, 2, 3) + arguments.length;
+}
+
+assert (inner_function (1) === 4);
+
+function element_references (a)
+{
+  arguments[0]++;
+  arguments[1] += 2;
+  for (arguments[2] in { key: 1 }) {}
+  assert (arguments[3] () === arguments);
+  assert (a === 1);
+  return arguments[0] + ":" + arguments[1] + ":" + arguments[2];
+}
+
+assert (element_references (1, 2, 3, function () { return this; }) === "2:4:key");
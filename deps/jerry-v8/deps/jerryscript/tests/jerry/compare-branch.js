@@ -0,0 +1,105 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Comparisons followed by conditional branches. */
+function branches (a, b) {
+  var result = "";
+
+  if (a < b) { result += "<"; }
+  if (a > b) { result += ">"; }
+  if (a <= b) { result += "L"; }
+  if (a >= b) { result += "G"; }
+  if (a == b) { result += "="; }
+  if (a != b) { result += "!"; }
+  if (a === b) { result += "S"; }
+  if (a !== b) { result += "N"; }
+  if (!(a < b)) { result += "n"; }
+
+  return result;
+}
+
+assert (branches (1, 2) === "<L!N");
+assert (branches (2, 1) === ">G!Nn");
+assert (branches (2, 2) === "LG=Sn");
+assert (branches (1.5, 2.5) === "<L!N");
+assert (branches ("a", "b") === "<L!N");
+assert (branches (1, "1") === "LG=Nn");
+assert (branches (NaN, NaN) === "!Nn");
+assert (branches (NaN, 1) === "!Nn");
+assert (branches (null, undefined) === "=Nn");
+
+/* Loop conditions with every comparison. */
+var count = 0;
+for (var i = 0; i < 10; i++) { count++; }
+for (var i = 10; i > 0; i--) { count++; }
+for (var i = 0; i <= 10; i++) { count++; }
+for (var i = 10; i >= 0; i--) { count++; }
+for (var i = 0; i !== 10; i++) { count++; }
+for (var i = 0.5; i < 10; i++) { count++; }
+assert (count === 62);
+
+var list = [1, 2, 3, 4];
+var sum = 0;
+for (var i = 0; i < list.length; i++) {
+  if (!list[i]) { continue; }
+  if (list[i] === 3) { sum += 10; }
+  sum += list[i];
+}
+assert (sum === 20);
+
+var i = 0;
+while (!(i >= 5)) { i++; }
+assert (i === 5);
+
+i = 0;
+do { i++; } while (!(i === 7));
+assert (i === 7);
+
+/* Logical not folded into the branch. */
+var t = true;
+var f = false;
+assert ((!t ? 1 : 2) === 2);
+assert ((!f ? 1 : 2) === 1);
+if (!t) { assert (false); }
+if (!!t) { } else { assert (false); }
+if (!0 && !"") { } else { assert (false); }
+if (!f || t) { } else { assert (false); }
+
+/* The result is still pushed when it is not used by a branch. */
+var b1 = (1 < 2);
+var b2 = (2 <= 1) || (3 === 3);
+assert (b1 === true && b2 === true);
+
+/* Conversions of the operands may throw. */
+var thrower = { valueOf: function () { throw "valueOf"; } };
+
+try {
+  if (thrower < 1) { assert (false); }
+  assert (false);
+} catch (e) {
+  assert (e === "valueOf");
+}
+
+try {
+  for (var k = 0; k < thrower; k++) { assert (false); }
+  assert (false);
+} catch (e) {
+  assert (e === "valueOf");
+}
+
+/* Objects with side effects are evaluated once. */
+var calls = 0;
+var counter = { valueOf: function () { calls++; return 5; } };
+for (var k = 0; k < counter; k++) { }
+assert (k === 5 && calls === 6);
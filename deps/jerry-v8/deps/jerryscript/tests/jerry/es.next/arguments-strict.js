@@ -0,0 +1,74 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+"use strict";
+
+function arrow_capture ()
+{
+  var get = () => arguments[1];
+  assert (arguments.length === 2);
+  return get ();
+}
+
+assert (arrow_capture (1, 2) === 2);
+
+function default_parameter (a, b = arguments.length)
+{
+  return b + arguments[0];
+}
+
+assert (default_parameter (1) === 2);
+
+function rest_parameter (a, ...rest)
+{
+  assert (rest.length === arguments.length - 1);
+  return arguments[arguments.length - 1];
+}
+
+assert (rest_parameter (1, 2, 3) === 3);
+
+function destructuring ()
+{
+  [arguments[0], arguments[1]] = [arguments[1], arguments[0]];
+  return arguments[0] + ":" + arguments[1];
+}
+
+assert (destructuring ("a", "b") === "b:a");
+
+function spread ()
+{
+  return Math.max (...arguments) + arguments.length;
+}
+
+assert (spread (1, 5, 2) === 8);
+
+function* generator ()
+{
+  yield arguments.length;
+  yield arguments[0];
+}
+
+var iterator = generator (4);
+assert (iterator.next ().value === 1);
+assert (iterator.next ().value === 4);
+
+class Counter
+{
+  count ()
+  {
+    return arguments.length;
+  }
+}
+
+assert (new Counter ().count (1, 2) === 2);
@@ -0,0 +1,58 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var expr = "Outer value";
+
+/* The name is referenced by the argument list. */
+var f = function expr(a = expr) {
+  return a;
+}
+
+assert(f() === f);
+
+f = function expr(a = () => expr) {
+  return a();
+}
+
+assert(f() === f);
+
+f = function expr(a = eval("expr")) {
+  return a;
+}
+
+assert(f() === f);
+
+/* The name is referenced by an arrow function or a block. */
+f = function expr() {
+  return () => expr;
+}
+
+assert(f()() === f);
+
+f = function expr() {
+  {
+    let g = () => expr;
+    return g();
+  }
+}
+
+assert(f() === f);
+
+/* The name property is set even if the name is not referenced. */
+f = function expr() {
+  return 1;
+}
+
+assert(f.name === "expr");
+assert(f() === 1);
@@ -49,3 +49,45 @@ var f = function expr(i) {
 }
 
 f(10);
+
+/* The name is not referenced by the body. */
+var expr = "Outer value";
+
+f = function expr() {
+  return 5;
+}
+
+assert(f() === 5);
+
+/* The name is referenced only by nested functions. */
+f = function expr() {
+  return function () {
+    return function () {
+      return expr;
+    };
+  };
+}
+
+assert(f()()() === f);
+
+f = function expr() {
+  return function () {
+    return eval("expr");
+  };
+}
+
+assert(f()() === f);
+
+f = function expr() {
+  with ({}) {
+    return expr;
+  }
+}
+
+assert(f() === f);
+
+f = function expr() {
+  return (0, eval)("expr");
+}
+
+assert(f() === "Outer value");
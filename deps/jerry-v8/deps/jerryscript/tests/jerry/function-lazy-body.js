@@ -0,0 +1,72 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* These bodies are longer than the small function limit, so they are not compiled before the first call. */
+function loops (n) {
+  var padding = "0123456789012345678901234567890123456789012345678901234567890123456789";
+  var sum = 0;
+
+  for (var i = 0; i < n; i++) {
+    if (i === 1) continue;
+    if (i === 5) break;
+    sum += i;
+  }
+
+  while (true) { break; }
+  do { sum++; continue; } while (false);
+
+  for (var key in { a: 1, b: 2 }) {
+    switch (key) {
+      case "a": break;
+      default: sum += 10; continue;
+    }
+    sum += 100;
+  }
+
+  return sum;
+}
+
+assert (loops (10) === 120);
+
+function assignments (obj) {
+  var padding = "0123456789012345678901234567890123456789012345678901234567890123456789";
+  var x, y;
+
+  (x) = 1;
+  x += 2;
+  x++;
+  --x;
+  obj.a = x;
+  obj["b"] = obj.a * 2;
+  obj.c = obj.c || (y = 5);
+  delete obj.a;
+
+  for (x in obj) { y += obj[x]; }
+  obj = x;
+  x = y;
+  y = obj;
+
+  return x + ":" + y;
+}
+
+assert (assignments ({}) === "16:c");
+
+function expressions () {
+  var padding = "0123456789012345678901234567890123456789012345678901234567890123456789";
+  function inner () { return this; }
+
+  return inner () !== undefined && /a(b)/.test ("ab") && typeof (0, eval) === "function";
+}
+
+assert (expressions ());
@@ -0,0 +1,115 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/* The loops run long enough to be compiled by the baseline JIT compiler. */
+var iterations = 3000;
+
+/* Integer arithmetic leaving the integer range. */
+var value = 0;
+for (var i = 0; i < iterations; i++) {
+  value = value + 1000000;
+}
+assert (value === 3000000000);
+
+var product = 1;
+for (var i = 0; i < iterations; i++) {
+  product = (product * 3) | 0;
+}
+assert (product === 2132598113);
+
+var negative = 0;
+for (var i = 0; i < iterations; i++) {
+  negative -= i;
+}
+assert (negative === -4498500);
+
+/* Negative zero and floating point values. */
+var zero = 0;
+for (var i = 0; i < iterations; i++) {
+  zero = 0 * -1;
+}
+assert (1 / zero === -Infinity);
+
+var fraction = 0;
+for (var i = 0; i < iterations; i++) {
+  fraction += 0.5;
+}
+assert (fraction === 1500);
+
+/* Property accesses, strings and mixed types. */
+var object = { counter: 0, text: "" };
+for (var i = 0; i < iterations; i++) {
+  object.counter++;
+  if (i % 1000 === 0) {
+    object.text += "x";
+  }
+}
+assert (object.counter === iterations);
+assert (object.text === "xxx");
+
+/* Calls and constructs from compiled loops. */
+function add (a, b) {
+  return a + b;
+}
+
+function Point (x) {
+  this.x = x;
+}
+
+var sum = 0;
+for (var i = 0; i < iterations; i++) {
+  sum = add (sum, new Point (i).x);
+}
+assert (sum === 4498500);
+
+/* Exceptions thrown by the compiled code and by the called functions. */
+function thrower (i) {
+  if (i === iterations - 1) {
+    throw new Error ("last");
+  }
+  return i;
+}
+
+var caught = 0;
+for (var i = 0; i < iterations; i++) {
+  try {
+    thrower (i);
+    undefinedVariable;
+  } catch (e) {
+    caught++;
+  }
+}
+assert (caught === iterations);
+
+try {
+  for (var i = 0; i < iterations; i++) {
+    thrower (i);
+  }
+  assert (false);
+} catch (e) {
+  assert (e.message === "last");
+  assert (i === iterations - 1);
+}
+
+/* Generators resumed by compiled loops. */
+function* range (limit) {
+  for (var i = 0; i < limit; i++) {
+    yield i;
+  }
+}
+
+var total = 0;
+for (var item of range (iterations)) {
+  total += item;
+}
+assert (total === 4498500);
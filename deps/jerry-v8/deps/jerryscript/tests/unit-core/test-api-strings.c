@@ -292,6 +292,27 @@ main (void)
   TEST_ASSERT (sz == 3);
   TEST_ASSERT (!strncmp (supl_substring, "\xed\xa0\x80", sz));
 
+  /* Test jerry_get_string_buffer */
+  const jerry_char_t *buffer_p = jerry_get_string_buffer (args[0], &sz);
+  TEST_ASSERT (buffer_p != NULL);
+  TEST_ASSERT (sz == 11);
+  TEST_ASSERT (!strncmp ((const char *) buffer_p, "\x73\x74\x72\x3a \xed\xa0\x80\xed\xb6\x8a", sz));
+
+  jerry_release_value (args[0]);
+
+  static const char *external_p = "characters of an external string are not copied";
+  args[0] = jerry_create_external_string ((const jerry_char_t *) external_p, NULL);
+  TEST_ASSERT (jerry_get_string_buffer (args[0], &sz) == (const jerry_char_t *) external_p);
+  TEST_ASSERT (sz == strlen (external_p));
+  jerry_release_value (args[0]);
+
+  /* Strings of integer numbers have no buffer */
+  args[0] = jerry_create_string ((jerry_char_t *) "1234");
+  TEST_ASSERT (jerry_get_string_buffer (args[0], &sz) == NULL);
+  jerry_release_value (args[0]);
+
+  args[0] = jerry_create_number (5);
+  TEST_ASSERT (jerry_get_string_buffer (args[0], &sz) == NULL);
   jerry_release_value (args[0]);
 
   jerry_cleanup ();
@@ -244,6 +244,65 @@ test_large_line_count (void)
   jerry_cleanup ();
 } /* test_large_line_count */
 
+static void
+test_lazy_exception_backtrace (void)
+{
+  jerry_init (JERRY_INIT_EMPTY);
+
+  const char *source = ("function f() {\n"
+                        "  throw new Error ('f');\n"
+                        "}\n"
+                        "var e1, e2;\n"
+                        "try { f (); } catch (e) { e1 = e; }\n"
+                        "try { f (); } catch (e) { e2 = e; }\n"
+                        "var names = Object.getOwnPropertyNames (e2);\n"
+                        "var desc = Object.getOwnPropertyDescriptor (e2, 'stack');\n"
+                        "var e3 = new Error ('e3');\n"
+                        "e3.stack = 'custom';\n"
+                        "var e4 = new Error ('e4');\n"
+                        "delete e4.stack;\n"
+                        "names.length === 2 && names[0] === 'stack' && names[1] === 'message'\n"
+                        "&& !desc.enumerable && desc.writable && desc.configurable\n"
+                        "&& Array.isArray (desc.value) && desc.value.length === 2\n"
+                        "&& e3.stack === 'custom' && !('stack' in e4)\n"
+                        "&& Object.keys (e1).length === 0\n");
+
+  jerry_value_t result = run ("lazy.js", source);
+
+  TEST_ASSERT (jerry_value_is_boolean (result) && jerry_get_boolean_value (result));
+  jerry_release_value (result);
+
+  /* The backtrace keeps the byte code of its frames alive. */
+  jerry_gc (JERRY_GC_PRESSURE_HIGH);
+
+  jerry_value_t global = jerry_get_global_object ();
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "e1");
+  jerry_value_t error = jerry_get_property (global, name);
+
+  jerry_release_value (name);
+  jerry_release_value (global);
+
+  TEST_ASSERT (jerry_value_is_object (error));
+
+  name = jerry_create_string ((const jerry_char_t *) "stack");
+  jerry_value_t backtrace = jerry_get_property (error, name);
+
+  jerry_release_value (name);
+  jerry_release_value (error);
+
+  TEST_ASSERT (!jerry_value_is_error (backtrace)
+               && jerry_value_is_array (backtrace));
+
+  TEST_ASSERT (jerry_get_array_length (backtrace) == 2);
+
+  compare (backtrace, 0, "lazy.js:2");
+  compare (backtrace, 1, "lazy.js:5");
+
+  jerry_release_value (backtrace);
+
+  jerry_cleanup ();
+} /* test_lazy_exception_backtrace */
+
 int
 main (void)
 {
@@ -254,6 +313,7 @@ main (void)
   test_get_backtrace_api_call ();
   test_exception_backtrace ();
   test_large_line_count ();
+  test_lazy_exception_backtrace ();
 
   return 0;
 } /* main */
@@ -0,0 +1,123 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "test-common.h"
+
+static bool
+run_test (const jerry_char_t *source_p, /**< source code */
+          size_t source_size) /**< size of the source code */
+{
+  jerry_value_t result = jerry_eval (source_p, source_size, JERRY_PARSE_NO_OPTS);
+  bool is_true = jerry_value_is_boolean (result) && jerry_get_boolean_value (result);
+
+  jerry_release_value (result);
+  return is_true;
+} /* run_test */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* The results must be the same with and without hidden classes. */
+
+  /* Objects which share a shape keep their own values and key order. */
+  const jerry_char_t test_shared[] = TEST_STRING_LITERAL (
+    "function point (x, y) { return { x: x, y: y, tag: 'p' }; }"
+    "var points = [];"
+    "for (var i = 0; i < 100; i++) { points.push (point (i, -i)); }"
+    "var ok = true;"
+    "for (var i = 0; i < 100; i++) {"
+    "  var p = points[i];"
+    "  ok = ok && p.x === i && p.y === -i && p.tag === 'p';"
+    "  ok = ok && Object.keys (p).join () === 'x,y,tag';"
+    "  p.x = p.y;"
+    "  ok = ok && p.x === -i && p.hasOwnProperty ('x') && !p.hasOwnProperty ('z');"
+    "}"
+    "var q = { y: 1, x: 2 };"
+    "q[0] = 'a'; q.b = 'c';"
+    "ok = ok && Object.keys (q).join () === '0,y,x,b';"
+    "ok = ok && JSON.stringify (points[3]) === '{\"x\":-3,\"y\":-3,\"tag\":\"p\"}';"
+    "ok"
+  );
+
+  TEST_ASSERT (run_test (test_shared, sizeof (test_shared) - 1));
+
+  /* Objects leave their shape when a property is deleted or redefined. */
+  const jerry_char_t test_convert[] = TEST_STRING_LITERAL (
+    "var ok = true;"
+    "var a = { x: 1, y: 2, z: 3 };"
+    "var b = { x: 4, y: 5, z: 6 };"
+    "delete a.y;"
+    "ok = ok && Object.keys (a).join () === 'x,z' && a.y === undefined && a.z === 3;"
+    "ok = ok && Object.keys (b).join () === 'x,y,z' && b.y === 5;"
+    "Object.defineProperty (b, 'x', { enumerable: false });"
+    "ok = ok && Object.keys (b).join () === 'y,z' && b.x === 4;"
+    "var c = { x: 7, y: 8 };"
+    "Object.freeze (c);"
+    "c.x = 9; c.w = 10;"
+    "ok = ok && c.x === 7 && c.w === undefined && Object.isFrozen (c);"
+    "var d = { x: 1 };"
+    "Object.defineProperty (d, 'g', { get: function () { return this.x + 1; } });"
+    "d.x = 5;"
+    "ok = ok && d.g === 6;"
+    "var e = {};"
+    "for (var i = 0; i < 100; i++) { e['p' + i] = i; }"
+    "var sum = 0;"
+    "for (var k in e) { sum += e[k]; }"
+    "ok = ok && sum === 4950 && Object.keys (e).length === 100 && e.p99 === 99;"
+    "ok"
+  );
+
+  TEST_ASSERT (run_test (test_convert, sizeof (test_convert) - 1));
+
+  /* Setters on the prototype chain are not bypassed by the shapes. */
+  const jerry_char_t test_proto[] = TEST_STRING_LITERAL (
+    "var log = [];"
+    "var proto = { set v (value) { log.push (value); } };"
+    "var o = Object.create (proto);"
+    "o.w = 1;"
+    "o.v = 2;"
+    "var plain = { w: 1 };"
+    "plain.v = 2;"
+    "log.length === 1 && log[0] === 2 && !o.hasOwnProperty ('v') && plain.v === 2"
+  );
+
+  TEST_ASSERT (run_test (test_proto, sizeof (test_proto) - 1));
+
+  /* Unused shapes are freed by the garbage collector. */
+  const jerry_char_t test_gc[] = TEST_STRING_LITERAL (
+    "var ok = true;"
+    "for (var i = 0; i < 200; i++) {"
+    "  var o = { a: i };"
+    "  o['n' + i] = i;"
+    "  o.b = o;"
+    "  ok = ok && o['n' + i] === i && o.b === o && o.a === i;"
+    "}"
+    "ok"
+  );
+
+  for (int i = 0; i < 4; i++)
+  {
+    TEST_ASSERT (run_test (test_gc, sizeof (test_gc) - 1));
+    jerry_gc (JERRY_GC_PRESSURE_HIGH);
+  }
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -0,0 +1,121 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "test-common.h"
+
+static bool
+run_test (const jerry_char_t *source_p, /**< source code */
+          size_t source_size) /**< size of the source code */
+{
+  jerry_value_t result = jerry_eval (source_p, source_size, JERRY_PARSE_NO_OPTS);
+  bool is_true = jerry_value_is_boolean (result) && jerry_get_boolean_value (result);
+
+  jerry_release_value (result);
+  return is_true;
+} /* run_test */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_inline_cache_stats_t stats;
+  memset (&stats, 0, sizeof (stats));
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_INLINE_CACHE))
+  {
+    TEST_ASSERT (!jerry_get_inline_cache_stats (&stats));
+    jerry_cleanup ();
+    return 0;
+  }
+
+  TEST_ASSERT (!jerry_get_inline_cache_stats (NULL));
+  TEST_ASSERT (jerry_get_inline_cache_stats (&stats));
+  TEST_ASSERT (stats.version == 1);
+  TEST_ASSERT (stats.load_hits == 0 && stats.store_hits == 0);
+
+  /* Repeated loads and stores of the same object are served by the cache. */
+  const jerry_char_t test_hits[] = TEST_STRING_LITERAL (
+    "var point = { x: 0, y: 0 };"
+    "function move (p, n) {"
+    "  for (var i = 0; i < n; i++) {"
+    "    p.x = p.x + 1;"
+    "    p.y += 2;"
+    "  }"
+    "  return p.x + p.y;"
+    "}"
+    "move (point, 100) === 300"
+  );
+
+  TEST_ASSERT (run_test (test_hits, sizeof (test_hits) - 1));
+  TEST_ASSERT (jerry_get_inline_cache_stats (&stats));
+  TEST_ASSERT (stats.load_hits >= 190 && stats.store_hits >= 190);
+  TEST_ASSERT (stats.caches >= 1);
+
+  /* Cached properties which are changed or removed are not used. */
+  const jerry_char_t test_invalidate[] = TEST_STRING_LITERAL (
+    "function get (o) { return o.a; }"
+    "function set (o, v) { o.a = v; }"
+    "var o = { a: 1 };"
+    "var ok = get (o) === 1 && get (o) === 1;"
+    "set (o, 2); set (o, 3);"
+    "ok = ok && get (o) === 3;"
+    "delete o.a;"
+    "ok = ok && get (o) === undefined;"
+    "Object.prototype.a = 'proto';"
+    "ok = ok && get (o) === 'proto';"
+    "delete Object.prototype.a;"
+    "o.a = 4;"
+    "ok = ok && get (o) === 4;"
+    "var setter_value;"
+    "Object.defineProperty (o, 'a', { get: function () { return 5; },"
+    "                                 set: function (v) { setter_value = v; } });"
+    "ok = ok && get (o) === 5;"
+    "set (o, 6);"
+    "ok = ok && setter_value === 6 && get (o) === 5;"
+    "var f = { a: 7 };"
+    "set (f, 8);"
+    "Object.freeze (f);"
+    "set (f, 9);"
+    "ok = ok && get (f) === 8;"
+    "ok"
+  );
+
+  TEST_ASSERT (run_test (test_invalidate, sizeof (test_invalidate) - 1));
+
+  /* Objects which share an access are still told apart after garbage collection. */
+  const jerry_char_t test_gc[] = TEST_STRING_LITERAL (
+    "function get_b (o) { return o.b; }"
+    "var ok = true;"
+    "for (var i = 0; i < 100; i++) {"
+    "  var o = { b: i };"
+    "  ok = ok && get_b (o) === i && get_b (o) === i;"
+    "  o = null;"
+    "}"
+    "ok"
+  );
+
+  for (int i = 0; i < 4; i++)
+  {
+    TEST_ASSERT (run_test (test_gc, sizeof (test_gc) - 1));
+    jerry_gc (JERRY_GC_PRESSURE_HIGH);
+  }
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -128,6 +128,27 @@ main (void)
     TEST_ASSERT (ecma_find_or_create_literal_string (NULL, 0) != JMEM_CP_NULL);
   }
 
+  /* Literals are found after the hash tables are grown. */
+  const uint32_t many_literals = 1000;
+  ecma_value_t first_string = ecma_find_or_create_literal_string ((const lit_utf8_byte_t *) "literal-x", 9);
+  ecma_value_t first_number = ecma_find_or_create_literal_number (0.25);
+
+  for (uint32_t i = 0; i < many_literals; i++)
+  {
+    lit_utf8_byte_t name[12] = { 'l', 'i', 't', 'e', 'r', 'a', 'l', '-',
+                                 (lit_utf8_byte_t) ('a' + (i % 26)),
+                                 (lit_utf8_byte_t) ('a' + ((i / 26) % 26)),
+                                 (lit_utf8_byte_t) ('a' + (i / 676)) };
+    ecma_value_t string = ecma_find_or_create_literal_string (name, 11);
+    TEST_ASSERT (ecma_find_or_create_literal_string (name, 11) == string);
+
+    ecma_value_t number = ecma_find_or_create_literal_number ((ecma_number_t) i + 0.5);
+    TEST_ASSERT (ecma_find_or_create_literal_number ((ecma_number_t) i + 0.5) == number);
+  }
+
+  TEST_ASSERT (ecma_find_or_create_literal_string ((const lit_utf8_byte_t *) "literal-x", 9) == first_string);
+  TEST_ASSERT (ecma_find_or_create_literal_number (0.25) == first_number);
+
   ecma_finalize_lit_storage ();
   jmem_finalize ();
   return 0;
@@ -0,0 +1,156 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+#include "test-common.h"
+
+
+static int call_count = 0;
+
+static jerry_value_t
+native_sum_handler (const jerry_value_t func_obj_val, /**< function object */
+                    const jerry_value_t this_val, /**< this arg */
+                    const jerry_value_t args_p[], /**< function arguments */
+                    const jerry_length_t args_cnt) /**< number of function arguments */
+{
+  JERRY_UNUSED (func_obj_val);
+  JERRY_UNUSED (this_val);
+
+  double sum = 0;
+
+  for (jerry_length_t i = 0; i < args_cnt; i++)
+  {
+    TEST_ASSERT (jerry_value_is_number (args_p[i]));
+    sum += jerry_get_number_value (args_p[i]);
+  }
+
+  call_count++;
+  return jerry_create_number (sum);
+} /* native_sum_handler */
+
+static jerry_value_t
+native_this_handler (const jerry_value_t func_obj_val, /**< function object */
+                     const jerry_value_t this_val, /**< this arg */
+                     const jerry_value_t args_p[], /**< function arguments */
+                     const jerry_length_t args_cnt) /**< number of function arguments */
+{
+  JERRY_UNUSED (func_obj_val);
+  JERRY_UNUSED (args_p);
+  JERRY_UNUSED (args_cnt);
+
+  call_count++;
+  return jerry_acquire_value (this_val);
+} /* native_this_handler */
+
+static jerry_value_t
+native_throw_handler (const jerry_value_t func_obj_val, /**< function object */
+                      const jerry_value_t this_val, /**< this arg */
+                      const jerry_value_t args_p[], /**< function arguments */
+                      const jerry_length_t args_cnt) /**< number of function arguments */
+{
+  JERRY_UNUSED (func_obj_val);
+  JERRY_UNUSED (this_val);
+  JERRY_UNUSED (args_p);
+  JERRY_UNUSED (args_cnt);
+
+  call_count++;
+  return jerry_create_error (JERRY_ERROR_TYPE, (const jerry_char_t *) "native error");
+} /* native_throw_handler */
+
+static jerry_value_t
+native_new_target_handler (const jerry_value_t func_obj_val, /**< function object */
+                           const jerry_value_t this_val, /**< this arg */
+                           const jerry_value_t args_p[], /**< function arguments */
+                           const jerry_length_t args_cnt) /**< number of function arguments */
+{
+  JERRY_UNUSED (func_obj_val);
+  JERRY_UNUSED (this_val);
+  JERRY_UNUSED (args_p);
+  JERRY_UNUSED (args_cnt);
+
+  call_count++;
+  return jerry_get_new_target ();
+} /* native_new_target_handler */
+
+static void
+register_function (const char *name_p, /**< name of the function */
+                   jerry_external_handler_t handler_p) /**< function callback */
+{
+  jerry_value_t global_obj_val = jerry_get_global_object ();
+  jerry_value_t function_val = jerry_create_external_function (handler_p);
+  jerry_value_t function_name_val = jerry_create_string ((const jerry_char_t *) name_p);
+  jerry_value_t result_val = jerry_set_property (global_obj_val, function_name_val, function_val);
+
+  TEST_ASSERT (jerry_value_is_boolean (result_val));
+
+  jerry_release_value (result_val);
+  jerry_release_value (function_name_val);
+  jerry_release_value (function_val);
+  jerry_release_value (global_obj_val);
+} /* register_function */
+
+static void
+run_test (const char *source_p, /**< source code which must evaluate to true */
+          int expected_call_count) /**< expected number of native calls */
+{
+  call_count = 0;
+
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+
+  TEST_ASSERT (jerry_value_is_boolean (result) && jerry_get_boolean_value (result));
+  TEST_ASSERT (call_count == expected_call_count);
+
+  jerry_release_value (result);
+} /* run_test */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  register_function ("sum", native_sum_handler);
+  register_function ("getThis", native_this_handler);
+  register_function ("throwError", native_throw_handler);
+  register_function ("getNewTarget", native_new_target_handler);
+
+  /* Result is pushed onto the stack, discarded, or stored as the completion value. */
+  run_test ("sum () === 0 && sum (1) === 1 && sum (1, 2) === 3 && sum (1, 2, 3, 4, 5, 6, 7, 8) === 36", 4);
+  run_test ("sum (1, 2); sum (3); true", 2);
+  run_test ("eval ('sum (4, 5)') === 9", 1);
+  run_test ("var a = 0; for (var i = 0; i < 100; i++) { a += sum (i, 1); } a === 5050", 100);
+  run_test ("function f (x) { return sum (x, x) } f (2) === 4 && f (3) === 6", 2);
+
+  /* The this value of property calls. */
+  run_test ("var o = { getThis: getThis }; o.getThis () === o && o['getThis'] () === o", 2);
+  run_test ("getThis () === undefined && getThis.call (5) == 5", 2);
+  run_test ("var u = { f: getThis }; (function () { 'use strict'; return u.f () === u; }) ()", 1);
+
+  /* Exceptions thrown by native functions. */
+  run_test ("var r = false; try { throwError (); } catch (e) { r = e instanceof TypeError; } r", 1);
+  run_test ("var r = false; try { var t = { f: throwError }; sum (1, t.f (2, 3)); } catch (e) { r = true; } r", 1);
+  run_test ("function g () { throwError (1); } var r = 0; "
+            "for (var i = 0; i < 10; i++) { try { g (); } catch (e) { r++; } } r === 10", 10);
+
+  /* The new.target is undefined for calls. */
+  run_test ("getNewTarget () === undefined", 1);
+  run_test ("function C () { return getNewTarget (); } new C (); C () === undefined", 2);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -0,0 +1,151 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-init-finalize.h"
+#include "jcontext.h"
+
+#include "test-common.h"
+
+/**
+ * Checks whether two numbers have the same bit pattern.
+ *
+ * @return true - if the numbers are the same (including NaN and the sign of zero),
+ *         false - otherwise
+ */
+static bool
+test_same_number (ecma_number_t left, /**< first number */
+                  ecma_number_t right) /**< second number */
+{
+  return memcmp (&left, &right, sizeof (ecma_number_t)) == 0;
+} /* test_same_number */
+
+/**
+ * Unit test's main function.
+ */
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jmem_init ();
+  ecma_init ();
+
+  const ecma_number_t numbers[] =
+  {
+    0.0, -0.0, 1.0, -1.0, 0.5, -1.5, 3.14159, 1e-10, -2.5e-20,
+    134217727.0, 134217728.0, -134217729.0, 2147483648.0, 4294967296.0,
+    1600000000000.0, 1600000000000.5, 9007199254740993.0, 1e20, 1e38, -1e38,
+    /* Boundaries of the directly encoded exponent range (2^-127 and 2^128 - ulp). */
+    5.877471754111438e-39, 1.1754943508222875e-38, 3.4028236692093843e+38,
+    3.402823669209385e+38, 2.938735877055719e-39,
+    1e300, -1e-300, 5e-324, 1.7976931348623157e308,
+  };
+
+  for (uint32_t i = 0; i < sizeof (numbers) / sizeof (numbers[0]); i++)
+  {
+    ecma_value_t value = ecma_make_number_value (numbers[i]);
+    TEST_ASSERT (ecma_is_value_number (value));
+    TEST_ASSERT (test_same_number (ecma_get_number_from_value (value), numbers[i]));
+
+    ecma_value_t copy = ecma_copy_value (value);
+    TEST_ASSERT (test_same_number (ecma_get_number_from_value (copy), numbers[i]));
+    ecma_free_value (value);
+    TEST_ASSERT (test_same_number (ecma_get_number_from_value (copy), numbers[i]));
+
+    /* Negated, halved and integer results of an update. */
+    if (ecma_is_value_float_number (copy))
+    {
+      copy = ecma_update_float_number (copy, -numbers[i]);
+      TEST_ASSERT (test_same_number (ecma_get_number_from_value (copy), -numbers[i]));
+
+      if (ecma_is_value_float_number (copy))
+      {
+        copy = ecma_update_float_number (copy, numbers[i] * 0.5);
+        TEST_ASSERT (test_same_number (ecma_get_number_from_value (copy), numbers[i] * 0.5));
+      }
+
+      if (ecma_is_value_float_number (copy))
+      {
+        copy = ecma_update_float_number (copy, 42.0);
+        TEST_ASSERT (ecma_is_value_integer_number (copy));
+        TEST_ASSERT (ecma_get_integer_from_value (copy) == 42);
+      }
+    }
+
+    ecma_free_value (copy);
+  }
+
+  /* Special values. */
+  ecma_value_t nan = ecma_make_nan_value ();
+  TEST_ASSERT (ecma_number_is_nan (ecma_get_number_from_value (nan)));
+  ecma_value_t infinity = ecma_make_number_value (ecma_number_make_infinity (false));
+  TEST_ASSERT (ecma_number_is_infinity (ecma_get_number_from_value (infinity)));
+  ecma_free_value (nan);
+  ecma_free_value (infinity);
+
+  /* Assigning numbers to an existing value. */
+  ecma_value_t target = ECMA_VALUE_UNDEFINED;
+
+  for (uint32_t i = 0; i < sizeof (numbers) / sizeof (numbers[0]); i++)
+  {
+    ecma_value_assign_number (&target, numbers[i]);
+    TEST_ASSERT (test_same_number (ecma_get_number_from_value (target), numbers[i]));
+
+    ecma_value_t value = ecma_make_number_value (numbers[(i + 7) % (sizeof (numbers) / sizeof (numbers[0]))]);
+    ecma_value_assign_value (&target, value);
+    TEST_ASSERT (test_same_number (ecma_get_number_from_value (target), ecma_get_number_from_value (value)));
+    ecma_free_value (value);
+  }
+
+  ecma_free_value (target);
+
+  /* Integers which are larger than the direct integer range keep their sign and value. */
+  ecma_value_t int32_min = ecma_make_int32_value (INT32_MIN);
+  ecma_value_t uint32_max = ecma_make_uint32_value (UINT32_MAX);
+  TEST_ASSERT (ecma_get_number_from_value (int32_min) == (ecma_number_t) INT32_MIN);
+  TEST_ASSERT (ecma_get_number_from_value (uint32_max) == (ecma_number_t) UINT32_MAX);
+  ecma_free_value (int32_min);
+  ecma_free_value (uint32_max);
+
+#if ENABLED (JERRY_VALUE_64_BIT)
+  /* Most floating point numbers are stored in the value without allocating memory.
+   * Numbers are allocated from the pools, which reuse free chunks without changing
+   * the size of the allocated heap memory, so the pools are emptied first. */
+  jmem_pools_collect_empty ();
+  size_t allocated_size = JERRY_CONTEXT (jmem_heap_allocated_size);
+
+  ecma_value_t timestamp = ecma_make_number_value (1600000000000.5);
+  ecma_value_t fraction = ecma_make_number_value (-0.1);
+  TEST_ASSERT (ecma_is_value_direct_float_number (timestamp));
+  TEST_ASSERT (ecma_is_value_direct_float_number (fraction));
+  TEST_ASSERT (ecma_make_number_value (-0.1) == fraction);
+  TEST_ASSERT (JERRY_CONTEXT (jmem_heap_allocated_size) == allocated_size);
+
+  ecma_value_t negative_zero = ecma_make_number_value (-0.0);
+  TEST_ASSERT (ecma_is_value_float_number (negative_zero));
+  TEST_ASSERT (!ecma_is_value_direct_float_number (negative_zero));
+  TEST_ASSERT (JERRY_CONTEXT (jmem_heap_allocated_size) > allocated_size);
+  ecma_free_value (negative_zero);
+  jmem_pools_collect_empty ();
+  TEST_ASSERT (JERRY_CONTEXT (jmem_heap_allocated_size) == allocated_size);
+#endif /* ENABLED (JERRY_VALUE_64_BIT) */
+
+  ecma_finalize ();
+  jmem_finalize ();
+
+  return 0;
+} /* main */
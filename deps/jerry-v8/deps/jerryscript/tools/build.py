@@ -114,10 +114,18 @@ def get_arguments():
                          help='enable error messages (%(choices)s)')
     coregrp.add_argument('--external-context', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable external context (%(choices)s)')
+    coregrp.add_argument('--hidden-classes', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable hidden classes of ordinary objects (%(choices)s)')
+    coregrp.add_argument('--inline-cache', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable per-site inline caches (%(choices)s)')
     coregrp.add_argument('--jerry-debugger', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable the jerry debugger (%(choices)s)')
+    coregrp.add_argument('--jit', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable the baseline JIT compiler (%(choices)s)')
     coregrp.add_argument('--js-parser', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable js-parser (%(choices)s)')
+    coregrp.add_argument('--lazy-functions', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='compile function bodies on first call (%(choices)s)')
     coregrp.add_argument('--line-info', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='provide line info (%(choices)s)')
     coregrp.add_argument('--logging', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -150,8 +158,14 @@ def get_arguments():
                          help='enable system allocator (%(choices)s)')
     coregrp.add_argument('--valgrind', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable Valgrind support (%(choices)s)'))
+    coregrp.add_argument('--value-64bit', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable 64 bit values with direct floating point numbers (%(choices)s)')
     coregrp.add_argument('--vm-exec-stop', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable VM execution stopping (%(choices)s)')
+    coregrp.add_argument('--vm-interrupt', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable asynchronous VM interrupt requests (%(choices)s)')
+    coregrp.add_argument('--vm-threaded-dispatch', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable threaded dispatch of the byte code interpreter (%(choices)s)')
 
     maingrp = parser.add_argument_group('jerry-main options')
     maingrp.add_argument('--link-map', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -198,9 +212,13 @@ def generate_build_options(arguments):
     build_options_append('JERRY_CPOINTER_32_BIT', arguments.cpointer_32bit)
     build_options_append('JERRY_ERROR_MESSAGES', arguments.error_messages)
     build_options_append('JERRY_EXTERNAL_CONTEXT', arguments.external_context)
+    build_options_append('JERRY_HIDDEN_CLASSES', arguments.hidden_classes)
+    build_options_append('JERRY_INLINE_CACHE', arguments.inline_cache)
     build_options_append('JERRY_DEBUGGER', arguments.jerry_debugger)
+    build_options_append('JERRY_JIT', arguments.jit)
     build_options_append('JERRY_PARSER', arguments.js_parser)
     build_options_append('JERRY_LINE_INFO', arguments.line_info)
+    build_options_append('JERRY_LAZY_FUNCTIONS', arguments.lazy_functions)
     build_options_append('JERRY_LOGGING', arguments.logging)
     build_options_append('JERRY_GLOBAL_HEAP_SIZE', arguments.mem_heap)
     build_options_append('JERRY_GC_LIMIT', arguments.gc_limit)
@@ -215,7 +233,10 @@ def generate_build_options(arguments):
     build_options_append('JERRY_SNAPSHOT_SAVE', arguments.snapshot_save)
     build_options_append('JERRY_SYSTEM_ALLOCATOR', arguments.system_allocator)
     build_options_append('JERRY_VALGRIND', arguments.valgrind)
+    build_options_append('JERRY_VALUE_64_BIT', arguments.value_64bit)
     build_options_append('JERRY_VM_EXEC_STOP', arguments.vm_exec_stop)
+    build_options_append('JERRY_VM_INTERRUPT', arguments.vm_interrupt)
+    build_options_append('JERRY_VM_THREADED_DISPATCH', arguments.vm_threaded_dispatch)
 
     if arguments.gc_mark_limit is not None:
         build_options.append('-D%s=%s' % ('JERRY_GC_MARK_LIMIT', arguments.gc_mark_limit))
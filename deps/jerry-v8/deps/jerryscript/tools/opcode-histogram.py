@@ -0,0 +1,123 @@
+#!/usr/bin/env python
+
+# Copyright JS Foundation and other contributors, http://js.foundation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from __future__ import print_function
+
+import argparse
+import collections
+import os
+import re
+import subprocess
+import sys
+
+FINAL_DUMP_START = 'Final byte code dump:'
+FINAL_DUMP_END = 'Byte code size:'
+INSTRUCTION_RE = re.compile(r'^\s*\d+ : (CBC_[A-Z0-9_]+)')
+
+# Line info instructions are interleaved with the statements and are not executed
+# together with their neighbours, so they are left out from the pair statistics.
+IGNORED_OPCODES = frozenset(['CBC_EXT_LINE'])
+
+
+def get_args():
+    """ Parse input arguments. """
+    desc = 'Counts the static frequency of byte code instructions and instruction pairs'
+    parser = argparse.ArgumentParser(description=desc)
+    parser.add_argument('--engine', required=True,
+                        help='jerry binary built with --show-opcodes=on')
+    parser.add_argument('--top', type=int, default=40,
+                        help='number of entries printed from each table (default: %(default)d)')
+    parser.add_argument('--triples', action='store_true',
+                        help='count instruction triples as well')
+    parser.add_argument('paths', nargs='+',
+                        help='JavaScript source files or directories searched for .js files')
+
+    return parser.parse_args()
+
+
+def collect_files(paths):
+    """ Expand the directories of the path list. """
+    files = []
+
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, names in os.walk(path):
+                files.extend(os.path.join(root, name) for name in sorted(names) if name.endswith('.js'))
+        else:
+            files.append(path)
+
+    return files
+
+
+def dump_byte_code(engine, source_file):
+    """ Return the final byte code of each function of a source file as lists of opcode names. """
+    proc = subprocess.Popen([engine, '--show-opcodes', '--parse-only', source_file],
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    output, _ = proc.communicate()
+
+    functions = []
+    current = None
+
+    for line in output.decode('utf-8', 'replace').splitlines():
+        if line.startswith(FINAL_DUMP_START):
+            current = []
+        elif current is not None:
+            if line.startswith(FINAL_DUMP_END):
+                functions.append(current)
+                current = None
+                continue
+
+            match = INSTRUCTION_RE.match(line)
+            if match and match.group(1) not in IGNORED_OPCODES:
+                current.append(match.group(1))
+
+    return functions
+
+
+def print_table(title, counter, total, top):
+    print('%s (%d in total)' % (title, total))
+
+    for key, count in counter.most_common(top):
+        if isinstance(key, tuple):
+            key = ' + '.join(key)
+        print('  %8d %6.2f%%  %s' % (count, 100.0 * count / max(total, 1), key))
+
+    print()
+
+
+def main(args):
+    if not os.path.isfile(args.engine):
+        sys.exit('Engine not found: %s' % args.engine)
+
+    singles = collections.Counter()
+    pairs = collections.Counter()
+    triples = collections.Counter()
+
+    for source_file in collect_files(args.paths):
+        for function in dump_byte_code(args.engine, source_file):
+            singles.update(function)
+            pairs.update(zip(function, function[1:]))
+            if args.triples:
+                triples.update(zip(function, function[1:], function[2:]))
+
+    print_table('Instructions', singles, sum(singles.values()), args.top)
+    print_table('Instruction pairs', pairs, sum(pairs.values()), args.top)
+    if args.triples:
+        print_table('Instruction triples', triples, sum(triples.values()), args.top)
+
+
+if __name__ == '__main__':
+    main(get_args())
@@ -0,0 +1,67 @@
+// Copyright 2010 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_V8_JERRY_H_
+#define V8_V8_JERRY_H_
+
+#include "v8.h"  // NOLINT(build/include)
+
+/**
+ * Extensions of the JerryScript backed implementation of the V8 API, which
+ * have no V8 counterpart. Embedders should only use them when V8JERRY is
+ * defined.
+ */
+namespace v8 {
+namespace jerry {
+
+/**
+ * Merges the code caches produced for several scripts into a single bundle,
+ * where the literals shared by the scripts are stored only once. Returns
+ * NULL if any of the code caches is invalid.
+ *
+ * The code cache of the index-th script starts at BundleEntryOffset(index)
+ * and extends to the end of the bundle. It can be passed to
+ * ScriptCompiler::kConsumeCodeCache like any other code cache, as long as
+ * the bundle is kept alive.
+ */
+V8_EXPORT ScriptCompiler::CachedData* MergeCodeCaches(
+    const ScriptCompiler::CachedData* const* cached_data, int count);
+
+/**
+ * Returns the offset of the code cache of the index-th script in a bundle
+ * created by MergeCodeCaches.
+ */
+V8_EXPORT int BundleEntryOffset(int index);
+
+/**
+ * Registers a block of memory holding code caches, which is neither modified
+ * nor released until the process exits (e.g. a read-only mapping of a bundle
+ * created by MergeCodeCaches). The byte code of code caches consumed from
+ * this block is executed in place instead of being copied to the heap, so
+ * processes which map the same file share the pages of the byte code.
+ */
+V8_EXPORT void RegisterStaticCodeCache(const void* data, size_t length);
+
+/**
+ * Counters of the inline caches of property loads and stores. Only the
+ * accesses to the properties of ordinary objects are counted.
+ */
+struct InlineCacheStatistics {
+  size_t load_hits;
+  size_t load_misses;
+  size_t store_hits;
+  size_t store_misses;
+  size_t caches;  // Number of functions which have an inline cache.
+};
+
+/**
+ * Fills the counters of the inline caches. Returns false if the engine is
+ * built without inline caches.
+ */
+V8_EXPORT bool GetInlineCacheStatistics(InlineCacheStatistics* statistics);
+
+}  // namespace jerry
+}  // namespace v8
+
+#endif  // V8_V8_JERRY_H_
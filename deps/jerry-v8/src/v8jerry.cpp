@@ -1,5 +1,6 @@
 #include <v8.h>
 #include <v8-debug.h>
+#include <v8-jerry.h>
 #include <v8-profiler.h>
 #include <libplatform/libplatform.h>
 
@@ -9,6 +10,7 @@
 #include <cstring>
 #include <deque>
 #include <locale>
+#include <memory>
 #include <stack>
 #include <string>
 #include <vector>
@@ -18,6 +20,8 @@
 
 /* Jerry <-> V8 binding classes */
 #include "v8jerry_callback.hpp"
+#include "v8jerry_code_cache.hpp"
+#include "v8jerry_finalizer.hpp"
 #include "v8jerry_handlescope.hpp"
 #include "v8jerry_flags.hpp"
 #include "v8jerry_isolate.hpp"
@@ -163,6 +167,12 @@ void V8::InitializeExternalStartupData(char const*) {
     V8_CALL_TRACE();
 }
 
+void V8::SetNativesDataBlob(StartupData* startup_blob) {
+    V8_CALL_TRACE();
+    // The natives blob holds the code cache of the embedder's built-in scripts.
+    JerryCodeCache::AddStaticData(startup_blob->data, (size_t) startup_blob->raw_size);
+}
+
 void V8::InitializePlatform(v8::Platform*) {
     V8_CALL_TRACE();
 }
@@ -290,7 +300,8 @@ Locker::~Locker() {
 
 /* ArrayBuffer & Allocator */
 void delete_external_array_buffer(void* ptr) {
-    free(static_cast<uint8_t*> (ptr));
+    // Called during GC: large buffers are released on the finalizer thread.
+    JerryFinalizer::Free(ptr);
 }
 
 Local<ArrayBuffer> ArrayBuffer::New(Isolate* isolate, void* data, size_t byte_length, ArrayBufferCreationMode mode) {
@@ -495,6 +506,16 @@ void Isolate::CancelTerminateExecution(void) {
     JerryIsolate::fromV8(this)->CancelTerminate();
 }
 
+bool Isolate::IsExecutionTerminating(void) {
+    V8_CALL_TRACE();
+    return JerryIsolate::fromV8(this)->IsTerminated();
+}
+
+void Isolate::RequestInterrupt(InterruptCallback callback, void* data) {
+    V8_CALL_TRACE();
+    JerryIsolate::fromV8(this)->RequestInterrupt(callback, data);
+}
+
 void Isolate::RequestGarbageCollectionForTesting(GarbageCollectionType type) {
     JerryIsolate::GetCurrent()->RunWeakCleanup();
 }
@@ -2112,6 +2133,49 @@ Local<Script> UnboundScript::BindToCurrentContext() {
 }
 
 /* Script */
+
+/* Characters of a script source or resource name as expected by jerry_parse.
+ * Strings which store their characters in a single buffer (including external
+ * strings, e.g. the embedded sources of built-in modules) are passed to the
+ * parser without copying them. */
+class ScriptChars {
+public:
+    explicit ScriptChars(Local<Value> value)
+        : m_value(jerry_create_undefined())
+        , m_chars(NULL)
+        , m_size(0)
+    {
+        JerryValue* jvalue = reinterpret_cast<JerryValue*>(*value);
+
+        // Empty handles and non-string values (e.g. an undefined resource name) have no characters.
+        if (jvalue == NULL || jvalue->value() == 0 || !jvalue->IsString()) {
+            return;
+        }
+
+        m_value = jerry_acquire_value(jvalue->value());
+        m_chars = jerry_get_string_buffer(m_value, &m_size);
+
+        if (m_chars == NULL) {
+            m_copy.resize(jerry_get_string_size(m_value));
+            m_size = jerry_string_to_char_buffer(m_value, m_copy.data(), (jerry_size_t) m_copy.size());
+            m_chars = m_copy.data();
+        }
+    }
+
+    ~ScriptChars() {
+        jerry_release_value(m_value);
+    }
+
+    const jerry_char_t* chars(void) const { return m_chars; }
+    size_t size(void) const { return m_size; }
+
+private:
+    jerry_value_t m_value;
+    const jerry_char_t* m_chars;
+    jerry_size_t m_size;
+    std::vector<jerry_char_t> m_copy;
+};
+
 ScriptCompiler::CachedData::CachedData(const uint8_t* data, int length, BufferPolicy buffer_policy)
     : data(data)
     , length(length)
@@ -2129,19 +2193,67 @@ ScriptCompiler::CachedData::~CachedData() {
 
 MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundScript(Isolate* isolate, Source* source, CompileOptions options) {
     V8_CALL_TRACE();
+    if (options != ScriptCompiler::kProduceCodeCache && options != ScriptCompiler::kConsumeCodeCache) {
+        return CompileUnbound(isolate, source, options);
+    }
+
+    Local<String> file = source->resource_name.IsEmpty() ? source->resource_name.As<String>() : source->resource_name->ToString(isolate);
+
+    ScriptChars text(source->source_string);
+    ScriptChars fileName(file);
+
+    jerry_value_t scriptFunction;
+    bool compiled;
+
     if (options == ScriptCompiler::kProduceCodeCache) {
-        String::Utf8Value text(source->source_string);
-        uint8_t* copy = new uint8_t[text.length()];
-        memcpy(copy, *text, text.length());
-        source->cached_data = new ScriptCompiler::CachedData((const uint8_t*) copy, text.length());
-    } else if (options == ScriptCompiler::kConsumeCodeCache) {
-        String::Utf8Value text(source->source_string);
-        CachedData* data = source->cached_data;
-        if (data->length != text.length() || memcmp(data->data, (const uint8_t*) *text, text.length())) {
-            data->rejected = true;
-        }
+        compiled = JerryCodeCache::Produce(fileName.chars(), fileName.size(),
+                                           text.chars(), text.size(), &source->cached_data, &scriptFunction);
+    } else {
+        compiled = JerryCodeCache::Consume(source->cached_data, text.chars(), text.size(), &scriptFunction);
+    }
+
+    if (!compiled) {
+        scriptFunction = jerry_parse(fileName.chars(), fileName.size(), text.chars(), text.size(), JERRY_PARSE_NO_OPTS);
+    }
+
+    JerryValue* result = JerryValue::TryCreateValue(JerryIsolate::fromV8(isolate), scriptFunction);
+    RETURN_HANDLE(UnboundScript, isolate, result);
+}
+
+uint32_t ScriptCompiler::CachedDataVersionTag() {
+    V8_CALL_TRACE();
+    return JerryCodeCache::VersionTag();
+}
+
+ScriptCompiler::CachedData* jerry::MergeCodeCaches(const ScriptCompiler::CachedData* const* cached_data, int count) {
+    V8_CALL_TRACE();
+    return JerryCodeCache::Merge(cached_data, count);
+}
+
+int jerry::BundleEntryOffset(int index) {
+    V8_CALL_TRACE();
+    return (int) JerryCodeCache::BundleEntryOffset(index);
+}
+
+void jerry::RegisterStaticCodeCache(const void* data, size_t length) {
+    V8_CALL_TRACE();
+    JerryCodeCache::AddStaticData(reinterpret_cast<const char*>(data), length);
+}
+
+bool jerry::GetInlineCacheStatistics(InlineCacheStatistics* statistics) {
+    V8_CALL_TRACE();
+    jerry_inline_cache_stats_t stats;
+
+    if (!jerry_get_inline_cache_stats(&stats)) {
+        return false;
     }
-    return CompileUnbound(isolate, source, options);
+
+    statistics->load_hits = stats.load_hits;
+    statistics->load_misses = stats.load_misses;
+    statistics->store_hits = stats.store_hits;
+    statistics->store_misses = stats.store_misses;
+    statistics->caches = stats.caches;
+    return true;
 }
 
 
@@ -2149,14 +2261,11 @@ Local<UnboundScript> ScriptCompiler::CompileUnbound(Isolate* isolate, Source* so
     V8_CALL_TRACE();
     Local<String> file = source->resource_name.IsEmpty() ? source->resource_name.As<String>() : source->resource_name->ToString(isolate);
 
-    String::Utf8Value text(source->source_string);
-    String::Utf8Value fileName(file);
+    ScriptChars text(source->source_string);
+    ScriptChars fileName(file);
 
-    jerry_value_t scriptFunction = jerry_parse((const jerry_char_t*)*fileName,
-                                               file->Utf8Length(),
-                                               (const jerry_char_t*)*text,
-                                               source->source_string->Utf8Length(),
-                                               JERRY_PARSE_NO_OPTS);
+    jerry_value_t scriptFunction = jerry_parse(fileName.chars(), fileName.size(),
+                                               text.chars(), text.size(), JERRY_PARSE_NO_OPTS);
 
     JerryValue* result = JerryValue::TryCreateValue(JerryIsolate::fromV8(isolate), scriptFunction);
     RETURN_HANDLE(UnboundScript, isolate, result);
@@ -2164,23 +2273,173 @@ Local<UnboundScript> ScriptCompiler::CompileUnbound(Isolate* isolate, Source* so
 
 MaybeLocal<Script> Script::Compile(Local<Context> context, Local<String> source, ScriptOrigin* origin /* = nullptr */) {
     V8_CALL_TRACE();
-    std::vector<jerry_char_t> sourceString;
-    sourceString.resize(source->Utf8Length());
-    source->WriteUtf8((char*)&sourceString[0], source->Utf8Length(), 0, String::NO_NULL_TERMINATION);
+    ScriptChars sourceString(source);
+    ScriptChars originStr(origin != NULL ? origin->ResourceName() : Local<Value>());
+
+    jerry_value_t scriptFunction = jerry_parse(originStr.chars(), originStr.size(),
+                                               sourceString.chars(), sourceString.size(), JERRY_PARSE_NO_OPTS);
+
+    JerryValue* result = JerryValue::TryCreateValue(JerryIsolate::fromV8(context->GetIsolate()), scriptFunction);
+
+    RETURN_HANDLE(Script, context->GetIsolate(), result /*new JerryValue(scriptFunction)*/);
+}
+
+/* Script streaming
+ *
+ * The JerryScript context is process wide and not thread safe, so the parsing
+ * itself cannot be moved to a background thread. The streaming task collects
+ * the chunks of the source and converts them to the UTF-8 form expected by
+ * jerry_parse on the background thread, so the main thread only parses.
+ */
+namespace internal {
+
+struct StreamedSource {
+    StreamedSource(ScriptCompiler::ExternalSourceStream* source_stream, ScriptCompiler::StreamedSource::Encoding encoding)
+        : source_stream(source_stream)
+        , encoding(encoding)
+        , finished(false)
+    {
+    }
+
+    void Stream(void) {
+        std::vector<uint8_t> raw;
+
+        while (true) {
+            const uint8_t* chunk = NULL;
+            size_t length = source_stream->GetMoreData(&chunk);
+
+            if (length == 0) {
+                break;
+            }
+
+            // The caller takes ownership of the chunk.
+            raw.insert(raw.end(), chunk, chunk + length);
+            delete [] chunk;
+        }
+
+        switch (encoding) {
+            case ScriptCompiler::StreamedSource::UTF8: {
+                utf8.swap(raw);
+                break;
+            }
+            case ScriptCompiler::StreamedSource::ONE_BYTE: {
+                utf8.reserve(raw.size());
+                for (uint8_t ch : raw) {
+                    if (ch < 0x80) {
+                        utf8.push_back(ch);
+                    } else {
+                        utf8.push_back((uint8_t) (0xc0 | (ch >> 6)));
+                        utf8.push_back((uint8_t) (0x80 | (ch & 0x3f)));
+                    }
+                }
+                break;
+            }
+            case ScriptCompiler::StreamedSource::TWO_BYTE: {
+                // Encoded as CESU-8 (the internal encoding of JerryScript):
+                // every code unit is converted separately, so unpaired
+                // surrogates (which are valid in JS sources) are kept as
+                // 3 byte sequences instead of failing the conversion.
+                const uint16_t* begin = reinterpret_cast<const uint16_t*>(raw.data());
+                const uint16_t* end = begin + raw.size() / sizeof(uint16_t);
+
+                utf8.reserve(raw.size() / sizeof(uint16_t));
+                for (const uint16_t* ch_p = begin; ch_p < end; ch_p++) {
+                    uint16_t ch = *ch_p;
+
+                    if (ch < 0x80) {
+                        utf8.push_back((uint8_t) ch);
+                    } else if (ch < 0x800) {
+                        utf8.push_back((uint8_t) (0xc0 | (ch >> 6)));
+                        utf8.push_back((uint8_t) (0x80 | (ch & 0x3f)));
+                    } else {
+                        utf8.push_back((uint8_t) (0xe0 | (ch >> 12)));
+                        utf8.push_back((uint8_t) (0x80 | ((ch >> 6) & 0x3f)));
+                        utf8.push_back((uint8_t) (0x80 | (ch & 0x3f)));
+                    }
+                }
+                break;
+            }
+        }
+
+        finished = true;
+    }
+
+    std::unique_ptr<ScriptCompiler::ExternalSourceStream> source_stream;
+    ScriptCompiler::StreamedSource::Encoding encoding;
+    std::vector<uint8_t> utf8;
+    bool finished;
+};
+
+} // namespace internal
+
+class JerryScriptStreamingTask : public ScriptCompiler::ScriptStreamingTask {
+public:
+    JerryScriptStreamingTask(internal::StreamedSource* source)
+        : m_source(source)
+    {
+    }
+
+    virtual void Run() { m_source->Stream(); }
+
+private:
+    internal::StreamedSource* m_source;
+};
+
+bool ScriptCompiler::ExternalSourceStream::SetBookmark() {
+    return false;
+}
+
+void ScriptCompiler::ExternalSourceStream::ResetToBookmark() {
+    assert(false && "ResetToBookmark is called without a bookmark");
+}
+
+ScriptCompiler::StreamedSource::StreamedSource(ExternalSourceStream* source_stream, Encoding encoding)
+    : impl_(new internal::StreamedSource(source_stream, encoding)) {
+    V8_CALL_TRACE();
+}
+
+ScriptCompiler::StreamedSource::~StreamedSource() {
+    V8_CALL_TRACE();
+    delete impl_;
+}
+
+const ScriptCompiler::CachedData* ScriptCompiler::StreamedSource::GetCachedData() const {
+    V8_CALL_TRACE();
+    return NULL;
+}
+
+ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(Isolate* isolate, StreamedSource* source, CompileOptions options) {
+    V8_CALL_TRACE();
+    return new JerryScriptStreamingTask(source->impl());
+}
+
+MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context, StreamedSource* source,
+                                           Local<String> full_source_string, const ScriptOrigin& origin) {
+    V8_CALL_TRACE();
+    internal::StreamedSource* streamed = source->impl();
+
+    if (!streamed->finished) {
+        // The streaming task was not run, fall back to the full source.
+        return Script::Compile(context, full_source_string, const_cast<ScriptOrigin*>(&origin));
+    }
 
     std::vector<jerry_char_t> originStr;
-    if (origin != NULL) {
-        v8::Local<v8::String> originData = origin->ResourceName().As<v8::String>();
+    if (!origin.ResourceName().IsEmpty()) {
+        v8::Local<v8::String> originData = origin.ResourceName().As<v8::String>();
 
         originStr.resize(originData->Utf8Length());
-        originData->WriteUtf8((char*)&originStr[0], originStr.size(), 0, String::NO_NULL_TERMINATION);
+        originData->WriteUtf8((char*)originStr.data(), originStr.size(), 0, String::NO_NULL_TERMINATION);
     }
 
-    jerry_value_t scriptFunction = jerry_parse(&originStr[0], originStr.size(), &sourceString[0], sourceString.size(), JERRY_PARSE_NO_OPTS);
+    jerry_value_t scriptFunction = jerry_parse(originStr.data(), originStr.size(),
+                                               streamed->utf8.data(), streamed->utf8.size(),
+                                               JERRY_PARSE_NO_OPTS);
 
-    JerryValue* result = JerryValue::TryCreateValue(JerryIsolate::fromV8(context->GetIsolate()), scriptFunction);
+    // The source is not needed anymore.
+    std::vector<uint8_t>().swap(streamed->utf8);
 
-    RETURN_HANDLE(Script, context->GetIsolate(), result /*new JerryValue(scriptFunction)*/);
+    JerryValue* result = JerryValue::TryCreateValue(JerryIsolate::fromV8(context->GetIsolate()), scriptFunction);
+    RETURN_HANDLE(Script, context->GetIsolate(), result);
 }
 
 
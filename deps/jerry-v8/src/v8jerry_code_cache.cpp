@@ -0,0 +1,266 @@
+#include "v8jerry_code_cache.hpp"
+
+#include <cstring>
+#include <vector>
+
+/* "JVCC" */
+static const uint32_t kCodeCacheMagic = 0x4343564a;
+/* Increase it when the layout of the cached data changes. */
+static const uint32_t kCodeCacheFormat = 2;
+/* Upper limit of the snapshot buffer compared to the source size. */
+static const size_t kMaxSnapshotRatio = 16;
+
+struct StaticData {
+    const uint8_t* data;
+    size_t size;
+};
+
+static std::vector<StaticData> s_static_data;
+
+/* static */
+uint32_t JerryCodeCache::VersionTag(void) {
+    return (kCodeCacheFormat << 24) | JERRY_SNAPSHOT_VERSION;
+}
+
+/* static */
+void JerryCodeCache::AddStaticData(const char* data, size_t size) {
+    StaticData block = { reinterpret_cast<const uint8_t*>(data), size };
+    s_static_data.push_back(block);
+}
+
+/* static */
+bool JerryCodeCache::IsStaticData(const uint8_t* data, size_t size) {
+    for (size_t idx = 0; idx < s_static_data.size(); idx++) {
+        const StaticData& block = s_static_data[idx];
+
+        if (data >= block.data
+            && size <= block.size
+            && (size_t) (data - block.data) <= block.size - size) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* static */
+uint32_t JerryCodeCache::HashSource(const jerry_char_t* source, size_t source_size) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+
+    for (size_t idx = 0; idx < source_size; idx++) {
+        hash ^= source[idx];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+/* static */
+bool JerryCodeCache::Produce(const jerry_char_t* resource_name, size_t resource_name_size,
+                             const jerry_char_t* source, size_t source_size,
+                             v8::ScriptCompiler::CachedData** cached_data, jerry_value_t* script) {
+    const size_t header_words = sizeof(Header) / sizeof(uint32_t);
+    size_t buffer_words = (source_size * 2 + 4096) / sizeof(uint32_t);
+    const size_t max_buffer_words = (source_size * kMaxSnapshotRatio + 4096) / sizeof(uint32_t);
+    std::vector<uint32_t> buffer;
+
+    while (true) {
+        buffer.resize(header_words + buffer_words);
+
+        jerry_value_t result = jerry_generate_snapshot(resource_name, resource_name_size, source, source_size, 0,
+                                                       buffer.data() + header_words, buffer_words * sizeof(uint32_t));
+
+        if (!jerry_value_is_error(result)) {
+            buffer.resize(header_words + (size_t) jerry_get_number_value(result) / sizeof(uint32_t));
+            jerry_release_value(result);
+            break;
+        }
+
+        // Syntax errors and unsupported constructs are reported by the regular parser.
+        jerry_error_t error_type = jerry_get_error_type(result);
+        jerry_release_value(result);
+
+        if (error_type == JERRY_ERROR_SYNTAX || buffer_words >= max_buffer_words) {
+            return false;
+        }
+
+        buffer_words *= 2;
+    }
+
+    const uint32_t* snapshot = buffer.data() + header_words;
+    size_t snapshot_size = (buffer.size() - header_words) * sizeof(uint32_t);
+
+    jerry_value_t loaded = jerry_load_function_snapshot(snapshot, snapshot_size, 0, JERRY_SNAPSHOT_EXEC_COPY_DATA);
+    if (jerry_value_is_error(loaded)) {
+        jerry_release_value(loaded);
+        return false;
+    }
+
+    Header* header = reinterpret_cast<Header*>(buffer.data());
+    header->magic = kCodeCacheMagic;
+    header->version = VersionTag();
+    header->source_hash = HashSource(source, source_size);
+    header->source_size = (uint32_t) source_size;
+    header->snapshot_offset = (uint32_t) sizeof(Header);
+    header->snapshot_size = (uint32_t) snapshot_size;
+    header->function_index = 0;
+    header->reserved = 0;
+
+    size_t length = buffer.size() * sizeof(uint32_t);
+    uint8_t* data = new uint8_t[length];
+    memcpy(data, buffer.data(), length);
+
+    *cached_data = new v8::ScriptCompiler::CachedData(data, (int) length, v8::ScriptCompiler::CachedData::BufferOwned);
+    *script = loaded;
+    return true;
+}
+
+/* static */
+bool JerryCodeCache::Consume(v8::ScriptCompiler::CachedData* cached_data,
+                             const jerry_char_t* source, size_t source_size,
+                             jerry_value_t* script) {
+    size_t length = cached_data->length > 0 ? (size_t) cached_data->length : 0;
+
+    if (length <= sizeof(Header) || (length % sizeof(uint32_t)) != 0) {
+        cached_data->rejected = true;
+        return false;
+    }
+
+    // The snapshot loader needs 32 bit aligned data, which is not guaranteed
+    // for buffers coming from JS (e.g. Buffer slices).
+    std::vector<uint32_t> aligned;
+    const uint32_t* words = reinterpret_cast<const uint32_t*>(cached_data->data);
+
+    if ((reinterpret_cast<uintptr_t>(cached_data->data) % sizeof(uint32_t)) != 0) {
+        aligned.resize(length / sizeof(uint32_t));
+        memcpy(aligned.data(), cached_data->data, length);
+        words = aligned.data();
+    }
+
+    const Header* header = reinterpret_cast<const Header*>(words);
+
+    if (header->magic != kCodeCacheMagic
+        || header->version != VersionTag()
+        || header->snapshot_offset < sizeof(Header)
+        || (header->snapshot_offset % sizeof(uint32_t)) != 0
+        || header->snapshot_offset > length
+        || header->snapshot_size == 0
+        || header->snapshot_size > length - header->snapshot_offset
+        || header->source_size != source_size
+        || header->source_hash != HashSource(source, source_size)) {
+        cached_data->rejected = true;
+        return false;
+    }
+
+    // Static data is never released or modified, so its byte code can be used without copying it to the heap.
+    uint32_t exec_opts = JERRY_SNAPSHOT_EXEC_COPY_DATA;
+    if (aligned.empty() && IsStaticData(cached_data->data, length)) {
+        exec_opts = JERRY_SNAPSHOT_EXEC_ALLOW_STATIC;
+    }
+
+    jerry_value_t loaded = jerry_load_function_snapshot(words + header->snapshot_offset / sizeof(uint32_t),
+                                                        header->snapshot_size,
+                                                        header->function_index,
+                                                        exec_opts);
+
+    if (jerry_value_is_error(loaded)) {
+        jerry_release_value(loaded);
+        cached_data->rejected = true;
+        return false;
+    }
+
+    *script = loaded;
+    return true;
+}
+
+/* static */
+v8::ScriptCompiler::CachedData* JerryCodeCache::Merge(const v8::ScriptCompiler::CachedData* const* cached_data,
+                                                      int count) {
+    if (count <= 0) {
+        return NULL;
+    }
+
+    std::vector<std::vector<uint32_t> > aligned((size_t) count);
+    std::vector<const uint32_t*> snapshots;
+    std::vector<size_t> snapshot_sizes;
+    std::vector<Header> headers;
+
+    for (int idx = 0; idx < count; idx++) {
+        const uint8_t* data = cached_data[idx]->data;
+        size_t length = cached_data[idx]->length > 0 ? (size_t) cached_data[idx]->length : 0;
+
+        if (length <= sizeof(Header) || (length % sizeof(uint32_t)) != 0) {
+            return NULL;
+        }
+
+        const uint32_t* words = reinterpret_cast<const uint32_t*>(data);
+
+        if ((reinterpret_cast<uintptr_t>(data) % sizeof(uint32_t)) != 0) {
+            aligned[idx].resize(length / sizeof(uint32_t));
+            memcpy(aligned[idx].data(), data, length);
+            words = aligned[idx].data();
+        }
+
+        const Header* header = reinterpret_cast<const Header*>(words);
+
+        // Only cached data of a single script (as created by Produce) can be merged.
+        if (header->magic != kCodeCacheMagic
+            || header->version != VersionTag()
+            || header->snapshot_offset != sizeof(Header)
+            || header->snapshot_size != length - sizeof(Header)
+            || header->function_index != 0) {
+            return NULL;
+        }
+
+        headers.push_back(*header);
+        snapshots.push_back(words + sizeof(Header) / sizeof(uint32_t));
+        snapshot_sizes.push_back(header->snapshot_size);
+    }
+
+    const size_t header_words = (size_t) count * sizeof(Header) / sizeof(uint32_t);
+    std::vector<uint32_t> buffer;
+    size_t merged_size;
+
+    if (count == 1) {
+        // The engine only merges two or more snapshots.
+        merged_size = snapshot_sizes[0];
+        buffer.resize(header_words + merged_size / sizeof(uint32_t));
+        memcpy(buffer.data() + header_words, snapshots[0], merged_size);
+    } else {
+        // Every input has its own snapshot header and literal table, so the merged
+        // snapshot is never larger than the inputs together, apart from the
+        // function offset table and its alignment.
+        size_t buffer_size = 2 * sizeof(uint64_t) + (size_t) count * sizeof(uint32_t);
+        for (size_t idx = 0; idx < snapshot_sizes.size(); idx++) {
+            buffer_size += snapshot_sizes[idx];
+        }
+
+        buffer.resize(header_words + buffer_size / sizeof(uint32_t));
+
+        const char* error = NULL;
+        merged_size = jerry_merge_snapshots(snapshots.data(), snapshot_sizes.data(), snapshots.size(),
+                                            buffer.data() + header_words, buffer_size, &error);
+
+        if (merged_size == 0) {
+            return NULL;
+        }
+
+        buffer.resize(header_words + merged_size / sizeof(uint32_t));
+    }
+
+    for (int idx = 0; idx < count; idx++) {
+        Header* header = reinterpret_cast<Header*>(buffer.data()) + idx;
+
+        *header = headers[idx];
+        header->snapshot_offset = (uint32_t) ((count - idx) * sizeof(Header));
+        header->snapshot_size = (uint32_t) merged_size;
+        header->function_index = (uint32_t) idx;
+    }
+
+    size_t length = buffer.size() * sizeof(uint32_t);
+    uint8_t* data = new uint8_t[length];
+    memcpy(data, buffer.data(), length);
+
+    return new v8::ScriptCompiler::CachedData(data, (int) length, v8::ScriptCompiler::CachedData::BufferOwned);
+}
@@ -0,0 +1,64 @@
+#ifndef V8JERRY_CODE_CACHE_HPP
+#define V8JERRY_CODE_CACHE_HPP
+
+#include <v8.h>
+
+#include "jerryscript.h"
+
+/* Code cache backed by JerryScript snapshots.
+ *
+ * The cached data starts with a JerryCodeCache::Header which identifies the
+ * engine and the source, and refers to the snapshot of the script's global code.
+ * Consuming it loads the byte code directly instead of parsing the source.
+ *
+ * The snapshot usually follows the header. Merged bundles start with the
+ * headers of all scripts, followed by a single snapshot holding every script.
+ */
+class JerryCodeCache {
+public:
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t source_hash;
+        uint32_t source_size;
+        uint32_t snapshot_offset; /* relative to the start of the header */
+        uint32_t snapshot_size;
+        uint32_t function_index;
+        uint32_t reserved;
+    };
+
+    /* Identifies the cached data format and the byte code version of the engine. */
+    static uint32_t VersionTag(void);
+
+    /* Parse the source into a snapshot and load it as a script.
+     * On success the cached data is set and the script is returned,
+     * otherwise false is returned and the source must be parsed normally. */
+    static bool Produce(const jerry_char_t* resource_name, size_t resource_name_size,
+                        const jerry_char_t* source, size_t source_size,
+                        v8::ScriptCompiler::CachedData** cached_data, jerry_value_t* script);
+
+    /* Load the script from the cached data. If the cached data does not
+     * belong to the source it is marked as rejected and false is returned. */
+    static bool Consume(v8::ScriptCompiler::CachedData* cached_data,
+                        const jerry_char_t* source, size_t source_size,
+                        jerry_value_t* script);
+
+    /* Merge the cached data of several scripts into a bundle, where literals
+     * shared by the scripts are stored once. The cached data of the index-th
+     * script starts at BundleEntryOffset(index). Returns NULL on failure. */
+    static v8::ScriptCompiler::CachedData* Merge(const v8::ScriptCompiler::CachedData* const* cached_data, int count);
+
+    static size_t BundleEntryOffset(int index) { return (size_t) index * sizeof(Header); }
+
+    /* Register a block of cached data which outlives the engine (e.g. the code
+     * cache of the embedder's built-in scripts compiled into the binary, or a
+     * read-only mapping of a code cache file). Byte code loaded from these
+     * blocks is executed in place, so processes mapping the same file share it. */
+    static void AddStaticData(const char* data, size_t size);
+
+private:
+    static bool IsStaticData(const uint8_t* data, size_t size);
+    static uint32_t HashSource(const jerry_char_t* source, size_t source_size);
+};
+
+#endif /* V8JERRY_CODE_CACHE_HPP */
@@ -0,0 +1,91 @@
+#include "v8jerry_finalizer.hpp"
+
+#include <cstdlib>
+
+static void FinalizerFreeMemory(void* ptr) {
+    free(ptr);
+}
+
+/* static */
+JerryFinalizer& JerryFinalizer::Instance(void) {
+    static JerryFinalizer s_instance;
+    return s_instance;
+}
+
+/* static */
+void JerryFinalizer::Free(void* ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+
+    Instance().Enqueue(FinalizerFreeMemory, ptr);
+}
+
+/* static */
+void JerryFinalizer::Shutdown(void) {
+    Instance().Stop();
+}
+
+void JerryFinalizer::Enqueue(FreeCallback callback, void* data) {
+    bool wakeup;
+
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+
+        if (!m_running) {
+            m_stop = false;
+            m_thread = std::thread(&JerryFinalizer::Run, this);
+            m_running = true;
+        }
+
+        // A GC frees many objects in a row: only the first one of a
+        // batch wakes up the background thread.
+        wakeup = m_pending.empty();
+        m_pending.push_back(Item{callback, data});
+    }
+
+    if (wakeup) {
+        m_wakeup.notify_one();
+    }
+}
+
+void JerryFinalizer::Stop(void) {
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+
+        if (!m_running) {
+            return;
+        }
+
+        m_stop = true;
+    }
+
+    m_wakeup.notify_one();
+    m_thread.join();
+
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_running = false;
+}
+
+void JerryFinalizer::Run(void) {
+    std::vector<Item> batch;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> guard(m_lock);
+            m_wakeup.wait(guard, [this] { return m_stop || !m_pending.empty(); });
+
+            if (m_pending.empty()) {
+                // Stop was requested and everything is processed.
+                return;
+            }
+
+            batch.swap(m_pending);
+        }
+
+        for (const Item& item : batch) {
+            item.callback(item.data);
+        }
+        batch.clear();
+    }
+}
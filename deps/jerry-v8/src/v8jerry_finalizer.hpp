@@ -0,0 +1,51 @@
+#ifndef V8JERRY_FINALIZER_HPP
+#define V8JERRY_FINALIZER_HPP
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Deferred finalization of native memory.
+ *
+ * Native free callbacks are called by the JerryScript GC while the engine is
+ * in the middle of a collection. Work which only releases native memory (and
+ * never touches the engine) is handed over to a background thread, so freeing
+ * large external buffers does not extend the GC pause.
+ */
+class JerryFinalizer {
+public:
+    typedef void (*FreeCallback)(void* data);
+
+    /* Free a malloc-ed block on the background thread. */
+    static void Free(void* ptr);
+
+    /* Wait for all scheduled work and stop the background thread. */
+    static void Shutdown(void);
+
+private:
+    struct Item {
+        FreeCallback callback;
+        void* data;
+    };
+
+    JerryFinalizer(void) : m_running(false), m_stop(false) {}
+    /* Runs on exit() without Isolate::Dispose (e.g. process.exit()):
+     * destroying a joinable std::thread would call std::terminate. */
+    ~JerryFinalizer(void) { Stop(); }
+
+    static JerryFinalizer& Instance(void);
+
+    void Enqueue(FreeCallback callback, void* data);
+    void Stop(void);
+    void Run(void);
+
+    std::mutex m_lock;
+    std::condition_variable m_wakeup;
+    std::thread m_thread;
+    std::vector<Item> m_pending;
+    bool m_running;
+    bool m_stop;
+};
+
+#endif /* V8JERRY_FINALIZER_HPP */
@@ -7,15 +7,32 @@
 #include <sstream>
 
 #include "v8jerry_handlescope.hpp"
+#include "v8jerry_finalizer.hpp"
 #include "v8jerry_flags.hpp"
 #include "v8jerry_templates.hpp"
 #include "v8jerry_utils.hpp"
 
 JerryIsolate* JerryIsolate::s_currentIsolate = nullptr;
 
+static jerry_value_t IsolateInterruptCallback(void *user_p) {
+    JerryIsolate* isolate = reinterpret_cast<JerryIsolate*>(user_p);
+
+    if (!isolate->IsTerminated()) {
+        isolate->RunInterrupts();
+    }
+
+    // An interrupt callback may also terminate the execution.
+    if (isolate->IsTerminated()) {
+        return jerry_create_string ((const jerry_char_t *) "Script Abort Requested");
+    }
+
+    return jerry_create_undefined();
+}
+
 JerryIsolate::JerryIsolate(const v8::Isolate::CreateParams& params) {
     m_terminated = false;
     jerry_init(JERRY_INIT_EMPTY/* | JERRY_INIT_MEM_STATS*/);
+    jerry_set_vm_interrupt_callback(IsolateInterruptCallback, this);
     m_fatalErrorCallback = nullptr;
 
     m_fn_map_new = new JerryPolyfill("new_map", "", "return new Map();");
@@ -54,19 +71,40 @@ void JerryIsolate::Exit(void) {
     }
 }
 
-static jerry_value_t IsolateTerminateCallback(void *user_p) {
-    return jerry_create_string ((const jerry_char_t *) "Script Abort Requested");
-}
-
+// May be called from any thread (e.g. node's watchdogs): only the
+// terminated flag and the VM interrupt flag are written here.
 void JerryIsolate::Terminate(void) {
     m_terminated = true;
-
-    jerry_set_vm_exec_stop_callback(IsolateTerminateCallback, NULL, 1);
+    jerry_request_vm_interrupt();
 }
 
 void JerryIsolate::CancelTerminate(void) {
+    // A still pending interrupt request is cleared by the next safe point.
     m_terminated = false;
-    jerry_set_vm_exec_stop_callback(NULL, NULL, 1);
+}
+
+// May be called from any thread.
+void JerryIsolate::RequestInterrupt(v8::InterruptCallback callback, void* data) {
+    {
+        std::lock_guard<std::mutex> guard(m_interrupts_lock);
+        m_interrupts.push_back(Interrupt{callback, data});
+    }
+
+    jerry_request_vm_interrupt();
+}
+
+void JerryIsolate::RunInterrupts(void) {
+    std::vector<Interrupt> interrupts;
+
+    {
+        std::lock_guard<std::mutex> guard(m_interrupts_lock);
+        interrupts.swap(m_interrupts);
+    }
+
+    // Callbacks may request new interrupts, those are serviced at the next safe point.
+    for (const Interrupt& interrupt : interrupts) {
+        interrupt.callback(JerryIsolate::toV8(this), interrupt.data);
+    }
 }
 
 namespace v8 {
@@ -151,6 +189,9 @@ void JerryIsolate::Dispose(void) {
 
     jerry_cleanup();
 
+    // Everything freed by the final GC is released before the isolate is gone.
+    JerryFinalizer::Shutdown();
+
     // Warning!... Do not use the JerryIsolate after this!
     // If you do: dragons will spawn from the depths of the earth and tear everything apart!
     // You have been warned!
@@ -1,7 +1,9 @@
 #ifndef V8JERRY_ISOLATE_HPP
 #define V8JERRY_ISOLATE_HPP
 
+#include <atomic>
 #include <deque>
+#include <mutex>
 #include <vector>
 #include <unordered_map>
 
@@ -44,6 +46,9 @@ public:
     void Terminate(void);
     void CancelTerminate(void);
 
+    void RequestInterrupt(v8::InterruptCallback callback, void* data);
+    void RunInterrupts(void);
+
     void RunWeakCleanup(void);
     void Dispose(void);
 
@@ -113,6 +118,11 @@ private:
         void* data;
     };
 
+    struct Interrupt {
+        v8::InterruptCallback callback;
+        void* data;
+    };
+
 
     void SetError(JerryValue* error);
     void InitalizeSlots(void);
@@ -157,11 +167,17 @@ private:
     v8::FatalErrorCallback m_fatalErrorCallback;
     v8::MessageCallback m_messageCallback;
 
-    bool m_terminated;
+    // Set from the watchdog threads, read by the VM interrupt callback.
+    std::atomic<bool> m_terminated;
     bool m_autorun_tasks;
 
     std::vector<Task*> m_tasks;
 
+    // Interrupts can be requested from any thread, they are serviced
+    // by the VM on the JS thread.
+    std::mutex m_interrupts_lock;
+    std::vector<Interrupt> m_interrupts;
+
     v8::PromiseHook m_promise_hook;
     v8::PromiseRejectCallback m_promise_reject_calback;
 
@@ -64,7 +64,7 @@ static jerry_value_t JerryHandlerStackTrace(const jerry_value_t func,
 static jerry_value_t JerryHandlerGC(const jerry_value_t func,
                                     const jerry_value_t thisarg,
                                     const jerry_value_t argv[],
-                                    const jerry_value_t argc) {
+                                    const jerry_length_t argc) {
     jerry_gc (JERRY_GC_PRESSURE_LOW);
     return jerry_create_undefined();
 }
@@ -101,7 +101,7 @@ extern "C" bool ecma_get_object_is_builtin(void* obj);
 #define ECMA_OBJECT_MAX_REF (0x3ffu << 6)
 #define ECMA_VALUE_TYPE_MASK 0x7u
 #define ECMA_VALUE_SHIFT 3
-typedef uint32_t ecma_value_t;
+typedef jerry_value_t ecma_value_t;
 
 extern "C" void * jmem_decompress_pointer (uintptr_t compressed_pointer);
 
@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "v8env.h"
+#include "v8-jerry.h"
+#include "assert.h"
+
+// JavaScript source code.
+const char jsSource[] = "               \
+    var a = 2;                          \
+    var b = 'Cached: ';                 \
+    function add(x, y) { return x + y; } \
+                                        \
+    for (var i = 0; i < 10; i++) {      \
+        a = add(a, i);                  \
+    }                                   \
+                                        \
+    b + a;                              \
+";
+
+// Evaluates to the same result as jsSource.
+const char jsOtherSource[] = "var c = 'Cached: '; c + (40 + 7);";
+
+static v8::Local<v8::UnboundScript> compile(V8Environment& env, v8::ScriptCompiler::CachedData** produced,
+                                            const char* code = jsSource) {
+    v8::Isolate* isolate = env.getIsolate();
+    v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate, code, v8::NewStringType::kNormal).ToLocalChecked();
+    v8::Local<v8::String> name = v8::String::NewFromUtf8(isolate, "code_cache.js", v8::NewStringType::kNormal).ToLocalChecked();
+    v8::ScriptOrigin origin(name);
+
+    v8::ScriptCompiler::Source script_source(source, origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source, v8::ScriptCompiler::kProduceCodeCache).ToLocalChecked();
+
+    // The source owns the cached data, copy it to keep it around.
+    const v8::ScriptCompiler::CachedData* data = script_source.GetCachedData();
+    *produced = NULL;
+    if (data != NULL) {
+        uint8_t* copy = new uint8_t[data->length];
+        memcpy(copy, data->data, data->length);
+        *produced = new v8::ScriptCompiler::CachedData(copy, data->length, v8::ScriptCompiler::CachedData::BufferOwned);
+    }
+
+    return script;
+}
+
+static v8::Local<v8::UnboundScript> consume(V8Environment& env, v8::ScriptCompiler::CachedData* cached, const char* code) {
+    v8::Isolate* isolate = env.getIsolate();
+    v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate, code, v8::NewStringType::kNormal).ToLocalChecked();
+    v8::ScriptCompiler::Source script_source(source, cached);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source, v8::ScriptCompiler::kConsumeCodeCache).ToLocalChecked();
+    ASSERT_EQUAL(script_source.GetCachedData()->rejected, false);
+    return script;
+}
+
+static void checkResult(V8Environment& env, v8::Local<v8::UnboundScript> script) {
+    v8::Local<v8::Value> result = script->BindToCurrentContext()->Run(env.getContext()).ToLocalChecked();
+
+    v8::String::Utf8Value utf8(env.getIsolate(), result);
+    ASSERT_STR_EQUAL(*utf8, "Cached: 47");
+}
+
+int main(int argc, char* argv[]) {
+    // Initialize V8.
+    V8Environment env(argc, argv);
+
+    ASSERT_EQUAL(v8::ScriptCompiler::CachedDataVersionTag() != 0, true);
+
+    v8::ScriptCompiler::CachedData* produced = NULL;
+    checkResult(env, compile(env, &produced));
+    ASSERT_EQUAL(produced != NULL, true);
+
+    // Consume the cache.
+    v8::ScriptCompiler::CachedData* cached = new v8::ScriptCompiler::CachedData(produced->data, produced->length);
+    {
+        v8::Isolate* isolate = env.getIsolate();
+        v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate, jsSource, v8::NewStringType::kNormal).ToLocalChecked();
+        v8::ScriptCompiler::Source script_source(source, cached);
+        v8::Local<v8::UnboundScript> script =
+            v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source, v8::ScriptCompiler::kConsumeCodeCache).ToLocalChecked();
+        ASSERT_EQUAL(script_source.GetCachedData()->rejected, false);
+        checkResult(env, script);
+    }
+
+    // A different source must reject the cache and fall back to parsing.
+    cached = new v8::ScriptCompiler::CachedData(produced->data, produced->length);
+    {
+        v8::Isolate* isolate = env.getIsolate();
+        v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate, "'Cached: ' + 47", v8::NewStringType::kNormal).ToLocalChecked();
+        v8::ScriptCompiler::Source script_source(source, cached);
+        v8::Local<v8::UnboundScript> script =
+            v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source, v8::ScriptCompiler::kConsumeCodeCache).ToLocalChecked();
+        ASSERT_EQUAL(script_source.GetCachedData()->rejected, true);
+        checkResult(env, script);
+    }
+
+    // Code caches merged into a bundle are consumed from their entry offsets.
+    v8::ScriptCompiler::CachedData* other = NULL;
+    checkResult(env, compile(env, &other, jsOtherSource));
+    ASSERT_EQUAL(other != NULL, true);
+
+    const v8::ScriptCompiler::CachedData* inputs[] = { produced, other };
+    v8::ScriptCompiler::CachedData* bundle = v8::jerry::MergeCodeCaches(inputs, 2);
+    ASSERT_EQUAL(bundle != NULL, true);
+    // The literals shared by the scripts are stored once.
+    ASSERT_EQUAL(bundle->length < produced->length + other->length, true);
+
+    for (int i = 1; i >= 0; i--) {
+        int offset = v8::jerry::BundleEntryOffset(i);
+        cached = new v8::ScriptCompiler::CachedData(bundle->data + offset, bundle->length - offset);
+        checkResult(env, consume(env, cached, i == 0 ? jsSource : jsOtherSource));
+    }
+
+    // An entry only matches its own source.
+    cached = new v8::ScriptCompiler::CachedData(bundle->data, bundle->length);
+    {
+        v8::Isolate* isolate = env.getIsolate();
+        v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate, jsOtherSource, v8::NewStringType::kNormal).ToLocalChecked();
+        v8::ScriptCompiler::Source script_source(source, cached);
+        v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source, v8::ScriptCompiler::kConsumeCodeCache).ToLocalChecked();
+        ASSERT_EQUAL(script_source.GetCachedData()->rejected, true);
+    }
+
+    // A bundle cannot be merged again.
+    const v8::ScriptCompiler::CachedData* nested[] = { bundle, other };
+    ASSERT_EQUAL(v8::jerry::MergeCodeCaches(nested, 2) == NULL, true);
+
+    // Bundles registered as static code caches (e.g. mapped files) are executed in place.
+    static uint32_t mapped_bundle[4096];
+    ASSERT_EQUAL((size_t) bundle->length <= sizeof(mapped_bundle), true);
+    memcpy(mapped_bundle, bundle->data, bundle->length);
+    v8::jerry::RegisterStaticCodeCache(mapped_bundle, bundle->length);
+
+    for (int i = 0; i < 2; i++) {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(mapped_bundle) + v8::jerry::BundleEntryOffset(i);
+        cached = new v8::ScriptCompiler::CachedData(data, bundle->length - v8::jerry::BundleEntryOffset(i));
+        v8::Local<v8::UnboundScript> script = consume(env, cached, i == 0 ? jsSource : jsOtherSource);
+        checkResult(env, script);
+        checkResult(env, script);
+    }
+
+    delete bundle;
+    delete other;
+
+    // Cached data registered as natives blob is executed in place.
+    static uint32_t natives_blob[4096];
+    ASSERT_EQUAL((size_t) produced->length <= sizeof(natives_blob), true);
+    memcpy(natives_blob, produced->data, produced->length);
+
+    v8::StartupData startup_data = { reinterpret_cast<const char*>(natives_blob), produced->length };
+    v8::V8::SetNativesDataBlob(&startup_data);
+
+    cached = new v8::ScriptCompiler::CachedData(reinterpret_cast<const uint8_t*>(natives_blob), produced->length);
+    {
+        v8::Isolate* isolate = env.getIsolate();
+        v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate, jsSource, v8::NewStringType::kNormal).ToLocalChecked();
+        v8::ScriptCompiler::Source script_source(source, cached);
+        v8::Local<v8::UnboundScript> script =
+            v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source, v8::ScriptCompiler::kConsumeCodeCache).ToLocalChecked();
+        ASSERT_EQUAL(script_source.GetCachedData()->rejected, false);
+        checkResult(env, script);
+        checkResult(env, script);
+    }
+
+    delete produced;
+    return 0;
+}
@@ -0,0 +1,46 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "v8env.h"
+#include "assert.h"
+
+#define BUFFER_COUNT 64
+#define BUFFER_SIZE 1024
+
+// Enough garbage to run the GC a few times.
+const char jsSource[] = "                \
+    for (var i = 0; i < 100000; i++) {   \
+        var garbage = { index: i };      \
+    }                                    \
+    true;                                \
+";
+
+int main(int argc, char* argv[]) {
+    // Initialize V8.
+    V8Environment env(argc, argv);
+    v8::Isolate* isolate = env.getIsolate();
+
+    {
+        v8::HandleScope handle_scope(isolate);
+
+        // Internalized buffers are released on the finalizer thread.
+        for (int i = 0; i < BUFFER_COUNT; i++) {
+            void* data = calloc(1, BUFFER_SIZE);
+            v8::ArrayBuffer::New(isolate, data, BUFFER_SIZE, v8::ArrayBufferCreationMode::kInternalized);
+        }
+    }
+
+    {
+        v8::HandleScope handle_scope(isolate);
+        v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate, jsSource, v8::NewStringType::kNormal).ToLocalChecked();
+        v8::Local<v8::Script> script = v8::Script::Compile(env.getContext(), source).ToLocalChecked();
+        v8::Local<v8::Value> result = script->Run(env.getContext()).ToLocalChecked();
+
+        ASSERT_EQUAL(result->IsTrue(), true);
+    }
+
+    // Like process.exit(), exit without disposing the isolate: the static
+    // destructors must not abort because of a running finalizer thread.
+    fflush(stdout);
+    exit(0);
+}
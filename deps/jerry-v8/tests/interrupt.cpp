@@ -0,0 +1,62 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include "v8env.h"
+#include "assert.h"
+
+// JavaScript source code.
+const char jsSource[] = "               \
+    function step(value) {              \
+        return value + 1;               \
+    }                                   \
+                                        \
+    var i = 0;                          \
+    while (true) {                      \
+        i = step(i);                    \
+    }                                   \
+";
+
+static int interrupt_count = 0;
+
+static void InterruptCallback(v8::Isolate* isolate, void* data) {
+    interrupt_count++;
+
+    // The callback runs on the JS thread at a safe point, so it may stop the script.
+    if (*reinterpret_cast<int*>(data) == 2) {
+        isolate->TerminateExecution();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    // Initialize V8.
+    V8Environment env(argc, argv);
+    v8::Isolate* isolate = env.getIsolate();
+
+    static int first = 1;
+    static int second = 2;
+
+    std::thread profiler([isolate]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        isolate->RequestInterrupt(InterruptCallback, &first);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        isolate->RequestInterrupt(InterruptCallback, &second);
+    });
+
+    {
+        v8::TryCatch try_catch(isolate);
+        v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate, jsSource, v8::NewStringType::kNormal).ToLocalChecked();
+        v8::Local<v8::Script> script = v8::Script::Compile(env.getContext(), source).ToLocalChecked();
+        v8::MaybeLocal<v8::Value> result = script->Run(env.getContext());
+
+        ASSERT_EQUAL(result.IsEmpty(), true);
+    }
+
+    profiler.join();
+    ASSERT_EQUAL(interrupt_count, 2);
+
+    isolate->CancelTerminateExecution();
+
+    return 0;
+}
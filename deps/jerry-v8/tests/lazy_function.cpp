@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include "v8env.h"
+#include "assert.h"
+
+// Function bodies longer than the lazy compilation threshold.
+const char jsSource[] = "                                                   \n\
+function add(a, b) {                                                        \n\
+    var unused = 'this body is long enough to be compiled lazily';          \n\
+    return a + b;                                                           \n\
+}                                                                           \n\
+function isStrict() {                                                       \n\
+    'use strict';                                                           \n\
+    var unused = 'this body is long enough to be compiled lazily';          \n\
+    return this === undefined;                                              \n\
+}                                                                           \n\
+function counter() {                                                        \n\
+    var count = 0;                                                          \n\
+    return function increment() {                                           \n\
+        var unused = 'this body is long enough to be compiled lazily';      \n\
+        return ++count;                                                     \n\
+    };                                                                      \n\
+}                                                                           \n\
+var immediate = (function () {                                              \n\
+    var unused = 'this body is long enough to be compiled lazily';          \n\
+    return 'immediate';                                                     \n\
+})();                                                                       \n\
+";
+
+// Early errors of long bodies are reported when the script is compiled.
+const char invalidSource[] = "                                              \n\
+function valid() {                                                          \n\
+    var unused = 'this body is long enough to be compiled lazily';          \n\
+    return 1;                                                               \n\
+}                                                                           \n\
+function invalid() {                                                        \n\
+    var unused = 'this body is long enough to be compiled lazily';          \n\
+    return 1 = 2;                                                           \n\
+}                                                                           \n\
+";
+
+static std::string run(V8Environment& env, const char* code) {
+    v8::Local<v8::String> source = v8::String::NewFromUtf8(env.getIsolate(), code, v8::NewStringType::kNormal).ToLocalChecked();
+    v8::Local<v8::Script> script = v8::Script::Compile(env.getContext(), source).ToLocalChecked();
+    v8::Local<v8::Value> result = script->Run(env.getContext()).ToLocalChecked();
+
+    v8::String::Utf8Value utf8(env.getIsolate(), result);
+    return std::string(*utf8);
+}
+
+int main(int argc, char* argv[]) {
+    // Initialize V8.
+    V8Environment env(argc, argv);
+
+    v8::Local<v8::String> source = v8::String::NewFromUtf8(env.getIsolate(), jsSource, v8::NewStringType::kNormal).ToLocalChecked();
+    v8::Local<v8::String> name = v8::String::NewFromUtf8(env.getIsolate(), "lazy.js", v8::NewStringType::kNormal).ToLocalChecked();
+    v8::ScriptOrigin origin(name);
+
+    v8::Local<v8::Script> script = v8::Script::Compile(env.getContext(), source, &origin).ToLocalChecked();
+    script->Run(env.getContext()).ToLocalChecked();
+
+    // Name and length are available before the body is compiled.
+    ASSERT_STR_EQUAL(run(env, "add.name + add.length").c_str(), "add2");
+    ASSERT_STR_EQUAL(run(env, "add(3, 4)").c_str(), "7");
+    ASSERT_STR_EQUAL(run(env, "isStrict()").c_str(), "true");
+
+    // Every closure shares the compiled body.
+    ASSERT_STR_EQUAL(run(env, "var c = counter(); c(); c() + ',' + counter()()").c_str(), "2,1");
+    ASSERT_STR_EQUAL(run(env, "immediate").c_str(), "immediate");
+
+    // The whole script is rejected, and the error location refers to the invalid body.
+    {
+        v8::TryCatch tc(env.getIsolate());
+
+        v8::Local<v8::String> invalid = v8::String::NewFromUtf8(env.getIsolate(), invalidSource, v8::NewStringType::kNormal).ToLocalChecked();
+        v8::Local<v8::String> invalidName = v8::String::NewFromUtf8(env.getIsolate(), "invalid.js", v8::NewStringType::kNormal).ToLocalChecked();
+        v8::ScriptOrigin invalidOrigin(invalidName);
+
+        v8::MaybeLocal<v8::Script> result = v8::Script::Compile(env.getContext(), invalid, &invalidOrigin);
+        ASSERT_EQUAL(result.IsEmpty(), true);
+        ASSERT_EQUAL(tc.HasCaught(), true);
+
+        v8::String::Utf8Value utf8(env.getIsolate(), tc.Exception());
+        std::string message(*utf8);
+        ASSERT_EQUAL(message.compare(0, 12, "SyntaxError:"), 0);
+        ASSERT_EQUAL(message.find("invalid.js:8:") != std::string::npos, true);
+    }
+
+    ASSERT_STR_EQUAL(run(env, "typeof valid").c_str(), "undefined");
+
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <string>
 #include "v8env.h"
 #include "assert.h"
 
@@ -16,6 +17,23 @@ const char jsSource[] = "               \
     b + a;                              \
 ";
 
+// Source kept outside of the engine heap, like the sources of built-in modules.
+class ExternalSource : public v8::String::ExternalOneByteStringResource {
+public:
+    const char* data() const { return jsSource; }
+    size_t length() const { return sizeof(jsSource) - 1; }
+};
+
+static std::string run(V8Environment& env, v8::Local<v8::String> source, const char* name) {
+    v8::Local<v8::String> file = v8::String::NewFromUtf8(env.getIsolate(), name, v8::NewStringType::kNormal).ToLocalChecked();
+    v8::ScriptOrigin origin(file);
+    v8::Local<v8::Script> script = v8::Script::Compile(env.getContext(), source, &origin).ToLocalChecked();
+    v8::Local<v8::Value> result = script->Run(env.getContext()).ToLocalChecked();
+
+    v8::String::Utf8Value utf8(env.getIsolate(), result);
+    return std::string(*utf8);
+}
+
 int main(int argc, char* argv[]) {
     // Initialize V8.
     V8Environment env(argc, argv);
@@ -27,5 +45,19 @@ int main(int argc, char* argv[]) {
     v8::String::Utf8Value utf8(env.getIsolate(), result);
     ASSERT_STR_EQUAL(*utf8, "Hello Script execution -> 202");
 
+    // External sources are parsed in place.
+    static ExternalSource external;
+    v8::Local<v8::String> externalSource = v8::String::NewExternalOneByte(env.getIsolate(), &external).ToLocalChecked();
+    ASSERT_STR_EQUAL(run(env, externalSource, "external.js").c_str(), "Hello Script execution -> 202");
+
+    // Characters outside of the BMP survive the conversions.
+    v8::Local<v8::String> unicodeSource =
+        v8::String::NewFromUtf8(env.getIsolate(), "'\xf0\x9f\x98\x80'.length + ' \xf0\x9f\x98\x80'", v8::NewStringType::kNormal).ToLocalChecked();
+    ASSERT_STR_EQUAL(run(env, unicodeSource, "unicode.js").c_str(), "2 \xf0\x9f\x98\x80");
+
+    // Numeric strings have no character buffer and are copied.
+    v8::Local<v8::String> numberSource = v8::String::NewFromUtf8(env.getIsolate(), "42", v8::NewStringType::kNormal).ToLocalChecked();
+    ASSERT_STR_EQUAL(run(env, numberSource, "number.js").c_str(), "42");
+
     return 0;
 }
\ No newline at end of file
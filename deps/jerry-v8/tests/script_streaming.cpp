@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include "v8env.h"
+#include "assert.h"
+
+// JavaScript source code.
+const char jsSource[] = "               \
+    var a = 2;                          \
+    var b = 'Hello \xc3\xa9 streaming -> '; \
+                                        \
+    for (var i = 0; i < 200; i++) {     \
+        a += 1;                         \
+    }                                   \
+                                        \
+    b + a;                              \
+";
+
+// Two-byte source with an unpaired surrogate and a surrogate pair in a string
+// literal: 'a\ud800b\ud83d\ude00'.
+const uint16_t jsTwoByteSource[] = {
+    '(', '\'', 'a', 0xd800, 'b', 0xd83d, 0xde00, '\'', ')', '.', 's', 'p', 'l', 'i', 't',
+    '(', '\'', '\'', ')', '.', 'm', 'a', 'p', '(', 'c', '=', '>', 'c', '.',
+    'c', 'h', 'a', 'r', 'C', 'o', 'd', 'e', 'A', 't', '(', '0', ')', ')', '.',
+    'j', 'o', 'i', 'n', '(', ')', ';'
+};
+
+// Returns the source in small chunks to test chunk boundaries.
+class ChunkedSourceStream : public v8::ScriptCompiler::ExternalSourceStream {
+public:
+    ChunkedSourceStream(const char* source, size_t length, size_t chunk_size)
+        : m_source(source)
+        , m_remaining(length)
+        , m_chunk_size(chunk_size)
+    {
+    }
+
+    virtual size_t GetMoreData(const uint8_t** src) {
+        size_t length = m_remaining < m_chunk_size ? m_remaining : m_chunk_size;
+
+        if (length > 0) {
+            uint8_t* chunk = new uint8_t[length];
+            memcpy(chunk, m_source, length);
+            *src = chunk;
+
+            m_source += length;
+            m_remaining -= length;
+        }
+        return length;
+    }
+
+private:
+    const char* m_source;
+    size_t m_remaining;
+    size_t m_chunk_size;
+};
+
+int main(int argc, char* argv[]) {
+    // Initialize V8.
+    V8Environment env(argc, argv);
+    v8::Isolate* isolate = env.getIsolate();
+
+    v8::ScriptCompiler::StreamedSource streamed_source(new ChunkedSourceStream(jsSource, strlen(jsSource), 7),
+                                                       v8::ScriptCompiler::StreamedSource::UTF8);
+    v8::ScriptCompiler::ScriptStreamingTask* task = v8::ScriptCompiler::StartStreamingScript(isolate, &streamed_source);
+
+    std::thread worker([task]() { task->Run(); });
+    worker.join();
+    delete task;
+
+    v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate, jsSource, v8::NewStringType::kNormal).ToLocalChecked();
+    v8::Local<v8::String> name = v8::String::NewFromUtf8(isolate, "streaming.js", v8::NewStringType::kNormal).ToLocalChecked();
+    v8::ScriptOrigin origin(name);
+
+    v8::Local<v8::Script> script = v8::ScriptCompiler::Compile(env.getContext(), &streamed_source, source, origin).ToLocalChecked();
+    v8::Local<v8::Value> result = script->Run(env.getContext()).ToLocalChecked();
+
+    v8::String::Utf8Value utf8(isolate, result);
+    ASSERT_STR_EQUAL(*utf8, "Hello \xc3\xa9 streaming -> 202");
+
+    // Unpaired surrogates are valid in JS sources.
+    v8::ScriptCompiler::StreamedSource two_byte_source(
+        new ChunkedSourceStream(reinterpret_cast<const char*>(jsTwoByteSource), sizeof(jsTwoByteSource), 6),
+        v8::ScriptCompiler::StreamedSource::TWO_BYTE);
+    task = v8::ScriptCompiler::StartStreamingScript(isolate, &two_byte_source);
+
+    std::thread two_byte_worker([task]() { task->Run(); });
+    two_byte_worker.join();
+    delete task;
+
+    // Only used if the source was not streamed.
+    source = v8::String::NewFromUtf8(isolate, "'not streamed'", v8::NewStringType::kNormal).ToLocalChecked();
+    script = v8::ScriptCompiler::Compile(env.getContext(), &two_byte_source, source, origin).ToLocalChecked();
+    result = script->Run(env.getContext()).ToLocalChecked();
+
+    v8::String::Utf8Value two_byte_utf8(isolate, result);
+    ASSERT_STR_EQUAL(*two_byte_utf8, "97,55296,98,55357,56832");
+
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include "v8env.h"
+#include "assert.h"
+
+// JavaScript source code.
+const char jsLoopSource[] = "           \
+    var i = 0;                          \
+    while (true) {                      \
+        i++;                            \
+    }                                   \
+";
+
+const char jsSource[] = "'Hello ' + 'after terminate';";
+
+int main(int argc, char* argv[]) {
+    // Initialize V8.
+    V8Environment env(argc, argv);
+    v8::Isolate* isolate = env.getIsolate();
+
+    // Terminate the endless loop from another thread, like node's watchdog does.
+    std::thread watchdog([isolate]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        isolate->TerminateExecution();
+    });
+
+    {
+        v8::TryCatch try_catch(isolate);
+        v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate, jsLoopSource, v8::NewStringType::kNormal).ToLocalChecked();
+        v8::Local<v8::Script> script = v8::Script::Compile(env.getContext(), source).ToLocalChecked();
+        v8::MaybeLocal<v8::Value> result = script->Run(env.getContext());
+
+        ASSERT_EQUAL(result.IsEmpty(), true);
+        ASSERT_EQUAL(isolate->IsExecutionTerminating(), true);
+    }
+
+    watchdog.join();
+    isolate->CancelTerminateExecution();
+    ASSERT_EQUAL(isolate->IsExecutionTerminating(), false);
+
+    {
+        v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate, jsSource, v8::NewStringType::kNormal).ToLocalChecked();
+        v8::Local<v8::Script> script = v8::Script::Compile(env.getContext(), source).ToLocalChecked();
+        v8::Local<v8::Value> result = script->Run(env.getContext()).ToLocalChecked();
+
+        v8::String::Utf8Value utf8(isolate, result);
+        ASSERT_STR_EQUAL(*utf8, "Hello after terminate");
+    }
+
+    return 0;
+}
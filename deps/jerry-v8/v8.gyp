@@ -22,6 +22,7 @@
       },
       'sources': [  ### gcmole(all) ###
         'deps/v8-headers/v8-debug.h',
+        'deps/v8-headers/v8-jerry.h',
         'deps/v8-headers/v8-platform.h',
         'deps/v8-headers/v8-profiler.h',
         'deps/v8-headers/v8-testing.h',
@@ -36,6 +37,10 @@
 
         'src/v8jerry_callback.cpp',
         'src/v8jerry_callback.hpp',
+        'src/v8jerry_code_cache.cpp',
+        'src/v8jerry_code_cache.hpp',
+        'src/v8jerry_finalizer.cpp',
+        'src/v8jerry_finalizer.hpp',
         'src/v8jerry_context.hpp',
         'src/v8jerry_flags.cpp',
         'src/v8jerry_flags.hpp',
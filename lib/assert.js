@@ -19,10 +19,6 @@
 // WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 'use strict';
 
-function asyncGeneratorStep(gen, resolve, reject, _next, _throw, key, arg) { try { var info = gen[key](arg); var value = info.value; } catch (error) { reject(error); return; } if (info.done) { resolve(value); } else { Promise.resolve(value).then(_next, _throw); } }
-
-function _asyncToGenerator(fn) { return function () { var self = this, args = arguments; return new Promise(function (resolve, reject) { var gen = fn.apply(self, args); function _next(value) { asyncGeneratorStep(gen, resolve, reject, _next, _throw, "next", value); } function _throw(err) { asyncGeneratorStep(gen, resolve, reject, _next, _throw, "throw", err); } _next(undefined); }); }; }
-
 function _slicedToArray(arr, i) { return _arrayWithHoles(arr) || _iterableToArrayLimit(arr, i) || _nonIterableRest(); }
 
 function _nonIterableRest() { throw new TypeError("Invalid attempt to destructure non-iterable instance"); }
@@ -899,55 +895,23 @@ function getActual(block) {
   }
 }
 
-function waitForActual(_x) {
-  return _waitForActual.apply(this, arguments);
-} // Expected to throw an error.
+async function waitForActual(block) {
+  if (typeof block !== 'function') {
+    throw new errors.TypeError('ERR_INVALID_ARG_TYPE', 'block', 'Function', block);
+  }
 
+  // Return a rejected promise if `block` throws synchronously.
+  var resultPromise = block();
+
+  try {
+    await resultPromise;
+  } catch (e) {
+    return e;
+  }
+
+  return errors.NO_EXCEPTION_SENTINEL;
+} // Expected to throw an error.
 
-function _waitForActual() {
-  _waitForActual = _asyncToGenerator(
-  /*#__PURE__*/
-  regeneratorRuntime.mark(function _callee(block) {
-    var resultPromise;
-    return regeneratorRuntime.wrap(function _callee$(_context) {
-      while (1) {
-        switch (_context.prev = _context.next) {
-          case 0:
-            if (!(typeof block !== 'function')) {
-              _context.next = 2;
-              break;
-            }
-
-            throw new errors.TypeError('ERR_INVALID_ARG_TYPE', 'block', 'Function', block);
-
-          case 2:
-            // Return a rejected promise if `block` throws synchronously.
-            resultPromise = block();
-            _context.prev = 3;
-            _context.next = 6;
-            return resultPromise;
-
-          case 6:
-            _context.next = 11;
-            break;
-
-          case 8:
-            _context.prev = 8;
-            _context.t0 = _context["catch"](3);
-            return _context.abrupt("return", _context.t0);
-
-          case 11:
-            return _context.abrupt("return", errors.NO_EXCEPTION_SENTINEL);
-
-          case 12:
-          case "end":
-            return _context.stop();
-        }
-      }
-    }, _callee, null, [[3, 8]]);
-  }));
-  return _waitForActual.apply(this, arguments);
-}
 
 function expectsError(stackStartFn, actual, error, message) {
   if (typeof error === 'string') {
@@ -1015,48 +979,8 @@ function _throws(block) {
 
 assert["throws"] = _throws;
 
-function rejects(_x2) {
-  return _rejects.apply(this, arguments);
-}
-
-function _rejects() {
-  _rejects = _asyncToGenerator(
-  /*#__PURE__*/
-  regeneratorRuntime.mark(function _callee2(block) {
-    var _len2,
-        args,
-        _key2,
-        _args2 = arguments;
-
-    return regeneratorRuntime.wrap(function _callee2$(_context2) {
-      while (1) {
-        switch (_context2.prev = _context2.next) {
-          case 0:
-            for (_len2 = _args2.length, args = new Array(_len2 > 1 ? _len2 - 1 : 0), _key2 = 1; _key2 < _len2; _key2++) {
-              args[_key2 - 1] = _args2[_key2];
-            }
-
-            _context2.t0 = expectsError;
-            _context2.t1 = void 0;
-            _context2.t2 = rejects;
-            _context2.next = 6;
-            return waitForActual(block);
-
-          case 6:
-            _context2.t3 = _context2.sent;
-            _context2.t4 = args;
-            _context2.t5 = [_context2.t2, _context2.t3].concat(_context2.t4);
-
-            _context2.t0.apply.call(_context2.t0, _context2.t1, _context2.t5);
-
-          case 10:
-          case "end":
-            return _context2.stop();
-        }
-      }
-    }, _callee2);
-  }));
-  return _rejects.apply(this, arguments);
+async function rejects(block, ...args) {
+  expectsError.apply(void 0, [rejects, await waitForActual(block)].concat(args));
 }
 
 assert.rejects = rejects;
@@ -1071,48 +995,8 @@ function doesNotThrow(block) {
 
 assert.doesNotThrow = doesNotThrow;
 
-function doesNotReject(_x3) {
-  return _doesNotReject.apply(this, arguments);
-}
-
-function _doesNotReject() {
-  _doesNotReject = _asyncToGenerator(
-  /*#__PURE__*/
-  regeneratorRuntime.mark(function _callee3(block) {
-    var _len4,
-        args,
-        _key4,
-        _args3 = arguments;
-
-    return regeneratorRuntime.wrap(function _callee3$(_context3) {
-      while (1) {
-        switch (_context3.prev = _context3.next) {
-          case 0:
-            for (_len4 = _args3.length, args = new Array(_len4 > 1 ? _len4 - 1 : 0), _key4 = 1; _key4 < _len4; _key4++) {
-              args[_key4 - 1] = _args3[_key4];
-            }
-
-            _context3.t0 = expectsNoError;
-            _context3.t1 = void 0;
-            _context3.t2 = doesNotReject;
-            _context3.next = 6;
-            return waitForActual(block);
-
-          case 6:
-            _context3.t3 = _context3.sent;
-            _context3.t4 = args;
-            _context3.t5 = [_context3.t2, _context3.t3].concat(_context3.t4);
-
-            _context3.t0.apply.call(_context3.t0, _context3.t1, _context3.t5);
-
-          case 10:
-          case "end":
-            return _context3.stop();
-        }
-      }
-    }, _callee3);
-  }));
-  return _doesNotReject.apply(this, arguments);
+async function doesNotReject(block, ...args) {
+  expectsNoError.apply(void 0, [doesNotReject, await waitForActual(block)].concat(args));
 }
 
 assert.doesNotReject = doesNotReject;
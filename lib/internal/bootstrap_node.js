@@ -391,6 +391,32 @@ _ref) {
     global.Buffer = NativeModule.require('buffer').Buffer;
     process.domain = null;
     process._exiting = false;
+    setupRegeneratorRuntime();
+  }
+
+  function setupRegeneratorRuntime() {
+    // Core modules use native generators and async functions. The
+    // regenerator runtime is only loaded when transpiled user code
+    // refers to the global regeneratorRuntime.
+    function setRuntime(value) {
+      Object.defineProperty(global, 'regeneratorRuntime', {
+        configurable: true,
+        writable: true,
+        enumerable: true,
+        value: value
+      });
+    }
+
+    Object.defineProperty(global, 'regeneratorRuntime', {
+      configurable: true,
+      enumerable: false,
+      get: function get() {
+        var runtime = NativeModule.require('internal/regenerator');
+        setRuntime(runtime);
+        return runtime;
+      },
+      set: setRuntime
+    });
   }
 
   function setupGlobalTimeouts() {
@@ -592,10 +618,11 @@ _ref) {
   // core modules found in lib/*.js. All core modules are compiled into the
   // node binary, so they can be loaded faster.
   var ContextifyScript = process.binding('contextify').ContextifyScript;
+  var utilBinding = process.binding('util');
+  var kStaticCachedData = utilBinding.contextify_static_cached_data_private_symbol;
 
 
   function runInThisContext(code, options) {
-    NativeModule.require("internal/regenerator");
     var script = new ContextifyScript(code, options);
     return script.runInThisContext();
     //return eval(code);
@@ -610,6 +637,7 @@ _ref) {
   }
 
   NativeModule._source = process.binding('natives');
+  NativeModule._codeCache = process.binding('natives_cache');
   NativeModule._cache = {};
   var config = process.binding('config');
   if (!config.exposeHTTP2) delete NativeModule._source.http2;
@@ -679,14 +707,21 @@ _ref) {
   NativeModule.prototype.compile = function () {
     var source = NativeModule.getSource(this.id);
     source = NativeModule.wrap(source);
+    var codeCache = NativeModule._codeCache[this.id];
     this.loading = true;
 
     try {
-      var fn = runInThisContext(source, {
+      var options = {
         filename: this.filename,
         lineOffset: 0,
         displayErrors: true
-      });
+      };
+      // The entries of the built-in code cache are [offset, length] pairs
+      // into the read-only static code cache block 0.
+      if (codeCache) {
+        utilBinding.setHiddenValue(options, kStaticCachedData, [0, codeCache[0], codeCache[1]]);
+      }
+      var fn = runInThisContext(source, options);
       fn(this.exports, NativeModule.require, this, this.filename);
       this.loaded = true;
     } finally {
@@ -0,0 +1,191 @@
+'use strict';
+
+// Persistent cache of compiled user modules, enabled with --compile-cache=dir
+// or NODE_COMPILE_CACHE=dir.
+//
+// Every module has one entry in the cache directory. The entry starts with a
+// header which records the path, the size and the modification time of the
+// module, followed by the code cache produced by vm.Script. The engine checks
+// the code cache against a hash of the source before it is used, and entries
+// which are rejected are removed. Entries are written to a temporary file
+// first and renamed, so concurrent processes never see partial entries.
+
+const fs = require('fs');
+const path = require('path');
+const vm = require('vm');
+
+const config = process.binding('config');
+
+// "NJCC"
+const kMagic = 0x43434a4e;
+// Increase it when the layout of the entries changes.
+const kFormat = 1;
+// magic, format, mtimeMs, size, path length and padding.
+const kHeaderSize = 32;
+// The oldest entries are removed when the cache grows beyond this size.
+const kMaxCacheSize = 128 * 1024 * 1024;
+
+const cacheDir = config.compileCacheDir ?
+  path.resolve(config.compileCacheDir) : undefined;
+
+// The directory is created and trimmed by the first write of the process.
+var firstWrite = true;
+
+function entryPath(filename) {
+  // FNV-1a
+  var hash = 0x811c9dc5;
+  for (var i = 0; i < filename.length; i++) {
+    hash ^= filename.charCodeAt(i);
+    hash = Math.imul(hash, 0x01000193);
+  }
+  const name = `${(hash >>> 0).toString(16)}-${filename.length}.jcc`;
+  return path.join(cacheDir, name);
+}
+
+function dataStart(pathLength) {
+  return kHeaderSize + ((pathLength + 7) & ~7);
+}
+
+function readEntry(file, filename, stats) {
+  var data;
+  try {
+    data = fs.readFileSync(file);
+  } catch (e) {
+    return undefined;
+  }
+
+  if (data.length <= kHeaderSize ||
+      data.readUInt32LE(0) !== kMagic ||
+      data.readUInt32LE(4) !== kFormat ||
+      data.readDoubleLE(8) !== stats.mtimeMs ||
+      data.readDoubleLE(16) !== stats.size) {
+    return undefined;
+  }
+
+  const pathLength = data.readUInt32LE(24);
+  const start = dataStart(pathLength);
+
+  if (start >= data.length ||
+      data.toString('utf8', kHeaderSize, kHeaderSize + pathLength) !==
+      filename) {
+    return undefined;
+  }
+
+  return data.slice(start);
+}
+
+function trimCache() {
+  var names;
+  try {
+    names = fs.readdirSync(cacheDir);
+  } catch (e) {
+    return;
+  }
+
+  const entries = [];
+  var totalSize = 0;
+  for (var i = 0; i < names.length; i++) {
+    const file = path.join(cacheDir, names[i]);
+    try {
+      const stats = fs.statSync(file);
+      entries.push({ file, size: stats.size, mtimeMs: stats.mtimeMs });
+      totalSize += stats.size;
+    } catch (e) {
+      // Removed by another process.
+    }
+  }
+
+  if (totalSize <= kMaxCacheSize)
+    return;
+
+  entries.sort((a, b) => a.mtimeMs - b.mtimeMs);
+
+  for (i = 0; i < entries.length && totalSize > kMaxCacheSize * 3 / 4; i++) {
+    try {
+      fs.unlinkSync(entries[i].file);
+      totalSize -= entries[i].size;
+    } catch (e) {
+      // Removed by another process.
+    }
+  }
+}
+
+function writeEntry(file, filename, stats, cachedData) {
+  if (firstWrite) {
+    firstWrite = false;
+    try {
+      fs.mkdirSync(cacheDir);
+    } catch (e) {
+      if (e.code !== 'EEXIST')
+        return;
+    }
+    trimCache();
+  }
+
+  const pathLength = Buffer.byteLength(filename);
+  const start = dataStart(pathLength);
+  const data = Buffer.alloc(start + cachedData.length);
+
+  data.writeUInt32LE(kMagic, 0);
+  data.writeUInt32LE(kFormat, 4);
+  data.writeDoubleLE(stats.mtimeMs, 8);
+  data.writeDoubleLE(stats.size, 16);
+  data.writeUInt32LE(pathLength, 24);
+  data.write(filename, kHeaderSize, pathLength, 'utf8');
+  cachedData.copy(data, start);
+
+  const tmpFile = `${file}.${process.pid}.tmp`;
+  try {
+    fs.writeFileSync(tmpFile, data);
+    fs.renameSync(tmpFile, file);
+  } catch (e) {
+    try {
+      fs.unlinkSync(tmpFile);
+    } catch (err) {
+      // The temporary file was not created.
+    }
+  }
+}
+
+function removeEntry(file) {
+  try {
+    fs.unlinkSync(file);
+  } catch (e) {
+    // Removed by another process.
+  }
+}
+
+// Compile the wrapper of a module, using the cached code of the module when
+// it is up to date, and return the wrapper function.
+function compileWrapper(wrapper, filename) {
+  const options = {
+    filename: filename,
+    lineOffset: 0,
+    displayErrors: true
+  };
+
+  var stats;
+  try {
+    stats = fs.statSync(filename);
+  } catch (e) {
+    return vm.runInThisContext(wrapper, options);
+  }
+
+  const file = entryPath(filename);
+  options.cachedData = readEntry(file, filename, stats);
+  options.produceCachedData = options.cachedData === undefined;
+
+  const script = new vm.Script(wrapper, options);
+
+  if (script.cachedDataProduced === true)
+    writeEntry(file, filename, stats, script.cachedData);
+  else if (script.cachedDataRejected === true)
+    removeEntry(file);
+
+  return script.runInThisContext(options);
+}
+
+module.exports = {
+  enabled: cacheDir !== undefined,
+  compileWrapper
+};
@@ -1,9 +1,5 @@
 'use strict';
 
-function asyncGeneratorStep(gen, resolve, reject, _next, _throw, key, arg) { try { var info = gen[key](arg); var value = info.value; } catch (error) { reject(error); return; } if (info.done) { resolve(value); } else { Promise.resolve(value).then(_next, _throw); } }
-
-function _asyncToGenerator(fn) { return function () { var self = this, args = arguments; return new Promise(function (resolve, reject) { var gen = fn.apply(self, args); function _next(value) { asyncGeneratorStep(gen, resolve, reject, _next, _throw, "next", value); } function _throw(err) { asyncGeneratorStep(gen, resolve, reject, _next, _throw, "throw", err); } _next(undefined); }); }; }
-
 function _classCallCheck(instance, Constructor) { if (!(instance instanceof Constructor)) { throw new TypeError("Cannot call a class as a function"); } }
 
 function _defineProperties(target, props) { for (var i = 0; i < props.length; i++) { var descriptor = props[i]; descriptor.enumerable = descriptor.enumerable || false; descriptor.configurable = true; if ("value" in descriptor) descriptor.writable = true; Object.defineProperty(target, descriptor.key, descriptor); } }
@@ -104,287 +100,103 @@ function () {
 
   }, {
     key: "resolve",
-    value: function () {
-      var _resolve = _asyncToGenerator(
-      /*#__PURE__*/
-      regeneratorRuntime.mark(function _callee(specifier) {
-        var parentURL,
-            _ref2,
-            url,
-            format,
-            _args = arguments;
-
-        return regeneratorRuntime.wrap(function _callee$(_context) {
-          while (1) {
-            switch (_context.prev = _context.next) {
-              case 0:
-                parentURL = _args.length > 1 && _args[1] !== undefined ? _args[1] : this.base;
-
-                if (!(typeof parentURL !== 'string')) {
-                  _context.next = 3;
-                  break;
-                }
-
-                throw new errors.TypeError('ERR_INVALID_ARG_TYPE', 'parentURL', 'string');
-
-              case 3:
-                _context.next = 5;
-                return this.resolver(specifier, parentURL, ModuleRequest.resolve);
-
-              case 5:
-                _ref2 = _context.sent;
-                url = _ref2.url;
-                format = _ref2.format;
-
-                if (Loader.validFormats.includes(format)) {
-                  _context.next = 10;
-                  break;
-                }
-
-                throw new errors.TypeError('ERR_INVALID_ARG_TYPE', 'format', Loader.validFormats);
-
-              case 10:
-                if (!(typeof url !== 'string')) {
-                  _context.next = 12;
-                  break;
-                }
-
-                throw new errors.TypeError('ERR_INVALID_ARG_TYPE', 'url', 'string');
-
-              case 12:
-                if (!(format === 'builtin')) {
-                  _context.next = 14;
-                  break;
-                }
-
-                return _context.abrupt("return", {
-                  url: "node:".concat(url),
-                  format: format
-                });
-
-              case 14:
-                if (!(format !== 'dynamic')) {
-                  _context.next = 19;
-                  break;
-                }
-
-                if (ModuleRequest.loaders.has(format)) {
-                  _context.next = 17;
-                  break;
-                }
-
-                throw new errors.Error('ERR_UNKNOWN_MODULE_FORMAT', format);
-
-              case 17:
-                if (url.startsWith('file:')) {
-                  _context.next = 19;
-                  break;
-                }
-
-                throw new errors.Error('ERR_INVALID_PROTOCOL', url, 'file:');
-
-              case 19:
-                return _context.abrupt("return", {
-                  url: url,
-                  format: format
-                });
-
-              case 20:
-              case "end":
-                return _context.stop();
-            }
-          }
-        }, _callee, this);
-      }));
+    value: async function resolve(specifier) {
+      var parentURL = arguments.length > 1 && arguments[1] !== undefined ? arguments[1] : this.base;
 
-      function resolve(_x) {
-        return _resolve.apply(this, arguments);
+      if (typeof parentURL !== 'string') {
+        throw new errors.TypeError('ERR_INVALID_ARG_TYPE', 'parentURL', 'string');
       }
 
-      return resolve;
-    }() // May create a new ModuleJob instance if one did not already exist.
+      var _ref2 = await this.resolver(specifier, parentURL, ModuleRequest.resolve),
+          url = _ref2.url,
+          format = _ref2.format;
 
-  }, {
-    key: "getModuleJob",
-    value: function () {
-      var _getModuleJob = _asyncToGenerator(
-      /*#__PURE__*/
-      regeneratorRuntime.mark(function _callee3(specifier) {
-        var parentURL,
-            _ref3,
-            url,
-            format,
-            job,
-            loaderInstance,
-            dynamicInstantiate,
-            _args3 = arguments;
-
-        return regeneratorRuntime.wrap(function _callee3$(_context3) {
-          while (1) {
-            switch (_context3.prev = _context3.next) {
-              case 0:
-                parentURL = _args3.length > 1 && _args3[1] !== undefined ? _args3[1] : this.base;
-                _context3.next = 3;
-                return this.resolve(specifier, parentURL);
-
-              case 3:
-                _ref3 = _context3.sent;
-                url = _ref3.url;
-                format = _ref3.format;
-                job = this.moduleMap.get(url);
-
-                if (!(job === undefined)) {
-                  _context3.next = 18;
-                  break;
-                }
-
-                if (!(format === 'dynamic')) {
-                  _context3.next = 15;
-                  break;
-                }
-
-                dynamicInstantiate = this.dynamicInstantiate;
-
-                if (!(typeof dynamicInstantiate !== 'function')) {
-                  _context3.next = 12;
-                  break;
-                }
-
-                throw new errors.Error('ERR_MISSING_DYNAMIC_INSTANTIATE_HOOK');
-
-              case 12:
-                loaderInstance =
-                /*#__PURE__*/
-                function () {
-                  var _ref4 = _asyncToGenerator(
-                  /*#__PURE__*/
-                  regeneratorRuntime.mark(function _callee2(url) {
-                    var _ref5, exports, execute;
-
-                    return regeneratorRuntime.wrap(function _callee2$(_context2) {
-                      while (1) {
-                        switch (_context2.prev = _context2.next) {
-                          case 0:
-                            _context2.next = 2;
-                            return dynamicInstantiate(url);
-
-                          case 2:
-                            _ref5 = _context2.sent;
-                            exports = _ref5.exports;
-                            execute = _ref5.execute;
-                            return _context2.abrupt("return", createDynamicModule(exports, url, function (reflect) {
-                              debug("Loading custom loader ".concat(url));
-                              execute(reflect.exports);
-                            }));
-
-                          case 6:
-                          case "end":
-                            return _context2.stop();
-                        }
-                      }
-                    }, _callee2);
-                  }));
-
-                  return function loaderInstance(_x3) {
-                    return _ref4.apply(this, arguments);
-                  };
-                }();
-
-                _context3.next = 16;
-                break;
-
-              case 15:
-                loaderInstance = ModuleRequest.loaders.get(format);
-
-              case 16:
-                job = new ModuleJob(this, url, loaderInstance);
-                this.moduleMap.set(url, job);
-
-              case 18:
-                return _context3.abrupt("return", job);
-
-              case 19:
-              case "end":
-                return _context3.stop();
-            }
-          }
-        }, _callee3, this);
-      }));
+      if (!Loader.validFormats.includes(format)) {
+        throw new errors.TypeError('ERR_INVALID_ARG_TYPE', 'format', Loader.validFormats);
+      }
+
+      if (typeof url !== 'string') {
+        throw new errors.TypeError('ERR_INVALID_ARG_TYPE', 'url', 'string');
+      }
+
+      if (format === 'builtin') {
+        return {
+          url: "node:".concat(url),
+          format: format
+        };
+      }
+
+      if (format !== 'dynamic') {
+        if (!ModuleRequest.loaders.has(format)) {
+          throw new errors.Error('ERR_UNKNOWN_MODULE_FORMAT', format);
+        }
 
-      function getModuleJob(_x2) {
-        return _getModuleJob.apply(this, arguments);
+        if (!url.startsWith('file:')) {
+          throw new errors.Error('ERR_INVALID_PROTOCOL', url, 'file:');
+        }
       }
 
-      return getModuleJob;
-    }()
+      return {
+        url: url,
+        format: format
+      };
+    } // May create a new ModuleJob}() // May create a new ModuleJob instance if one did not already exist.
+
   }, {
-    key: "import",
-    value: function () {
-      var _import2 = _asyncToGenerator(
-      /*#__PURE__*/
-      regeneratorRuntime.mark(function _callee4(specifier) {
-        var parentURL,
-            job,
-            module,
-            _args4 = arguments;
-        return regeneratorRuntime.wrap(function _callee4$(_context4) {
-          while (1) {
-            switch (_context4.prev = _context4.next) {
-              case 0:
-                parentURL = _args4.length > 1 && _args4[1] !== undefined ? _args4[1] : this.base;
-                _context4.next = 3;
-                return this.getModuleJob(specifier, parentURL);
-
-              case 3:
-                job = _context4.sent;
-                _context4.next = 6;
-                return job.run();
-
-              case 6:
-                module = _context4.sent;
-                return _context4.abrupt("return", module.namespace());
-
-              case 8:
-              case "end":
-                return _context4.stop();
-            }
+    key: "getModuleJob",
+    value: async function getModuleJob(specifier) {
+      var parentURL = arguments.length > 1 && arguments[1] !== undefined ? arguments[1] : this.base;
+
+      var _ref3 = await this.resolve(specifier, parentURL),
+          url = _ref3.url,
+          format = _ref3.format;
+
+      var job = this.moduleMap.get(url);
+
+      if (job === undefined) {
+        var loaderInstance;
+
+        if (format === 'dynamic') {
+          var dynamicInstantiate = this.dynamicInstantiate;
+
+          if (typeof dynamicInstantiate !== 'function') {
+            throw new errors.Error('ERR_MISSING_DYNAMIC_INSTANTIATE_HOOK');
           }
-        }, _callee4, this);
-      }));
 
-      function _import(_x4) {
-        return _import2.apply(this, arguments);
+          loaderInstance = async function loaderInstance(url) {
+            var _ref5 = await dynamicInstantiate(url),
+                exports = _ref5.exports,
+                execute = _ref5.execute;
+
+            return createDynamicModule(exports, url, function (reflect) {
+              debug("Loading custom loader ".concat(url));
+              execute(reflect.exports);
+            });
+          };
+        } else {
+          loaderInstance = ModuleRequest.loaders.get(format);
+        }
+
+        job = new ModuleJob(this, url, loaderInstance);
+        this.moduleMap.set(url, job);
       }
 
-      return _import;
-    }()
+      return job;
+    }
+  }, {
+    key: "import",
+    value: async function _import(specifier) {
+      var parentURL = arguments.length > 1 && arguments[1] !== undefined ? arguments[1] : this.base;
+      var job = await this.getModuleJob(specifier, parentURL);
+      var module = await job.run();
+      return module.namespace();
+    }
   }], [{
     key: "registerImportDynamicallyCallback",
     value: function registerImportDynamicallyCallback(loader) {
-      setImportModuleDynamicallyCallback(
-      /*#__PURE__*/
-      function () {
-        var _ref6 = _asyncToGenerator(
-        /*#__PURE__*/
-        regeneratorRuntime.mark(function _callee5(referrer, specifier) {
-          return regeneratorRuntime.wrap(function _callee5$(_context5) {
-            while (1) {
-              switch (_context5.prev = _context5.next) {
-                case 0:
-                  return _context5.abrupt("return", loader["import"](specifier, normalizeReferrerURL(referrer)));
-
-                case 1:
-                case "end":
-                  return _context5.stop();
-              }
-            }
-          }, _callee5);
-        }));
-
-        return function (_x5, _x6) {
-          return _ref6.apply(this, arguments);
-        };
-      }());
+      setImportModuleDynamicallyCallback(async function (referrer, specifier) {
+        return loader["import"](specifier, normalizeReferrerURL(referrer));
+      });
     }
   }]);
 
@@ -1,9 +1,5 @@
 'use strict';
 
-function asyncGeneratorStep(gen, resolve, reject, _next, _throw, key, arg) { try { var info = gen[key](arg); var value = info.value; } catch (error) { reject(error); return; } if (info.done) { resolve(value); } else { Promise.resolve(value).then(_next, _throw); } }
-
-function _asyncToGenerator(fn) { return function () { var self = this, args = arguments; return new Promise(function (resolve, reject) { var gen = fn.apply(self, args); function _next(value) { asyncGeneratorStep(gen, resolve, reject, _next, _throw, "next", value); } function _throw(err) { asyncGeneratorStep(gen, resolve, reject, _next, _throw, "throw", err); } _next(undefined); }); }; }
-
 var _require$internalBind = require('internal/process').internalBinding('module_wrap'),
     ModuleWrap = _require$internalBind.ModuleWrap,
     setImportModuleDynamicallyCallback = _require$internalBind.setImportModuleDynamicallyCallback;
@@ -49,24 +45,9 @@ var createDynamicModule = function createDynamicModule(exports) {
   }
 
   var module = new ModuleWrap(reexports, "".concat(url));
-  module.link(
-  /*#__PURE__*/
-  _asyncToGenerator(
-  /*#__PURE__*/
-  regeneratorRuntime.mark(function _callee() {
-    return regeneratorRuntime.wrap(function _callee$(_context) {
-      while (1) {
-        switch (_context.prev = _context.next) {
-          case 0:
-            return _context.abrupt("return", reflectiveModule);
-
-          case 1:
-          case "end":
-            return _context.stop();
-        }
-      }
-    }, _callee);
-  })));
+  module.link(async function () {
+    return reflectiveModule;
+  });
   module.instantiate();
   return {
     module: module,
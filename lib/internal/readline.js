@@ -3,10 +3,6 @@
 // License: MIT, authors: @sindresorhus, Qix-, and arjunmehta
 // Matches all ansi escape code sequences in a string
 
-var _marked =
-/*#__PURE__*/
-regeneratorRuntime.mark(emitKeys);
-
 function _templateObject4() {
   var data = _taggedTemplateLiteral(["0J"]);
 
@@ -183,594 +179,271 @@ function stripVTControlCharacters(str) {
 */
 
 
-function emitKeys(stream) {
-  var ch, s, escaped, key, code, modifier, cmdStart, cmd, match;
-  return regeneratorRuntime.wrap(function emitKeys$(_context) {
-    while (1) {
-      switch (_context.prev = _context.next) {
-        case 0:
-          if (!true) {
-            _context.next = 245;
-            break;
-          }
-
-          _context.next = 3;
-          return;
-
-        case 3:
-          ch = _context.sent;
-          s = ch;
-          escaped = false;
-          key = {
-            sequence: null,
-            name: undefined,
-            ctrl: false,
-            meta: false,
-            shift: false
-          };
-
-          if (!(ch === kEscape)) {
-            _context.next = 18;
-            break;
-          }
-
-          escaped = true;
-          _context.t0 = s;
-          _context.next = 12;
-          return;
-
-        case 12:
-          s = _context.t0 += ch = _context.sent;
-
-          if (!(ch === kEscape)) {
-            _context.next = 18;
-            break;
-          }
-
-          _context.t1 = s;
-          _context.next = 17;
-          return;
-
-        case 17:
-          s = _context.t1 += ch = _context.sent;
-
-        case 18:
-          if (!(escaped && (ch === 'O' || ch === '['))) {
-            _context.next = 240;
-            break;
-          }
-
-          // ansi escape sequence
-          code = ch;
-          modifier = 0;
-
-          if (!(ch === 'O')) {
-            _context.next = 35;
-            break;
-          }
-
-          _context.t2 = s;
-          _context.next = 25;
-          return;
+function* emitKeys(stream) {
+  while (true) {
+    var ch = yield;
+    var s = ch;
+    var escaped = false;
+    var key = {
+      sequence: null,
+      name: undefined,
+      ctrl: false,
+      meta: false,
+      shift: false
+    };
+
+    if (ch === kEscape) {
+      escaped = true;
+      s += ch = yield;
+
+      if (ch === kEscape) {
+        s += ch = yield;
+      }
+    }
 
-        case 25:
-          s = _context.t2 += ch = _context.sent;
+    if (escaped && (ch === 'O' || ch === '[')) {
+      // ansi escape sequence
+      var code = ch;
+      var modifier = 0;
 
-          if (!(ch >= '0' && ch <= '9')) {
-            _context.next = 32;
-            break;
-          }
+      if (ch === 'O') {
+        // ESC O letter
+        // ESC O modifier letter
+        s += ch = yield;
 
+        if (ch >= '0' && ch <= '9') {
           modifier = (ch >> 0) - 1;
-          _context.t3 = s;
-          _context.next = 31;
-          return;
-
-        case 31:
-          s = _context.t3 += ch = _context.sent;
-
-        case 32:
-          code += ch;
-          _context.next = 70;
-          break;
-
-        case 35:
-          if (!(ch === '[')) {
-            _context.next = 70;
-            break;
-          }
-
-          _context.t4 = s;
-          _context.next = 39;
-          return;
-
-        case 39:
-          s = _context.t4 += ch = _context.sent;
-
-          if (!(ch === '[')) {
-            _context.next = 46;
-            break;
-          }
-
+          s += ch = yield;
+        }
+
+        code += ch;
+      } else if (ch === '[') {
+        // ESC [ letter
+        // ESC [ modifier letter
+        // ESC [ [ modifier letter
+        // ESC [ [ num char
+        s += ch = yield;
+
+        if (ch === '[') {
           // \x1b[[A
           //      ^--- escape codes might have a second bracket
           code += ch;
-          _context.t5 = s;
-          _context.next = 45;
-          return;
-
-        case 45:
-          s = _context.t5 += ch = _context.sent;
-
-        case 46:
-          /*
-           * Here and later we try to buffer just enough data to get
-           * a complete ascii sequence.
-           *
-           * We have basically two classes of ascii characters to process:
-           *
-           *
-           * 1. `\x1b[24;5~` should be parsed as { code: '[24~', modifier: 5 }
-           *
-           * This particular example is featuring Ctrl+F12 in xterm.
-           *
-           *  - `;5` part is optional, e.g. it could be `\x1b[24~`
-           *  - first part can contain one or two digits
-           *
-           * So the generic regexp is like /^\d\d?(;\d)?[~^$]$/
-           *
-           *
-           * 2. `\x1b[1;5H` should be parsed as { code: '[H', modifier: 5 }
-           *
-           * This particular example is featuring Ctrl+Home in xterm.
-           *
-           *  - `1;5` part is optional, e.g. it could be `\x1b[H`
-           *  - `1;` part is optional, e.g. it could be `\x1b[5H`
-           *
-           * So the generic regexp is like /^((\d;)?\d)?[A-Za-z]$/
-           *
-           */
-          cmdStart = s.length - 1; // skip one or two leading digits
-
-          if (!(ch >= '0' && ch <= '9')) {
-            _context.next = 57;
-            break;
-          }
-
-          _context.t6 = s;
-          _context.next = 51;
-          return;
-
-        case 51:
-          s = _context.t6 += ch = _context.sent;
-
-          if (!(ch >= '0' && ch <= '9')) {
-            _context.next = 57;
-            break;
-          }
-
-          _context.t7 = s;
-          _context.next = 56;
-          return;
-
-        case 56:
-          s = _context.t7 += ch = _context.sent;
-
-        case 57:
-          if (!(ch === ';')) {
-            _context.next = 67;
-            break;
+          s += ch = yield;
+        }
+
+        /*
+         * Here and later we try to buffer just enough data to get
+         * a complete ascii sequence.
+         *
+         * We have basically two classes of ascii characters to process:
+         *
+         *
+         * 1. `\x1b[24;5~` should be parsed as { code: '[24~', modifier: 5 }
+         *
+         * This particular example is featuring Ctrl+F12 in xterm.
+         *
+         *  - `;5` part is optional, e.g. it could be `\x1b[24~`
+         *  - first part can contain one or two digits
+         *
+         * So the generic regexp is like /^\d\d?(;\d)?[~^$]$/
+         *
+         *
+         * 2. `\x1b[1;5H` should be parsed as { code: '[H', modifier: 5 }
+         *
+         * This particular example is featuring Ctrl+Home in xterm.
+         *
+         *  - `1;5` part is optional, e.g. it could be `\x1b[H`
+         *  - `1;` part is optional, e.g. it could be `\x1b[5H`
+         *
+         * So the generic regexp is like /^((\d;)?\d)?[A-Za-z]$/
+         *
+         */
+        var cmdStart = s.length - 1;
+
+        // skip one or two leading digits
+        if (ch >= '0' && ch <= '9') {
+          s += ch = yield;
+
+          if (ch >= '0' && ch <= '9') {
+            s += ch = yield;
           }
+        }
 
-          _context.t8 = s;
-          _context.next = 61;
-          return;
+        // skip modifier
+        if (ch === ';') {
+          s += ch = yield;
 
-        case 61:
-          s = _context.t8 += ch = _context.sent;
-
-          if (!(ch >= '0' && ch <= '9')) {
-            _context.next = 67;
-            break;
-          }
-
-          _context.t9 = s;
-          _context.next = 66;
-          return;
-
-        case 66:
-          s = _context.t9 += ch = _context.sent;
-
-        case 67:
-          /*
-           * We buffered enough data, now trying to extract code
-           * and modifier from it
-           */
-          cmd = s.slice(cmdStart);
-          match = void 0;
-
-          if (match = cmd.match(/^(\d\d?)(;(\d))?([~^$])$/)) {
-            code += match[1] + match[4];
-            modifier = (match[3] || 1) - 1;
-          } else if (match = cmd.match(/^((\d;)?(\d))?([A-Za-z])$/)) {
-            code += match[4];
-            modifier = (match[3] || 1) - 1;
-          } else {
-            code += cmd;
+          if (ch >= '0' && ch <= '9') {
+            s += ch = yield;
           }
+        }
+
+        /*
+         * We buffered enough data, now trying to extract code
+         * and modifier from it
+         */
+        var cmd = s.slice(cmdStart);
+        var match;
+
+        if ((match = cmd.match(/^(\d\d?)(;(\d))?([~^$])$/))) {
+          code += match[1] + match[4];
+          modifier = (match[3] || 1) - 1;
+        } else if ((match = cmd.match(/^((\d;)?(\d))?([A-Za-z])$/))) {
+          code += match[4];
+          modifier = (match[3] || 1) - 1;
+        } else {
+          code += cmd;
+        }
+      }
 
-        case 70:
-          // Parse the key modifier
-          key.ctrl = !!(modifier & 4);
-          key.meta = !!(modifier & 10);
-          key.shift = !!(modifier & 1);
-          key.code = code; // Parse the key itself
-
-          _context.t10 = code;
-          _context.next = _context.t10 === 'OP' ? 77 : _context.t10 === 'OQ' ? 79 : _context.t10 === 'OR' ? 81 : _context.t10 === 'OS' ? 83 : _context.t10 === '[11~' ? 85 : _context.t10 === '[12~' ? 87 : _context.t10 === '[13~' ? 89 : _context.t10 === '[14~' ? 91 : _context.t10 === '[[A' ? 93 : _context.t10 === '[[B' ? 95 : _context.t10 === '[[C' ? 97 : _context.t10 === '[[D' ? 99 : _context.t10 === '[[E' ? 101 : _context.t10 === '[15~' ? 103 : _context.t10 === '[17~' ? 105 : _context.t10 === '[18~' ? 107 : _context.t10 === '[19~' ? 109 : _context.t10 === '[20~' ? 111 : _context.t10 === '[21~' ? 113 : _context.t10 === '[23~' ? 115 : _context.t10 === '[24~' ? 117 : _context.t10 === '[A' ? 119 : _context.t10 === '[B' ? 121 : _context.t10 === '[C' ? 123 : _context.t10 === '[D' ? 125 : _context.t10 === '[E' ? 127 : _context.t10 === '[F' ? 129 : _context.t10 === '[H' ? 131 : _context.t10 === 'OA' ? 133 : _context.t10 === 'OB' ? 135 : _context.t10 === 'OC' ? 137 : _context.t10 === 'OD' ? 139 : _context.t10 === 'OE' ? 141 : _context.t10 === 'OF' ? 143 : _context.t10 === 'OH' ? 145 : _context.t10 === '[1~' ? 147 : _context.t10 === '[2~' ? 149 : _context.t10 === '[3~' ? 151 : _context.t10 === '[4~' ? 153 : _context.t10 === '[5~' ? 155 : _context.t10 === '[6~' ? 157 : _context.t10 === '[[5~' ? 159 : _context.t10 === '[[6~' ? 161 : _context.t10 === '[7~' ? 163 : _context.t10 === '[8~' ? 165 : _context.t10 === '[a' ? 167 : _context.t10 === '[b' ? 170 : _context.t10 === '[c' ? 173 : _context.t10 === '[d' ? 176 : _context.t10 === '[e' ? 179 : _context.t10 === '[2$' ? 182 : _context.t10 === '[3$' ? 185 : _context.t10 === '[5$' ? 188 : _context.t10 === '[6$' ? 191 : _context.t10 === '[7$' ? 194 : _context.t10 === '[8$' ? 197 : _context.t10 === 'Oa' ? 200 : _context.t10 === 'Ob' ? 203 : _context.t10 === 'Oc' ? 206 : _context.t10 === 'Od' ? 209 : _context.t10 === 'Oe' ? 212 : _context.t10 === '[2^' ? 215 : _context.t10 === '[3^' ? 218 : _context.t10 === '[5^' ? 221 : _context.t10 === '[6^' ? 224 : _context.t10 === '[7^' ? 227 : _context.t10 === '[8^' ? 230 : _context.t10 === '[Z' ? 233 : 236;
-          break;
-
-        case 77:
-          key.name = 'f1';
-          return _context.abrupt("break", 238);
-
-        case 79:
-          key.name = 'f2';
-          return _context.abrupt("break", 238);
-
-        case 81:
-          key.name = 'f3';
-          return _context.abrupt("break", 238);
-
-        case 83:
-          key.name = 'f4';
-          return _context.abrupt("break", 238);
-
-        case 85:
-          key.name = 'f1';
-          return _context.abrupt("break", 238);
-
-        case 87:
-          key.name = 'f2';
-          return _context.abrupt("break", 238);
-
-        case 89:
-          key.name = 'f3';
-          return _context.abrupt("break", 238);
-
-        case 91:
-          key.name = 'f4';
-          return _context.abrupt("break", 238);
-
-        case 93:
-          key.name = 'f1';
-          return _context.abrupt("break", 238);
-
-        case 95:
-          key.name = 'f2';
-          return _context.abrupt("break", 238);
-
-        case 97:
-          key.name = 'f3';
-          return _context.abrupt("break", 238);
-
-        case 99:
-          key.name = 'f4';
-          return _context.abrupt("break", 238);
-
-        case 101:
-          key.name = 'f5';
-          return _context.abrupt("break", 238);
-
-        case 103:
-          key.name = 'f5';
-          return _context.abrupt("break", 238);
-
-        case 105:
-          key.name = 'f6';
-          return _context.abrupt("break", 238);
-
-        case 107:
-          key.name = 'f7';
-          return _context.abrupt("break", 238);
-
-        case 109:
-          key.name = 'f8';
-          return _context.abrupt("break", 238);
-
-        case 111:
-          key.name = 'f9';
-          return _context.abrupt("break", 238);
-
-        case 113:
-          key.name = 'f10';
-          return _context.abrupt("break", 238);
-
-        case 115:
-          key.name = 'f11';
-          return _context.abrupt("break", 238);
-
-        case 117:
-          key.name = 'f12';
-          return _context.abrupt("break", 238);
-
-        case 119:
-          key.name = 'up';
-          return _context.abrupt("break", 238);
-
-        case 121:
-          key.name = 'down';
-          return _context.abrupt("break", 238);
-
-        case 123:
-          key.name = 'right';
-          return _context.abrupt("break", 238);
-
-        case 125:
-          key.name = 'left';
-          return _context.abrupt("break", 238);
-
-        case 127:
-          key.name = 'clear';
-          return _context.abrupt("break", 238);
-
-        case 129:
-          key.name = 'end';
-          return _context.abrupt("break", 238);
-
-        case 131:
-          key.name = 'home';
-          return _context.abrupt("break", 238);
-
-        case 133:
-          key.name = 'up';
-          return _context.abrupt("break", 238);
-
-        case 135:
-          key.name = 'down';
-          return _context.abrupt("break", 238);
-
-        case 137:
-          key.name = 'right';
-          return _context.abrupt("break", 238);
-
-        case 139:
-          key.name = 'left';
-          return _context.abrupt("break", 238);
-
-        case 141:
-          key.name = 'clear';
-          return _context.abrupt("break", 238);
-
-        case 143:
-          key.name = 'end';
-          return _context.abrupt("break", 238);
-
-        case 145:
-          key.name = 'home';
-          return _context.abrupt("break", 238);
-
-        case 147:
-          key.name = 'home';
-          return _context.abrupt("break", 238);
-
-        case 149:
-          key.name = 'insert';
-          return _context.abrupt("break", 238);
-
-        case 151:
-          key.name = 'delete';
-          return _context.abrupt("break", 238);
-
-        case 153:
-          key.name = 'end';
-          return _context.abrupt("break", 238);
-
-        case 155:
-          key.name = 'pageup';
-          return _context.abrupt("break", 238);
-
-        case 157:
-          key.name = 'pagedown';
-          return _context.abrupt("break", 238);
-
-        case 159:
-          key.name = 'pageup';
-          return _context.abrupt("break", 238);
-
-        case 161:
-          key.name = 'pagedown';
-          return _context.abrupt("break", 238);
-
-        case 163:
-          key.name = 'home';
-          return _context.abrupt("break", 238);
-
-        case 165:
-          key.name = 'end';
-          return _context.abrupt("break", 238);
-
-        case 167:
-          key.name = 'up';
-          key.shift = true;
-          return _context.abrupt("break", 238);
-
-        case 170:
-          key.name = 'down';
-          key.shift = true;
-          return _context.abrupt("break", 238);
-
-        case 173:
-          key.name = 'right';
-          key.shift = true;
-          return _context.abrupt("break", 238);
-
-        case 176:
-          key.name = 'left';
-          key.shift = true;
-          return _context.abrupt("break", 238);
-
-        case 179:
-          key.name = 'clear';
-          key.shift = true;
-          return _context.abrupt("break", 238);
-
-        case 182:
-          key.name = 'insert';
-          key.shift = true;
-          return _context.abrupt("break", 238);
-
-        case 185:
-          key.name = 'delete';
-          key.shift = true;
-          return _context.abrupt("break", 238);
-
-        case 188:
-          key.name = 'pageup';
-          key.shift = true;
-          return _context.abrupt("break", 238);
-
-        case 191:
-          key.name = 'pagedown';
-          key.shift = true;
-          return _context.abrupt("break", 238);
-
-        case 194:
-          key.name = 'home';
-          key.shift = true;
-          return _context.abrupt("break", 238);
-
-        case 197:
-          key.name = 'end';
-          key.shift = true;
-          return _context.abrupt("break", 238);
-
-        case 200:
-          key.name = 'up';
-          key.ctrl = true;
-          return _context.abrupt("break", 238);
-
-        case 203:
-          key.name = 'down';
-          key.ctrl = true;
-          return _context.abrupt("break", 238);
-
-        case 206:
-          key.name = 'right';
-          key.ctrl = true;
-          return _context.abrupt("break", 238);
-
-        case 209:
-          key.name = 'left';
-          key.ctrl = true;
-          return _context.abrupt("break", 238);
-
-        case 212:
-          key.name = 'clear';
-          key.ctrl = true;
-          return _context.abrupt("break", 238);
-
-        case 215:
-          key.name = 'insert';
-          key.ctrl = true;
-          return _context.abrupt("break", 238);
-
-        case 218:
-          key.name = 'delete';
-          key.ctrl = true;
-          return _context.abrupt("break", 238);
-
-        case 221:
-          key.name = 'pageup';
-          key.ctrl = true;
-          return _context.abrupt("break", 238);
-
-        case 224:
-          key.name = 'pagedown';
-          key.ctrl = true;
-          return _context.abrupt("break", 238);
-
-        case 227:
-          key.name = 'home';
-          key.ctrl = true;
-          return _context.abrupt("break", 238);
-
-        case 230:
-          key.name = 'end';
-          key.ctrl = true;
-          return _context.abrupt("break", 238);
-
-        case 233:
-          key.name = 'tab';
-          key.shift = true;
-          return _context.abrupt("break", 238);
-
-        case 236:
-          key.name = 'undefined';
-          return _context.abrupt("break", 238);
-
-        case 238:
-          _context.next = 241;
-          break;
-
-        case 240:
-          if (ch === '\r') {
-            // carriage return
-            key.name = 'return';
-          } else if (ch === '\n') {
-            // enter, should have been called linefeed
-            key.name = 'enter';
-          } else if (ch === '\t') {
-            // tab
-            key.name = 'tab';
-          } else if (ch === '\b' || ch === '\x7f') {
-            // backspace or ctrl+h
-            key.name = 'backspace';
-            key.meta = escaped;
-          } else if (ch === kEscape) {
-            // escape key
-            key.name = 'escape';
-            key.meta = escaped;
-          } else if (ch === ' ') {
-            key.name = 'space';
-            key.meta = escaped;
-          } else if (!escaped && ch <= '\x1a') {
-            // ctrl+letter
-            key.name = String.fromCharCode(ch.charCodeAt(0) + 'a'.charCodeAt(0) - 1);
-            key.ctrl = true;
-          } else if (/^[0-9A-Za-z]$/.test(ch)) {
-            // letter, number, shift+letter
-            key.name = ch.toLowerCase();
-            key.shift = /^[A-Z]$/.test(ch);
-            key.meta = escaped;
-          } else if (escaped) {
-            // Escape sequence timeout
-            key.name = ch.length ? undefined : 'escape';
-            key.meta = true;
-          }
-
-        case 241:
-          key.sequence = s;
-
-          if (s.length !== 0 && (key.name !== undefined || escaped)) {
-            /* Named character or sequence */
-            stream.emit('keypress', escaped ? undefined : s, key);
-          } else if (s.length === 1) {
-            /* Single unnamed character, e.g. "." */
-            stream.emit('keypress', s, key);
-          }
-          /* Unrecognized or broken escape sequence, don't emit anything */
-
+      // Parse the key modifier
+      key.ctrl = !!(modifier & 4);
+      key.meta = !!(modifier & 10);
+      key.shift = !!(modifier & 1);
+      key.code = code;
+
+      // Parse the key itself
+      switch (code) {
+        /* xterm/gnome ESC O letter */
+        case 'OP': key.name = 'f1'; break;
+        case 'OQ': key.name = 'f2'; break;
+        case 'OR': key.name = 'f3'; break;
+        case 'OS': key.name = 'f4'; break;
+
+        /* xterm/rxvt ESC [ number ~ */
+        case '[11~': key.name = 'f1'; break;
+        case '[12~': key.name = 'f2'; break;
+        case '[13~': key.name = 'f3'; break;
+        case '[14~': key.name = 'f4'; break;
+
+        /* from Cygwin and used in libuv */
+        case '[[A': key.name = 'f1'; break;
+        case '[[B': key.name = 'f2'; break;
+        case '[[C': key.name = 'f3'; break;
+        case '[[D': key.name = 'f4'; break;
+        case '[[E': key.name = 'f5'; break;
+
+        /* common */
+        case '[15~': key.name = 'f5'; break;
+        case '[17~': key.name = 'f6'; break;
+        case '[18~': key.name = 'f7'; break;
+        case '[19~': key.name = 'f8'; break;
+        case '[20~': key.name = 'f9'; break;
+        case '[21~': key.name = 'f10'; break;
+        case '[23~': key.name = 'f11'; break;
+        case '[24~': key.name = 'f12'; break;
+
+        /* xterm ESC [ letter */
+        case '[A': key.name = 'up'; break;
+        case '[B': key.name = 'down'; break;
+        case '[C': key.name = 'right'; break;
+        case '[D': key.name = 'left'; break;
+        case '[E': key.name = 'clear'; break;
+        case '[F': key.name = 'end'; break;
+        case '[H': key.name = 'home'; break;
+
+        /* xterm/gnome ESC O letter */
+        case 'OA': key.name = 'up'; break;
+        case 'OB': key.name = 'down'; break;
+        case 'OC': key.name = 'right'; break;
+        case 'OD': key.name = 'left'; break;
+        case 'OE': key.name = 'clear'; break;
+        case 'OF': key.name = 'end'; break;
+        case 'OH': key.name = 'home'; break;
+
+        /* xterm/rxvt ESC [ number ~ */
+        case '[1~': key.name = 'home'; break;
+        case '[2~': key.name = 'insert'; break;
+        case '[3~': key.name = 'delete'; break;
+        case '[4~': key.name = 'end'; break;
+        case '[5~': key.name = 'pageup'; break;
+        case '[6~': key.name = 'pagedown'; break;
+
+        /* putty */
+        case '[[5~': key.name = 'pageup'; break;
+        case '[[6~': key.name = 'pagedown'; break;
+
+        /* rxvt */
+        case '[7~': key.name = 'home'; break;
+        case '[8~': key.name = 'end'; break;
+
+        /* rxvt keys with modifiers */
+        case '[a': key.name = 'up'; key.shift = true; break;
+        case '[b': key.name = 'down'; key.shift = true; break;
+        case '[c': key.name = 'right'; key.shift = true; break;
+        case '[d': key.name = 'left'; key.shift = true; break;
+        case '[e': key.name = 'clear'; key.shift = true; break;
+
+        case '[2$': key.name = 'insert'; key.shift = true; break;
+        case '[3$': key.name = 'delete'; key.shift = true; break;
+        case '[5$': key.name = 'pageup'; key.shift = true; break;
+        case '[6$': key.name = 'pagedown'; key.shift = true; break;
+        case '[7$': key.name = 'home'; key.shift = true; break;
+        case '[8$': key.name = 'end'; key.shift = true; break;
+
+        case 'Oa': key.name = 'up'; key.ctrl = true; break;
+        case 'Ob': key.name = 'down'; key.ctrl = true; break;
+        case 'Oc': key.name = 'right'; key.ctrl = true; break;
+        case 'Od': key.name = 'left'; key.ctrl = true; break;
+        case 'Oe': key.name = 'clear'; key.ctrl = true; break;
+
+        case '[2^': key.name = 'insert'; key.ctrl = true; break;
+        case '[3^': key.name = 'delete'; key.ctrl = true; break;
+        case '[5^': key.name = 'pageup'; key.ctrl = true; break;
+        case '[6^': key.name = 'pagedown'; key.ctrl = true; break;
+        case '[7^': key.name = 'home'; key.ctrl = true; break;
+        case '[8^': key.name = 'end'; key.ctrl = true; break;
+
+        /* misc. */
+        case '[Z': key.name = 'tab'; key.shift = true; break;
+        default: key.name = 'undefined'; break;
+      }
+    } else if (ch === '\r') {
+      // carriage return
+      key.name = 'return';
+    } else if (ch === '\n') {
+      // enter, should have been called linefeed
+      key.name = 'enter';
+    } else if (ch === '\t') {
+      // tab
+      key.name = 'tab';
+    } else if (ch === '\b' || ch === '\x7f') {
+      // backspace or ctrl+h
+      key.name = 'backspace';
+      key.meta = escaped;
+    } else if (ch === kEscape) {
+      // escape key
+      key.name = 'escape';
+      key.meta = escaped;
+    } else if (ch === ' ') {
+      key.name = 'space';
+      key.meta = escaped;
+    } else if (!escaped && ch <= '\x1a') {
+      // ctrl+letter
+      key.name = String.fromCharCode(ch.charCodeAt(0) + 'a'.charCodeAt(0) - 1);
+      key.ctrl = true;
+    } else if (/^[0-9A-Za-z]$/.test(ch)) {
+      // letter, number, shift+letter
+      key.name = ch.toLowerCase();
+      key.shift = /^[A-Z]$/.test(ch);
+      key.meta = escaped;
+    } else if (escaped) {
+      // Escape sequence timeout
+      key.name = ch.length ? undefined : 'escape';
+      key.meta = true;
+    }
 
-          _context.next = 0;
-          break;
+    key.sequence = s;
 
-        case 245:
-        case "end":
-          return _context.stop();
-      }
+    if (s.length !== 0 && (key.name !== undefined || escaped)) {
+      /* Named character or sequence */
+      stream.emit('keypress', escaped ? undefined : s, key);
+    } else if (s.length === 1) {
+      /* Single unnamed character, e.g. "." */
+      stream.emit('keypress', s, key);
     }
-  }, _marked);
+    /* Unrecognized or broken escape sequence, don't emit anything */
+  }
 }
 
 module.exports = {
@@ -0,0 +1,242 @@
+'use strict';
+
+// Single file bundles of user modules and their compiled code.
+//
+// `node --build-snapshot-bundle=file entry.js` runs the entry script and, when
+// the process exits, writes every module it has loaded to the bundle. The
+// code caches of the modules are merged by the engine, so the literals shared
+// by the modules are stored once. The resolved paths of the require() calls
+// are stored as well.
+//
+// `node --snapshot-bundle=file entry.js` (or NODE_SNAPSHOT_BUNDLE=file) reads
+// the bundle once at startup. Modules found in the bundle are resolved, read
+// and compiled without touching the file system. The engine checks every
+// code cache against a hash of the source before it is used, so a bundle
+// built by a different engine only loses the compiled code.
+//
+// Where the platform allows it, the bundle is mapped read-only instead of
+// being read. The engine executes the byte code of the mapped code caches in
+// place, so the processes of a cluster which load the same bundle share its
+// pages. The mapping is never exposed to scripts: only a copy of the header,
+// the index and the sources is read from it. The bundle is written to a
+// temporary file and renamed, so running processes keep their mapping of the
+// previous bundle.
+//
+// Layout of the bundle:
+//   magic, format, index length and sources length (4 x uint32)
+//   index: JSON { modules: [[filename, sourceStart, sourceLength,
+//                            cacheOffset]], paths: { cacheKey: filename } }
+//   sources: UTF-8 source of every module
+//   merged code caches, 8 byte aligned
+
+const fs = require('fs');
+const vm = require('vm');
+
+const config = process.binding('config');
+const {
+  contextify_static_cached_data_private_symbol: kStaticCachedData,
+  setHiddenValue
+} = process.binding('util');
+const {
+  mergeCachedData,
+  mapCachedData,
+  readCachedData
+} = process.binding('contextify');
+
+// "NJSB"
+const kMagic = 0x42534a4e;
+// Increase it when the layout of the bundle changes.
+const kFormat = 1;
+const kHeaderSize = 16;
+
+// Modules recorded by --build-snapshot-bundle, in load order.
+const recorded = [];
+
+// Contents of the bundle loaded by --snapshot-bundle. When the bundle is
+// mapped, `bundle` only holds the part before the code caches, which are
+// consumed from the static code cache block `cacheBlock`.
+var bundle;
+var bundleLength;
+var cacheBlock;
+var cacheStart;
+const modules = new Map();
+
+function align(offset) {
+  return (offset + 7) & ~7;
+}
+
+function writeBundle(file) {
+  const { _pathCache } = require('module');
+  const caches = [];
+  var merged;
+
+  for (var i = 0; i < recorded.length; i++) {
+    if (recorded[i].cachedData !== undefined)
+      caches.push(recorded[i].cachedData);
+  }
+
+  if (caches.length > 0 && typeof mergeCachedData === 'function')
+    merged = mergeCachedData(caches);
+
+  const index = { modules: [], paths: {} };
+  const sources = [];
+  var sourcesLength = 0;
+  var cacheIndex = 0;
+
+  for (i = 0; i < recorded.length; i++) {
+    const { filename, content, cachedData } = recorded[i];
+    const source = Buffer.from(content, 'utf8');
+    var cacheOffset = -1;
+
+    if (cachedData !== undefined) {
+      if (merged !== undefined)
+        cacheOffset = merged.offsets[cacheIndex];
+      cacheIndex++;
+    }
+
+    index.modules.push([filename, sourcesLength, source.length, cacheOffset]);
+    sources.push(source);
+    sourcesLength += source.length;
+  }
+
+  for (const key of Object.keys(_pathCache))
+    index.paths[key] = _pathCache[key];
+
+  const indexData = Buffer.from(JSON.stringify(index), 'utf8');
+  const header = Buffer.alloc(kHeaderSize);
+  header.writeUInt32LE(kMagic, 0);
+  header.writeUInt32LE(kFormat, 4);
+  header.writeUInt32LE(indexData.length, 8);
+  header.writeUInt32LE(sourcesLength, 12);
+
+  const end = kHeaderSize + indexData.length + sourcesLength;
+  const parts = [header, indexData].concat(sources);
+
+  if (merged !== undefined) {
+    parts.push(Buffer.alloc(align(end) - end));
+    parts.push(merged.data);
+  }
+
+  const tmpFile = `${file}.${process.pid}.tmp`;
+  fs.writeFileSync(tmpFile, Buffer.concat(parts));
+  fs.renameSync(tmpFile, file);
+}
+
+function readBundle(file) {
+  var data;
+  var mapped;
+  if (typeof mapCachedData === 'function')
+    mapped = mapCachedData(file);
+  if (mapped !== undefined) {
+    data = readCachedData(mapped.block, 0,
+                          Math.min(mapped.length, kHeaderSize));
+  } else {
+    data = fs.readFileSync(file);
+  }
+
+  if (data.length < kHeaderSize ||
+      data.readUInt32LE(0) !== kMagic ||
+      data.readUInt32LE(4) !== kFormat) {
+    throw new Error(`${file} is not a snapshot bundle`);
+  }
+
+  const indexLength = data.readUInt32LE(8);
+  const sourcesStart = kHeaderSize + indexLength;
+  cacheStart = align(sourcesStart + data.readUInt32LE(12));
+
+  if (mapped !== undefined) {
+    data = readCachedData(mapped.block, 0,
+                          Math.min(mapped.length, cacheStart));
+    cacheBlock = mapped.block;
+    bundleLength = mapped.length;
+  } else {
+    bundleLength = data.length;
+  }
+
+  const index = JSON.parse(data.toString('utf8', kHeaderSize, sourcesStart));
+  bundle = data;
+
+  for (var i = 0; i < index.modules.length; i++) {
+    const [filename, start, length, cacheOffset] = index.modules[i];
+    modules.set(filename, {
+      sourceStart: sourcesStart + start,
+      sourceEnd: sourcesStart + start + length,
+      cacheOffset
+    });
+  }
+
+  return index.paths;
+}
+
+// Returns the resolved paths stored in the bundle, which are used to seed
+// Module._pathCache.
+function loadPaths() {
+  try {
+    return readBundle(config.snapshotBundle);
+  } catch (err) {
+    bundle = undefined;
+    cacheBlock = undefined;
+    modules.clear();
+    process.emitWarning(`Ignoring snapshot bundle: ${err.message}`);
+    return {};
+  }
+}
+
+// Returns the source of a bundled module, or undefined.
+function readSource(filename) {
+  const entry = modules.get(filename);
+  if (entry === undefined)
+    return undefined;
+  return bundle.toString('utf8', entry.sourceStart, entry.sourceEnd);
+}
+
+// Compile the wrapper of a module, and record or look up its compiled code.
+// Returns undefined for modules which are not part of the bundle.
+function compileWrapper(wrapper, filename, content) {
+  const options = {
+    filename: filename,
+    lineOffset: 0,
+    displayErrors: true
+  };
+
+  if (config.buildSnapshotBundle) {
+    options.produceCachedData = true;
+    const script = new vm.Script(wrapper, options);
+    recorded.push({
+      filename,
+      content,
+      cachedData: script.cachedDataProduced === true ?
+        script.cachedData : undefined
+    });
+    return script.runInThisContext(options);
+  }
+
+  const entry = modules.get(filename);
+  if (entry === undefined)
+    return undefined;
+
+  const cacheOffset = cacheStart + entry.cacheOffset;
+  if (entry.cacheOffset >= 0 && cacheOffset < bundleLength) {
+    if (cacheBlock !== undefined) {
+      setHiddenValue(options, kStaticCachedData,
+                     [cacheBlock, cacheOffset, bundleLength - cacheOffset]);
+    } else {
+      options.cachedData = bundle.slice(cacheOffset);
+    }
+  }
+
+  // A rejected code cache falls back to compiling the source.
+  return new vm.Script(wrapper, options).runInThisContext(options);
+}
+
+if (config.buildSnapshotBundle) {
+  process.on('exit', () => writeBundle(config.buildSnapshotBundle));
+}
+
+module.exports = {
+  building: !!config.buildSnapshotBundle,
+  loading: !config.buildSnapshotBundle && !!config.snapshotBundle,
+  loadPaths,
+  readSource,
+  compileWrapper
+};
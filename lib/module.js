@@ -24,6 +24,8 @@
 const NativeModule = require('native_module');
 const util = require('util');
 const internalModule = require('internal/module');
+const compileCache = require('internal/compile_cache');
+const snapshotBundle = require('internal/snapshot_bundle');
 const { getURLFromFilePath } = require('internal/url');
 const vm = require('vm');
 const assert = require('assert').ok;
@@ -85,6 +87,8 @@ Module.builtinModules = builtinModules;
 
 Module._cache = Object.create(null);
 Module._pathCache = Object.create(null);
+if (snapshotBundle.loading)
+  Object.assign(Module._pathCache, snapshotBundle.loadPaths());
 Module._extensions = Object.create(null);
 var modulePaths = [];
 Module.globalPaths = [];
@@ -618,11 +622,21 @@ Module.prototype._compile = function(content, filename) {
   // create wrapper function
   var wrapper = Module.wrap(content);
 
-  var compiledWrapper = vm.runInThisContext(wrapper, {
-    filename: filename,
-    lineOffset: 0,
-    displayErrors: true
-  });
+  var compiledWrapper;
+  if (snapshotBundle.building || snapshotBundle.loading)
+    compiledWrapper = snapshotBundle.compileWrapper(wrapper, filename, content);
+
+  if (compiledWrapper !== undefined) {
+    // Compiled by the snapshot bundle.
+  } else if (compileCache.enabled) {
+    compiledWrapper = compileCache.compileWrapper(wrapper, filename);
+  } else {
+    compiledWrapper = vm.runInThisContext(wrapper, {
+      filename: filename,
+      lineOffset: 0,
+      displayErrors: true
+    });
+  }
 
   var inspectorWrapper = null;
   if (process._breakFirstLine && process._eval == null) {
@@ -664,7 +678,11 @@ Module.prototype._compile = function(content, filename) {
 
 // Native extension for .js
 Module._extensions['.js'] = function(module, filename) {
-  var content = fs.readFileSync(filename, 'utf8');
+  var content;
+  if (snapshotBundle.loading)
+    content = snapshotBundle.readSource(filename);
+  if (content === undefined)
+    content = fs.readFileSync(filename, 'utf8');
   module._compile(internalModule.stripBOM(content), filename);
 };
 
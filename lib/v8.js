@@ -33,6 +33,7 @@ class Deserializer extends _Deserializer { }
 const {
   cachedDataVersionTag,
   setFlagsFromString,
+  getInlineCacheStatistics: _getInlineCacheStatistics,
   heapStatisticsArrayBuffer,
   heapSpaceStatisticsArrayBuffer,
   updateHeapStatisticsArrayBuffer,
@@ -82,6 +83,13 @@ function getHeapStatistics() {
   };
 }
 
+// Returns undefined when the engine has no inline caches.
+function getInlineCacheStatistics() {
+  if (typeof _getInlineCacheStatistics !== 'function')
+    return undefined;
+  return _getInlineCacheStatistics();
+}
+
 function getHeapSpaceStatistics() {
   const heapSpaceStatistics = new Array(kNumberOfHeapSpaces);
   const buffer = heapSpaceStatisticsBuffer;
@@ -210,6 +218,7 @@ module.exports = exports = {
   cachedDataVersionTag,
   getHeapStatistics,
   getHeapSpaceStatistics,
+  getInlineCacheStatistics,
   setFlagsFromString,
   Serializer,
   Deserializer,
@@ -9,6 +9,7 @@
     'node_no_browser_globals%': 'false',
     'node_use_v8_platform%': 'true',
     'node_use_bundled_v8%': 'true',
+    'node_use_code_cache%': 'true',
     'node_shared%': 'false',
     'force_dynamic_crt%': 0,
     'node_module_version%': '',
@@ -88,6 +89,7 @@
       'lib/internal/cluster/shared_handle.js',
       'lib/internal/cluster/utils.js',
       'lib/internal/cluster/worker.js',
+      'lib/internal/compile_cache.js',
       'lib/internal/encoding.js',
       'lib/internal/errors.js',
       'lib/internal/freelist.js',
@@ -115,6 +117,7 @@
       'lib/internal/readline.js',
       'lib/internal/regenerator.js',
       'lib/internal/repl.js',
+      'lib/internal/snapshot_bundle.js',
       'lib/internal/socket_list.js',
       #'lib/internal/test/unicode.js',
       'lib/internal/trace_events_async_hooks.js',
@@ -699,6 +702,27 @@
       'target_name': 'node_js2c',
       'type': 'none',
       'toolsets': ['host'],
+      'variables': {
+        'js2c_code_cache_args%': [],
+        'conditions': [
+          [ 'node_use_jerry=="true" and node_use_code_cache=="true"', {
+            'js2c_code_cache_args': [
+              '--code-cache=<(PRODUCT_DIR)/<(EXECUTABLE_PREFIX)node_mkcodecache<(EXECUTABLE_SUFFIX)',
+            ],
+          }],
+        ],
+      },
+      'conditions': [
+        [ 'node_use_jerry=="true" and node_use_code_cache=="true"', {
+          'conditions': [
+            [ 'want_separate_host_toolset==1', {
+              'dependencies': [ 'node_mkcodecache#host' ],
+            }, {
+              'dependencies': [ 'node_mkcodecache' ],
+            }],
+          ],
+        }],
+      ],
       'actions': [
         {
           'action_name': 'node_js2c',
@@ -724,6 +748,7 @@
           'action': [
             'python',
             'tools/js2c.py',
+            '<@(js2c_code_cache_args)',
             '<@(_outputs)',
             '<@(_inputs)',
           ],
@@ -1010,5 +1035,26 @@
         },
       ]
     }], # end aix section
+    [ 'node_use_jerry=="true" and node_use_code_cache=="true"', {
+      'targets': [
+        {
+          # Compiles the built-in modules at build time, see tools/js2c.py.
+          'target_name': 'node_mkcodecache',
+          'type': 'executable',
+          'sources': [
+            'tools/code_cache/mkcodecache.cc',
+          ],
+          'conditions': [
+            [ 'want_separate_host_toolset==1', {
+              'toolsets': ['host'],
+              'dependencies': [ 'deps/jerry-v8/v8.gyp:v8#host' ],
+            }, {
+              'toolsets': ['target'],
+              'dependencies': [ 'deps/jerry-v8/v8.gyp:v8' ],
+            }],
+          ],
+        }, # end node_mkcodecache
+      ]
+    }], # end code cache section
   ], # end conditions block
 }
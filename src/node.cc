@@ -185,6 +185,7 @@ using v8::PromiseHookType;
 using v8::PropertyCallbackInfo;
 using v8::ScriptOrigin;
 using v8::SealHandleScope;
+using v8::StartupData;
 using v8::String;
 using v8::TryCatch;
 using v8::Uint32Array;
@@ -276,6 +277,19 @@ bool config_pending_deprecation = false;
 // Set in node.cc by ParseArgs when --redirect-warnings= is used.
 std::string config_warning_file;  // NOLINT(runtime/string)
 
+// Set in node.cc by ParseArgs when --compile-cache= or NODE_COMPILE_CACHE
+// is used.
+// Used in node_config.cc to set a constant on process.binding('config')
+// that is used by lib/internal/compile_cache.js
+std::string config_compile_cache_dir;  // NOLINT(runtime/string)
+
+// Set in node.cc by ParseArgs when --build-snapshot-bundle=,
+// --snapshot-bundle= or NODE_SNAPSHOT_BUNDLE is used.
+// Used in node_config.cc to set a constant on process.binding('config')
+// that is used by lib/internal/snapshot_bundle.js
+std::string config_build_snapshot_bundle;  // NOLINT(runtime/string)
+std::string config_snapshot_bundle;  // NOLINT(runtime/string)
+
 // Set in node.cc by ParseArgs when --expose-internals or --expose_internals is
 // used.
 // Used in node_config.cc to set a constant on process.binding('config')
@@ -2267,6 +2281,9 @@ static void Binding(const FunctionCallbackInfo<Value>& args) {
   } else if (!strcmp(*module_v, "natives")) {
     exports = Object::New(env->isolate());
     DefineJavaScript(env, exports);
+  } else if (!strcmp(*module_v, "natives_cache")) {
+    exports = Object::New(env->isolate());
+    DefineJavaScriptCodeCache(env, exports);
   } else {
     return ThrowIfNoSuchModule(env, *module_v);
   }
@@ -3227,6 +3244,13 @@ static void PrintHelp() {
          "  --redirect-warnings=file\n"
          "                             write warnings to file instead of\n"
          "                             stderr\n"
+         "  --compile-cache=dir        cache compiled modules in dir\n"
+         "  --build-snapshot-bundle=file\n"
+         "                             write the modules loaded by the\n"
+         "                             script and their compiled code to\n"
+         "                             file\n"
+         "  --snapshot-bundle=file     load modules from a bundle written\n"
+         "                             by --build-snapshot-bundle\n"
          "  --trace-sync-io            show stack trace when use of sync IO\n"
          "                             is detected after the first tick\n"
          "  --force-async-hooks-checks\n"
@@ -3309,6 +3333,10 @@ static void PrintHelp() {
          "                             file\n"
          "NODE_REDIRECT_WARNINGS       write warnings to path instead of\n"
          "                             stderr\n"
+         "NODE_COMPILE_CACHE           directory where compiled modules are\n"
+         "                             cached\n"
+         "NODE_SNAPSHOT_BUNDLE         load modules from a bundle written\n"
+         "                             by --build-snapshot-bundle\n"
          "OPENSSL_CONF                 load OpenSSL configuration from file\n"
          "\n"
          "Documentation can be found at https://nodejs.org/\n");
@@ -3361,6 +3389,8 @@ static void CheckIfAllowedInEnv(const char* exe, bool is_env,
     "--max-http-header-size",
     "--trace-warnings",
     "--redirect-warnings",
+    "--compile-cache",
+    "--snapshot-bundle",
     "--trace-sync-io",
     "--force-async-hooks-checks",
     "--trace-events-enabled",
@@ -3501,6 +3531,12 @@ static void ParseArgs(int* argc,
       trace_warnings = true;
     } else if (strncmp(arg, "--redirect-warnings=", 20) == 0) {
       config_warning_file = arg + 20;
+    } else if (strncmp(arg, "--compile-cache=", 16) == 0) {
+      config_compile_cache_dir = arg + 16;
+    } else if (strncmp(arg, "--build-snapshot-bundle=", 24) == 0) {
+      config_build_snapshot_bundle = arg + 24;
+    } else if (strncmp(arg, "--snapshot-bundle=", 18) == 0) {
+      config_snapshot_bundle = arg + 18;
     } else if (strcmp(arg, "--trace-deprecation") == 0) {
       trace_deprecation = true;
     } else if (strcmp(arg, "--trace-sync-io") == 0) {
@@ -3988,6 +4024,12 @@ void Init(int* argc,
   if (config_warning_file.empty())
     SafeGetenv("NODE_REDIRECT_WARNINGS", &config_warning_file);
 
+  if (config_compile_cache_dir.empty())
+    SafeGetenv("NODE_COMPILE_CACHE", &config_compile_cache_dir);
+
+  if (config_snapshot_bundle.empty())
+    SafeGetenv("NODE_SNAPSHOT_BUNDLE", &config_snapshot_bundle);
+
 #if HAVE_OPENSSL
   if (openssl_config.empty())
     SafeGetenv("OPENSSL_CONF", &openssl_config);
@@ -4363,6 +4405,12 @@ int Start(int argc, char** argv) {
             "and could change at any time.\n");
     v8_platform.StartTracingAgent();
   }
+#ifdef V8JERRY
+  // The code cache of the built-in modules is part of the binary, so its
+  // byte code can be executed in place.
+  static StartupData natives_cache = CodeCacheBlob();
+  V8::SetNativesDataBlob(&natives_cache);
+#endif
   V8::Initialize();
   performance::performance_v8_start = PERFORMANCE_NOW();
   v8_initialized = true;
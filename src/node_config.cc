@@ -106,6 +106,36 @@ static void InitConfig(Local<Object> target,
         ReadOnly).FromJust();
   }
 
+  if (!config_compile_cache_dir.empty()) {
+    target->DefineOwnProperty(
+        context,
+        FIXED_ONE_BYTE_STRING(isolate, "compileCacheDir"),
+        String::NewFromUtf8(isolate,
+                            config_compile_cache_dir.data(),
+                            v8::NewStringType::kNormal).ToLocalChecked(),
+        ReadOnly).FromJust();
+  }
+
+  if (!config_build_snapshot_bundle.empty()) {
+    target->DefineOwnProperty(
+        context,
+        FIXED_ONE_BYTE_STRING(isolate, "buildSnapshotBundle"),
+        String::NewFromUtf8(isolate,
+                            config_build_snapshot_bundle.data(),
+                            v8::NewStringType::kNormal).ToLocalChecked(),
+        ReadOnly).FromJust();
+  }
+
+  if (!config_snapshot_bundle.empty()) {
+    target->DefineOwnProperty(
+        context,
+        FIXED_ONE_BYTE_STRING(isolate, "snapshotBundle"),
+        String::NewFromUtf8(isolate,
+                            config_snapshot_bundle.data(),
+                            v8::NewStringType::kNormal).ToLocalChecked(),
+        ReadOnly).FromJust();
+  }
+
   Local<Object> debugOptions = Object::New(isolate);
 
   target->DefineOwnProperty(
@@ -20,10 +20,26 @@
 // USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "node_internals.h"
+#include "node_javascript.h"
 #include "node_watchdog.h"
 #include "base-object-inl.h"
 #include "v8-debug.h"
 
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef V8JERRY
+#include "v8-jerry.h"
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#endif
+
 namespace node {
 
 using v8::Array;
@@ -45,6 +61,7 @@ using v8::MaybeLocal;
 using v8::Name;
 using v8::NamedPropertyHandlerConfiguration;
 using v8::Nothing;
+using v8::Number;
 using v8::Object;
 using v8::ObjectTemplate;
 using v8::Persistent;
@@ -523,6 +540,32 @@ class ContextifyContext {
   }
 };
 
+// Read-only blocks of code caches, which are never released. The engine may
+// execute the byte code of the code caches consumed from these blocks in
+// place, so they are never exposed to scripts as Buffers. Instead, the
+// contextify_static_cached_data private symbol on the options of
+// ContextifyScript selects a code cache by its block index, offset and
+// length. It is only set by the internal module loaders, a plain
+// staticCachedData option of vm.Script is ignored. Block 0 is the code cache
+// of the built-in modules embedded in the binary.
+struct StaticCodeCache {
+  const uint8_t* data;
+  size_t length;
+};
+
+static std::vector<StaticCodeCache>& StaticCodeCaches() {
+  static std::vector<StaticCodeCache> blocks;
+  if (blocks.empty()) {
+    v8::StartupData blob = CodeCacheBlob();
+    StaticCodeCache builtin = {
+      reinterpret_cast<const uint8_t*>(blob.data),
+      static_cast<size_t>(blob.raw_size)
+    };
+    blocks.push_back(builtin);
+  }
+  return blocks;
+}
+
 class ContextifyScript : public BaseObject {
  private:
   Persistent<UnboundScript> script_;
@@ -574,6 +617,8 @@ class ContextifyScript : public BaseObject {
     MaybeLocal<Integer> columnOffset = GetColumnOffsetArg(env, options);
     Maybe<bool> maybe_display_errors = GetDisplayErrorsArg(env, options);
     MaybeLocal<Uint8Array> cached_data_buf = GetCachedData(env, options);
+    std::unique_ptr<ScriptCompiler::CachedData> static_cached_data(
+        GetStaticCachedData(env, options));
     Maybe<bool> maybe_produce_cached_data = GetProduceCachedData(env, options);
     MaybeLocal<Context> maybe_context = GetContext(env, options);
     if (try_catch.HasCaught()) {
@@ -591,6 +636,8 @@ class ContextifyScript : public BaseObject {
       cached_data = new ScriptCompiler::CachedData(
           static_cast<uint8_t*>(contents.Data()) + ui8->ByteOffset(),
           ui8->ByteLength());
+    } else {
+      cached_data = static_cached_data.release();
     }
 
     ScriptOrigin origin(filename.ToLocalChecked(), lineOffset.ToLocalChecked(),
@@ -898,6 +945,46 @@ class ContextifyScript : public BaseObject {
   }
 
 
+  // Returns the code cache selected by the static cached data private symbol
+  // of the options, which is an array of [block, offset, length] (see
+  // StaticCodeCaches), or nullptr.
+  static ScriptCompiler::CachedData* GetStaticCachedData(
+      Environment* env, Local<Value> options) {
+    if (!options->IsObject()) {
+      return nullptr;
+    }
+
+    MaybeLocal<Value> maybe_value = options.As<Object>()->GetPrivate(
+        env->context(), env->contextify_static_cached_data_private_symbol());
+    Local<Value> value;
+    if (!maybe_value.ToLocal(&value) || value->IsUndefined()) {
+      return nullptr;
+    }
+
+    uint32_t range[3];
+    bool valid = value->IsArray() && value.As<Array>()->Length() == 3;
+    for (uint32_t i = 0; valid && i < 3; i++) {
+      Local<Value> item;
+      valid = value.As<Array>()->Get(env->context(), i).ToLocal(&item) &&
+              item->IsUint32();
+      if (valid)
+        range[i] = item.As<v8::Uint32>()->Value();
+    }
+
+    const std::vector<StaticCodeCache>& blocks = StaticCodeCaches();
+    if (!valid ||
+        range[0] >= blocks.size() ||
+        range[1] > blocks[range[0]].length ||
+        range[2] > blocks[range[0]].length - range[1]) {
+      env->ThrowRangeError("Static code cache range is out of range");
+      return nullptr;
+    }
+
+    return new ScriptCompiler::CachedData(blocks[range[0]].data + range[1],
+                                          static_cast<int>(range[2]));
+  }
+
+
   static Maybe<bool> GetProduceCachedData(Environment* env,
                                           Local<Value> options) {
     if (!options->IsObject()) {
@@ -1074,12 +1161,160 @@ class ContextifyScript : public BaseObject {
 };
 
 
+#ifdef V8JERRY
+// args: cachedData array
+// Merges code caches produced by vm.Script into a single bundle, which stores
+// the literals shared by the scripts once. Returns { data, offsets } where
+// data.slice(offsets[i]) is the code cache of the i-th script, or undefined
+// if the code caches cannot be merged.
+void MergeCachedData(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  if (!args[0]->IsArray())
+    return env->ThrowTypeError("cachedData must be an array");
+
+  Local<Array> caches = args[0].As<Array>();
+  const int count = static_cast<int>(caches->Length());
+  std::vector<std::unique_ptr<ScriptCompiler::CachedData>> owned;
+  std::vector<const ScriptCompiler::CachedData*> inputs;
+
+  for (int i = 0; i < count; i++) {
+    Local<Value> value = caches->Get(env->context(), i).ToLocalChecked();
+    if (!value->IsUint8Array())
+      return env->ThrowTypeError("cachedData must contain Buffers");
+
+    Local<Uint8Array> ui8 = value.As<Uint8Array>();
+    ArrayBuffer::Contents contents = ui8->Buffer()->GetContents();
+    owned.emplace_back(new ScriptCompiler::CachedData(
+        static_cast<uint8_t*>(contents.Data()) + ui8->ByteOffset(),
+        ui8->ByteLength()));
+    inputs.push_back(owned.back().get());
+  }
+
+  std::unique_ptr<ScriptCompiler::CachedData> bundle(
+      v8::jerry::MergeCodeCaches(inputs.data(), count));
+  if (!bundle)
+    return;
+
+  Local<Array> offsets = Array::New(env->isolate(), count);
+  for (int i = 0; i < count; i++) {
+    offsets->Set(env->context(), i,
+                 Integer::New(env->isolate(),
+                              v8::jerry::BundleEntryOffset(i))).FromJust();
+  }
+
+  Local<Object> result = Object::New(env->isolate());
+  result->Set(env->context(),
+              FIXED_ONE_BYTE_STRING(env->isolate(), "data"),
+              Buffer::Copy(env,
+                           reinterpret_cast<const char*>(bundle->data),
+                           bundle->length).ToLocalChecked()).FromJust();
+  result->Set(env->context(),
+              FIXED_ONE_BYTE_STRING(env->isolate(), "offsets"),
+              offsets).FromJust();
+  args.GetReturnValue().Set(result);
+}
+
+#ifndef _WIN32
+// args: filename
+// Maps a file holding code caches (e.g. a snapshot bundle) read-only, appends
+// the mapping to the static code cache blocks and registers it with the
+// engine, which executes the byte code of the code caches consumed from it in
+// place. The pages of the byte code are then shared by every process mapping
+// the file. Each path is mapped once and the mapping is never released.
+// Returns { block, length }, or undefined if the file cannot be mapped.
+void MapCachedData(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  if (!args[0]->IsString())
+    return env->ThrowTypeError("filename must be a string");
+
+  static std::unordered_map<std::string, uint32_t> mapped_files;
+  std::vector<StaticCodeCache>& blocks = StaticCodeCaches();
+  node::Utf8Value filename(env->isolate(), args[0]);
+  uint32_t block;
+
+  auto it = mapped_files.find(*filename);
+  if (it != mapped_files.end()) {
+    block = it->second;
+  } else {
+    int fd = open(*filename, O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+      return;
+
+    struct stat st;
+    void* data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+      data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED)
+      return;
+
+    StaticCodeCache mapping = {
+      static_cast<const uint8_t*>(data),
+      static_cast<size_t>(st.st_size)
+    };
+    v8::jerry::RegisterStaticCodeCache(data, mapping.length);
+
+    block = static_cast<uint32_t>(blocks.size());
+    blocks.push_back(mapping);
+    mapped_files[*filename] = block;
+  }
+
+  Local<Object> result = Object::New(env->isolate());
+  result->Set(env->context(),
+              FIXED_ONE_BYTE_STRING(env->isolate(), "block"),
+              Integer::NewFromUnsigned(env->isolate(), block)).FromJust();
+  Local<Number> length =
+      Number::New(env->isolate(), static_cast<double>(blocks[block].length));
+  result->Set(env->context(),
+              FIXED_ONE_BYTE_STRING(env->isolate(), "length"),
+              length).FromJust();
+  args.GetReturnValue().Set(result);
+}
+
+// args: block, start, end
+// Returns a copy of a range of a static code cache block. Writing to the
+// blocks would fault (or change running byte code), so scripts only ever
+// get copies of them.
+void ReadCachedData(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  if (!args[0]->IsUint32() || !args[1]->IsUint32() || !args[2]->IsUint32())
+    return env->ThrowTypeError("block, start and end must be integers");
+
+  const std::vector<StaticCodeCache>& blocks = StaticCodeCaches();
+  uint32_t block = args[0].As<v8::Uint32>()->Value();
+  uint32_t start = args[1].As<v8::Uint32>()->Value();
+  uint32_t end = args[2].As<v8::Uint32>()->Value();
+
+  if (block >= blocks.size() || start > end || end > blocks[block].length)
+    return env->ThrowRangeError("range is out of the static code cache");
+
+  Local<Object> buffer;
+  if (Buffer::Copy(env,
+                   reinterpret_cast<const char*>(blocks[block].data + start),
+                   end - start).ToLocal(&buffer)) {
+    args.GetReturnValue().Set(buffer);
+  }
+}
+#endif  // _WIN32
+#endif  // V8JERRY
+
 void InitContextify(Local<Object> target,
                     Local<Value> unused,
                     Local<Context> context) {
   Environment* env = Environment::GetCurrent(context);
   ContextifyContext::Init(env, target);
   ContextifyScript::Init(env, target);
+#ifdef V8JERRY
+  env->SetMethod(target, "mergeCachedData", MergeCachedData);
+#ifndef _WIN32
+  env->SetMethod(target, "mapCachedData", MapCachedData);
+  env->SetMethod(target, "readCachedData", ReadCachedData);
+#endif
+#endif
 }
 
 }  // anonymous namespace
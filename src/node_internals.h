@@ -172,6 +172,18 @@ extern bool config_expose_internals;
 // it to stderr.
 extern std::string config_warning_file;  // NOLINT(runtime/string)
 
+// Set in node.cc by ParseArgs when --compile-cache= or NODE_COMPILE_CACHE
+// is used. Compiled user modules are cached in this directory.
+extern std::string config_compile_cache_dir;  // NOLINT(runtime/string)
+
+// Set in node.cc by ParseArgs when --build-snapshot-bundle= is used. The
+// modules loaded by the main script are written to this bundle.
+extern std::string config_build_snapshot_bundle;  // NOLINT(runtime/string)
+
+// Set in node.cc by ParseArgs when --snapshot-bundle= or NODE_SNAPSHOT_BUNDLE
+// is used. Modules are loaded from this bundle.
+extern std::string config_snapshot_bundle;  // NOLINT(runtime/string)
+
 // Set in node.cc by ParseArgs when --pending-deprecation or
 // NODE_PENDING_DEPRECATION is used
 extern bool config_pending_deprecation;
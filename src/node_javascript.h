@@ -31,6 +31,11 @@ namespace node {
 void DefineJavaScript(Environment* env, v8::Local<v8::Object> target);
 v8::Local<v8::String> MainSource(Environment* env);
 
+// Code cache of the built-in modules produced at build time. Modules without
+// an entry (or builds without a code cache) are compiled from source.
+void DefineJavaScriptCodeCache(Environment* env, v8::Local<v8::Object> target);
+v8::StartupData CodeCacheBlob();
+
 }  // namespace node
 
 #endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
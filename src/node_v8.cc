@@ -25,6 +25,10 @@
 #include "util-inl.h"
 #include "v8.h"
 
+#ifdef V8JERRY
+#include "v8-jerry.h"
+#endif
+
 namespace node {
 
 using v8::Array;
@@ -37,6 +41,7 @@ using v8::Integer;
 using v8::Isolate;
 using v8::Local;
 using v8::NewStringType;
+using v8::Number;
 using v8::Object;
 using v8::ScriptCompiler;
 using v8::String;
@@ -125,6 +130,29 @@ void SetFlagsFromString(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+#ifdef V8JERRY
+void GetInlineCacheStatistics(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  v8::jerry::InlineCacheStatistics s;
+
+  if (!v8::jerry::GetInlineCacheStatistics(&s))
+    return;
+
+  Local<Object> result = Object::New(env->isolate());
+#define V(name)                                                               \
+  result->Set(FIXED_ONE_BYTE_STRING(env->isolate(), #name),                   \
+              Number::New(env->isolate(), static_cast<double>(s.name)));
+  V(load_hits)
+  V(load_misses)
+  V(store_hits)
+  V(store_misses)
+  V(caches)
+#undef V
+  args.GetReturnValue().Set(result);
+}
+#endif
+
+
 void InitializeV8Bindings(Local<Object> target,
                           Local<Value> unused,
                           Local<Context> context) {
@@ -203,6 +231,10 @@ void InitializeV8Bindings(Local<Object> target,
 #undef V
 
   env->SetMethod(target, "setFlagsFromString", SetFlagsFromString);
+
+#ifdef V8JERRY
+  env->SetMethod(target, "getInlineCacheStatistics", GetInlineCacheStatistics);
+#endif
 }
 
 }  // namespace node
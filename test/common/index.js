@@ -310,7 +310,6 @@ let knownGlobals = [
   constructor, // Enumerable in V8 3.21.
   global,
   process,
-  regeneratorRuntime, // TODO(V8JERRY): remove this if transpiled modules are restored (JerryScript supports generators).
   setImmediate,
   setInterval,
   setTimeout
@@ -384,6 +383,9 @@ function leakedGlobals() {
   const leaked = [];
 
   for (const val in global) {
+    // The regenerator runtime is installed on first use by transpiled code.
+    if (val === 'regeneratorRuntime')
+      continue;
     if (!knownGlobals.includes(global[val])) {
       leaked.push(val);
     }
@@ -0,0 +1,51 @@
+'use strict';
+
+// Tests the --compile-cache command line flag and NODE_COMPILE_CACHE by
+// loading a module in child processes, which store and reuse its compiled
+// code in a temporary cache directory.
+
+require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const { spawnSync } = require('child_process');
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+const cacheDir = path.join(tmpdir.path, 'compile-cache');
+const modulePath = path.join(tmpdir.path, 'cached.js');
+const script = `console.log(require(${JSON.stringify(modulePath)})(20));`;
+
+function run(execArgv, env) {
+  const child = spawnSync(process.execPath, execArgv.concat(['-e', script]),
+                          { env: Object.assign({}, process.env, env) });
+  assert.strictEqual(child.status, 0, child.stderr.toString());
+  return child.stdout.toString().trim();
+}
+
+fs.writeFileSync(modulePath, 'module.exports = (x) => x + 1;');
+
+// The first run creates the cache directory and one entry.
+assert.strictEqual(run([`--compile-cache=${cacheDir}`], {}), '21');
+const entries = fs.readdirSync(cacheDir);
+assert.strictEqual(entries.length, 1);
+
+const entryPath = path.join(cacheDir, entries[0]);
+const entry = fs.readFileSync(entryPath);
+
+// The second run loads the module from the cache without rewriting it.
+assert.strictEqual(run([], { NODE_COMPILE_CACHE: cacheDir }), '21');
+assert.deepStrictEqual(fs.readFileSync(entryPath), entry);
+
+// A changed module replaces the entry.
+fs.writeFileSync(modulePath, 'module.exports = (x) => x + 2;');
+const time = new Date(Date.now() + 10000);
+fs.utimesSync(modulePath, time, time);
+assert.strictEqual(run([`--compile-cache=${cacheDir}`], {}), '22');
+assert.deepStrictEqual(fs.readdirSync(cacheDir), entries);
+assert.notDeepStrictEqual(fs.readFileSync(entryPath), entry);
+
+// A corrupted entry is ignored.
+fs.writeFileSync(entryPath, 'corrupted');
+assert.strictEqual(run([`--compile-cache=${cacheDir}`], {}), '22');
@@ -0,0 +1,82 @@
+'use strict';
+
+// Tests the --build-snapshot-bundle and --snapshot-bundle command line flags
+// and NODE_SNAPSHOT_BUNDLE by building a bundle of a small module graph in a
+// child process and loading the modules from it in other child processes.
+
+require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const { spawnSync } = require('child_process');
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+const bundlePath = path.join(tmpdir.path, 'app.snap');
+const entryPath = path.join(tmpdir.path, 'entry.js');
+const libPath = path.join(tmpdir.path, 'lib', 'index.js');
+
+function run(execArgv, env) {
+  const child = spawnSync(process.execPath, execArgv.concat([entryPath]),
+                          { env: Object.assign({}, process.env, env) });
+  assert.strictEqual(child.status, 0, child.stderr.toString());
+  return child.stdout.toString().trim();
+}
+
+fs.mkdirSync(path.dirname(libPath));
+fs.writeFileSync(entryPath, '#!/usr/bin/env node\n' +
+                            'console.log(require("./lib")(20));');
+fs.writeFileSync(libPath, 'module.exports = (x) => x + 1;');
+
+// Building the bundle runs the script.
+assert.strictEqual(run([`--build-snapshot-bundle=${bundlePath}`], {}), '21');
+assert.ok(fs.statSync(bundlePath).size > 0);
+
+// The bundled modules are used even if the files are removed.
+fs.unlinkSync(libPath);
+fs.rmdirSync(path.dirname(libPath));
+assert.strictEqual(run([`--snapshot-bundle=${bundlePath}`], {}), '21');
+assert.strictEqual(run([], { NODE_SNAPSHOT_BUNDLE: bundlePath }), '21');
+
+// Rebuilding replaces the bundle instead of rewriting it, so processes which
+// have mapped the previous bundle are not affected.
+fs.mkdirSync(path.dirname(libPath));
+fs.writeFileSync(libPath, 'module.exports = (x) => x + 1;');
+const { ino } = fs.statSync(bundlePath);
+assert.strictEqual(run([`--build-snapshot-bundle=${bundlePath}`], {}), '21');
+assert.notStrictEqual(fs.statSync(bundlePath).ino, ino);
+fs.unlinkSync(libPath);
+fs.rmdirSync(path.dirname(libPath));
+assert.strictEqual(run([`--snapshot-bundle=${bundlePath}`], {}), '21');
+
+// The bundled source takes precedence over the file.
+fs.writeFileSync(entryPath, 'console.log("changed");');
+assert.strictEqual(run([`--snapshot-bundle=${bundlePath}`], {}), '21');
+
+// The mapping of a bundle is shared per path, and scripts only get copies of
+// its contents.
+const { mapCachedData, readCachedData } = process.binding('contextify');
+if (typeof mapCachedData === 'function') {
+  const contents = fs.readFileSync(bundlePath);
+  const mapped = mapCachedData(bundlePath);
+  assert.ok(!Buffer.isBuffer(mapped));
+  assert.strictEqual(mapped.length, contents.length);
+  assert.deepStrictEqual(mapCachedData(bundlePath), mapped);
+
+  const copy = readCachedData(mapped.block, 0, mapped.length);
+  assert.deepStrictEqual(copy, contents);
+  copy.fill(0);
+  assert.deepStrictEqual(readCachedData(mapped.block, 0, mapped.length),
+                         contents);
+  assert.throws(() => readCachedData(mapped.block, 0, mapped.length + 1),
+                RangeError);
+}
+
+// An invalid bundle is ignored with a warning.
+fs.writeFileSync(bundlePath, 'corrupted');
+const child = spawnSync(process.execPath,
+                        [`--snapshot-bundle=${bundlePath}`, entryPath]);
+assert.strictEqual(child.status, 0, child.stderr.toString());
+assert.strictEqual(child.stdout.toString().trim(), 'changed');
+assert.ok(/Ignoring snapshot bundle/.test(child.stderr.toString()));
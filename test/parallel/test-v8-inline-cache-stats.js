@@ -0,0 +1,48 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const v8 = require('v8');
+
+const before = v8.getInlineCacheStatistics();
+if (before === undefined)
+  common.skip('the engine is built without inline caches');
+
+const keys = [
+  'caches',
+  'load_hits',
+  'load_misses',
+  'store_hits',
+  'store_misses'];
+assert.deepStrictEqual(Object.keys(before).sort(), keys);
+keys.forEach(function(key) {
+  assert.strictEqual(typeof before[key], 'number');
+  assert.ok(before[key] >= 0);
+});
+
+function Point(x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+// Every access of the loop sees objects of the same shape.
+function sum(points) {
+  let total = 0;
+  for (let i = 0; i < points.length; i++) {
+    points[i].x = points[i].x + 1;
+    total += points[i].x + points[i].y;
+  }
+  return total;
+}
+
+const points = [];
+for (let i = 0; i < 100; i++)
+  points.push(new Point(i, i));
+assert.strictEqual(sum(points), 100 + 2 * 4950);
+
+const after = v8.getInlineCacheStatistics();
+assert.ok(after.load_hits > before.load_hits);
+assert.ok(after.store_hits > before.store_hits);
+assert.ok(after.caches > 0);
+keys.forEach(function(key) {
+  assert.ok(after[key] >= before[key], key);
+});
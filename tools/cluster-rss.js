@@ -0,0 +1,141 @@
+#!/usr/bin/env node
+/**
+ * Usage:
+ *   cluster-rss.js [--workers=<n>] [<module>]
+ *
+ * Measures the memory of a cluster whose workers load the same code, once with
+ * the code compiled by every worker and once with the code loaded from a
+ * snapshot bundle (see `--snapshot-bundle`), which the workers map and share.
+ *
+ * Every worker requires <module> and then reports to the primary process,
+ * which sums the Rss and Pss of the workers from /proc/<pid>/smaps_rollup.
+ * Pss divides shared pages between the processes sharing them, so it drops
+ * by the size of the shared code. <module> must load its code synchronously
+ * and must not keep the process alive for the bundle to be built. Without
+ * <module> a generated module graph is measured.
+ *
+ * Only Linux is supported.
+ */
+'use strict';
+const cluster = require('cluster');
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const { spawnSync } = require('child_process');
+
+const kModules = 100;
+const kFunctionsPerModule = 50;
+
+function generateApp(dir) {
+  const main = [];
+  for (var i = 0; i < kModules; i++) {
+    const lines = [];
+    for (var j = 0; j < kFunctionsPerModule; j++) {
+      lines.push(`exports.f${j} = function f${j}(a, b) {`,
+                 `  var s = 'module ${i} function ${j}';`,
+                 '  for (var k = 0; k < a; k++) b = (b * 31 + k) | 0;',
+                 '  return s.length + b;',
+                 '};');
+    }
+    fs.writeFileSync(path.join(dir, `m${i}.js`), lines.join('\n'));
+    main.push(`require('./m${i}.js');`);
+  }
+  fs.writeFileSync(path.join(dir, 'index.js'), main.join('\n'));
+  return path.join(dir, 'index.js');
+}
+
+function readMemory(pid) {
+  var text;
+  try {
+    text = fs.readFileSync(`/proc/${pid}/smaps_rollup`, 'latin1');
+  } catch (e) {
+    text = fs.readFileSync(`/proc/${pid}/smaps`, 'latin1');
+  }
+
+  const memory = { rss: 0, pss: 0 };
+  const re = /^(Rss|Pss):\s+(\d+) kB$/gm;
+  var match;
+  while ((match = re.exec(text)) !== null)
+    memory[match[1].toLowerCase()] += +match[2];
+  return memory;
+}
+
+function measure(workers, execArgv, app) {
+  cluster.setupMaster({ execArgv, args: [app] });
+
+  return new Promise((resolve) => {
+    const pids = [];
+    for (var i = 0; i < workers; i++) {
+      cluster.fork().on('message', function(msg) {
+        if (msg !== 'ready')
+          return;
+        pids.push(this.process.pid);
+        if (pids.length < workers)
+          return;
+
+        const total = { rss: 0, pss: 0 };
+        for (const pid of pids) {
+          const memory = readMemory(pid);
+          total.rss += memory.rss;
+          total.pss += memory.pss;
+        }
+        var exited = 0;
+        cluster.on('exit', function onExit() {
+          if (++exited < workers)
+            return;
+          cluster.removeListener('exit', onExit);
+          resolve(total);
+        });
+        for (const id in cluster.workers)
+          cluster.workers[id].kill();
+      });
+    }
+  });
+}
+
+function format(name, memory) {
+  return `${name.padEnd(10)} rss ${String(memory.rss).padStart(8)} kB` +
+         `   pss ${String(memory.pss).padStart(8)} kB`;
+}
+
+async function main() {
+  var workers = 8;
+  var app;
+
+  for (const arg of process.argv.slice(2)) {
+    if (arg.startsWith('--workers='))
+      workers = +arg.slice('--workers='.length);
+    else
+      app = path.resolve(arg);
+  }
+
+  const dir = fs.mkdtempSync(path.join(os.tmpdir(), 'cluster-rss-'));
+  if (app === undefined)
+    app = generateApp(dir);
+
+  const bundle = path.join(dir, 'app.snap');
+  const build = spawnSync(process.execPath,
+                          [`--build-snapshot-bundle=${bundle}`, app],
+                          { stdio: 'inherit' });
+  if (build.status !== 0 || !fs.existsSync(bundle)) {
+    console.error('Building the snapshot bundle failed');
+    process.exit(1);
+  }
+
+  console.log(`${workers} workers, bundle ${fs.statSync(bundle).size} bytes`);
+  const compiled = await measure(workers, [], app);
+  console.log(format('compiled', compiled));
+  const shared = await measure(workers, [`--snapshot-bundle=${bundle}`], app);
+  console.log(format('bundle', shared));
+  console.log(format('saved', {
+    rss: compiled.rss - shared.rss,
+    pss: compiled.pss - shared.pss
+  }));
+}
+
+if (cluster.isMaster) {
+  main();
+} else {
+  require(process.argv[2]);
+  process.send('ready');
+}
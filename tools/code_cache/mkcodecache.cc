@@ -0,0 +1,80 @@
+// Produces the code cache of a built-in module at build time.
+//
+// Usage: mkcodecache <filename> < wrapped-source > cached-data
+//
+// The source is read from stdin and must be wrapped exactly as
+// NativeModule.wrap() does at runtime, otherwise the cache is rejected.
+// Exits with a non-zero status if the engine cannot produce a cache for
+// the source; tools/js2c.py embeds the source only in that case.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <memory>
+#include <string>
+
+#include "libplatform/libplatform.h"
+#include "v8.h"
+
+int main(int argc, char* argv[]) {
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <filename>\n", argv[0]);
+    return 2;
+  }
+
+  std::string source;
+  char buffer[4096];
+  size_t read;
+  while ((read = fread(buffer, 1, sizeof(buffer), stdin)) > 0)
+    source.append(buffer, read);
+
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  std::unique_ptr<v8::Platform> platform(v8::platform::CreateDefaultPlatform());
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator =
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+
+  int status = 1;
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> code =
+        v8::String::NewFromUtf8(isolate, source.data(),
+                                v8::NewStringType::kNormal,
+                                static_cast<int>(source.size()))
+            .ToLocalChecked();
+    v8::Local<v8::String> filename =
+        v8::String::NewFromUtf8(isolate, argv[1], v8::NewStringType::kNormal)
+            .ToLocalChecked();
+
+    v8::ScriptOrigin origin(filename);
+    v8::ScriptCompiler::Source script_source(code, origin);
+    v8::Local<v8::UnboundScript> script;
+
+    if (v8::ScriptCompiler::CompileUnboundScript(
+            isolate, &script_source, v8::ScriptCompiler::kProduceCodeCache)
+            .ToLocal(&script)) {
+      const v8::ScriptCompiler::CachedData* cached_data =
+          script_source.GetCachedData();
+      if (cached_data != nullptr &&
+          fwrite(cached_data->data, 1, cached_data->length, stdout) ==
+              static_cast<size_t>(cached_data->length)) {
+        status = 0;
+      }
+    }
+  }
+
+  isolate->Dispose();
+  delete create_params.array_buffer_allocator;
+  v8::V8::Dispose();
+  v8::V8::ShutdownPlatform();
+  return status;
+}
@@ -33,6 +33,7 @@
 
 import os
 import re
+import subprocess
 import sys
 import string
 
@@ -175,6 +176,8 @@ namespace node {{
 
 {definitions}
 
+{code_cache}
+
 v8::Local<v8::String> MainSource(Environment* env) {{
   return internal_bootstrap_node_value.ToStringChecked(env->isolate());
 }}
@@ -183,6 +186,16 @@ void DefineJavaScript(Environment* env, v8::Local<v8::Object> target) {{
   {initializers}
 }}
 
+v8::StartupData CodeCacheBlob() {{
+  v8::StartupData blob = {{ reinterpret_cast<const char*>(raw_code_cache),
+                           static_cast<int>(code_cache_size) }};
+  return blob;
+}}
+
+void DefineJavaScriptCodeCache(Environment* env, v8::Local<v8::Object> target) {{
+  {code_cache_initializers}
+}}
+
 }}  // namespace node
 """
 
@@ -218,6 +231,43 @@ CHECK(target->Set(env->context(),
                   {value}.ToStringChecked(env->isolate())).FromJust());
 """
 
+# The code cache of all modules is stored in a single read-only block, which
+# is registered with the engine as the natives blob. Byte code of cached
+# modules is executed straight from this block, so it is never exposed to
+# scripts as a Buffer: the entries only hold the offset and the length of the
+# code cache of each module.
+CODE_CACHE = """
+alignas(uint32_t) static const uint8_t raw_code_cache[] = {{ {data} }};
+static const size_t code_cache_size = {size};
+"""
+
+CODE_CACHE_ENTRY = """\
+auto code_cache_entry = [env](uint32_t offset, uint32_t length) {
+  v8::Isolate* isolate = env->isolate();
+  v8::Local<v8::Array> entry = v8::Array::New(isolate, 2);
+  CHECK(entry->Set(env->context(), 0,
+                   v8::Integer::NewFromUnsigned(isolate, offset)).FromJust());
+  CHECK(entry->Set(env->context(), 1,
+                   v8::Integer::NewFromUnsigned(isolate, length)).FromJust());
+  return entry;
+};
+"""
+
+CODE_CACHE_INITIALIZER = """\
+CHECK(target->Set(env->context(),
+                  {key}.ToStringChecked(env->isolate()),
+                  code_cache_entry({offset}, {length})).FromJust());
+"""
+
+# Must match NativeModule.wrapper in lib/internal/bootstrap_node.js.
+NATIVE_MODULE_WRAPPER = [
+  '(function (exports, require, module, __filename, __dirname) { ',
+  '\n});'
+]
+
+# Compiled by node::MainSource() without the module wrapper.
+NO_CODE_CACHE = [ 'internal/bootstrap_node' ]
+
 
 def Render(var, data):
   # Treat non-ASCII as UTF-8 and convert it to UTF-16.
@@ -232,7 +282,19 @@ def Render(var, data):
   return template.format(var=var, data=data)
 
 
-def JS2C(source, target):
+def ProduceCodeCache(tool, name, lines):
+  source = NATIVE_MODULE_WRAPPER[0] + lines + NATIVE_MODULE_WRAPPER[1]
+  process = subprocess.Popen([tool, '%s.js' % name],
+                             stdin=subprocess.PIPE,
+                             stdout=subprocess.PIPE)
+  cached_data = process.communicate(source)[0]
+  # Modules the engine cannot cache are compiled from source at runtime.
+  if process.returncode != 0:
+    return None
+  return cached_data
+
+
+def JS2C(source, target, code_cache_tool=None):
   modules = []
   consts = {}
   macros = {}
@@ -250,6 +312,8 @@ def JS2C(source, target):
   # Build source code lines
   definitions = []
   initializers = []
+  code_cache = ''
+  code_cache_initializers = []
 
   for name in modules:
     lines = ReadFile(str(name))
@@ -266,6 +330,7 @@ def JS2C(source, target):
     if name.endswith(".gypi"):
       lines = re.sub(r'#.*?\n', '', lines)
       lines = re.sub(r'\'', '"', lines)
+    is_script = name.endswith('.js')
     name = name.split('.', 1)[0]
     var = name.replace('-', '_').replace('/', '_')
     key = '%s_key' % var
@@ -275,16 +340,39 @@ def JS2C(source, target):
     definitions.append(Render(value, lines))
     initializers.append(INITIALIZER.format(key=key, value=value))
 
+    if code_cache_tool and is_script and name not in NO_CODE_CACHE:
+      cached_data = ProduceCodeCache(code_cache_tool, name, lines)
+      if cached_data:
+        offset = len(code_cache)
+        code_cache += cached_data
+        # Keep every entry 32 bit aligned.
+        code_cache += '\0' * (-len(code_cache) % 4)
+        code_cache_initializers.append(
+            CODE_CACHE_INITIALIZER.format(key=key,
+                                          offset=offset,
+                                          length=len(cached_data)))
+
+  if code_cache_initializers:
+    code_cache_initializers.insert(0, CODE_CACHE_ENTRY)
+
   # Emit result
   output = open(str(target[0]), "w")
-  output.write(TEMPLATE.format(definitions=''.join(definitions),
-                               initializers=''.join(initializers)))
+  output.write(TEMPLATE.format(
+      definitions=''.join(definitions),
+      initializers=''.join(initializers),
+      code_cache=CODE_CACHE.format(data=ToCString(code_cache or '\0'),
+                                   size=len(code_cache)),
+      code_cache_initializers=''.join(code_cache_initializers)))
   output.close()
 
 def main():
-  natives = sys.argv[1]
-  source_files = sys.argv[2:]
-  JS2C(source_files, [natives])
+  code_cache_tool = None
+  args = sys.argv[1:]
+  if args and args[0].startswith('--code-cache='):
+    code_cache_tool = args.pop(0)[len('--code-cache='):]
+  natives = args[0]
+  source_files = args[1:]
+  JS2C(source_files, [natives], code_cache_tool)
 
 if __name__ == "__main__":
   main()